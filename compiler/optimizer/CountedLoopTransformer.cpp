@@ -0,0 +1,374 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "optimizer/CountedLoopTransformer.hpp"
+
+#include "compile/Compilation.hpp"
+#include "compile/SymbolReferenceTable.hpp"
+#include "il/Block.hpp"
+#include "il/ILOpCodes.hpp"
+#include "il/ILOps.hpp"
+#include "il/Node.hpp"
+#include "il/Node_inlines.hpp"
+#include "il/ResolvedMethodSymbol.hpp"
+#include "il/Symbol.hpp"
+#include "il/SymbolReference.hpp"
+#include "il/TreeTop.hpp"
+#include "il/TreeTop_inlines.hpp"
+#include "infra/BitVector.hpp"
+#include "infra/Cfg.hpp"
+#include "infra/ILWalk.hpp"
+#include "optimizer/Optimization_inlines.hpp"
+#include "optimizer/Structure.hpp"
+
+TR::CountedLoopTransformer::CountedLoopTransformer(TR::OptimizationManager *manager)
+   : TR::Optimization(manager),
+     _addressTakenLocals(NULL)
+   {}
+
+void
+TR::CountedLoopTransformer::collectInnermostLoops(TR_Structure *structure, LoopVector &loops)
+   {
+   TR_RegionStructure *region = structure->asRegion();
+   if (region == NULL)
+      return;
+
+   bool isInnermost = true;
+   TR_RegionStructure::Cursor it(*region);
+   for (TR_StructureSubGraphNode *node = it.getFirst(); node != NULL; node = it.getNext())
+      {
+      if (node->getStructure()->asRegion() != NULL)
+         {
+         isInnermost = false;
+         collectInnermostLoops(node->getStructure(), loops);
+         }
+      }
+
+   if (isInnermost && region->isNaturalLoop())
+      loops.push_back(region);
+   }
+
+void
+TR::CountedLoopTransformer::findAddressTakenLocals()
+   {
+   _addressTakenLocals = new (trStackMemory()) TR_BitVector(comp()->getSymRefTab()->getNumSymRefs(), trMemory(), stackAlloc, growable);
+
+   for (TR::PreorderNodeIterator iter(comp()->getStartTree(), comp()); iter.currentTree(); ++iter)
+      {
+      TR::Node *node = iter.currentNode();
+      if (node->getOpCodeValue() == TR::loadaddr && node->getSymbol()->isAutoOrParm())
+         _addressTakenLocals->set(node->getSymbolReference()->getReferenceNumber());
+      }
+   }
+
+bool
+TR::CountedLoopTransformer::findCountedLoop(TR_RegionStructure *region, CountedLoop &loop)
+   {
+   TR::Block *header = region->getEntryBlock();
+   TR::Block *latch = header;
+   int32_t numBlocks = 0;
+
+   TR_RegionStructure::Cursor it(*region);
+   for (TR_StructureSubGraphNode *node = it.getFirst(); node != NULL; node = it.getNext())
+      {
+      TR_BlockStructure *blockStructure = node->getStructure()->asBlock();
+      if (blockStructure == NULL)
+         return false;
+      if (blockStructure->getBlock() != header)
+         latch = blockStructure->getBlock();
+      numBlocks++;
+      }
+
+   if (numBlocks > 2)
+      return false;
+
+   // The header of a two block loop has to fall into the latch
+   if (latch != header && header->getNextBlock() != latch)
+      return false;
+
+   TR::Block *exit = latch->getNextBlock();
+   if (exit == NULL || exit == header || latch->getSuccessors().size() != 2)
+      return false;
+
+   TR::TreeTop *backEdgeTree = latch->getLastRealTreeTop();
+   TR::Node *backEdge = backEdgeTree->getNode();
+   if (!backEdge->getOpCode().isIf() || backEdge->getBranchDestination() != header->getEntry())
+      return false;
+
+   TR::Node *counter = NULL;
+   TR::Node *limit = NULL;
+   switch (backEdge->getOpCodeValue())
+      {
+      case TR::ificmplt:
+      case TR::iflcmplt:
+         counter = backEdge->getFirstChild();
+         limit = backEdge->getSecondChild();
+         break;
+      case TR::ificmpgt:
+      case TR::iflcmpgt:
+         counter = backEdge->getSecondChild();
+         limit = backEdge->getFirstChild();
+         break;
+      default:
+         return false;
+      }
+
+   TR::TreeTop *incrementTree = backEdgeTree->getPrevRealTreeTop();
+   TR::Node *increment = incrementTree->getNode();
+   if (!increment->getOpCode().isStoreDirect())
+      return false;
+
+   // In a two block loop the latch only advances the induction variable
+   if (latch != header && latch->getFirstRealTreeTop() != incrementTree)
+      return false;
+
+   TR::SymbolReference *inductionVariable = increment->getSymbolReference();
+   TR::DataType type = increment->getDataType();
+   if (!inductionVariable->getSymbol()->isAutoOrParm()
+       || _addressTakenLocals->get(inductionVariable->getReferenceNumber())
+       || (type != TR::Int32 && type != TR::Int64)
+       || limit->getDataType() != type)
+      return false;
+
+   TR::Node *add = increment->getFirstChild();
+   if (add->getOpCodeValue() != (type == TR::Int32 ? TR::iadd : TR::ladd))
+      return false;
+
+   TR::Node *step = add->getSecondChild();
+   if (!step->getOpCode().isLoadConst() || step->get64bitIntegralValue() != 1)
+      return false;
+
+   loop.header = header;
+   loop.latch = latch;
+   loop.exit = exit;
+   loop.inductionVariable = inductionVariable;
+   loop.incrementTree = incrementTree;
+   loop.backEdgeTree = backEdgeTree;
+   loop.limit = limit;
+   loop.definedLocals = new (trStackMemory()) TR_BitVector(comp()->getSymRefTab()->getNumSymRefs(), trMemory(), stackAlloc, growable);
+
+   for (TR::TreeTop *tt = header->getEntry(); tt != latch->getExit(); tt = tt->getNextTreeTop())
+      {
+      TR::Node *node = tt->getNode();
+      if (node->getOpCode().isStoreDirect() && node->getSymbol()->isAutoOrParm())
+         loop.definedLocals->set(node->getSymbolReference()->getReferenceNumber());
+      }
+
+   if (!isInductionVariableLoad(add->getFirstChild(), loop))
+      return false;
+
+   // The test has to see the advanced value: either the sum itself or a load of
+   // the induction variable that is not commoned with one from before the store
+   if (counter != add && !(isInductionVariableLoad(counter, loop) && counter->getReferenceCount() == 1))
+      return false;
+
+   return isInvariant(limit, loop);
+   }
+
+bool
+TR::CountedLoopTransformer::isInductionVariableLoad(TR::Node *node, CountedLoop &loop)
+   {
+   return node->getOpCode().isLoadVarDirect()
+      && node->getSymbol() == loop.inductionVariable->getSymbol();
+   }
+
+bool
+TR::CountedLoopTransformer::isInvariant(TR::Node *node, CountedLoop &loop)
+   {
+   if (node->getOpCode().isLoadConst())
+      return true;
+
+   // Conversions and arithmetic of invariant values are invariant
+   if (!node->getOpCode().hasSymbolReference() && node->getNumChildren() > 0)
+      {
+      for (int32_t i = 0; i < node->getNumChildren(); i++)
+         {
+         if (!isInvariant(node->getChild(i), loop))
+            return false;
+         }
+      return true;
+      }
+
+   // A local is invariant unless the loop stores it or its address may be
+   // written through
+   if (!node->getOpCode().isLoadVarDirect())
+      return false;
+
+   TR::SymbolReference *symRef = node->getSymbolReference();
+   return symRef->getSymbol()->isAutoOrParm()
+      && symRef->getSymbol() != loop.inductionVariable->getSymbol()
+      && !loop.definedLocals->get(symRef->getReferenceNumber())
+      && !_addressTakenLocals->get(symRef->getReferenceNumber());
+   }
+
+bool
+TR::CountedLoopTransformer::isUnitStrideAccess(TR::Node *access, CountedLoop &loop)
+   {
+   TR::ILOpCode &opCode = access->getOpCode();
+   if (!(opCode.isLoadIndirect() || opCode.isStoreIndirect()) || opCode.isWrtBar())
+      return false;
+
+   if (access->getSymbol()->isVolatile())
+      return false;
+
+   int64_t stride = 0;
+   return getAddressStride(access->getFirstChild(), loop, stride)
+      && stride == access->getSize();
+   }
+
+bool
+TR::CountedLoopTransformer::getAddressStride(TR::Node *address, CountedLoop &loop, int64_t &stride)
+   {
+   if (address->getOpCode().isArrayRef())
+      {
+      int64_t baseStride = 0;
+      int64_t indexStride = 0;
+      if (!getAddressStride(address->getFirstChild(), loop, baseStride)
+          || !getIndexStride(address->getSecondChild(), loop, indexStride))
+         return false;
+      stride = baseStride + indexStride;
+      return true;
+      }
+
+   stride = 0;
+   return address->getType().isAddress() && isInvariant(address, loop);
+   }
+
+bool
+TR::CountedLoopTransformer::getIndexStride(TR::Node *index, CountedLoop &loop, int64_t &stride)
+   {
+   if (isInductionVariableLoad(index, loop))
+      {
+      stride = 1;
+      return true;
+      }
+
+   if (isInvariant(index, loop))
+      {
+      stride = 0;
+      return true;
+      }
+
+   int64_t firstStride = 0;
+   int64_t secondStride = 0;
+   TR::Node *secondChild = index->getNumChildren() > 1 ? index->getSecondChild() : NULL;
+   switch (index->getOpCodeValue())
+      {
+      // Widening the induction variable itself cannot overflow, widening an
+      // expression of it could
+      case TR::i2l:
+         if (!isInductionVariableLoad(index->getFirstChild(), loop))
+            return false;
+         stride = 1;
+         return true;
+
+      case TR::iadd:
+      case TR::ladd:
+      case TR::isub:
+      case TR::lsub:
+         if (!getIndexStride(index->getFirstChild(), loop, firstStride)
+             || !getIndexStride(secondChild, loop, secondStride))
+            return false;
+         stride = index->getOpCode().isAdd() ? firstStride + secondStride : firstStride - secondStride;
+         return true;
+
+      case TR::imul:
+      case TR::lmul:
+         if (!secondChild->getOpCode().isLoadConst()
+             || !getIndexStride(index->getFirstChild(), loop, firstStride))
+            return false;
+         stride = firstStride * secondChild->get64bitIntegralValue();
+         return true;
+
+      case TR::ishl:
+      case TR::lshl:
+         if (!secondChild->getOpCode().isLoadConst()
+             || secondChild->get64bitIntegralValue() < 0
+             || secondChild->get64bitIntegralValue() > 16
+             || !getIndexStride(index->getFirstChild(), loop, firstStride))
+            return false;
+         stride = firstStride << secondChild->get64bitIntegralValue();
+         return true;
+
+      default:
+         return false;
+      }
+   }
+
+TR::Block *
+TR::CountedLoopTransformer::findFallThroughEntry(CountedLoop &loop)
+   {
+   TR::Block *entry = NULL;
+   for (auto edge = loop.header->getPredecessors().begin(); edge != loop.header->getPredecessors().end(); ++edge)
+      {
+      TR::Block *pred = toBlock((*edge)->getFrom());
+      if (pred == loop.latch)
+         continue;
+      if (entry != NULL)
+         return NULL;
+      entry = pred;
+      }
+
+   if (entry == NULL
+       || entry->getEntry() == NULL
+       || entry->getNextBlock() != loop.header
+       || (entry->getLastRealTreeTop()->getNode()->getOpCode().isBranch()
+           && entry->getLastRealTreeTop()->getNode()->getBranchDestination() == loop.header->getEntry()))
+      return NULL;
+
+   return entry;
+   }
+
+// The loop body runs at least once, and then while the advanced induction
+// variable is below the limit. Computing the count in 64 bits keeps it exact
+// for any int induction variable.
+TR::SymbolReference *
+TR::CountedLoopTransformer::createTripCount(CountedLoop &loop, TR::TreeTop *insertionPoint)
+   {
+   TR::Node *limit = loop.limit->duplicateTree();
+   TR::Node *counter = TR::Node::createLoad(limit, loop.inductionVariable);
+   if (limit->getDataType() == TR::Int32)
+      {
+      limit = TR::Node::create(limit, TR::i2l, 1, limit);
+      counter = TR::Node::create(counter, TR::i2l, 1, counter);
+      }
+
+   TR::Node *remaining = TR::Node::create(limit, TR::lsub, 2, limit, counter);
+   TR::Node *count = TR::Node::create(limit, TR::lmax, 2, remaining, TR::Node::lconst(limit, 1));
+
+   TR::SymbolReference *tripCount = comp()->getSymRefTab()->createTemporary(comp()->getMethodSymbol(), TR::Int64);
+   TR::TreeTop::create(comp(), insertionPoint->getPrevTreeTop(), TR::Node::createStore(tripCount, count));
+   return tripCount;
+   }
+
+TR::Node *
+TR::CountedLoopTransformer::createStartAddress(TR::Node *access)
+   {
+   TR::Node *address = access->getFirstChild()->duplicateTree();
+   int32_t offset = access->getSymbolReference()->getOffset();
+   if (offset == 0)
+      return address;
+
+   return comp()->target().is64Bit()
+      ? TR::Node::create(access, TR::aladd, 2, address, TR::Node::lconst(access, offset))
+      : TR::Node::create(access, TR::aiadd, 2, address, TR::Node::iconst(access, offset));
+   }
+
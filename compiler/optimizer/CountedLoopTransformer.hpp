@@ -0,0 +1,113 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef COUNTEDLOOPTRANSFORMER_INCL
+#define COUNTEDLOOPTRANSFORMER_INCL
+
+#include <stdint.h>
+#include <vector>
+#include "env/TRMemory.hpp"
+#include "optimizer/Optimization.hpp"
+
+class TR_BitVector;
+class TR_RegionStructure;
+class TR_Structure;
+namespace TR { class Block; }
+namespace TR { class Node; }
+namespace TR { class OptimizationManager; }
+namespace TR { class SymbolReference; }
+namespace TR { class TreeTop; }
+
+namespace TR
+{
+
+// Common analysis for optimizations that rewrite small counted loops in the
+// bottom tested form left by loop canonicalization:
+//
+//    header:  ...
+//    latch:   i = i + 1
+//             if (i < limit) goto header
+//
+// where i is an int or long auto whose address is not taken, limit is
+// invariant, and the loop is at most the header and a latch it falls into.
+// Memory is recognized as accessed with unit stride when every access is an
+// indirect load or store at base + sizeof(element) * i + constant for an
+// invariant base.
+
+class CountedLoopTransformer : public TR::Optimization
+   {
+   public:
+
+   CountedLoopTransformer(TR::OptimizationManager *manager);
+
+   protected:
+
+   struct CountedLoop
+      {
+      TR::Block *header;
+      TR::Block *latch;                   // Same as header for single block loops
+      TR::Block *exit;                    // Fall through successor of the latch
+      TR::SymbolReference *inductionVariable;
+      TR::TreeTop *incrementTree;
+      TR::TreeTop *backEdgeTree;
+      TR::Node *limit;                    // Exclusive upper bound of the induction variable
+      TR_BitVector *definedLocals;        // Locals stored anywhere in the loop
+      };
+
+   typedef TR::typed_allocator<TR_RegionStructure *, TR::Region&> LoopAllocator;
+   typedef std::vector<TR_RegionStructure *, LoopAllocator> LoopVector;
+   typedef TR::typed_allocator<CountedLoop, TR::Region&> CountedLoopAllocator;
+   typedef std::vector<CountedLoop, CountedLoopAllocator> CountedLoopVector;
+
+   void collectInnermostLoops(TR_Structure *structure, LoopVector &loops);
+
+   // Must be called before findCountedLoop, and the result is only valid for
+   // the stack region that is current when it is called
+   void findAddressTakenLocals();
+   bool findCountedLoop(TR_RegionStructure *region, CountedLoop &loop);
+
+   bool isInductionVariableLoad(TR::Node *node, CountedLoop &loop);
+   bool isInvariant(TR::Node *node, CountedLoop &loop);
+
+   // Whether access is a non volatile indirect load or store that moves one
+   // element further each iteration
+   bool isUnitStrideAccess(TR::Node *access, CountedLoop &loop);
+   bool getAddressStride(TR::Node *address, CountedLoop &loop, int64_t &stride);
+   bool getIndexStride(TR::Node *index, CountedLoop &loop, int64_t &stride);
+
+   // The only block outside the loop that flows into the header, provided it
+   // falls into the header, so code can be placed between the two
+   TR::Block *findFallThroughEntry(CountedLoop &loop);
+
+   // Stores the number of iterations the loop runs from here into a new long
+   // temporary, and returns the temporary
+   TR::SymbolReference *createTripCount(CountedLoop &loop, TR::TreeTop *insertionPoint);
+
+   // The address access touches in the current iteration, with the offset of
+   // its symbol reference folded in
+   TR::Node *createStartAddress(TR::Node *access);
+
+   TR_BitVector *_addressTakenLocals;
+   };
+
+}
+
+#endif // COUNTEDLOOPTRANSFORMER_INCL
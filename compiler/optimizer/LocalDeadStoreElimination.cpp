@@ -749,9 +749,11 @@ void TR::LocalDeadStoreElimination::adjustStoresInfo(TR::Node *node, TR_BitVecto
    {
    // Gen the information for this node if it is a store; mark the symbol
    // being stored into as unused so that any dead store encountered above
-   // can be removed if it does not feed a use.
+   // can be removed if it does not feed a use. A masked vector store leaves
+   // the lanes outside its mask alone, so it cannot kill an earlier store.
    //
-   if (node->getOpCode().isStore() && !(node->getSymbolReference()->getSymbol()->isAutoOrParm() && node->storedValueIsIrrelevant()))
+   if (node->getOpCode().isStore() && !node->getOpCode().isVectorMasked() &&
+       !(node->getSymbolReference()->getSymbol()->isAutoOrParm() && node->storedValueIsIrrelevant()))
       {
       TR::SymbolReference *symRef = node->getSymbolReference();
       TR::Symbol *sym = symRef->getSymbol();
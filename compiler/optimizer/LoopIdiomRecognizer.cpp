@@ -0,0 +1,376 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "optimizer/LoopIdiomRecognizer.hpp"
+
+#include "codegen/CodeGenerator.hpp"
+#include "compile/Compilation.hpp"
+#include "compile/SymbolReferenceTable.hpp"
+#include "env/StackMemoryRegion.hpp"
+#include "il/Block.hpp"
+#include "il/ILOpCodes.hpp"
+#include "il/ILOps.hpp"
+#include "il/Node.hpp"
+#include "il/Node_inlines.hpp"
+#include "il/ResolvedMethodSymbol.hpp"
+#include "il/Symbol.hpp"
+#include "il/SymbolReference.hpp"
+#include "il/TreeTop.hpp"
+#include "il/TreeTop_inlines.hpp"
+#include "infra/BitVector.hpp"
+#include "infra/Cfg.hpp"
+#include "infra/ILWalk.hpp"
+#include "optimizer/Optimization_inlines.hpp"
+#include "optimizer/Optimizer.hpp"
+#include "optimizer/Structure.hpp"
+#include "optimizer/TransformUtil.hpp"
+#include "ras/Debug.hpp"
+
+#define OPT_DETAILS "O^O LOOP IDIOM RECOGNITION: "
+
+TR::LoopIdiomRecognizer::LoopIdiomRecognizer(TR::OptimizationManager *manager)
+   : TR::CountedLoopTransformer(manager)
+   {}
+
+int32_t
+TR::LoopIdiomRecognizer::perform()
+   {
+   TR::CodeGenerator *codegen = cg();
+   if (!codegen->getSupportsArraySet()
+       && !codegen->getSupportsPrimitiveArrayCopy()
+       && !codegen->getSupportsArrayCmpLen())
+      {
+      if (trace())
+         traceMsg(comp(), "No block operations are supported on this platform\n");
+      return 0;
+      }
+
+   TR::CFG *cfg = comp()->getFlowGraph();
+   if (cfg->getStructure() == NULL)
+      return 0;
+
+   TR::StackMemoryRegion stackMemoryRegion(*trMemory());
+
+   LoopVector loops((LoopAllocator(trMemory()->currentStackRegion())));
+   collectInnermostLoops(cfg->getStructure(), loops);
+   if (loops.empty())
+      return 0;
+
+   findAddressTakenLocals();
+
+   // Describe every candidate before any of them is reduced, since reducing a
+   // copy changes the flow graph under the structure
+   CountedLoopVector candidates((CountedLoopAllocator(trMemory()->currentStackRegion())));
+   for (LoopVector::iterator it = loops.begin(); it != loops.end(); ++it)
+      {
+      CountedLoop loop;
+      if (!findCountedLoop(*it, loop))
+         {
+         if (trace())
+            traceMsg(comp(), "Loop %d is not a counted loop\n", (*it)->getNumber());
+         continue;
+         }
+
+      if (!loop.header->isCold())
+         candidates.push_back(loop);
+      }
+
+   int32_t reducedCount = 0;
+   for (CountedLoopVector::iterator it = candidates.begin(); it != candidates.end(); ++it)
+      {
+      if (reduceFill(*it) || reduceCopy(*it) || reduceCompare(*it))
+         reducedCount++;
+      else if (trace())
+         traceMsg(comp(), "Loop at block_%d does not match any idiom\n", it->header->getNumber());
+      }
+
+   if (reducedCount > 0)
+      {
+      cfg->setStructure(NULL);
+      optimizer()->setUseDefInfo(NULL);
+      optimizer()->setValueNumberInfo(NULL);
+      optimizer()->setAliasSetsAreValid(false);
+      }
+
+   _addressTakenLocals = NULL;
+
+   return reducedCount;
+   }
+
+//
+// Fill:
+//
+//    Tstorei <base + sizeof(T) * i>
+//      Tconst or Tload                    loop invariant
+//    istore i (iadd (iload i) (iconst 1))
+//    ificmplt --> header (iload i) (limit)
+//
+// becomes
+//
+//    lstore tripCount (lmax (lsub limit i) 1)
+//    treetop (arrayset <base + sizeof(T) * i> value (tripCount * sizeof(T)))
+//    istore i (iadd (iload i) (l2i tripCount))
+//
+bool
+TR::LoopIdiomRecognizer::reduceFill(CountedLoop &loop)
+   {
+   if (!cg()->getSupportsArraySet() || loop.header != loop.latch)
+      return false;
+
+   TR::TreeTop *storeTree = loop.header->getFirstRealTreeTop();
+   if (storeTree->getNextTreeTop() != loop.incrementTree)
+      return false;
+
+   TR::Node *store = storeTree->getNode();
+   if (!store->getOpCode().isStoreIndirect() || !isUnitStrideAccess(store, loop))
+      return false;
+
+   // Evaluators fill with integral values only
+   TR::Node *value = store->getSecondChild();
+   if ((!value->getType().isIntegral() && !value->getType().isAddress()) || !isInvariant(value, loop))
+      return false;
+
+   if (!performTransformation(comp(), "%sReducing fill loop %d to arrayset\n", OPT_DETAILS, loop.header->getNumber()))
+      return false;
+
+   int32_t elementSize = store->getSize();
+   TR::SymbolReference *tripCount = createTripCount(loop, storeTree);
+
+   TR::Node *arrayset = TR::Node::create(store, TR::arrayset, 3);
+   arrayset->setAndIncChild(0, createStartAddress(store));
+   arrayset->setAndIncChild(1, value->duplicateTree());
+   arrayset->setAndIncChild(2, createByteLength(tripCount, elementSize, true));
+   arrayset->setSymbolReference(comp()->getSymRefTab()->findOrCreateArraySetSymbol());
+
+   TR::TreeTop::create(comp(), storeTree->getPrevTreeTop(), TR::Node::create(TR::treetop, 1, arrayset));
+   TR::TreeTop::create(comp(), loop.incrementTree, createIncrement(loop, TR::Node::createLoad(store, tripCount)));
+   TR::TransformUtil::removeTree(comp(), storeTree);
+   removeLatch(loop);
+   return true;
+   }
+
+//
+// Copy:
+//
+//    Tstorei <dst + sizeof(T) * i>
+//      Tloadi <src + sizeof(T) * i>
+//    istore i (iadd (iload i) (iconst 1))
+//    ificmplt --> header (iload i) (limit)
+//
+// becomes a test of whether the destination starts inside the source, which
+// keeps the loop, and a block copy otherwise:
+//
+//    lstore tripCount (lmax (lsub limit i) 1)
+//    iflucmplt --> header (lsub (a2l dst) (a2l src)) (tripCount * sizeof(T))
+//
+//    treetop (arraycopy src dst (tripCount * sizeof(T)))
+//    istore i (iadd (iload i) (l2i tripCount))
+//    goto --> exit
+//
+bool
+TR::LoopIdiomRecognizer::reduceCopy(CountedLoop &loop)
+   {
+   if (!cg()->getSupportsPrimitiveArrayCopy() || loop.header != loop.latch)
+      return false;
+
+   TR::TreeTop *storeTree = loop.header->getFirstRealTreeTop();
+   if (storeTree->getNextTreeTop() != loop.incrementTree)
+      return false;
+
+   TR::Node *store = storeTree->getNode();
+   if (!store->getOpCode().isStoreIndirect() || !isUnitStrideAccess(store, loop))
+      return false;
+
+   TR::Node *load = store->getSecondChild();
+   if (!load->getOpCode().isLoadIndirect()
+       || load->getDataType() != store->getDataType()
+       || load->getReferenceCount() != 1
+       || !isUnitStrideAccess(load, loop))
+      return false;
+
+   // The test is placed on the only way into the loop
+   TR::Block *entry = findFallThroughEntry(loop);
+   if (entry == NULL)
+      return false;
+
+   if (!performTransformation(comp(), "%sReducing copy loop %d to arraycopy\n", OPT_DETAILS, loop.header->getNumber()))
+      return false;
+
+   // The new blocks are outside the loop, so the structure is rebuilt rather
+   // than updated
+   TR::CFG *cfg = comp()->getFlowGraph();
+   cfg->setStructure(NULL);
+   bool is64Bit = comp()->target().is64Bit();
+   int32_t elementSize = store->getSize();
+
+   TR::Block *testBlock = TR::Block::createEmptyBlock(store, comp(), loop.header->getFrequency(), loop.header);
+   TR::Block *copyBlock = TR::Block::createEmptyBlock(store, comp(), loop.header->getFrequency(), loop.header);
+   entry->getExit()->join(testBlock->getEntry());
+   testBlock->getExit()->join(copyBlock->getEntry());
+   copyBlock->getExit()->join(loop.header->getEntry());
+   cfg->addNode(testBlock);
+   cfg->addNode(copyBlock);
+
+   TR::SymbolReference *tripCount = createTripCount(loop, testBlock->getExit());
+
+   TR::Node *distance = is64Bit
+      ? TR::Node::create(store, TR::lsub, 2,
+            TR::Node::create(store, TR::a2l, 1, createStartAddress(store)),
+            TR::Node::create(store, TR::a2l, 1, createStartAddress(load)))
+      : TR::Node::create(store, TR::isub, 2,
+            TR::Node::create(store, TR::a2i, 1, createStartAddress(store)),
+            TR::Node::create(store, TR::a2i, 1, createStartAddress(load)));
+   TR::Node *overlapTest = TR::Node::createif(is64Bit ? TR::iflucmplt : TR::ifiucmplt,
+      distance, createByteLength(tripCount, elementSize, true), loop.header->getEntry());
+   testBlock->append(TR::TreeTop::create(comp(), overlapTest));
+
+   TR::Node *arraycopy = TR::Node::createArraycopy(createStartAddress(load), createStartAddress(store),
+      createByteLength(tripCount, elementSize, true));
+   arraycopy->setSymbolReference(comp()->getSymRefTab()->findOrCreateArrayCopySymbol());
+   arraycopy->setArrayCopyElementType(store->getDataType());
+   arraycopy->setForwardArrayCopy(true);
+   if (elementSize == 2)
+      arraycopy->setHalfWordElementArrayCopy(true);
+   else if (elementSize == 4 || elementSize == 8)
+      arraycopy->setWordElementArrayCopy(true);
+
+   copyBlock->append(TR::TreeTop::create(comp(), TR::Node::create(TR::treetop, 1, arraycopy)));
+   copyBlock->append(TR::TreeTop::create(comp(), createIncrement(loop, TR::Node::createLoad(store, tripCount))));
+   copyBlock->append(TR::TreeTop::create(comp(), TR::Node::create(store, TR::Goto, 0, loop.exit->getEntry())));
+
+   cfg->addEdge(entry, testBlock);
+   cfg->addEdge(testBlock, copyBlock);
+   cfg->addEdge(testBlock, loop.header);
+   cfg->addEdge(copyBlock, loop.exit);
+   cfg->removeEdge(entry, loop.header);
+   return true;
+   }
+
+//
+// Compare:
+//
+//    header: ifTcmpne --> mismatch (Tloadi <a + sizeof(T) * i>) (Tloadi <b + sizeof(T) * i>)
+//    latch:  istore i (iadd (iload i) (iconst 1))
+//            ificmplt --> header (iload i) (limit)
+//
+// becomes
+//
+//    header: lstore tripCount (lmax (lsub limit i) 1)
+//            lstore matched (lushr (arraycmplen a b (tripCount * sizeof(T))) log2(sizeof(T)))
+//            istore i (iadd (iload i) (l2i matched))
+//            iflcmplt --> mismatch (matched) (tripCount)
+//    latch:
+//
+bool
+TR::LoopIdiomRecognizer::reduceCompare(CountedLoop &loop)
+   {
+   if (!cg()->getSupportsArrayCmpLen() || loop.header == loop.latch)
+      return false;
+
+   TR::TreeTop *compareTree = loop.header->getFirstRealTreeTop();
+   TR::Node *compare = compareTree->getNode();
+   if (compareTree != loop.header->getLastRealTreeTop()
+       || !compare->getOpCode().isIf()
+       || !compare->getOpCode().isCompareForEquality()
+       || compare->getOpCode().isCompareTrueIfEqual()
+       || compare->getBranchDestination() == loop.latch->getEntry())
+      return false;
+
+   TR::Node *first = compare->getFirstChild();
+   TR::Node *second = compare->getSecondChild();
+   if (!first->getType().isIntegral()
+       || first->getDataType() != second->getDataType()
+       || !isUnitStrideAccess(first, loop)
+       || !isUnitStrideAccess(second, loop))
+      return false;
+
+   if (!performTransformation(comp(), "%sReducing compare loop %d to arraycmplen\n", OPT_DETAILS, loop.header->getNumber()))
+      return false;
+
+   int32_t elementSize = first->getSize();
+   int32_t shift = 0;
+   while ((1 << shift) < elementSize)
+      shift++;
+
+   TR::SymbolReference *tripCount = createTripCount(loop, compareTree);
+
+   TR::Node *arraycmplen = TR::Node::create(compare, TR::arraycmplen, 3);
+   arraycmplen->setAndIncChild(0, createStartAddress(first));
+   arraycmplen->setAndIncChild(1, createStartAddress(second));
+   arraycmplen->setAndIncChild(2, createByteLength(tripCount, elementSize, false));
+   arraycmplen->setSymbolReference(comp()->getSymRefTab()->findOrCreateArrayCmpLenSymbol());
+
+   // The first mismatched byte is in the first mismatched element
+   TR::Node *matchedElements = arraycmplen;
+   if (shift > 0)
+      matchedElements = TR::Node::create(compare, TR::lushr, 2, arraycmplen, TR::Node::iconst(compare, shift));
+
+   TR::SymbolReference *matched = comp()->getSymRefTab()->createTemporary(comp()->getMethodSymbol(), TR::Int64);
+   TR::TreeTop *matchedTree = TR::TreeTop::create(comp(), compareTree->getPrevTreeTop(), TR::Node::createStore(matched, matchedElements));
+   TR::TreeTop *incrementTree = TR::TreeTop::create(comp(), matchedTree, createIncrement(loop, TR::Node::createLoad(compare, matched)));
+   TR::TreeTop::create(comp(), incrementTree,
+      TR::Node::createif(TR::iflcmplt, TR::Node::createLoad(compare, matched), TR::Node::createLoad(compare, tripCount), compare->getBranchDestination()));
+
+   TR::TransformUtil::removeTree(comp(), compareTree);
+   removeLatch(loop);
+   return true;
+   }
+
+// Lengths of copies and fills are address sized, arraycmplen takes a long
+TR::Node *
+TR::LoopIdiomRecognizer::createByteLength(TR::SymbolReference *tripCount, int32_t elementSize, bool addressSized)
+   {
+   TR::Node *count = TR::Node::createLoad(tripCount);
+   TR::Node *length = count;
+   if (elementSize != 1)
+      length = TR::Node::create(count, TR::lmul, 2, count, TR::Node::lconst(count, elementSize));
+
+   if (addressSized && !comp()->target().is64Bit())
+      length = TR::Node::create(count, TR::l2i, 1, length);
+
+   return length;
+   }
+
+TR::Node *
+TR::LoopIdiomRecognizer::createIncrement(CountedLoop &loop, TR::Node *iterations)
+   {
+   TR::Node *counter = TR::Node::createLoad(iterations, loop.inductionVariable);
+   if (counter->getDataType() == TR::Int32)
+      return TR::Node::createStore(loop.inductionVariable,
+         TR::Node::create(iterations, TR::iadd, 2, counter, TR::Node::create(iterations, TR::l2i, 1, iterations)));
+
+   return TR::Node::createStore(loop.inductionVariable, TR::Node::create(iterations, TR::ladd, 2, counter, iterations));
+   }
+
+// Drops the old increment and the back edge, leaving the latch to fall out of the loop
+void
+TR::LoopIdiomRecognizer::removeLatch(CountedLoop &loop)
+   {
+   TR::TransformUtil::removeTree(comp(), loop.incrementTree);
+   TR::TransformUtil::removeTree(comp(), loop.backEdgeTree);
+   comp()->getFlowGraph()->removeEdge(loop.latch, loop.header);
+   }
+
+const char *
+TR::LoopIdiomRecognizer::optDetailString() const throw()
+   {
+   return "O^O LOOP IDIOM RECOGNITION: ";
+   }
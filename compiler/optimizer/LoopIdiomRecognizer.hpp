@@ -0,0 +1,81 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef LOOPIDIOMRECOGNIZER_INCL
+#define LOOPIDIOMRECOGNIZER_INCL
+
+#include <stdint.h>
+#include "optimizer/CountedLoopTransformer.hpp"
+#include "optimizer/OptimizationManager.hpp"
+
+namespace TR { class Node; }
+namespace TR { class SymbolReference; }
+
+namespace TR
+{
+
+// Language neutral recognition of counted loops that copy, fill or compare
+// memory one element at a time, replacing them with the arraycopy, arrayset
+// and arraycmplen nodes that the code generators lower to block operations.
+//
+// Loops are recognized as described in CountedLoopTransformer. The header and
+// latch are the same block for copy and fill loops, and every access walks
+// memory with unit stride.
+//
+//    fill:    *(base + i)     = value            one block, value invariant
+//    copy:    *(dst + i)      = *(src + i)       one block
+//    compare: if (*(a + i) != *(b + i)) goto out  header and latch
+//
+// Loads and stores with non integral types are only copied. Copies are
+// versioned on whether the destination starts inside the source, since the
+// element by element loop then propagates values where a block copy would not.
+//
+// The recognized loops are those written directly against memory, as
+// JitBuilder methods do. Array accesses in languages that check bounds or
+// compute element addresses from object headers are left to loop reduction.
+
+class LoopIdiomRecognizer : public TR::CountedLoopTransformer
+   {
+   public:
+
+   LoopIdiomRecognizer(TR::OptimizationManager *manager);
+   static TR::Optimization *create(TR::OptimizationManager *manager)
+      {
+      return new (manager->allocator()) LoopIdiomRecognizer(manager);
+      }
+
+   virtual int32_t perform();
+   virtual const char * optDetailString() const throw();
+
+   private:
+
+   bool reduceFill(CountedLoop &loop);
+   bool reduceCopy(CountedLoop &loop);
+   bool reduceCompare(CountedLoop &loop);
+
+   TR::Node *createByteLength(TR::SymbolReference *tripCount, int32_t elementSize, bool addressSized);
+   TR::Node *createIncrement(CountedLoop &loop, TR::Node *iterations);
+   void removeLatch(CountedLoop &loop);
+   };
+
+}
+
+#endif // LOOPIDIOMRECOGNIZER_INCL
@@ -4423,14 +4423,19 @@ int32_t
 TR_LoopReducer::perform()
    {
 
+#ifdef J9_PROJECT_SPECIFIC
    // enable only if the new loop reduction framework is
    // disabled
    //
+   // The OMR idiom recognizer only handles loops over raw memory and
+   // runs after this pass rather than instead of it
+   //
    if (optimizer()->isEnabled(OMR::idiomRecognition))
       {
       dumpOptDetails(comp(), "idiom recognition is enabled, skipping loopReducer\n");
       return 0;
       }
+#endif
 
    if (!comp()->cg()->getSupportsArraySet() &&
       !comp()->cg()->getSupportsReferenceArrayCopy() &&
@@ -0,0 +1,561 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "optimizer/LoopVectorizer.hpp"
+
+#include <algorithm>
+#include "codegen/CodeGenerator.hpp"
+#include "compile/Compilation.hpp"
+#include "compile/SymbolReferenceTable.hpp"
+#include "env/StackMemoryRegion.hpp"
+#include "il/Block.hpp"
+#include "il/ILOpCodes.hpp"
+#include "il/ILOps.hpp"
+#include "il/Node.hpp"
+#include "il/Node_inlines.hpp"
+#include "il/ResolvedMethodSymbol.hpp"
+#include "il/Symbol.hpp"
+#include "il/SymbolReference.hpp"
+#include "il/TreeTop.hpp"
+#include "il/TreeTop_inlines.hpp"
+#include "infra/BitVector.hpp"
+#include "infra/Cfg.hpp"
+#include "infra/ILWalk.hpp"
+#include "optimizer/Optimization_inlines.hpp"
+#include "optimizer/Optimizer.hpp"
+#include "optimizer/Structure.hpp"
+#include "ras/Debug.hpp"
+
+#define OPT_DETAILS "O^O LOOP VECTORIZER: "
+
+// Loops needing more overlap tests between their stores and other accesses
+// than this are left alone, as the guard would cost more than the vector loop
+// is likely to save
+#define MAX_OVERLAP_TESTS 16
+
+TR::LoopVectorizer::LoopVectorizer(TR::OptimizationManager *manager)
+   : TR::CountedLoopTransformer(manager)
+   {}
+
+int32_t
+TR::LoopVectorizer::perform()
+   {
+   if (!cg()->getSupportsAutoSIMD())
+      return 0;
+
+   TR::CFG *cfg = comp()->getFlowGraph();
+   if (cfg->getStructure() == NULL)
+      return 0;
+
+   TR::StackMemoryRegion stackMemoryRegion(*trMemory());
+
+   LoopVector loops((LoopAllocator(trMemory()->currentStackRegion())));
+   collectInnermostLoops(cfg->getStructure(), loops);
+   if (loops.empty())
+      return 0;
+
+   findAddressTakenLocals();
+
+   // Describe every candidate before any of them is changed, since
+   // vectorizing a loop adds blocks under the structure
+   CountedLoopVector candidates((CountedLoopAllocator(trMemory()->currentStackRegion())));
+   for (LoopVector::iterator it = loops.begin(); it != loops.end(); ++it)
+      {
+      CountedLoop loop;
+      if (!findCountedLoop(*it, loop))
+         {
+         if (trace())
+            traceMsg(comp(), "Loop %d is not a counted loop\n", (*it)->getNumber());
+         continue;
+         }
+
+      if (loop.header == loop.latch && !loop.header->isCold())
+         candidates.push_back(loop);
+      }
+
+   int32_t vectorizedCount = 0;
+   for (CountedLoopVector::iterator it = candidates.begin(); it != candidates.end(); ++it)
+      {
+      // Prefer the widest vectors every operation of the loop is supported for
+      LoopBody body(trMemory()->currentStackRegion());
+      bool vectorizable = false;
+      for (int32_t length = TR::NumVectorLengths; length >= TR::VectorLength128 && !vectorizable; length--)
+         vectorizable = analyzeBody(*it, static_cast<TR::VectorLength>(length), body);
+
+      if (!vectorizable)
+         {
+         if (trace())
+            traceMsg(comp(), "Loop at block_%d cannot be vectorized\n", it->header->getNumber());
+         continue;
+         }
+
+      if (vectorize(*it, body))
+         vectorizedCount++;
+      }
+
+   if (vectorizedCount > 0)
+      {
+      cfg->setStructure(NULL);
+      optimizer()->setUseDefInfo(NULL);
+      optimizer()->setValueNumberInfo(NULL);
+      optimizer()->setAliasSetsAreValid(false);
+      }
+
+   _addressTakenLocals = NULL;
+
+   return vectorizedCount;
+   }
+
+bool
+TR::LoopVectorizer::analyzeBody(CountedLoop &loop, TR::VectorLength length, LoopBody &body)
+   {
+   body.elementType = TR::NoType;
+   body.vectorType = TR::NoType;
+   body.stores.clear();
+   body.loads.clear();
+   body.reductions.clear();
+
+   // The element type is that of the first value the loop produces
+   for (TR::TreeTop *tt = loop.header->getFirstRealTreeTop(); tt != loop.incrementTree; tt = tt->getNextTreeTop())
+      {
+      TR::Node *node = tt->getNode();
+      if (node->getOpCode().isStore())
+         {
+         body.elementType = node->getDataType();
+         break;
+         }
+      }
+
+   if (!body.elementType.isVectorElement())
+      return false;
+
+   body.vectorType = TR::DataType::createVectorType(body.elementType.getDataType(), length);
+   if (!isSupported(TR::ILOpCode::createVectorOpCode(TR::vloadi, body.vectorType))
+       || !isSupported(TR::ILOpCode::createVectorOpCode(TR::vstorei, body.vectorType)))
+      return false;
+
+   for (TR::TreeTop *tt = loop.header->getFirstRealTreeTop(); tt != loop.incrementTree; tt = tt->getNextTreeTop())
+      {
+      TR::Node *node = tt->getNode();
+      if (node->getOpCodeValue() == TR::treetop)
+         {
+         if (!isVectorizable(node->getFirstChild(), loop, body))
+            return false;
+         }
+      else if (node->getOpCode().isStoreIndirect())
+         {
+         if (node->getDataType() != body.elementType
+             || !isUnitStrideAccess(node, loop)
+             || !isVectorizable(node->getSecondChild(), loop, body))
+            return false;
+         body.stores.push_back(node);
+         }
+      else if (node->getOpCode().isStoreDirect())
+         {
+         if (!isReduction(tt, loop, body))
+            return false;
+         }
+      else
+         {
+         return false;
+         }
+      }
+
+   // The accumulator of a reduction may not be seen or changed by anything
+   // else in the loop
+   for (ReductionVector::iterator it = body.reductions.begin(); it != body.reductions.end(); ++it)
+      {
+      int32_t loads = 0;
+      for (TR::PreorderNodeIterator iter(loop.header->getEntry(), comp()); iter.currentTree() != loop.header->getExit(); ++iter)
+         {
+         TR::Node *node = iter.currentNode();
+         if (node->getOpCode().isLoadVarDirect() && node->getSymbol() == it->accumulator->getSymbol())
+            loads++;
+         }
+
+      if (loads != 1)
+         return false;
+
+      for (ReductionVector::iterator other = body.reductions.begin(); other != it; ++other)
+         {
+         if (other->accumulator->getSymbol() == it->accumulator->getSymbol())
+            return false;
+         }
+      }
+
+   if (body.stores.empty() && body.reductions.empty())
+      return false;
+
+   return body.stores.size() * (body.stores.size() + body.loads.size()) <= MAX_OVERLAP_TESTS;
+   }
+
+bool
+TR::LoopVectorizer::isVectorizable(TR::Node *node, CountedLoop &loop, LoopBody &body)
+   {
+   if (node->getDataType() != body.elementType)
+      return false;
+
+   if (node->getOpCode().isLoadIndirect())
+      {
+      if (!isUnitStrideAccess(node, loop))
+         return false;
+      if (std::find(body.loads.begin(), body.loads.end(), node) == body.loads.end())
+         body.loads.push_back(node);
+      return true;
+      }
+
+   if (isInvariant(node, loop))
+      return isSupported(TR::ILOpCode::createVectorOpCode(TR::vsplats, body.vectorType));
+
+   // Only operations that compute the same value lane by lane. Integer
+   // division can trap, shifts mask their amount differently, and floating
+   // point min and max differ on NaN and signed zeros.
+   TR::ILOpCode &opCode = node->getOpCode();
+   bool isIntegral = body.elementType.isIntegral();
+   if (!(opCode.isAdd() || opCode.isSub() || opCode.isMul() || opCode.isNeg()
+         || opCode.isAnd() || opCode.isOr() || opCode.isXor()
+         || (opCode.isDiv() && !isIntegral)
+         || ((opCode.isMax() || opCode.isMin()) && isIntegral)
+         || node->getOpCodeValue() == TR::ILOpCode::absOpCode(body.elementType))
+       || opCode.isUnsigned())
+      return false;
+
+   if (!isSupported(TR::ILOpCode::convertScalarToVector(node->getOpCodeValue(), body.vectorType.getVectorLength())))
+      return false;
+
+   for (int32_t i = 0; i < node->getNumChildren(); i++)
+      {
+      if (!isVectorizable(node->getChild(i), loop, body))
+         return false;
+      }
+
+   return true;
+   }
+
+//
+//    Tstore acc (Top (Tload acc) operand)       op is add, and, or, xor, min or max
+//
+bool
+TR::LoopVectorizer::isReduction(TR::TreeTop *tree, CountedLoop &loop, LoopBody &body)
+   {
+   TR::Node *store = tree->getNode();
+   TR::SymbolReference *accumulator = store->getSymbolReference();
+   if (store->getDataType() != body.elementType
+       || !body.elementType.isIntegral()
+       || !accumulator->getSymbol()->isAutoOrParm()
+       || accumulator->getSymbol() == loop.inductionVariable->getSymbol()
+       || _addressTakenLocals->get(accumulator->getReferenceNumber()))
+      return false;
+
+   TR::Node *value = store->getFirstChild();
+   TR::ILOpCode &opCode = value->getOpCode();
+   if (!(opCode.isAdd() || opCode.isAnd() || opCode.isOr() || opCode.isXor() || opCode.isMax() || opCode.isMin())
+       || value->getNumChildren() != 2
+       || value->getReferenceCount() != 1)
+      return false;
+
+   TR::Node *previous = value->getFirstChild();
+   TR::Node *operand = value->getSecondChild();
+   if (!previous->getOpCode().isLoadVarDirect() || previous->getSymbol() != accumulator->getSymbol())
+      std::swap(previous, operand);
+
+   if (!previous->getOpCode().isLoadVarDirect()
+       || previous->getSymbol() != accumulator->getSymbol()
+       || previous->getReferenceCount() != 1)
+      return false;
+
+   if (!isSupported(TR::ILOpCode::convertScalarToVector(value->getOpCodeValue(), body.vectorType.getVectorLength()))
+       || !isSupported(getReductionOpCode(value->getOpCodeValue(), body.vectorType))
+       || !isSupported(TR::ILOpCode::createVectorOpCode(TR::vload, body.vectorType))
+       || !isSupported(TR::ILOpCode::createVectorOpCode(TR::vstore, body.vectorType))
+       || !isSupported(TR::ILOpCode::createVectorOpCode(TR::vsplats, body.vectorType))
+       || !isVectorizable(operand, loop, body))
+      return false;
+
+   Reduction reduction;
+   reduction.tree = tree;
+   reduction.accumulator = accumulator;
+   reduction.operand = operand;
+   reduction.vectorAccumulator = NULL;
+   body.reductions.push_back(reduction);
+   return true;
+   }
+
+bool
+TR::LoopVectorizer::isSupported(TR::ILOpCodes op)
+   {
+   return op != TR::BadILOp && cg()->getSupportsOpCodeForAutoSIMD(TR::ILOpCode(op));
+   }
+
+TR::ILOpCodes
+TR::LoopVectorizer::getReductionOpCode(TR::ILOpCodes scalarOp, TR::DataType vectorType)
+   {
+   TR::ILOpCode opCode(scalarOp);
+   TR::VectorOperation operation = TR::vBadOperation;
+   if (opCode.isAdd())
+      operation = TR::vreductionAdd;
+   else if (opCode.isAnd())
+      operation = TR::vreductionAnd;
+   else if (opCode.isOr())
+      operation = TR::vreductionOr;
+   else if (opCode.isXor())
+      operation = TR::vreductionXor;
+   else if (opCode.isMax())
+      operation = TR::vreductionMax;
+   else if (opCode.isMin())
+      operation = TR::vreductionMin;
+
+   if (operation == TR::vBadOperation)
+      return TR::BadILOp;
+
+   return TR::ILOpCode::createVectorOpCode(operation, vectorType);
+   }
+
+bool
+TR::LoopVectorizer::vectorize(CountedLoop &loop, LoopBody &body)
+   {
+   TR::Block *entry = findFallThroughEntry(loop);
+   if (entry == NULL)
+      return false;
+
+   if (!performTransformation(comp(), "%sVectorizing loop %d with %s\n", OPT_DETAILS, loop.header->getNumber(),
+         TR::DataType::getName(body.vectorType)))
+      return false;
+
+   TR::CFG *cfg = comp()->getFlowGraph();
+   cfg->setStructure(NULL);
+
+   TR::Node *backEdge = loop.backEdgeTree->getNode();
+   TR::DataType counterType = loop.inductionVariable->getSymbol()->getDataType();
+   bool isLongCounter = counterType == TR::Int64;
+   int32_t elementSize = TR::DataType::getSize(body.elementType);
+   int32_t vectorBytes = TR::DataType::getSize(body.vectorType);
+   int32_t elementsPerVector = vectorBytes / elementSize;
+   int32_t frequency = loop.header->getFrequency();
+
+   TR::Block *guard = TR::Block::createEmptyBlock(backEdge, comp(), frequency, loop.header);
+   TR::Block *preheader = TR::Block::createEmptyBlock(backEdge, comp(), frequency, loop.header);
+   TR::Block *vectorLoop = TR::Block::createEmptyBlock(backEdge, comp(), frequency, loop.header);
+   TR::Block *vectorExit = TR::Block::createEmptyBlock(backEdge, comp(), frequency, loop.header);
+   entry->getExit()->join(guard->getEntry());
+   guard->getExit()->join(preheader->getEntry());
+   preheader->getExit()->join(vectorLoop->getEntry());
+   vectorLoop->getExit()->join(vectorExit->getEntry());
+   vectorExit->getExit()->join(loop.header->getEntry());
+   cfg->addNode(guard);
+   cfg->addNode(preheader);
+   cfg->addNode(vectorLoop);
+   cfg->addNode(vectorExit);
+
+   // Loops too short for one vector, or whose stores may feed their own loads
+   // within a vector, stay scalar
+   TR::SymbolReference *tripCount = createTripCount(loop, guard->getExit());
+   TR::Node *scalarOnly = TR::Node::create(backEdge, TR::lcmplt, 2,
+      TR::Node::createLoad(backEdge, tripCount), TR::Node::lconst(backEdge, elementsPerVector));
+   for (NodeVector::iterator store = body.stores.begin(); store != body.stores.end(); ++store)
+      {
+      for (NodeVector::iterator other = body.stores.begin(); other != store; ++other)
+         scalarOnly = TR::Node::create(backEdge, TR::ior, 2, scalarOnly, createOverlapTest(*store, *other, vectorBytes));
+      for (NodeVector::iterator load = body.loads.begin(); load != body.loads.end(); ++load)
+         scalarOnly = TR::Node::create(backEdge, TR::ior, 2, scalarOnly, createOverlapTest(*store, *load, vectorBytes));
+      }
+   guard->append(TR::TreeTop::create(comp(),
+      TR::Node::createif(TR::ificmpne, scalarOnly, TR::Node::iconst(backEdge, 0), loop.header->getEntry())));
+
+   // The vector loop runs whole vectors up to vectorEnd
+   TR::Node *vectorCount = TR::Node::create(backEdge, TR::land, 2,
+      TR::Node::createLoad(backEdge, tripCount), TR::Node::lconst(backEdge, -elementsPerVector));
+   TR::Node *vectorEndValue = isLongCounter
+      ? TR::Node::create(backEdge, TR::ladd, 2, TR::Node::createLoad(backEdge, loop.inductionVariable), vectorCount)
+      : TR::Node::create(backEdge, TR::iadd, 2, TR::Node::createLoad(backEdge, loop.inductionVariable),
+           TR::Node::create(backEdge, TR::l2i, 1, vectorCount));
+   TR::SymbolReference *vectorEnd = comp()->getSymRefTab()->createTemporary(comp()->getMethodSymbol(), counterType);
+   preheader->append(TR::TreeTop::create(comp(), TR::Node::createStore(vectorEnd, vectorEndValue)));
+
+   TR::ILOpCodes vectorLoad = TR::ILOpCode::createVectorOpCode(TR::vload, body.vectorType);
+   TR::ILOpCodes vectorStore = TR::ILOpCode::createVectorOpCode(TR::vstore, body.vectorType);
+   TR::ILOpCodes splat = TR::ILOpCode::createVectorOpCode(TR::vsplats, body.vectorType);
+   for (ReductionVector::iterator it = body.reductions.begin(); it != body.reductions.end(); ++it)
+      {
+      // min and max start from the accumulator itself, the others from the
+      // identity of the operation
+      TR::Node *reduction = it->tree->getNode()->getFirstChild();
+      TR::Node *initial = NULL;
+      if (reduction->getOpCode().isMax() || reduction->getOpCode().isMin())
+         initial = TR::Node::createLoad(backEdge, it->accumulator);
+      else if (reduction->getOpCode().isAnd())
+         {
+         initial = TR::Node::create(backEdge, TR::ILOpCode::constOpCode(body.elementType), 0);
+         initial->set64bitIntegralValue(-1);
+         }
+      else
+         initial = TR::Node::createConstZeroValue(backEdge, body.elementType);
+
+      it->vectorAccumulator = comp()->getSymRefTab()->createTemporary(comp()->getMethodSymbol(), body.vectorType);
+      preheader->append(TR::TreeTop::create(comp(),
+         TR::Node::createStore(it->vectorAccumulator, TR::Node::create(backEdge, splat, 1, initial), vectorStore)));
+      }
+
+   // The vector body follows the order of the scalar trees, with commoned
+   // values staying commoned
+   TR::ILOpCodes vectorStoreIndirect = TR::ILOpCode::createVectorOpCode(TR::vstorei, body.vectorType);
+   NodeMap vectors((NodeMapAllocator(trMemory()->currentStackRegion())));
+   for (TR::TreeTop *tt = loop.header->getFirstRealTreeTop(); tt != loop.incrementTree; tt = tt->getNextTreeTop())
+      {
+      TR::Node *node = tt->getNode();
+      TR::Node *vectorNode = NULL;
+      if (node->getOpCodeValue() == TR::treetop)
+         {
+         vectorNode = TR::Node::create(node, TR::treetop, 1, createVector(node->getFirstChild(), loop, body, vectors));
+         }
+      else if (node->getOpCode().isStoreIndirect())
+         {
+         vectorNode = TR::Node::createWithSymRef(node, vectorStoreIndirect, 2, getVectorShadow(node, body));
+         vectorNode->setAndIncChild(0, createStartAddress(node));
+         vectorNode->setAndIncChild(1, createVector(node->getSecondChild(), loop, body, vectors));
+         }
+      else
+         {
+         for (ReductionVector::iterator it = body.reductions.begin(); it != body.reductions.end(); ++it)
+            {
+            if (it->tree != tt)
+               continue;
+
+            TR::ILOpCodes combine = TR::ILOpCode::convertScalarToVector(node->getFirstChild()->getOpCodeValue(),
+               body.vectorType.getVectorLength());
+            TR::Node *previous = TR::Node::createWithSymRef(node, vectorLoad, 0, it->vectorAccumulator);
+            vectorNode = TR::Node::createStore(it->vectorAccumulator,
+               TR::Node::create(node, combine, 2, previous, createVector(it->operand, loop, body, vectors)), vectorStore);
+            }
+         }
+
+      vectorLoop->append(TR::TreeTop::create(comp(), vectorNode));
+      }
+
+   TR::Node *counter = TR::Node::createLoad(backEdge, loop.inductionVariable);
+   TR::Node *advanced = isLongCounter
+      ? TR::Node::create(backEdge, TR::ladd, 2, counter, TR::Node::lconst(backEdge, elementsPerVector))
+      : TR::Node::create(backEdge, TR::iadd, 2, counter, TR::Node::iconst(backEdge, elementsPerVector));
+   vectorLoop->append(TR::TreeTop::create(comp(), TR::Node::createStore(loop.inductionVariable, advanced)));
+   vectorLoop->append(TR::TreeTop::create(comp(),
+      TR::Node::createif(isLongCounter ? TR::iflcmplt : TR::ificmplt,
+         TR::Node::createLoad(backEdge, loop.inductionVariable), TR::Node::createLoad(backEdge, vectorEnd), vectorLoop->getEntry())));
+
+   // Fold the lanes into each accumulator, and leave the remaining iterations
+   // to the original loop
+   for (ReductionVector::iterator it = body.reductions.begin(); it != body.reductions.end(); ++it)
+      {
+      TR::Node *combine = it->tree->getNode()->getFirstChild();
+      TR::Node *lanes = TR::Node::create(backEdge, getReductionOpCode(combine->getOpCodeValue(), body.vectorType), 1,
+         TR::Node::createWithSymRef(backEdge, vectorLoad, 0, it->vectorAccumulator));
+      vectorExit->append(TR::TreeTop::create(comp(), TR::Node::createStore(it->accumulator,
+         TR::Node::create(backEdge, combine->getOpCodeValue(), 2, TR::Node::createLoad(backEdge, it->accumulator), lanes))));
+      }
+
+   vectorExit->append(TR::TreeTop::create(comp(),
+      TR::Node::createif(isLongCounter ? TR::iflcmpge : TR::ificmpge,
+         TR::Node::createLoad(backEdge, loop.inductionVariable), loop.limit->duplicateTree(), loop.exit->getEntry())));
+
+   cfg->addEdge(entry, guard);
+   cfg->addEdge(guard, preheader);
+   cfg->addEdge(guard, loop.header);
+   cfg->addEdge(preheader, vectorLoop);
+   cfg->addEdge(vectorLoop, vectorLoop);
+   cfg->addEdge(vectorLoop, vectorExit);
+   cfg->addEdge(vectorExit, loop.header);
+   cfg->addEdge(vectorExit, loop.exit);
+   cfg->removeEdge(entry, loop.header);
+   return true;
+   }
+
+TR::Node *
+TR::LoopVectorizer::createVector(TR::Node *node, CountedLoop &loop, LoopBody &body, NodeMap &vectors)
+   {
+   NodeMap::iterator existing = vectors.find(node);
+   if (existing != vectors.end())
+      return existing->second;
+
+   TR::Node *vector = NULL;
+   if (node->getOpCode().isLoadIndirect())
+      {
+      vector = TR::Node::createWithSymRef(node, TR::ILOpCode::createVectorOpCode(TR::vloadi, body.vectorType), 1,
+         createStartAddress(node), getVectorShadow(node, body));
+      }
+   else if (isInvariant(node, loop))
+      {
+      vector = TR::Node::create(node, TR::ILOpCode::createVectorOpCode(TR::vsplats, body.vectorType), 1, node->duplicateTree());
+      }
+   else
+      {
+      vector = TR::Node::create(node,
+         TR::ILOpCode::convertScalarToVector(node->getOpCodeValue(), body.vectorType.getVectorLength()), node->getNumChildren());
+      for (int32_t i = 0; i < node->getNumChildren(); i++)
+         vector->setAndIncChild(i, createVector(node->getChild(i), loop, body, vectors));
+      }
+
+   vectors[node] = vector;
+   return vector;
+   }
+
+// Array elements keep the array shadow of the vector type. Any other access,
+// such as one through a named or field shadow, uses a generic shadow that
+// aliases with every other shadow, since the vector shadow would only alias
+// with the array shadow of the element type.
+TR::SymbolReference *
+TR::LoopVectorizer::getVectorShadow(TR::Node *access, LoopBody &body)
+   {
+   TR::SymbolReferenceTable *symRefTab = comp()->getSymRefTab();
+   if (!access->getSymbol()->isArrayShadowSymbol())
+      {
+      symRefTab->aliasBuilder.setConservativeGenericIntShadowAliasing(true);
+      return symRefTab->findOrCreateGenericIntShadowSymbolReference(0);
+      }
+
+   return symRefTab->findOrCreateArrayShadowSymbolRef(body.vectorType);
+   }
+
+// Whether storing through store can change what access reads or writes in a
+// later iteration of the same vector: the distance between the two is
+// neither zero nor at least a vector
+TR::Node *
+TR::LoopVectorizer::createOverlapTest(TR::Node *store, TR::Node *access, int32_t vectorBytes)
+   {
+   TR::Node *distance = comp()->target().is64Bit()
+      ? TR::Node::create(store, TR::lsub, 2,
+            TR::Node::create(store, TR::a2l, 1, createStartAddress(store)),
+            TR::Node::create(store, TR::a2l, 1, createStartAddress(access)))
+      : TR::Node::create(store, TR::i2l, 1,
+            TR::Node::create(store, TR::isub, 2,
+               TR::Node::create(store, TR::a2i, 1, createStartAddress(store)),
+               TR::Node::create(store, TR::a2i, 1, createStartAddress(access))));
+
+   TR::Node *isNear = TR::Node::create(store, TR::lucmplt, 2,
+      TR::Node::create(store, TR::ladd, 2, distance, TR::Node::lconst(store, vectorBytes - 1)),
+      TR::Node::lconst(store, 2 * vectorBytes - 1));
+   TR::Node *isApart = TR::Node::create(store, TR::lcmpne, 2, distance, TR::Node::lconst(store, 0));
+   return TR::Node::create(store, TR::iand, 2, isNear, isApart);
+   }
+
+const char *
+TR::LoopVectorizer::optDetailString() const throw()
+   {
+   return "O^O LOOP VECTORIZER: ";
+   }
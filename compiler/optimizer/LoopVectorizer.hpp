@@ -0,0 +1,129 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef LOOPVECTORIZER_INCL
+#define LOOPVECTORIZER_INCL
+
+#include <stdint.h>
+#include <map>
+#include <vector>
+#include "il/DataTypes.hpp"
+#include "il/ILOpCodes.hpp"
+#include "optimizer/CountedLoopTransformer.hpp"
+#include "optimizer/OptimizationManager.hpp"
+
+namespace TR { class Block; }
+namespace TR { class Node; }
+namespace TR { class SymbolReference; }
+namespace TR { class TreeTop; }
+
+namespace TR
+{
+
+// Vectorizes single block counted loops, recognized as described in
+// CountedLoopTransformer, whose body only
+//
+//    stores an expression of unit stride loads and invariants:  *(c + i) = *(a + i) * k + *(b + i)
+//    accumulates such an expression into a local:               sum = sum + *(a + i)
+//
+// where every load, store and operation is of the same element type and has a
+// vector counterpart the code generator supports. Accumulations are integral
+// add, and, or, xor, min and max; floating point sums are left alone because
+// reassociating them changes the result.
+//
+// The vector loop is placed in front of the original loop, which stays as the
+// scalar loop for the remaining iterations:
+//
+//    guard:       tripCount = max(limit - i, 1)
+//                 if (tripCount < VF || stores overlap other accesses) goto header
+//    preheader:   vectorEnd = i + (tripCount & -VF)
+//                 vacc = splat(identity)
+//    vectorLoop:  vector body
+//                 i = i + VF
+//                 if (i < vectorEnd) goto vectorLoop
+//    vectorExit:  sum = sum op reduce(vacc)
+//                 if (i >= limit) goto exit
+//    header:      original loop
+//
+// The overlap test versions the loop on the distance between each store and
+// every other access: within one vector the loads of an iteration can run
+// before the stores of an earlier iteration, which is only safe when the two
+// are the same address or at least a vector apart.
+
+class LoopVectorizer : public TR::CountedLoopTransformer
+   {
+   public:
+
+   LoopVectorizer(TR::OptimizationManager *manager);
+   static TR::Optimization *create(TR::OptimizationManager *manager)
+      {
+      return new (manager->allocator()) LoopVectorizer(manager);
+      }
+
+   virtual int32_t perform();
+   virtual const char * optDetailString() const throw();
+
+   private:
+
+   struct Reduction
+      {
+      TR::TreeTop *tree;
+      TR::SymbolReference *accumulator;
+      TR::Node *operand;                  // Value combined into the accumulator each iteration
+      TR::SymbolReference *vectorAccumulator;
+      };
+
+   typedef TR::typed_allocator<Reduction, TR::Region&> ReductionAllocator;
+   typedef std::vector<Reduction, ReductionAllocator> ReductionVector;
+   typedef TR::typed_allocator<TR::Node *, TR::Region&> NodeAllocator;
+   typedef std::vector<TR::Node *, NodeAllocator> NodeVector;
+   typedef TR::typed_allocator<std::pair<TR::Node * const, TR::Node *>, TR::Region&> NodeMapAllocator;
+   typedef std::map<TR::Node *, TR::Node *, std::less<TR::Node *>, NodeMapAllocator> NodeMap;
+
+   struct LoopBody
+      {
+      LoopBody(TR::Region &region)
+         : elementType(TR::NoType), vectorType(TR::NoType), stores(region), loads(region), reductions(region) {}
+
+      TR::DataType elementType;
+      TR::DataType vectorType;
+      NodeVector stores;
+      NodeVector loads;
+      ReductionVector reductions;
+      };
+
+   // Checks every tree of the loop body against vectors of the given length,
+   // and collects what the transformation needs into body
+   bool analyzeBody(CountedLoop &loop, TR::VectorLength length, LoopBody &body);
+   bool isVectorizable(TR::Node *node, CountedLoop &loop, LoopBody &body);
+   bool isReduction(TR::TreeTop *tree, CountedLoop &loop, LoopBody &body);
+   bool isSupported(TR::ILOpCodes op);
+
+   bool vectorize(CountedLoop &loop, LoopBody &body);
+   TR::Node *createVector(TR::Node *node, CountedLoop &loop, LoopBody &body, NodeMap &vectors);
+   TR::SymbolReference *getVectorShadow(TR::Node *access, LoopBody &body);
+   TR::Node *createOverlapTest(TR::Node *store, TR::Node *access, int32_t vectorBytes);
+   TR::ILOpCodes getReductionOpCode(TR::ILOpCodes scalarOp, TR::DataType vectorType);
+   };
+
+}
+
+#endif // LOOPVECTORIZER_INCL
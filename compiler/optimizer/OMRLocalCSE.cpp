@@ -442,8 +442,11 @@ void OMR::LocalCSE::examineNode(TR::Node *node, TR_BitVector &seenAvailableLoade
    // because of strict/non strict problems when a very large float/double value
    // is stored and then read.
    //
+   // Masked vector loads only read some lanes, so a full store cannot be
+   // forwarded into them
+   //
    TR::SymbolReference * symRef = node->getOpCode().hasSymbolReference() ? node->getSymbolReference() : 0;
-   if (symRef && node->getOpCode().isLoadVar())
+   if (symRef && node->getOpCode().isLoadVar() && !node->getOpCode().isVectorMasked())
       {
       StoreMap::iterator result = _storeMap->find(symRef->getReferenceNumber());
       if (result != _storeMap->end() && result->second->getSymbolReference()->getReferenceNumber() == symRef->getReferenceNumber())
@@ -687,9 +690,11 @@ void OMR::LocalCSE::examineNode(TR::Node *node, TR_BitVector &seenAvailableLoade
             killAvailableExpressions(symRefNum);
          }
 
-      // Step 3 : add this node as a copy propagation candidate if it is a store
+      // Step 3 : add this node as a copy propagation candidate if it is a store.
+      // A masked vector store still kills the stores above, but it leaves the
+      // lanes outside its mask alone so its value is not a copy of the memory.
       //
-      if (node->getOpCode().isStore())
+      if (node->getOpCode().isStore() && !node->getOpCode().isVectorMasked())
          {
          (*_storeMap)[symRefNum] = node;
          }
@@ -93,6 +93,12 @@ OMR::OptimizationManager::OptimizationManager(TR::Optimizer *o, OptimizationFact
       case OMR::loopReduction:
          _flags.set(requiresStructure | checkStructure | dumpStructure);
          break;
+      case OMR::idiomRecognition:
+         _flags.set(requiresStructure | checkStructure | dumpStructure);
+         break;
+      case OMR::SPMDKernelParallelization:
+         _flags.set(requiresStructure | checkStructure | dumpStructure);
+         break;
       case OMR::loopReplicator:
          _flags.set(requiresStructure | checkStructure | dumpStructure);
          break;
@@ -88,12 +88,15 @@
 #include "optimizer/LocalOpts.hpp"
 #include "optimizer/LocalReordering.hpp"
 #include "optimizer/LoopCanonicalizer.hpp"
+#include "optimizer/LoopIdiomRecognizer.hpp"
 #include "optimizer/LoopReducer.hpp"
 #include "optimizer/LoopReplicator.hpp"
+#include "optimizer/LoopVectorizer.hpp"
 #include "optimizer/LoopVersioner.hpp"
 #include "optimizer/OrderBlocks.hpp"
 #include "optimizer/RedundantAsyncCheckRemoval.hpp"
 #include "optimizer/Simplifier.hpp"
+#include "optimizer/SuperwordVectorizer.hpp"
 #include "optimizer/VirtualGuardCoalescer.hpp"
 #include "optimizer/VirtualGuardHeadMerger.hpp"
 #include "optimizer/Inliner.hpp"
@@ -102,6 +105,7 @@
 #include "optimizer/GlobalValuePropagation.hpp"
 #include "optimizer/LocalValuePropagation.hpp"
 #include "optimizer/RegDepCopyRemoval.hpp"
+#include "optimizer/ScalarReplacement.hpp"
 #include "optimizer/SinkStores.hpp"
 #include "optimizer/PartialRedundancy.hpp"
 #include "optimizer/OSRDefAnalysis.hpp"
@@ -237,6 +241,8 @@ const OptimizationStrategy eachExpensiveGlobalValuePropagationOpts[] =
    { deadTreesElimination                          }, // clean up left-over accesses before escape analysis
 #ifdef J9_PROJECT_SPECIFIC
    { expensiveObjectAllocationGroup                         },
+#else
+   { escapeAnalysis,                              IfEAOpportunities }, // replace allocations that do not escape with temps
 #endif
    { eachExpensiveGlobalValuePropagationGroup,    IfEnabled }, // if inlining was done
    { endGroup                                               }
@@ -292,16 +298,12 @@ const OptimizationStrategy partialRedundancyEliminationOpts[] =
    { globalDeadStoreElimination, IfEnabledAndMoreThanOneBlock}, // It may need to be run twice if deadstore elimination is required,
    { deadTreesElimination,                  }, // but this only happens for unsafe access (arraytranslate.twoToOne)
    { loopReduction,                         }, // and so is conditional
-#ifdef J9_PROJECT_SPECIFIC
    { idiomRecognition,         IfLoopsAndNotProfiling }, // after loopReduction!!
-#endif
    { lastLoopVersionerGroup,          IfLoops },
    { treeSimplification,                    }, // cleanup before AutoVectorization
    { deadTreesElimination,                  }, // cleanup before AutoVectorization
    { inductionVariableAnalysis,             IfLoopsAndNotProfiling   },
-#ifdef J9_PROJECT_SPECIFIC
    { SPMDKernelParallelization,          IfLoops },
-#endif
    { loopStrider,                 IfLoops   },
    { treeSimplification,          IfEnabled },
    { lastLoopVersionerGroup,          IfEnabledAndLoops },
@@ -610,6 +612,7 @@ static const OptimizationStrategy omrHotStrategyOpts[] =
    { OMR::localDeadStoreElimination,                         }, //remove the astore if no literal pool is required
    { OMR::localCSE,                                          },  //common up lit pool refs in the same block
    { OMR::arraysetStoreElimination                           },
+   { OMR::superwordVectorization                             }, // after the last localCSE has commoned the stores' bases
    { OMR::localValuePropagation,    OMR::MarkLastRun         },
    { OMR::checkcastAndProfiledGuardCoalescer                 },
    { OMR::osrExceptionEdgeRemoval, OMR::MarkLastRun          },
@@ -854,6 +857,14 @@ OMR::Optimizer::Optimizer(TR::Compilation *comp, TR::ResolvedMethodSymbol *metho
       new (comp->allocator()) TR::OptimizationManager(self(), TR::RecognizedCallTransformer::create, OMR::recognizedCallTransformer);
    _opts[OMR::switchAnalyzer] =
       new (comp->allocator()) TR::OptimizationManager(self(), TR::SwitchAnalyzer::create, OMR::switchAnalyzer);
+   _opts[OMR::escapeAnalysis] =
+      new (comp->allocator()) TR::OptimizationManager(self(), TR::ScalarReplacement::create, OMR::escapeAnalysis);
+   _opts[OMR::idiomRecognition] =
+      new (comp->allocator()) TR::OptimizationManager(self(), TR::LoopIdiomRecognizer::create, OMR::idiomRecognition);
+   _opts[OMR::SPMDKernelParallelization] =
+      new (comp->allocator()) TR::OptimizationManager(self(), TR::LoopVectorizer::create, OMR::SPMDKernelParallelization);
+   _opts[OMR::superwordVectorization] =
+      new (comp->allocator()) TR::OptimizationManager(self(), TR::SuperwordVectorizer::create, OMR::superwordVectorization);
    // NOTE: Please add new OMR optimizations here!
 
    // initialize OMR optimization groups
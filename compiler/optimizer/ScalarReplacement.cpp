@@ -0,0 +1,530 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "optimizer/ScalarReplacement.hpp"
+
+#include <limits>
+
+#include "compile/Compilation.hpp"
+#include "compile/SymbolReferenceTable.hpp"
+#include "env/CompilerEnv.hpp"
+#include "env/ObjectModel.hpp"
+#include "env/StackMemoryRegion.hpp"
+#include "il/Block.hpp"
+#include "il/ILOpCodes.hpp"
+#include "il/ILOps.hpp"
+#include "il/Node.hpp"
+#include "il/Node_inlines.hpp"
+#include "il/ResolvedMethodSymbol.hpp"
+#include "il/Symbol.hpp"
+#include "il/SymbolReference.hpp"
+#include "il/TreeTop.hpp"
+#include "il/TreeTop_inlines.hpp"
+#include "infra/Assert.hpp"
+#include "optimizer/Dominators.hpp"
+#include "optimizer/Optimization_inlines.hpp"
+#include "optimizer/Optimizer.hpp"
+#include "optimizer/TransformUtil.hpp"
+#include "ras/Debug.hpp"
+
+#define OPT_DETAILS "O^O SCALAR REPLACEMENT: "
+
+// Beyond this many fields the temporaries are more likely to be spilled than
+// the allocation is to be expensive
+static const size_t MAX_REPLACED_FIELDS = 16;
+
+TR::ScalarReplacement::ScalarReplacement(TR::OptimizationManager *manager)
+   : TR::Optimization(manager),
+     _candidates(NULL),
+     _allocations(NULL),
+     _locals(NULL)
+   {}
+
+int32_t
+TR::ScalarReplacement::perform()
+   {
+   TR::StackMemoryRegion stackMemoryRegion(*trMemory());
+   TR::Region &region = trMemory()->currentStackRegion();
+
+   CandidateVector candidates((CandidateAllocator(region)));
+   AllocationMap allocations((std::less<TR::Node *>()), AllocationMapAllocator(region));
+   LocalMap locals((std::less<int32_t>()), LocalMapAllocator(region));
+   _candidates = &candidates;
+   _allocations = &allocations;
+   _locals = &locals;
+
+   findCandidates();
+
+   int32_t replacedCount = 0;
+   if (!_candidates->empty())
+      {
+      vcount_t visitCount = comp()->incOrResetVisitCount();
+      for (TR::TreeTop *tt = comp()->getStartTree(); tt != NULL; tt = tt->getNextTreeTop())
+         findEscapes(tt->getNode(), visitCount);
+
+      findUndominatedLoads();
+
+      for (CandidateVector::iterator it = _candidates->begin(); it != _candidates->end(); ++it)
+         {
+         Candidate *candidate = *it;
+         if (candidate->escapes)
+            continue;
+
+         if (!performTransformation(comp(), "%sReplacing allocation n%dn [" POINTER_PRINTF_FORMAT "] with %d temporaries\n",
+               OPT_DETAILS, candidate->allocation->getGlobalIndex(), candidate->allocation, (int32_t)candidate->fields.size()))
+            continue;
+
+         replaceAllocation(candidate);
+         replacedCount++;
+         }
+      }
+
+   if (replacedCount > 0)
+      {
+      vcount_t visitCount = comp()->incOrResetVisitCount();
+      TR::TreeTop *nextTree = NULL;
+      for (TR::TreeTop *tt = comp()->getStartTree(); tt != NULL; tt = nextTree)
+         {
+         nextTree = tt->getNextTreeTop();
+         TR::Node *node = tt->getNode();
+         int32_t offset = 0;
+         Candidate *candidate = NULL;
+
+         // Anchors of the reference and stores of it to its own local go away with the allocation
+         if ((node->getOpCodeValue() == TR::treetop || node->getOpCode().isStoreDirect())
+             && (candidate = getBaseCandidate(node->getFirstChild(), offset)) != NULL
+             && candidate->replaced)
+            {
+            TR::TransformUtil::removeTree(comp(), tt);
+            continue;
+            }
+
+         // The allocation dominates every load of its local, so the reference is never null
+         if (node->getOpCode().isNullCheck()
+             && (candidate = getBaseCandidate(node->getNullCheckReference(), offset)) != NULL
+             && candidate->replaced)
+            TR::Node::recreate(node, TR::treetop);
+
+         rewriteAccesses(node, visitCount);
+         }
+
+      optimizer()->setUseDefInfo(NULL);
+      optimizer()->setValueNumberInfo(NULL);
+      optimizer()->setAliasSetsAreValid(false);
+      }
+
+   _candidates = NULL;
+   _allocations = NULL;
+   _locals = NULL;
+
+   return replacedCount;
+   }
+
+bool
+TR::ScalarReplacement::isSupportedAllocation(TR::Node *allocation)
+   {
+   switch (allocation->getOpCodeValue())
+      {
+      case TR::New:
+         return true;
+      case TR::newarray:
+      case TR::anewarray:
+         {
+         // Removing the allocation must not remove a size check
+         TR::Node *length = allocation->getFirstChild();
+         return length->getOpCode().isLoadConst() && (length->get64bitIntegralValue() >= 0);
+         }
+      default:
+         return false;
+      }
+   }
+
+void
+TR::ScalarReplacement::findCandidates()
+   {
+   TR::Block *block = NULL;
+   for (TR::TreeTop *tt = comp()->getStartTree(); tt != NULL; tt = tt->getNextTreeTop())
+      {
+      TR::Node *node = tt->getNode();
+      if (node->getOpCodeValue() == TR::BBStart)
+         block = node->getBlock();
+
+      if (node->getNumChildren() == 0 || !node->getFirstChild()->getOpCode().isNew())
+         continue;
+
+      bool isAnchor = (node->getOpCodeValue() == TR::treetop);
+      bool isLocalStore = node->getOpCode().isStoreDirect()
+         && (node->getDataType() == TR::Address)
+         && node->getSymbolReference()->getSymbol()->isAuto();
+      if (!isAnchor && !isLocalStore)
+         continue;
+
+      TR::Node *allocation = node->getFirstChild();
+      Candidate *candidate = NULL;
+      AllocationMap::iterator existing = _allocations->find(allocation);
+      if (existing != _allocations->end())
+         {
+         candidate = existing->second;
+         }
+      else
+         {
+         if (!isSupportedAllocation(allocation))
+            continue;
+
+         TR::Region &region = trMemory()->currentStackRegion();
+         candidate = new (region) Candidate(region, allocation, tt, NULL);
+         _candidates->push_back(candidate);
+         (*_allocations)[allocation] = candidate;
+         if (trace())
+            traceMsg(comp(), "Allocation candidate n%dn in tree n%dn\n", allocation->getGlobalIndex(), node->getGlobalIndex());
+         }
+
+      // The first local the allocation is stored to tracks it; stores to any other local make it escape
+      if (isLocalStore && (candidate->local == NULL))
+         {
+         int32_t localNumber = node->getSymbolReference()->getReferenceNumber();
+         if (_locals->find(localNumber) == _locals->end())
+            {
+            candidate->local = node->getSymbolReference();
+            candidate->localStoreTree = tt;
+            candidate->localStoreBlock = block;
+            (*_locals)[localNumber] = candidate;
+            }
+         }
+      }
+   }
+
+void
+TR::ScalarReplacement::findEscapes(TR::Node *node, vcount_t visitCount)
+   {
+   if (node->getVisitCount() == visitCount)
+      return;
+   node->setVisitCount(visitCount);
+
+   if (node->getOpCode().hasSymbolReference() && (node->getSymbolReference() != NULL) && !_locals->empty())
+      {
+      LocalMap::iterator local = _locals->find(node->getSymbolReference()->getReferenceNumber());
+      if (local != _locals->end())
+         {
+         Candidate *candidate = local->second;
+         if (node->getOpCodeValue() == TR::loadaddr)
+            markEscaping(candidate, node, "the address of its local is taken");
+         else if (node->getOpCode().isStoreDirect() && (node->getFirstChild() != candidate->allocation))
+            markEscaping(candidate, node, "its local is redefined");
+         }
+      }
+
+   for (int32_t i = 0; i < node->getNumChildren(); i++)
+      {
+      TR::Node *child = node->getChild(i);
+      int32_t offset = 0;
+      Candidate *candidate = getCandidate(child);
+      if (candidate != NULL)
+         checkUse(node, i, candidate, 0, false);
+      else if ((candidate = getBaseCandidate(child, offset)) != NULL)
+         checkUse(node, i, candidate, offset, true);
+
+      findEscapes(child, visitCount);
+      }
+   }
+
+void
+TR::ScalarReplacement::checkUse(TR::Node *parent, int32_t childIndex, Candidate *candidate, int32_t offset, bool isDerived)
+   {
+   TR::ILOpCode &opCode = parent->getOpCode();
+   int32_t baseOffset = 0;
+
+   if ((childIndex == 0) && (opCode.isLoadIndirect() || opCode.isStoreIndirect()))
+      {
+      if (!addField(candidate, offset + (int32_t)parent->getSymbolReference()->getOffset(), parent))
+         markEscaping(candidate, parent, "a field access cannot be replaced");
+      return;
+      }
+
+   // The destination object of a write barrier is the base of the same store
+   if ((childIndex == 2) && opCode.isWrtBar() && opCode.isStoreIndirect()
+       && (getBaseCandidate(parent->getFirstChild(), baseOffset) == candidate))
+      return;
+
+   if (parent->getOpCodeValue() == TR::treetop)
+      return;
+
+   if (!isDerived)
+      {
+      if (opCode.isStoreDirect()
+          && (parent->getFirstChild() == candidate->allocation)
+          && (parent->getSymbolReference() == candidate->local))
+         return;
+
+      // A constant offset from the reference, whose own uses are checked as derived addresses
+      if ((childIndex == 0) && (getBaseCandidate(parent, baseOffset) == candidate))
+         return;
+      }
+
+   markEscaping(candidate, parent, "the reference is used");
+   }
+
+void
+TR::ScalarReplacement::findUndominatedLoads()
+   {
+   // Every other definition of the local already makes the allocation escape, so a load the store
+   // dominates sees the allocation. Any other load may see null, which the temporaries cannot
+   // represent, and dereferencing it must still throw.
+   TR_Dominators *dominators = NULL;
+   vcount_t visitCount = comp()->incOrResetVisitCount();
+   TR::Block *block = NULL;
+   for (TR::TreeTop *tt = comp()->getStartTree(); tt != NULL; tt = tt->getNextTreeTop())
+      {
+      TR::Node *node = tt->getNode();
+      if (node->getOpCodeValue() == TR::BBStart)
+         block = node->getBlock();
+
+      checkLocalLoads(node, block, visitCount, dominators);
+
+      // Trees of a block are contiguous, so within the block of the store the loads after it are dominated
+      Candidate *candidate = NULL;
+      if (node->getOpCode().isStoreDirect() && (candidate = getCandidate(node->getFirstChild())) != NULL && (candidate->localStoreTree == tt))
+         candidate->localStoreSeen = true;
+      }
+   }
+
+void
+TR::ScalarReplacement::checkLocalLoads(TR::Node *node, TR::Block *block, vcount_t visitCount, TR_Dominators *&dominators)
+   {
+   if (node->getVisitCount() == visitCount)
+      return;
+   node->setVisitCount(visitCount);
+
+   for (int32_t i = 0; i < node->getNumChildren(); i++)
+      checkLocalLoads(node->getChild(i), block, visitCount, dominators);
+
+   Candidate *candidate = NULL;
+   if (!node->getOpCode().isLoadVarDirect() || (candidate = getCandidate(node)) == NULL || candidate->escapes)
+      return;
+
+   bool dominated = false;
+   if (candidate->localStoreBlock == block)
+      {
+      dominated = candidate->localStoreSeen;
+      }
+   else
+      {
+      if (dominators == NULL)
+         dominators = new (trStackMemory()) TR_Dominators(comp());
+      dominated = dominators->dominates(candidate->localStoreBlock, block) != 0;
+      }
+
+   if (!dominated)
+      markEscaping(candidate, node, "its local is loaded where the allocation may not have been stored");
+   }
+
+bool
+TR::ScalarReplacement::addField(Candidate *candidate, int32_t offset, TR::Node *access)
+   {
+   if (access->getSymbolReference()->isUnresolved())
+      return false;
+
+   TR::DataType type = access->getDataType();
+   switch (type)
+      {
+      case TR::Int8:
+      case TR::Int16:
+      case TR::Int32:
+      case TR::Int64:
+      case TR::Float:
+      case TR::Double:
+      case TR::Address:
+         break;
+      default:
+         return false;
+      }
+
+   int32_t size = (int32_t)access->getSize();
+   if (!isWithinAllocation(candidate, offset, size))
+      return false;
+
+   Field *existing = getField(candidate, offset);
+   if (existing != NULL)
+      return existing->type == type;
+
+   for (FieldVector::iterator field = candidate->fields.begin(); field != candidate->fields.end(); ++field)
+      {
+      if ((offset < field->offset + field->size) && (field->offset < offset + size))
+         return false;
+      }
+
+   if (candidate->fields.size() >= MAX_REPLACED_FIELDS)
+      return false;
+
+   Field field = { offset, size, type, NULL };
+   candidate->fields.push_back(field);
+   return true;
+   }
+
+bool
+TR::ScalarReplacement::isWithinAllocation(Candidate *candidate, int32_t offset, int32_t size)
+   {
+   TR::Node *allocation = candidate->allocation;
+   if (allocation->getOpCodeValue() == TR::New)
+      return offset >= (int32_t)TR::Compiler->om.objectHeaderSizeInBytes();
+
+   int64_t headerSize = (int64_t)TR::Compiler->om.contiguousArrayHeaderSizeInBytes();
+   if (offset < headerSize)
+      return false;
+
+   // Reference elements have the size of a reference field. Primitive element
+   // sizes are only known to the front end, so every access must agree on one.
+   int64_t elementSize = size;
+   if (allocation->getOpCodeValue() == TR::anewarray)
+      elementSize = TR::Compiler->om.sizeofReferenceField();
+   else if (!candidate->fields.empty() && (candidate->fields.front().size != size))
+      return false;
+
+   int64_t length = allocation->getFirstChild()->get64bitIntegralValue();
+   return (int64_t)offset + size <= headerSize + length * elementSize;
+   }
+
+void
+TR::ScalarReplacement::markEscaping(Candidate *candidate, TR::Node *use, const char *reason)
+   {
+   if (!candidate->escapes && trace())
+      traceMsg(comp(), "Allocation n%dn escapes at n%dn: %s\n", candidate->allocation->getGlobalIndex(), use->getGlobalIndex(), reason);
+   candidate->escapes = true;
+   }
+
+TR::ScalarReplacement::Candidate *
+TR::ScalarReplacement::getCandidate(TR::Node *node)
+   {
+   if (node->getOpCode().isNew())
+      {
+      AllocationMap::iterator allocation = _allocations->find(node);
+      return (allocation != _allocations->end()) ? allocation->second : NULL;
+      }
+
+   if (node->getOpCode().isLoadVarDirect() && (node->getDataType() == TR::Address) && !_locals->empty())
+      {
+      LocalMap::iterator local = _locals->find(node->getSymbolReference()->getReferenceNumber());
+      return (local != _locals->end()) ? local->second : NULL;
+      }
+
+   return NULL;
+   }
+
+TR::ScalarReplacement::Candidate *
+TR::ScalarReplacement::getBaseCandidate(TR::Node *node, int32_t &offset)
+   {
+   Candidate *candidate = getCandidate(node);
+   if (candidate != NULL)
+      {
+      offset = 0;
+      return candidate;
+      }
+
+   if (node->getOpCode().isAdd()
+       && (node->getDataType() == TR::Address)
+       && (node->getNumChildren() == 2)
+       && node->getSecondChild()->getOpCode().isLoadConst())
+      {
+      int64_t value = node->getSecondChild()->get64bitIntegralValue();
+      candidate = getCandidate(node->getFirstChild());
+      if ((candidate != NULL) && (value >= 0) && (value <= std::numeric_limits<int32_t>::max()))
+         {
+         offset = (int32_t)value;
+         return candidate;
+         }
+      }
+
+   return NULL;
+   }
+
+TR::ScalarReplacement::Field *
+TR::ScalarReplacement::getField(Candidate *candidate, int32_t offset)
+   {
+   for (FieldVector::iterator field = candidate->fields.begin(); field != candidate->fields.end(); ++field)
+      {
+      if (field->offset == offset)
+         return &*field;
+      }
+   return NULL;
+   }
+
+void
+TR::ScalarReplacement::replaceAllocation(Candidate *candidate)
+   {
+   // The allocation zeroes the object, so do the same to its fields where it was
+   for (FieldVector::iterator field = candidate->fields.begin(); field != candidate->fields.end(); ++field)
+      {
+      field->temp = comp()->getSymRefTab()->createTemporary(comp()->getMethodSymbol(), field->type);
+      TR::Node *zero = TR::Node::createConstZeroValue(candidate->allocation, field->type);
+      TR::Node *store = TR::Node::createStore(candidate->allocation, field->temp, zero);
+      candidate->allocationTree->insertBefore(TR::TreeTop::create(comp(), store));
+      if (trace())
+         traceMsg(comp(), "   field at offset %d of allocation n%dn becomes #%d\n", field->offset, candidate->allocation->getGlobalIndex(), field->temp->getReferenceNumber());
+      }
+   candidate->replaced = true;
+   }
+
+void
+TR::ScalarReplacement::rewriteAccesses(TR::Node *node, vcount_t visitCount)
+   {
+   if (node->getVisitCount() == visitCount)
+      return;
+   node->setVisitCount(visitCount);
+
+   int32_t offset = 0;
+   Candidate *candidate = NULL;
+   if ((node->getOpCode().isLoadIndirect() || node->getOpCode().isStoreIndirect())
+       && (candidate = getBaseCandidate(node->getFirstChild(), offset)) != NULL
+       && candidate->replaced)
+      {
+      Field *field = getField(candidate, offset + (int32_t)node->getSymbolReference()->getOffset());
+      TR_ASSERT_FATAL(field != NULL, "Access n%dn of replaced allocation n%dn has no field", node->getGlobalIndex(), candidate->allocation->getGlobalIndex());
+
+      bool isStore = node->getOpCode().isStore();
+      for (int32_t i = 0; i < node->getNumChildren(); i++)
+         {
+         if (!isStore || (i != 1))
+            node->getChild(i)->recursivelyDecReferenceCount();
+         }
+
+      if (isStore)
+         {
+         TR::Node::recreate(node, comp()->il.opCodeForDirectStore(field->type));
+         node->setChild(0, node->getSecondChild());
+         node->setNumChildren(1);
+         }
+      else
+         {
+         TR::Node::recreate(node, comp()->il.opCodeForDirectLoad(field->type));
+         node->setNumChildren(0);
+         }
+      node->setSymbolReference(field->temp);
+      }
+
+   for (int32_t i = 0; i < node->getNumChildren(); i++)
+      rewriteAccesses(node->getChild(i), visitCount);
+   }
+
+const char *
+TR::ScalarReplacement::optDetailString() const throw()
+   {
+   return "O^O SCALAR REPLACEMENT: ";
+   }
@@ -0,0 +1,145 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef SCALARREPLACEMENT_INCL
+#define SCALARREPLACEMENT_INCL
+
+#include <stdint.h>
+#include <map>
+#include <vector>
+#include "env/TRMemory.hpp"
+#include "il/DataTypes.hpp"
+#include "optimizer/Optimization.hpp"
+#include "optimizer/OptimizationManager.hpp"
+
+class TR_Dominators;
+namespace TR { class Block; }
+namespace TR { class Node; }
+namespace TR { class SymbolReference; }
+namespace TR { class TreeTop; }
+
+namespace TR
+{
+
+// Language neutral escape analysis that replaces allocations that never
+// escape the method with temporaries holding their fields.
+//
+// An allocation (new, or newarray/anewarray with a constant length) is a
+// candidate when it is anchored by a treetop or stored to an auto that has
+// no other definition and whose address is never taken. It escapes when its
+// reference, directly or through that auto, is used for anything other than
+// the base of a resolved indirect load or store at a constant offset: passed
+// to a call, returned, stored to memory or to another local, compared, or
+// used as an array. It also escapes when the auto is loaded where the store
+// of the allocation does not dominate, since the load may then see null.
+//
+// Each field of a non-escaping allocation, identified by its offset, becomes
+// a temporary that is zeroed where the allocation was, and the field accesses
+// become direct loads and stores of those temporaries. Allocations whose
+// accesses overlap with different types stay on the heap, as do those that
+// would need too many temporaries, and those accessed inside the object
+// header or outside the elements of the array.
+//
+// Allocating escaping objects on the stack needs the front end to lay out the
+// object header and to describe the object to the garbage collector, so it is
+// left to language specific implementations of this pass.
+
+class ScalarReplacement : public TR::Optimization
+   {
+   public:
+
+   ScalarReplacement(TR::OptimizationManager *manager);
+   static TR::Optimization *create(TR::OptimizationManager *manager)
+      {
+      return new (manager->allocator()) ScalarReplacement(manager);
+      }
+
+   virtual int32_t perform();
+   virtual const char * optDetailString() const throw();
+
+   private:
+
+   struct Field
+      {
+      int32_t offset;
+      int32_t size;
+      TR::DataType type;
+      TR::SymbolReference *temp;
+      };
+
+   typedef TR::typed_allocator<Field, TR::Region&> FieldAllocator;
+   typedef std::vector<Field, FieldAllocator> FieldVector;
+
+   struct Candidate
+      {
+      Candidate(TR::Region &region, TR::Node *allocation, TR::TreeTop *allocationTree, TR::SymbolReference *local)
+         : allocation(allocation), allocationTree(allocationTree), local(local), localStoreTree(NULL), localStoreBlock(NULL), localStoreSeen(false), escapes(false), replaced(false), fields(FieldAllocator(region))
+         {}
+
+      TR::Node *allocation;         // The new, newarray or anewarray node
+      TR::TreeTop *allocationTree;  // Treetop or auto store anchoring the allocation
+      TR::SymbolReference *local;   // Auto the allocation is stored to, or NULL
+      TR::TreeTop *localStoreTree;  // Store of the allocation to local
+      TR::Block *localStoreBlock;   // Block of localStoreTree
+      bool localStoreSeen;          // Whether findUndominatedLoads has walked past localStoreTree
+      bool escapes;
+      bool replaced;
+      FieldVector fields;
+      };
+
+   typedef TR::typed_allocator<Candidate *, TR::Region&> CandidateAllocator;
+   typedef std::vector<Candidate *, CandidateAllocator> CandidateVector;
+
+   typedef TR::typed_allocator<std::pair<TR::Node * const, Candidate *>, TR::Region&> AllocationMapAllocator;
+   typedef std::map<TR::Node *, Candidate *, std::less<TR::Node *>, AllocationMapAllocator> AllocationMap;
+
+   typedef TR::typed_allocator<std::pair<const int32_t, Candidate *>, TR::Region&> LocalMapAllocator;
+   typedef std::map<int32_t, Candidate *, std::less<int32_t>, LocalMapAllocator> LocalMap;
+
+   bool isSupportedAllocation(TR::Node *allocation);
+   void findCandidates();
+   void findEscapes(TR::Node *node, vcount_t visitCount);
+   void checkUse(TR::Node *parent, int32_t childIndex, Candidate *candidate, int32_t offset, bool isDerived);
+   // Mark candidates whose local is loaded where the store of the allocation does not dominate
+   void findUndominatedLoads();
+   void checkLocalLoads(TR::Node *node, TR::Block *block, vcount_t visitCount, TR_Dominators *&dominators);
+   bool addField(Candidate *candidate, int32_t offset, TR::Node *access);
+   // Whether the access lies past the header and, for arrays, within the elements
+   bool isWithinAllocation(Candidate *candidate, int32_t offset, int32_t size);
+   void markEscaping(Candidate *candidate, TR::Node *use, const char *reason);
+
+   // The candidate whose reference node yields, or NULL
+   Candidate *getCandidate(TR::Node *node);
+   // The candidate that node is the reference of, or a constant offset from; sets offset
+   Candidate *getBaseCandidate(TR::Node *node, int32_t &offset);
+   Field *getField(Candidate *candidate, int32_t offset);
+
+   void replaceAllocation(Candidate *candidate);
+   void rewriteAccesses(TR::Node *node, vcount_t visitCount);
+
+   CandidateVector *_candidates;
+   AllocationMap *_allocations;
+   LocalMap *_locals;
+   };
+
+}
+
+#endif // SCALARREPLACEMENT_INCL
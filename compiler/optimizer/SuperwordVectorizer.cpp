@@ -0,0 +1,705 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "optimizer/SuperwordVectorizer.hpp"
+
+#include <algorithm>
+#include "codegen/CodeGenerator.hpp"
+#include "compile/Compilation.hpp"
+#include "compile/SymbolReferenceTable.hpp"
+#include "env/StackMemoryRegion.hpp"
+#include "il/Block.hpp"
+#include "il/ILOpCodes.hpp"
+#include "il/ILOps.hpp"
+#include "il/Node.hpp"
+#include "il/Node_inlines.hpp"
+#include "il/Symbol.hpp"
+#include "il/SymbolReference.hpp"
+#include "il/TreeTop.hpp"
+#include "il/TreeTop_inlines.hpp"
+#include "infra/BitVector.hpp"
+#include "infra/Checklist.hpp"
+#include "optimizer/Optimization_inlines.hpp"
+#include "optimizer/Optimizer.hpp"
+#include "ras/Debug.hpp"
+
+#define OPT_DETAILS "O^O SUPERWORD VECTORIZER: "
+
+TR::SuperwordVectorizer::SuperwordVectorizer(TR::OptimizationManager *manager)
+   : TR::Optimization(manager)
+   {}
+
+int32_t
+TR::SuperwordVectorizer::perform()
+   {
+   if (!cg()->getSupportsAutoSIMD())
+      return 0;
+
+   TR::StackMemoryRegion stackMemoryRegion(*trMemory());
+
+   int32_t packCount = 0;
+   for (TR::TreeTop *tt = comp()->getStartTree(); tt; tt = tt->getNode()->getBlock()->getExit()->getNextTreeTop())
+      {
+      TR::Block *block = tt->getNode()->getBlock();
+      if (block->isCold())
+         continue;
+
+      // Packing changes the trees the remaining candidates were found in, so
+      // look for them again after each pack
+      while (packBlock(block))
+         packCount++;
+      }
+
+   if (packCount > 0)
+      {
+      optimizer()->setUseDefInfo(NULL);
+      optimizer()->setValueNumberInfo(NULL);
+      optimizer()->setAliasSetsAreValid(false);
+      }
+
+   return packCount;
+   }
+
+bool
+TR::SuperwordVectorizer::packBlock(TR::Block *block)
+   {
+   LaneVector seeds((LaneAllocator(trMemory()->currentStackRegion())));
+   collectSeeds(block, seeds);
+
+   for (size_t i = 0; i < seeds.size(); i++)
+      {
+      // Every group of stores off one base is tried once, from its first store
+      LaneVector group((LaneAllocator(trMemory()->currentStackRegion())));
+      bool triedBefore = false;
+      for (size_t j = 0; j < seeds.size() && !triedBefore; j++)
+         {
+         if (seeds[j].store->getDataType() != seeds[i].store->getDataType()
+             || !areEquivalent(seeds[j].base, seeds[i].base))
+            continue;
+
+         if (j < i)
+            triedBefore = true;
+         else
+            group.push_back(seeds[j]);
+         }
+
+      if (triedBefore || group.size() < 2)
+         continue;
+
+      std::sort(group.begin(), group.end(), compareLaneOffsets);
+
+      bool storesTwice = false;
+      for (size_t j = 1; j < group.size(); j++)
+         storesTwice = storesTwice || group[j].offset == group[j - 1].offset;
+      if (storesTwice)
+         continue;
+
+      TR::DataType elementType = group[0].store->getDataType();
+      int32_t elementSize = TR::DataType::getSize(elementType);
+      for (size_t start = 0; start + 1 < group.size(); start++)
+         {
+         // Prefer the widest vectors the stores fill
+         for (int32_t length = TR::NumVectorLengths; length >= TR::VectorLength128; length--)
+            {
+            TR::DataType vectorType = TR::DataType::createVectorType(elementType.getDataType(), static_cast<TR::VectorLength>(length));
+            size_t laneCount = TR::DataType::getSize(vectorType) / elementSize;
+            if (start + laneCount > group.size())
+               continue;
+
+            bool consecutive = true;
+            for (size_t lane = 1; lane < laneCount && consecutive; lane++)
+               consecutive = group[start + lane].offset == group[start].offset + static_cast<int64_t>(lane) * elementSize;
+            if (!consecutive)
+               continue;
+
+            Pack pack(trMemory()->currentStackRegion());
+            pack.elementType = elementType;
+            pack.vectorType = vectorType;
+            pack.lanes.assign(group.begin() + start, group.begin() + start + laneCount);
+            pack.keptNodes.push_back(pack.lanes.front().store->getFirstChild());
+            for (LaneVector::iterator it = pack.lanes.begin() + 1; it != pack.lanes.end(); ++it)
+               areEquivalent(it->base, pack.lanes.front().base, &pack.equatedLoads);
+
+            NodeVector values((NodeAllocator(trMemory()->currentStackRegion())));
+            for (LaneVector::iterator it = pack.lanes.begin(); it != pack.lanes.end(); ++it)
+               values.push_back(it->store->getSecondChild());
+
+            pack.scalarCost = static_cast<int32_t>(laneCount);
+            pack.vectorCost = 1;
+            if (!isSupported(TR::ILOpCode::createVectorOpCode(TR::vstorei, vectorType))
+                || !isIsomorphic(values, pack))
+               {
+               if (trace())
+                  traceMsg(comp(), "Stores n%dn to n%dn are not isomorphic as %s\n", pack.lanes.front().store->getGlobalIndex(),
+                     pack.lanes.back().store->getGlobalIndex(), TR::DataType::getName(vectorType));
+               continue;
+               }
+
+            if (pack.vectorCost >= pack.scalarCost)
+               {
+               if (trace())
+                  traceMsg(comp(), "Stores n%dn to n%dn as %s cost %d vector operations instead of %d\n",
+                     pack.lanes.front().store->getGlobalIndex(), pack.lanes.back().store->getGlobalIndex(),
+                     TR::DataType::getName(vectorType), pack.vectorCost, pack.scalarCost);
+               continue;
+               }
+
+            if (!isLegal(pack, block))
+               {
+               if (trace())
+                  traceMsg(comp(), "Stores n%dn to n%dn cannot be moved together\n", pack.lanes.front().store->getGlobalIndex(),
+                     pack.lanes.back().store->getGlobalIndex());
+               continue;
+               }
+
+            if (!performTransformation(comp(), "%sPacking %d stores n%dn to n%dn in block_%d into %s (%d operations instead of %d)\n",
+                  OPT_DETAILS, static_cast<int32_t>(laneCount), pack.lanes.front().store->getGlobalIndex(),
+                  pack.lanes.back().store->getGlobalIndex(), block->getNumber(), TR::DataType::getName(vectorType),
+                  pack.vectorCost, pack.scalarCost))
+               return false;
+
+            createPack(pack);
+            return true;
+            }
+         }
+      }
+
+   return false;
+   }
+
+void
+TR::SuperwordVectorizer::collectSeeds(TR::Block *block, LaneVector &seeds)
+   {
+   for (TR::TreeTop *tt = block->getFirstRealTreeTop(); tt != block->getExit(); tt = tt->getNextTreeTop())
+      {
+      TR::Node *node = tt->getNode();
+      if (!node->getOpCode().isStoreIndirect()
+          || node->getOpCode().isWrtBar()
+          || !node->getDataType().isVectorElement()
+          || node->getSymbolReference()->isUnresolved()
+          || node->getSymbol()->isVolatile())
+         continue;
+
+      Lane lane;
+      lane.tree = tt;
+      lane.store = node;
+      getAddressBase(node, lane.base, lane.offset);
+      seeds.push_back(lane);
+      }
+   }
+
+void
+TR::SuperwordVectorizer::getAddressBase(TR::Node *access, TR::Node *&base, int64_t &offset)
+   {
+   base = access->getFirstChild();
+   offset = access->getSymbolReference()->getOffset();
+   if ((base->getOpCodeValue() == TR::aladd || base->getOpCodeValue() == TR::aiadd)
+       && base->getSecondChild()->getOpCode().isLoadConst())
+      {
+      offset += base->getSecondChild()->get64bitIntegralValue();
+      base = base->getFirstChild();
+      }
+   }
+
+// Whether the two trees compute the same value when nothing they load
+// changes in between. The distinct loads this relies on go to equatedLoads.
+bool
+TR::SuperwordVectorizer::areEquivalent(TR::Node *first, TR::Node *second, NodeVector *equatedLoads)
+   {
+   if (first == second)
+      return true;
+
+   TR::ILOpCode &opCode = first->getOpCode();
+   if (first->getOpCodeValue() != second->getOpCodeValue()
+       || first->getNumChildren() != second->getNumChildren())
+      return false;
+
+   if (opCode.isLoadConst())
+      return (first->getDataType().isIntegral() || first->getDataType() == TR::Address) && first->getConstValue() == second->getConstValue();
+
+   if (opCode.hasSymbolReference())
+      {
+      if (!(opCode.isLoadVar() || first->getOpCodeValue() == TR::loadaddr)
+          || first->getSymbolReference() != second->getSymbolReference())
+         return false;
+      }
+
+   for (int32_t i = 0; i < first->getNumChildren(); i++)
+      {
+      if (!areEquivalent(first->getChild(i), second->getChild(i), equatedLoads))
+         return false;
+      }
+
+   if (equatedLoads && opCode.isLoadVar())
+      {
+      equatedLoads->push_back(first);
+      equatedLoads->push_back(second);
+      }
+
+   return true;
+   }
+
+// Whether nodes, one per lane in lane order, compute a vector the target can
+// compute with a single operation from vectors of their children
+bool
+TR::SuperwordVectorizer::isIsomorphic(NodeVector &nodes, Pack &pack)
+   {
+   TR::Node *first = nodes[0];
+   if (first->getDataType() != pack.elementType)
+      return false;
+
+   if (isSplat(nodes, &pack.equatedLoads))
+      {
+      pack.keptNodes.push_back(first);
+      pack.vectorCost++;
+      return isSupported(TR::ILOpCode::createVectorOpCode(TR::vsplats, pack.vectorType));
+      }
+
+   // A lane value used anywhere else would still be needed as a scalar
+   for (NodeVector::iterator it = nodes.begin(); it != nodes.end(); ++it)
+      {
+      if ((*it)->getOpCodeValue() != first->getOpCodeValue() || (*it)->getReferenceCount() != 1)
+         return false;
+      }
+
+   pack.scalarCost += static_cast<int32_t>(nodes.size());
+   pack.vectorCost++;
+
+   TR::ILOpCode &opCode = first->getOpCode();
+   if (opCode.isLoadIndirect())
+      {
+      TR::Node *firstBase;
+      int64_t firstOffset;
+      getAddressBase(first, firstBase, firstOffset);
+      for (size_t lane = 0; lane < nodes.size(); lane++)
+         {
+         TR::Node *base;
+         int64_t offset;
+         getAddressBase(nodes[lane], base, offset);
+         if (nodes[lane]->getSymbolReference()->isUnresolved()
+             || nodes[lane]->getSymbol()->isVolatile()
+             || !areEquivalent(base, firstBase, &pack.equatedLoads)
+             || offset != firstOffset + static_cast<int64_t>(lane) * first->getSize())
+            return false;
+         }
+
+      pack.keptNodes.push_back(first->getFirstChild());
+      return isSupported(TR::ILOpCode::createVectorOpCode(TR::vloadi, pack.vectorType));
+      }
+
+   // Only operations that compute the same value lane by lane. Integer
+   // division can trap, shifts mask their amount differently, and floating
+   // point min and max differ on NaN and signed zeros.
+   bool isIntegral = pack.elementType.isIntegral();
+   if (!(opCode.isAdd() || opCode.isSub() || opCode.isMul() || opCode.isNeg()
+         || opCode.isAnd() || opCode.isOr() || opCode.isXor()
+         || (opCode.isDiv() && !isIntegral)
+         || ((opCode.isMax() || opCode.isMin()) && isIntegral)
+         || first->getOpCodeValue() == TR::ILOpCode::absOpCode(pack.elementType))
+       || opCode.isUnsigned())
+      return false;
+
+   if (!isSupported(TR::ILOpCode::convertScalarToVector(first->getOpCodeValue(), pack.vectorType.getVectorLength())))
+      return false;
+
+   NodeVector children((NodeAllocator(trMemory()->currentStackRegion())));
+   for (int32_t i = 0; i < first->getNumChildren(); i++)
+      {
+      children.clear();
+      for (NodeVector::iterator it = nodes.begin(); it != nodes.end(); ++it)
+         children.push_back((*it)->getChild(i));
+
+      if (!isIsomorphic(children, pack))
+         return false;
+      }
+
+   return true;
+   }
+
+// Whether every lane has the same value: the same node, equal constants, or
+// loads of the same local, which go to equatedLoads
+bool
+TR::SuperwordVectorizer::isSplat(NodeVector &nodes, NodeVector *equatedLoads)
+   {
+   TR::Node *first = nodes[0];
+   for (NodeVector::iterator it = nodes.begin() + 1; it != nodes.end(); ++it)
+      {
+      TR::Node *node = *it;
+      if (node == first)
+         continue;
+
+      if (node->getOpCodeValue() != first->getOpCodeValue())
+         return false;
+
+      if (first->getOpCode().isLoadConst())
+         {
+         bool equal = first->getDataType() == TR::Float ? first->getFloatBits() == node->getFloatBits()
+            : first->getDataType() == TR::Double ? first->getDoubleBits() == node->getDoubleBits()
+            : first->getConstValue() == node->getConstValue();
+         if (!equal)
+            return false;
+         }
+      else if (!first->getOpCode().isLoadVarDirect()
+               || !first->getSymbol()->isAutoOrParm()
+               || node->getSymbolReference() != first->getSymbolReference())
+         {
+         return false;
+         }
+      }
+
+   if (equatedLoads && first->getOpCode().isLoadVar())
+      {
+      for (NodeVector::iterator it = nodes.begin(); it != nodes.end(); ++it)
+         {
+         if (*it != first)
+            equatedLoads->push_back(*it);
+         }
+      equatedLoads->push_back(first);
+      }
+
+   return true;
+   }
+
+bool
+TR::SuperwordVectorizer::isSupported(TR::ILOpCodes op)
+   {
+   return op != TR::BadILOp && cg()->getSupportsOpCodeForAutoSIMD(TR::ILOpCode(op));
+   }
+
+bool
+TR::SuperwordVectorizer::isPackedTree(Pack &pack, TR::TreeTop *tree)
+   {
+   for (LaneVector::iterator it = pack.lanes.begin(); it != pack.lanes.end(); ++it)
+      {
+      if (it->tree == tree)
+         return true;
+      }
+   return false;
+   }
+
+static void
+markEvaluated(TR::Node *node, TR::NodeChecklist &evaluated)
+   {
+   if (evaluated.contains(node))
+      return;
+
+   evaluated.add(node);
+   for (int32_t i = 0; i < node->getNumChildren(); i++)
+      markEvaluated(node->getChild(i), evaluated);
+   }
+
+// Also collects the loads that were not evaluated before
+template <typename NodeContainer> static void
+markEvaluated(TR::Node *node, TR::NodeChecklist &evaluated, NodeContainer &loads)
+   {
+   if (evaluated.contains(node))
+      return;
+
+   evaluated.add(node);
+   if (node->getOpCode().isLoadVar())
+      loads.push_back(node);
+
+   for (int32_t i = 0; i < node->getNumChildren(); i++)
+      markEvaluated(node->getChild(i), evaluated, loads);
+   }
+
+// Whether the lanes of pack compute the same values when they all move to the
+// last of their stores
+bool
+TR::SuperwordVectorizer::isLegal(Pack &pack, TR::Block *block)
+   {
+   // Loads evaluated before a store or call that may change what they load
+   // hold an older value than a later load of the same symbol
+   TR::NodeChecklist evaluated(comp());
+   NodeVector evaluatedLoads((NodeAllocator(trMemory()->currentStackRegion())));
+   TR::NodeChecklist staleLoads(comp());
+   TR::TreeTop *tt = block->getFirstRealTreeTop();
+   for (; !isPackedTree(pack, tt); tt = tt->getNextTreeTop())
+      {
+      TR::Node *node = tt->getNode();
+      markEvaluated(node, evaluated, evaluatedLoads);
+
+      if (node->getNumChildren() > 0 && (node->getOpCodeValue() == TR::treetop || node->getOpCode().isCheck()))
+         node = node->getFirstChild();
+      if (!node->getOpCode().isStore() && !node->getOpCode().isCall())
+         continue;
+
+      for (NodeVector::iterator it = evaluatedLoads.begin(); it != evaluatedLoads.end(); ++it)
+         {
+         if (!staleLoads.contains(*it) && node->mayKill().contains((*it)->getSymbolReference(), comp()))
+            staleLoads.add(*it);
+         }
+      }
+
+   pack.firstTree = tt;
+
+   TR::NodeChecklist visited(comp());
+   NodeCountMap references((NodeCountAllocator(trMemory()->currentStackRegion())));
+   NodeVector earlierStores((NodeAllocator(trMemory()->currentStackRegion())));
+   TR_BitVector loadedLocals(comp()->getSymRefTab()->getNumSymRefs(), trMemory(), stackAlloc, growable);
+   TR_BitVector storedLocals(comp()->getSymRefTab()->getNumSymRefs(), trMemory(), stackAlloc, growable);
+
+   size_t remainingStores = pack.lanes.size();
+   for (; remainingStores > 0; tt = tt->getNextTreeTop())
+      {
+      TR::Node *node = tt->getNode();
+      if (isPackedTree(pack, tt))
+         {
+         for (int32_t i = 0; i < node->getNumChildren(); i++)
+            {
+            if (!checkPackedTree(node->getChild(i), evaluated, visited, references, earlierStores, loadedLocals, pack.equatedLoads))
+               return false;
+            }
+
+         earlierStores.push_back(node);
+         if (--remainingStores == 0)
+            pack.lastTree = tt;
+         }
+      else if (!checkIntermediateTree(node, evaluated, visited, storedLocals))
+         {
+         return false;
+         }
+      }
+
+   for (NodeVector::iterator it = pack.equatedLoads.begin(); it != pack.equatedLoads.end(); ++it)
+      {
+      if (staleLoads.contains(*it))
+         return false;
+      }
+
+   // Values first computed by the lanes must not be used anywhere else, as
+   // the vector store only computes the trees it keeps from the first lane.
+   // Those hold the same value for any use after the pack.
+   TR::NodeChecklist kept(comp());
+   for (NodeVector::iterator it = pack.keptNodes.begin(); it != pack.keptNodes.end(); ++it)
+      markEvaluated(*it, kept);
+
+   for (NodeCountMap::iterator it = references.begin(); it != references.end(); ++it)
+      {
+      if (it->first->getReferenceCount() != it->second && !kept.contains(it->first))
+         return false;
+      }
+
+   return !loadedLocals.intersects(storedLocals);
+   }
+
+// Collects what a packed tree reads, and counts its references to nodes not
+// yet evaluated when the pack starts
+bool
+TR::SuperwordVectorizer::checkPackedTree(TR::Node *node, TR::NodeChecklist &evaluated, TR::NodeChecklist &visited,
+      NodeCountMap &references, NodeVector &earlierStores, TR_BitVector &loadedLocals, NodeVector &equatedLoads)
+   {
+   if (evaluated.contains(node))
+      return true;
+
+   references[node]++;
+   if (visited.contains(node))
+      return true;
+   visited.add(node);
+
+   TR::ILOpCode &opCode = node->getOpCode();
+   if (opCode.isCall() || opCode.isStore() || node->exceptionsRaised() || node->canCauseGC())
+      return false;
+
+   if (opCode.hasSymbolReference())
+      {
+      if (node->getSymbolReference()->isUnresolved() || node->getSymbol()->isVolatile())
+         return false;
+
+      if (opCode.isLoadVar())
+         {
+         // The load happens after the stores of earlier lanes in the scalar
+         // trees, but before all of them in the vector store
+         for (NodeVector::iterator it = earlierStores.begin(); it != earlierStores.end(); ++it)
+            {
+            if (mayOverlap(*it, node, equatedLoads))
+               return false;
+            }
+
+         if (opCode.isLoadVarDirect())
+            loadedLocals.set(node->getSymbolReference()->getReferenceNumber());
+         }
+      else if (node->getOpCodeValue() != TR::loadaddr)
+         {
+         return false;
+         }
+      }
+
+   for (int32_t i = 0; i < node->getNumChildren(); i++)
+      {
+      if (!checkPackedTree(node->getChild(i), evaluated, visited, references, earlierStores, loadedLocals, equatedLoads))
+         return false;
+      }
+
+   return true;
+   }
+
+// Whether a tree between the stores of a pack can run before all of them
+bool
+TR::SuperwordVectorizer::checkIntermediateTree(TR::Node *node, TR::NodeChecklist &evaluated, TR::NodeChecklist &visited,
+      TR_BitVector &storedLocals)
+   {
+   if (evaluated.contains(node) || visited.contains(node))
+      return true;
+   visited.add(node);
+
+   TR::ILOpCode &opCode = node->getOpCode();
+   if (opCode.isCall() || node->exceptionsRaised() || node->canCauseGC())
+      return false;
+
+   if (opCode.hasSymbolReference())
+      {
+      if (!(opCode.isLoadVarDirect() || opCode.isStoreDirect() || node->getOpCodeValue() == TR::loadaddr)
+          || !node->getSymbol()->isAutoOrParm())
+         return false;
+
+      if (opCode.isStoreDirect())
+         storedLocals.set(node->getSymbolReference()->getReferenceNumber());
+      }
+   else if (opCode.isStore())
+      {
+      return false;
+      }
+
+   for (int32_t i = 0; i < node->getNumChildren(); i++)
+      {
+      if (!checkIntermediateTree(node->getChild(i), evaluated, visited, storedLocals))
+         return false;
+      }
+
+   return true;
+   }
+
+bool
+TR::SuperwordVectorizer::mayOverlap(TR::Node *store, TR::Node *load, NodeVector &equatedLoads)
+   {
+   if (load->getOpCode().isLoadIndirect())
+      {
+      TR::Node *storeBase, *loadBase;
+      int64_t storeOffset, loadOffset;
+      getAddressBase(store, storeBase, storeOffset);
+      getAddressBase(load, loadBase, loadOffset);
+      if (areEquivalent(storeBase, loadBase, &equatedLoads))
+         return storeOffset < loadOffset + load->getSize() && loadOffset < storeOffset + store->getSize();
+      }
+
+   return store->mayKill().contains(load->getSymbolReference(), comp());
+   }
+
+void
+TR::SuperwordVectorizer::createPack(Pack &pack)
+   {
+   NodeVector stores((NodeAllocator(trMemory()->currentStackRegion())));
+   NodeVector values((NodeAllocator(trMemory()->currentStackRegion())));
+   for (LaneVector::iterator it = pack.lanes.begin(); it != pack.lanes.end(); ++it)
+      {
+      stores.push_back(it->store);
+      values.push_back(it->store->getSecondChild());
+      }
+
+   TR::Node *firstStore = stores[0];
+   TR::Node *vectorStore = TR::Node::createWithSymRef(firstStore, TR::ILOpCode::createVectorOpCode(TR::vstorei, pack.vectorType), 2,
+      getVectorShadow(stores, pack));
+   vectorStore->setAndIncChild(0, createAddress(firstStore));
+   vectorStore->setAndIncChild(1, createVector(values, pack));
+   pack.lastTree->insertBefore(TR::TreeTop::create(comp(), vectorStore));
+
+   if (trace())
+      {
+      traceMsg(comp(), "Packed stores");
+      for (NodeVector::iterator it = stores.begin(); it != stores.end(); ++it)
+         traceMsg(comp(), " n%dn", (*it)->getGlobalIndex());
+      traceMsg(comp(), " into n%dn\n", vectorStore->getGlobalIndex());
+      }
+
+   // The vector store holds on to what it shares with the lanes
+   for (LaneVector::iterator it = pack.lanes.begin(); it != pack.lanes.end(); ++it)
+      it->tree->unlink(true);
+   }
+
+TR::Node *
+TR::SuperwordVectorizer::createVector(NodeVector &nodes, Pack &pack)
+   {
+   TR::Node *first = nodes[0];
+   if (isSplat(nodes))
+      return TR::Node::create(first, TR::ILOpCode::createVectorOpCode(TR::vsplats, pack.vectorType), 1, first);
+
+   if (first->getOpCode().isLoadIndirect())
+      {
+      return TR::Node::createWithSymRef(first, TR::ILOpCode::createVectorOpCode(TR::vloadi, pack.vectorType), 1,
+         createAddress(first), getVectorShadow(nodes, pack));
+      }
+
+   TR::Node *vector = TR::Node::create(first,
+      TR::ILOpCode::convertScalarToVector(first->getOpCodeValue(), pack.vectorType.getVectorLength()), first->getNumChildren());
+
+   NodeVector children((NodeAllocator(trMemory()->currentStackRegion())));
+   for (int32_t i = 0; i < first->getNumChildren(); i++)
+      {
+      children.clear();
+      for (NodeVector::iterator it = nodes.begin(); it != nodes.end(); ++it)
+         children.push_back((*it)->getChild(i));
+
+      vector->setAndIncChild(i, createVector(children, pack));
+      }
+
+   return vector;
+   }
+
+// The address the first lane of access touches, with the offset of its
+// symbol reference folded in
+TR::Node *
+TR::SuperwordVectorizer::createAddress(TR::Node *access)
+   {
+   TR::Node *address = access->getFirstChild();
+   int32_t offset = access->getSymbolReference()->getOffset();
+   if (offset == 0)
+      return address;
+
+   return comp()->target().is64Bit()
+      ? TR::Node::create(access, TR::aladd, 2, address, TR::Node::lconst(access, offset))
+      : TR::Node::create(access, TR::aiadd, 2, address, TR::Node::iconst(access, offset));
+   }
+
+// Array elements keep the array shadow of the vector type. Anything else,
+// such as the fields of a structure, uses a generic shadow that aliases with
+// every other shadow, since the vector covers several of them.
+TR::SymbolReference *
+TR::SuperwordVectorizer::getVectorShadow(NodeVector &accesses, Pack &pack)
+   {
+   TR::SymbolReferenceTable *symRefTab = comp()->getSymRefTab();
+   for (NodeVector::iterator it = accesses.begin(); it != accesses.end(); ++it)
+      {
+      if (!(*it)->getSymbol()->isArrayShadowSymbol())
+         {
+         symRefTab->aliasBuilder.setConservativeGenericIntShadowAliasing(true);
+         return symRefTab->findOrCreateGenericIntShadowSymbolReference(0);
+         }
+      }
+
+   return symRefTab->findOrCreateArrayShadowSymbolRef(pack.vectorType);
+   }
+
+const char *
+TR::SuperwordVectorizer::optDetailString() const throw()
+   {
+   return "O^O SUPERWORD VECTORIZER: ";
+   }
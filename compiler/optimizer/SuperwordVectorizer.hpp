@@ -0,0 +1,146 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef SUPERWORDVECTORIZER_INCL
+#define SUPERWORDVECTORIZER_INCL
+
+#include <stdint.h>
+#include <map>
+#include <vector>
+#include "env/TRMemory.hpp"
+#include "il/DataTypes.hpp"
+#include "il/ILOpCodes.hpp"
+#include "optimizer/Optimization.hpp"
+#include "optimizer/OptimizationManager.hpp"
+
+class TR_BitVector;
+namespace TR { class Block; }
+namespace TR { class Node; }
+namespace TR { class NodeChecklist; }
+namespace TR { class SymbolReference; }
+namespace TR { class TreeTop; }
+
+namespace TR
+{
+
+// Packs straight line scalar code into vector operations within a block.
+//
+// A pack starts from indirect stores of one element type to consecutive
+// addresses off the same base, one store per vector lane:
+//
+//    *(p + 0) = *(q + 0) * k + *(r + 0)
+//    *(p + 4) = *(q + 4) * k + *(r + 4)
+//    ...
+//
+// whose values are isomorphic: every lane applies the same operations, loads
+// from consecutive addresses in lane order, and uses the same invariant
+// operands, which are splatted. The pack becomes a single vector store in
+// place of the last of its scalar stores.
+//
+// Moving every lane there must not change what any of them reads, so the
+// trees between the stores may only compute and store locals the pack does
+// not read, and no load of the pack may see a store of an earlier lane.
+// Distinct loads the pack takes to have the same value, such as the bases of
+// different lanes, must not have been evaluated before a store that may
+// change what they load.
+//
+// The cost model counts one operation per scalar node or vector node, with
+// splats costing an operation each. A pack is only formed when it saves
+// operations.
+
+class SuperwordVectorizer : public TR::Optimization
+   {
+   public:
+
+   SuperwordVectorizer(TR::OptimizationManager *manager);
+   static TR::Optimization *create(TR::OptimizationManager *manager)
+      {
+      return new (manager->allocator()) SuperwordVectorizer(manager);
+      }
+
+   virtual int32_t perform();
+   virtual const char * optDetailString() const throw();
+
+   private:
+
+   struct Lane
+      {
+      TR::TreeTop *tree;
+      TR::Node *store;
+      TR::Node *base;                     // Address of the store less its constant offset
+      int64_t offset;
+      };
+
+   typedef TR::typed_allocator<Lane, TR::Region&> LaneAllocator;
+   typedef std::vector<Lane, LaneAllocator> LaneVector;
+   typedef TR::typed_allocator<TR::Node *, TR::Region&> NodeAllocator;
+   typedef std::vector<TR::Node *, NodeAllocator> NodeVector;
+   typedef TR::typed_allocator<std::pair<TR::Node * const, int32_t>, TR::Region&> NodeCountAllocator;
+   typedef std::map<TR::Node *, int32_t, std::less<TR::Node *>, NodeCountAllocator> NodeCountMap;
+
+   struct Pack
+      {
+      Pack(TR::Region &region)
+         : lanes(region), elementType(TR::NoType), vectorType(TR::NoType), scalarCost(0), vectorCost(0), firstTree(NULL), lastTree(NULL),
+           equatedLoads(region), keptNodes(region) {}
+
+      LaneVector lanes;                   // In lane order
+      TR::DataType elementType;
+      TR::DataType vectorType;
+      int32_t scalarCost;
+      int32_t vectorCost;
+      TR::TreeTop *firstTree;             // First and last stores of the pack in block order
+      TR::TreeTop *lastTree;
+      NodeVector equatedLoads;            // Distinct loads the pack assumes have the same value
+      NodeVector keptNodes;               // Scalar trees the vector store evaluates in place of the first lane
+      };
+
+   static bool compareLaneOffsets(const Lane &first, const Lane &second) { return first.offset < second.offset; }
+
+   bool packBlock(TR::Block *block);
+   void collectSeeds(TR::Block *block, LaneVector &seeds);
+
+   // Splits the address of access into a base and a constant byte offset,
+   // including the offset of its symbol reference
+   void getAddressBase(TR::Node *access, TR::Node *&base, int64_t &offset);
+   bool areEquivalent(TR::Node *first, TR::Node *second, NodeVector *equatedLoads = NULL);
+
+   bool isIsomorphic(NodeVector &nodes, Pack &pack);
+   bool isSplat(NodeVector &nodes, NodeVector *equatedLoads = NULL);
+   bool isSupported(TR::ILOpCodes op);
+
+   bool isPackedTree(Pack &pack, TR::TreeTop *tree);
+   bool isLegal(Pack &pack, TR::Block *block);
+   bool checkPackedTree(TR::Node *node, TR::NodeChecklist &evaluated, TR::NodeChecklist &visited,
+      NodeCountMap &references, NodeVector &earlierStores, TR_BitVector &loadedLocals, NodeVector &equatedLoads);
+   bool checkIntermediateTree(TR::Node *node, TR::NodeChecklist &evaluated, TR::NodeChecklist &visited,
+      TR_BitVector &storedLocals);
+   bool mayOverlap(TR::Node *store, TR::Node *load, NodeVector &equatedLoads);
+
+   void createPack(Pack &pack);
+   TR::Node *createVector(NodeVector &nodes, Pack &pack);
+   TR::Node *createAddress(TR::Node *access);
+   TR::SymbolReference *getVectorShadow(NodeVector &accesses, Pack &pack);
+   };
+
+}
+
+#endif // SUPERWORDVECTORIZER_INCL
@@ -362,7 +362,7 @@ void OMR::X86::AMD64::MemoryReference::assignRegisters(TR::Instruction  *current
       }
    }
 
-uint32_t OMR::X86::AMD64::MemoryReference::estimateBinaryLength(TR::CodeGenerator *cg)
+uint32_t OMR::X86::AMD64::MemoryReference::estimateBinaryLength(TR::CodeGenerator *cg, TR::Instruction *containingInstruction)
    {
    uint32_t estimate;
 
@@ -379,7 +379,7 @@ uint32_t OMR::X86::AMD64::MemoryReference::estimateBinaryLength(TR::CodeGenerato
       _addressRegister = NULL;
       }
 
-   estimate = OMR::X86::MemoryReference::estimateBinaryLength(cg);
+   estimate = OMR::X86::MemoryReference::estimateBinaryLength(cg, containingInstruction);
 
    // For [disp32], AMD64 needs a SIB byte
    //
@@ -63,7 +63,7 @@ class OMR_EXTENSIBLE MemoryReference : public OMR::X86::MemoryReference
    virtual void decNodeReferenceCounts(TR::CodeGenerator *cg);
    virtual void useRegisters(TR::Instruction  *instr, TR::CodeGenerator *cg);
    virtual void assignRegisters(TR::Instruction  *currentInstruction, TR::CodeGenerator *cg);
-   virtual uint32_t estimateBinaryLength(TR::CodeGenerator *cg);
+   virtual uint32_t estimateBinaryLength(TR::CodeGenerator *cg, TR::Instruction *containingInstruction = NULL);
    virtual uint8_t *generateBinaryEncoding(uint8_t *modRM, TR::Instruction  *containingInstruction, TR::CodeGenerator *cg);
 #endif
    TR::Register *getAddressRegister(){ return _addressRegister; }
@@ -1095,6 +1095,20 @@ bool OMR::X86::CodeGenerator::getSupportsOpCodeForAutoSIMD(TR::CPU *cpu, TR::ILO
             default:
                return false;
             }
+      case TR::mTrueCount:
+         if (!cpu->supportsFeature(OMR_FEATURE_X86_POPCNT))
+            return false;
+         // Intentional fallthrough
+      case TR::mAnyTrue:
+      case TR::mAllTrue:
+      case TR::mmAnyTrue:
+      case TR::mmAllTrue:
+      case TR::mFirstTrue:
+      case TR::mLastTrue:
+         // Reductions read every lane out of the mask bits, which needs a quadword move from an opmask past 16 lanes
+         if (cpu->supportsFeature(OMR_FEATURE_X86_AVX512F) && ot.getVectorNumLanes() > 16 && !cpu->supportsFeature(OMR_FEATURE_X86_AVX512BW))
+            return false;
+         // Intentional fallthrough
       case TR::mToLongBits:
           switch (ot.getVectorLength())
              {
@@ -1107,6 +1121,21 @@ bool OMR::X86::CodeGenerator::getSupportsOpCodeForAutoSIMD(TR::CPU *cpu, TR::ILO
              default:
                 return false;
              }
+      case TR::mLongBitsToMask:
+         if (!cpu->supportsFeature(OMR_FEATURE_X86_AVX512F))
+            return false;
+         return ot.getVectorNumLanes() <= 16 || cpu->supportsFeature(OMR_FEATURE_X86_AVX512BW);
+      case TR::vmloadi:
+      case TR::vmstorei:
+         {
+         // Masked off lanes must not be accessed, which requires AVX-512 masked moves
+         if (!cpu->supportsFeature(OMR_FEATURE_X86_AVX512F))
+            return false;
+         TR::InstOpCode movOpcode = (et == TR::Int8 || et == TR::Int16) ? TR::InstOpCode::VMOVDQU8MemReg : TR::InstOpCode::VMOVDQU32MemReg;
+         if (movOpcode.getSIMDEncoding(cpu, ot.getVectorLength()) == OMR::X86::Bad)
+            return false;
+         return (et != TR::Int8 && et != TR::Int16) || cpu->supportsFeature(OMR_FEATURE_X86_AVX512BW);
+         }
       case TR::vmabs:
          if (et.isFloatingPoint())
             return false; // Todo; Implement masked vabs for fp types
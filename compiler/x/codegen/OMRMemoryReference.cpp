@@ -947,8 +947,37 @@ OMR::X86::MemoryReference::assignRegisters(
    }
 
 
+// EVEX encodings scale an 8-bit displacement by the size of the memory operand,
+// so only multiples of that size can use the short form. Returns the scale for
+// EVEX encoded instructions, and 0 for all others.
+//
+static uint8_t
+getEvexDisplacementDivisor(TR::Instruction *containingInstruction)
+   {
+   switch (containingInstruction->getEncodingMethod())
+      {
+      case OMR::X86::EVEX_L128:
+         return 16;
+      case OMR::X86::EVEX_L256:
+         return 32;
+      case OMR::X86::EVEX_L512:
+         return 64;
+      case OMR::X86::Default:
+         if (!containingInstruction->getOpCode().info().isEvex())
+            return 0;
+         if (containingInstruction->getOpCode().info().isEvex512())
+            return 64;
+         if (containingInstruction->getOpCode().info().isEvex256())
+            return 32;
+         return 16;
+      default:
+         return 0;
+      }
+   }
+
+
 uint32_t
-OMR::X86::MemoryReference::estimateBinaryLength(TR::CodeGenerator *cg)
+OMR::X86::MemoryReference::estimateBinaryLength(TR::CodeGenerator *cg, TR::Instruction *containingInstruction)
    {
    if (self()->getBaseRegister() && toRealRegister(self()->getBaseRegister())->getRegisterNumber() == TR::RealRegister::vfp)
       {
@@ -968,6 +997,7 @@ OMR::X86::MemoryReference::estimateBinaryLength(TR::CodeGenerator *cg)
         self()->getSymbolReference().getOffset() != 0    ||
         self()->isForceWideDisplacement()) ? 4 : 0);
    uint32_t length = 0;
+   uint8_t evexDisplacementDivisor = containingInstruction ? getEvexDisplacementDivisor(containingInstruction) : 0;
 
    switch (addressTypes)
       {
@@ -1013,7 +1043,8 @@ OMR::X86::MemoryReference::estimateBinaryLength(TR::CodeGenerator *cg)
             }
          else if (displacement >= -128 &&
                   displacement <= 127  &&
-                  !self()->isForceWideDisplacement())
+                  !self()->isForceWideDisplacement() &&
+                  (evexDisplacementDivisor == 0 || displacement % evexDisplacementDivisor == 0))
             {
             length = 1;
             }
@@ -1036,7 +1067,8 @@ OMR::X86::MemoryReference::estimateBinaryLength(TR::CodeGenerator *cg)
          TR_ASSERT(IS_32BIT_SIGNED(displacement), "64-bit displacement should have been replaced in TR_AMD64MemoryReference::generateBinaryEncoding");
          if (displacement >= -128 &&
              displacement <= 127  &&
-             !self()->isForceWideDisplacement())
+             !self()->isForceWideDisplacement() &&
+             (evexDisplacementDivisor == 0 || displacement % evexDisplacementDivisor == 0))
             {
             length = 2;
             }
@@ -1151,7 +1183,7 @@ OMR::X86::MemoryReference::getBinaryLengthLowerBound(TR::CodeGenerator *cg)
    return length;
    }
 
-OMR::X86::EnlargementResult OMR::X86::MemoryReference::enlarge(TR::CodeGenerator *cg, int32_t requestedEnlargementSize, int32_t maxEnlargementSize, bool allowPartialEnlargement)
+OMR::X86::EnlargementResult OMR::X86::MemoryReference::enlarge(TR::CodeGenerator *cg, int32_t requestedEnlargementSize, int32_t maxEnlargementSize, bool allowPartialEnlargement, TR::Instruction *containingInstruction)
    {
    static char* disableMemRefExpansion = feGetEnv("TR_DisableMemRefExpansion");
    if (!disableMemRefExpansion)
@@ -1160,10 +1192,10 @@ OMR::X86::EnlargementResult OMR::X86::MemoryReference::enlarge(TR::CodeGenerator
    int32_t growth = 0;
    if (!self()->isForceWideDisplacement())
       {
-      int32_t currentEncodingAllocation = self()->estimateBinaryLength(cg);
+      int32_t currentEncodingAllocation = self()->estimateBinaryLength(cg, containingInstruction);
       int32_t currentPatchSize = self()->getBinaryLengthLowerBound(cg);
       _flags.set(MemRef_ForceWideDisplacement);
-      int32_t potentialEncodingGrowth = self()->estimateBinaryLength(cg) - currentPatchSize;
+      int32_t potentialEncodingGrowth = self()->estimateBinaryLength(cg, containingInstruction) - currentPatchSize;
       int32_t potentialPatchGrowth = self()->getBinaryLengthLowerBound(cg) - currentEncodingAllocation;
 
       if (potentialPatchGrowth > 0 &&
@@ -1176,7 +1208,7 @@ OMR::X86::EnlargementResult OMR::X86::MemoryReference::enlarge(TR::CodeGenerator
       else
          {
          _flags.reset(MemRef_ForceWideDisplacement);
-         self()->estimateBinaryLength(cg);
+         self()->estimateBinaryLength(cg, containingInstruction);
          return OMR::X86::EnlargementResult(0, 0);
          }
       }
@@ -1431,8 +1463,8 @@ OMR::X86::MemoryReference::generateBinaryEncoding(
         self()->isForceWideDisplacement()) ? 4 : 0);
 
    intptr_t displacement;
-   uint8_t displacementDivisor = 16;
-   bool isEvex = true;
+   uint8_t displacementDivisor = getEvexDisplacementDivisor(containingInstruction);
+   bool isEvex = displacementDivisor != 0;
 
    uint8_t *cursor = modRM;
    TR::RealRegister *base = NULL;
@@ -1441,26 +1473,6 @@ OMR::X86::MemoryReference::generateBinaryEncoding(
    TR::Symbol *symbol;
    uint8_t *immediateCursor = 0;
 
-   switch (containingInstruction->getEncodingMethod())
-      {
-      case OMR::X86::EVEX_L128:
-         break;
-      case OMR::X86::EVEX_L256:
-         displacementDivisor = 32;
-         break;
-      case OMR::X86::EVEX_L512:
-         displacementDivisor = 64;
-         break;
-      case OMR::X86::Default:
-         displacementDivisor = containingInstruction->getOpCode().info().isEvex256() ? 32 : displacementDivisor;
-         displacementDivisor = containingInstruction->getOpCode().info().isEvex512() ? 64 : displacementDivisor;
-         isEvex = containingInstruction->getOpCode().info().isEvex();
-         break;
-      default:
-         isEvex = false;
-         break;
-      }
-
    switch (addressTypes)
       {
       case 1:
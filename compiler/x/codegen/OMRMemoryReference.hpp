@@ -319,8 +319,10 @@ class OMR_EXTENSIBLE MemoryReference : public OMR::MemoryReference
    static int32_t getStrideForNode(TR::Node *node, TR::CodeGenerator *cg);
 
    uint32_t getBinaryLengthLowerBound(TR::CodeGenerator *cg);
-   virtual uint32_t estimateBinaryLength(TR::CodeGenerator *cg);
-   virtual OMR::X86::EnlargementResult  enlarge(TR::CodeGenerator *cg, int32_t requestedEnlargementSize, int32_t maxEnlargementSize, bool allowPartialEnlargement);
+   // The containing instruction, when known, accounts for the displacement
+   // encodings it can use
+   virtual uint32_t estimateBinaryLength(TR::CodeGenerator *cg, TR::Instruction *containingInstruction = NULL);
+   virtual OMR::X86::EnlargementResult  enlarge(TR::CodeGenerator *cg, int32_t requestedEnlargementSize, int32_t maxEnlargementSize, bool allowPartialEnlargement, TR::Instruction *containingInstruction = NULL);
 
    virtual void decNodeReferenceCounts(TR::CodeGenerator *cg);
 
@@ -5266,12 +5266,15 @@ TR::InstOpCode OMR::X86::TreeEvaluator::getNativeSIMDOpcode(TR::ILOpCodes opcode
          case TR::vdiv:
             binaryOp = BinaryArithmeticDiv;
             break;
+         case TR::vmand:
          case TR::vand:
             binaryOp = BinaryArithmeticAnd;
             break;
+         case TR::vmor:
          case TR::vor:
             binaryOp = BinaryArithmeticOr;
             break;
+         case TR::vmxor:
          case TR::vxor:
             binaryOp = BinaryArithmeticXor;
             break;
@@ -5675,16 +5678,17 @@ TR::Register* OMR::X86::TreeEvaluator::vectorBinaryArithmeticEvaluator(TR::Node*
    bool useRegMemForm = cg->comp()->target().cpu.supportsAVX() && !mask;
    bool maskTypeMismatch = false;
 
-   if (et == TR::Int8 || et == TR::Int16)
+   if (et != TR::Int32)
       {
       switch (node->getOpCode().getVectorOperation())
          {
-         case TR::vand:
-         case TR::vor:
-         case TR::vxor:
-            // There are no native opcodes meant specifically for these element types
-            // Therefore, if masking is required, we cannot use a single instruction
-            // to perform these masked bitwise operations because of the element type mismatch.
+         case TR::vmand:
+         case TR::vmor:
+         case TR::vmxor:
+            // The EVEX forms of the bitwise opcodes apply the mask to dword lanes and
+            // there are no native opcodes meant specifically for the other element types.
+            // Therefore, we cannot use a single instruction to perform these masked
+            // bitwise operations because of the element type mismatch.
             maskTypeMismatch = true;
             break;
          default:
@@ -5974,25 +5978,25 @@ OMR::X86::TreeEvaluator::bitpermuteEvaluator(TR::Node *node, TR::CodeGenerator *
 TR::Register*
 OMR::X86::TreeEvaluator::mAnyTrueEvaluator(TR::Node *node, TR::CodeGenerator *cg)
    {
-   return TR::TreeEvaluator::unImpOpEvaluator(node, cg);
+   return TR::TreeEvaluator::maskReductionEvaluator(node, cg);
    }
 
 TR::Register*
 OMR::X86::TreeEvaluator::mAllTrueEvaluator(TR::Node *node, TR::CodeGenerator *cg)
    {
-   return TR::TreeEvaluator::unImpOpEvaluator(node, cg);
+   return TR::TreeEvaluator::maskReductionEvaluator(node, cg);
    }
 
 TR::Register*
 OMR::X86::TreeEvaluator::mmAnyTrueEvaluator(TR::Node *node, TR::CodeGenerator *cg)
    {
-   return TR::TreeEvaluator::unImpOpEvaluator(node, cg);
+   return TR::TreeEvaluator::maskReductionEvaluator(node, cg);
    }
 
 TR::Register*
 OMR::X86::TreeEvaluator::mmAllTrueEvaluator(TR::Node *node, TR::CodeGenerator *cg)
    {
-   return TR::TreeEvaluator::unImpOpEvaluator(node, cg);
+   return TR::TreeEvaluator::maskReductionEvaluator(node, cg);
    }
 
 TR::Register*
@@ -6022,30 +6026,26 @@ OMR::X86::TreeEvaluator::mstoreiEvaluator(TR::Node *node, TR::CodeGenerator *cg)
 TR::Register*
 OMR::X86::TreeEvaluator::mTrueCountEvaluator(TR::Node *node, TR::CodeGenerator *cg)
    {
-   return TR::TreeEvaluator::unImpOpEvaluator(node, cg);
+   return TR::TreeEvaluator::maskReductionEvaluator(node, cg);
    }
 
 TR::Register*
 OMR::X86::TreeEvaluator::mFirstTrueEvaluator(TR::Node *node, TR::CodeGenerator *cg)
    {
-   return TR::TreeEvaluator::unImpOpEvaluator(node, cg);
+   return TR::TreeEvaluator::maskReductionEvaluator(node, cg);
    }
 
 TR::Register*
 OMR::X86::TreeEvaluator::mLastTrueEvaluator(TR::Node *node, TR::CodeGenerator *cg)
    {
-   return TR::TreeEvaluator::unImpOpEvaluator(node, cg);
+   return TR::TreeEvaluator::maskReductionEvaluator(node, cg);
    }
 
 TR::Register*
-OMR::X86::TreeEvaluator::mToLongBitsEvaluator(TR::Node *node, TR::CodeGenerator *cg)
+OMR::X86::TreeEvaluator::maskToBitsHelper(TR::Node *node, TR::Node *maskNode, TR::CodeGenerator *cg)
    {
-   TR::DataType type = node->getDataType();
-   TR::Node *maskNode = node->getFirstChild();
+   TR::DataType type = maskNode->getDataType();
    TR::Register *maskReg = cg->evaluate(maskNode);
-
-   TR_ASSERT_FATAL_WITH_NODE(node, cg->comp()->target().is64Bit(), "mToLongBitsEvaluator() only supported on 64-bit");
-
    TR::Register *resultReg = cg->allocateRegister(TR_GPR);
 
    if (maskReg->getKind() == TR_VMR)
@@ -6069,19 +6069,100 @@ OMR::X86::TreeEvaluator::mToLongBitsEvaluator(TR::Node *node, TR::CodeGenerator
             movMskOp = TR::InstOpCode::MOVMSKPSRegReg;
             break;
          case TR::Int16:
-            TR_ASSERT_FATAL(false, "Int16 element type not supported mToLongBitsEvaluator");
+            TR_ASSERT_FATAL(false, "Int16 element type not supported maskToBitsHelper");
          case TR::Int8:
             movMskOp = TR::InstOpCode::PMOVMSKB4RegReg;
             break;
          default:
-            TR_ASSERT_FATAL(false, "Unexpected element type for mToLongBitsEvaluator");
+            TR_ASSERT_FATAL(false, "Unexpected element type for maskToBitsHelper");
          }
       OMR::X86::Encoding movMskEncoding = movMskOp.getSIMDEncoding(&cg->comp()->target().cpu, type.getVectorLength());
-      TR_ASSERT_FATAL(movMskEncoding != OMR::X86::Bad, "Unsupported movmsk opcode in mToLongBitsEvaluator");
+      TR_ASSERT_FATAL(movMskEncoding != OMR::X86::Bad, "Unsupported movmsk opcode in maskToBitsHelper");
 
       generateRegRegInstruction(movMskOp.getMnemonic(), node, resultReg, maskReg, cg, movMskEncoding);
       }
 
+   return resultReg;
+   }
+
+TR::Register*
+OMR::X86::TreeEvaluator::maskReductionEvaluator(TR::Node *node, TR::CodeGenerator *cg)
+   {
+   TR::Node *maskNode = node->getFirstChild();
+   TR::Node *secondMaskNode = node->getOpCode().isVectorMasked() ? node->getSecondChild() : NULL;
+   int32_t numLanes = maskNode->getDataType().getVectorNumLanes();
+
+   TR_ASSERT_FATAL_WITH_NODE(node, cg->comp()->target().is64Bit(), "maskReductionEvaluator() only supported on 64-bit");
+
+   // Bits above the last lane are always clear, so every reduction works on the
+   // low numLanes bits of a general purpose register
+   TR::Register *bitsReg = maskToBitsHelper(node, maskNode, cg);
+   TR::Register *resultReg = bitsReg;
+
+   if (secondMaskNode)
+      {
+      TR::Register *secondBitsReg = maskToBitsHelper(node, secondMaskNode, cg);
+      generateRegRegInstruction(TR::InstOpCode::AND8RegReg, node, bitsReg, secondBitsReg, cg);
+      cg->stopUsingRegister(secondBitsReg);
+      }
+
+   switch (node->getOpCode().getVectorOperation())
+      {
+      case TR::mAnyTrue:
+      case TR::mmAnyTrue:
+         generateRegRegInstruction(TR::InstOpCode::TEST8RegReg, node, bitsReg, bitsReg, cg);
+         generateRegInstruction(TR::InstOpCode::SETNE1Reg, node, bitsReg, cg);
+         generateRegRegInstruction(TR::InstOpCode::MOVZXReg4Reg1, node, bitsReg, bitsReg, cg);
+         break;
+      case TR::mAllTrue:
+      case TR::mmAllTrue:
+         if (numLanes > 32)
+            generateRegImmInstruction(TR::InstOpCode::CMP8RegImms, node, bitsReg, -1, cg);
+         else
+            generateRegImmInstruction(TR::InstOpCode::CMP4RegImm4, node, bitsReg, static_cast<int32_t>((static_cast<uint64_t>(1) << numLanes) - 1), cg);
+         generateRegInstruction(TR::InstOpCode::SETE1Reg, node, bitsReg, cg);
+         generateRegRegInstruction(TR::InstOpCode::MOVZXReg4Reg1, node, bitsReg, bitsReg, cg);
+         break;
+      case TR::mTrueCount:
+         TR_ASSERT_FATAL_WITH_NODE(node, cg->comp()->target().cpu.supportsFeature(OMR_FEATURE_X86_POPCNT), "mTrueCount requires POPCNT");
+         generateRegRegInstruction(TR::InstOpCode::POPCNT8RegReg, node, bitsReg, bitsReg, cg);
+         break;
+      case TR::mFirstTrue:
+      case TR::mLastTrue:
+         {
+         // The bit scan leaves ZF set when no lane is, and the result keeps the
+         // lane count for mFirstTrue or -1 for mLastTrue
+         bool isFirst = node->getOpCode().getVectorOperation() == TR::mFirstTrue;
+         resultReg = cg->allocateRegister(TR_GPR);
+         generateRegImmInstruction(TR::InstOpCode::MOV8RegImm4, node, resultReg, isFirst ? numLanes : -1, cg);
+         generateRegRegInstruction(isFirst ? TR::InstOpCode::BSF8RegReg : TR::InstOpCode::BSR8RegReg, node, bitsReg, bitsReg, cg);
+         generateRegRegInstruction(TR::InstOpCode::CMOVNE8RegReg, node, resultReg, bitsReg, cg);
+         cg->stopUsingRegister(bitsReg);
+         break;
+         }
+      default:
+         TR_ASSERT_FATAL_WITH_NODE(node, false, "Unexpected mask reduction opcode");
+         break;
+      }
+
+   node->setRegister(resultReg);
+   cg->decReferenceCount(maskNode);
+
+   if (secondMaskNode)
+      cg->decReferenceCount(secondMaskNode);
+
+   return resultReg;
+   }
+
+TR::Register*
+OMR::X86::TreeEvaluator::mToLongBitsEvaluator(TR::Node *node, TR::CodeGenerator *cg)
+   {
+   TR::Node *maskNode = node->getFirstChild();
+
+   TR_ASSERT_FATAL_WITH_NODE(node, cg->comp()->target().is64Bit(), "mToLongBitsEvaluator() only supported on 64-bit");
+
+   TR::Register *resultReg = maskToBitsHelper(node, maskNode, cg);
+
    node->setRegister(resultReg);
    cg->decReferenceCount(maskNode);
 
@@ -6091,7 +6172,37 @@ OMR::X86::TreeEvaluator::mToLongBitsEvaluator(TR::Node *node, TR::CodeGenerator
 TR::Register*
 OMR::X86::TreeEvaluator::mLongBitsToMaskEvaluator(TR::Node *node, TR::CodeGenerator *cg)
    {
-   return TR::TreeEvaluator::unImpOpEvaluator(node, cg);
+   TR::Node *valueNode = node->getFirstChild();
+   int32_t numLanes = node->getDataType().getVectorNumLanes();
+
+   TR_ASSERT_FATAL_WITH_NODE(node, cg->comp()->target().is64Bit(), "mLongBitsToMaskEvaluator() only supported on 64-bit");
+   TR_ASSERT_FATAL_WITH_NODE(node, cg->comp()->target().cpu.supportsFeature(OMR_FEATURE_X86_AVX512F), "mLongBitsToMaskEvaluator() requires AVX-512");
+
+   TR::Register *valueReg = cg->evaluate(valueNode);
+   TR::Register *bitsReg = cg->allocateRegister(TR_GPR);
+   TR::Register *resultReg = cg->allocateRegister(TR_VMR);
+
+   // Mask reductions rely on the bits above the last lane being clear
+   generateRegRegInstruction(numLanes > 32 ? TR::InstOpCode::MOV8RegReg : TR::InstOpCode::MOV4RegReg, node, bitsReg, valueReg, cg);
+
+   if (numLanes < 32)
+      generateRegImmInstruction(TR::InstOpCode::AND4RegImm4, node, bitsReg, (1 << numLanes) - 1, cg);
+
+   if (numLanes > 16)
+      {
+      TR_ASSERT_FATAL_WITH_NODE(node, cg->comp()->target().cpu.supportsFeature(OMR_FEATURE_X86_AVX512BW), "Masks wider than 16 lanes require AVX-512BW");
+      generateRegRegInstruction(TR::InstOpCode::KMOVQMaskReg, node, resultReg, bitsReg, cg);
+      }
+   else
+      {
+      generateRegRegInstruction(TR::InstOpCode::KMOVWMaskReg, node, resultReg, bitsReg, cg);
+      }
+
+   cg->stopUsingRegister(bitsReg);
+   node->setRegister(resultReg);
+   cg->decReferenceCount(valueNode);
+
+   return resultReg;
    }
 
 TR::Register*
@@ -6593,40 +6704,33 @@ OMR::X86::TreeEvaluator::binaryVectorMaskHelper(TR::InstOpCode opcode,
    {
    TR_ASSERT_FATAL(encoding != OMR::X86::Bad, "No suitable encoding method for opcode");
    bool vectorMask = maskReg->getKind() == TR_VRF;
-   TR::Register *tmpReg = vectorMask ? cg->allocateRegister(TR_VRF) : NULL;
+   TR::InstOpCode movOpcode = TR::InstOpCode::MOVDQURegReg;
+   OMR::X86::Encoding movEncoding = movOpcode.getSIMDEncoding(&cg->comp()->target().cpu, node->getDataType().getVectorLength());
 
-   if (vectorMask)
-      {
-      generateRegRegInstruction(TR::InstOpCode::MOVDQURegReg, node, resultReg, lhsReg, cg, encoding);
-      }
+   generateRegRegInstruction(movOpcode.getMnemonic(), node, resultReg, lhsReg, cg, movEncoding);
 
-   if (encoding == OMR::X86::Legacy)
-      {
-      generateRegRegInstruction(TR::InstOpCode::MOVDQURegReg, node, tmpReg, lhsReg, cg);
-      generateRegRegInstruction(opcode.getMnemonic(), node, tmpReg, rhsReg, cg, encoding);
-      TR_ASSERT_FATAL(vectorMask, "Native vector masking not supported");
-      vectorMergeMaskHelper(node, resultReg, tmpReg, maskReg, cg);
-      cg->stopUsingRegister(tmpReg);
-      return resultReg;
-      }
-   else if (vectorMask && maskTypeMismatch)
+   if (vectorMask || maskTypeMismatch)
       {
-      generateRegRegRegInstruction(opcode.getMnemonic(), node, tmpReg, lhsReg, rhsReg, cg, encoding);
+      // The operation cannot be masked natively, so the unmasked result
+      // is merged into the left operand instead
+      TR::Register *tmpReg = cg->allocateRegister(TR_VRF);
+
+      if (encoding == OMR::X86::Legacy)
+         {
+         TR_ASSERT_FATAL(vectorMask, "Native vector masking not supported");
+         generateRegRegInstruction(TR::InstOpCode::MOVDQURegReg, node, tmpReg, lhsReg, cg);
+         generateRegRegInstruction(opcode.getMnemonic(), node, tmpReg, rhsReg, cg, encoding);
+         }
+      else
+         {
+         generateRegRegRegInstruction(opcode.getMnemonic(), node, tmpReg, lhsReg, rhsReg, cg, encoding);
+         }
+
       vectorMergeMaskHelper(node, resultReg, tmpReg, maskReg, cg);
       cg->stopUsingRegister(tmpReg);
-      return resultReg;
-      }
-   else if (vectorMask)
-      {
-      generateRegMaskRegRegInstruction(opcode.getMnemonic(), node, tmpReg, maskReg, lhsReg, rhsReg, cg, encoding);
-      cg->stopUsingRegister(tmpReg);
-      return resultReg;
       }
    else
       {
-      TR::InstOpCode movOpcode = TR::InstOpCode::MOVDQURegReg;
-      OMR::X86::Encoding movEncoding = movOpcode.getSIMDEncoding(&cg->comp()->target().cpu, node->getDataType().getVectorLength());
-      generateRegRegInstruction(movOpcode.getMnemonic(), node, resultReg, lhsReg, cg, movEncoding);
       generateRegMaskRegRegInstruction(opcode.getMnemonic(), node, resultReg, maskReg, lhsReg, rhsReg, cg, encoding);
       }
 
@@ -7071,7 +7175,7 @@ OMR::X86::TreeEvaluator::vmaddEvaluator(TR::Node *node, TR::CodeGenerator *cg)
 TR::Register*
 OMR::X86::TreeEvaluator::vmandEvaluator(TR::Node *node, TR::CodeGenerator *cg)
    {
-   return TR::TreeEvaluator::unImpOpEvaluator(node, cg);
+   return TR::TreeEvaluator::vectorBinaryArithmeticEvaluator(node, cg);
    }
 
 TR::Register*
@@ -7131,7 +7235,7 @@ OMR::X86::TreeEvaluator::vmindexVectorEvaluator(TR::Node *node, TR::CodeGenerato
 TR::Register*
 OMR::X86::TreeEvaluator::vmloadiEvaluator(TR::Node *node, TR::CodeGenerator *cg)
    {
-   return TR::TreeEvaluator::unImpOpEvaluator(node, cg);
+   return TR::TreeEvaluator::SIMDloadEvaluator(node, cg);
    }
 
 TR::Register*
@@ -7167,7 +7271,7 @@ OMR::X86::TreeEvaluator::vmnotEvaluator(TR::Node *node, TR::CodeGenerator *cg)
 TR::Register*
 OMR::X86::TreeEvaluator::vmorEvaluator(TR::Node *node, TR::CodeGenerator *cg)
    {
-   return TR::TreeEvaluator::unImpOpEvaluator(node, cg);
+   return TR::TreeEvaluator::vectorBinaryArithmeticEvaluator(node, cg);
    }
 
 TR::Register*
@@ -7239,7 +7343,7 @@ OMR::X86::TreeEvaluator::vmsqrtEvaluator(TR::Node *node, TR::CodeGenerator *cg)
 TR::Register*
 OMR::X86::TreeEvaluator::vmstoreiEvaluator(TR::Node *node, TR::CodeGenerator *cg)
    {
-   return TR::TreeEvaluator::unImpOpEvaluator(node, cg);
+   return TR::TreeEvaluator::SIMDstoreEvaluator(node, cg);
    }
 
 TR::Register*
@@ -7251,7 +7355,7 @@ OMR::X86::TreeEvaluator::vmsubEvaluator(TR::Node *node, TR::CodeGenerator *cg)
 TR::Register*
 OMR::X86::TreeEvaluator::vmxorEvaluator(TR::Node *node, TR::CodeGenerator *cg)
    {
-   return TR::TreeEvaluator::unImpOpEvaluator(node, cg);
+   return TR::TreeEvaluator::vectorBinaryArithmeticEvaluator(node, cg);
    }
 
 TR::Register*
@@ -425,6 +425,9 @@ class OMR_EXTENSIBLE TreeEvaluator: public OMR::TreeEvaluator
    static TR::Register *vectorMergeMaskHelper(TR::Node *node, TR::VectorLength vl, TR::DataType dt, TR::Register *resultReg, TR::Register *srcReg, TR::Register *maskReg, TR::CodeGenerator *cg, bool zeroMask = false);
    static TR::Register *vectorMergeMaskHelper(TR::Node *node, TR::Register *resultReg, TR::Register *srcReg, TR::Register *maskReg, TR::CodeGenerator *cg, bool zeroMask = false);
    static TR::Register *arrayToVectorMaskHelper(TR::Node *node, TR::CodeGenerator *cg);
+   // Returns a GPR holding one bit per lane of the mask, lane 0 in the lowest bit
+   static TR::Register *maskToBitsHelper(TR::Node *node, TR::Node *maskNode, TR::CodeGenerator *cg);
+   static TR::Register *maskReductionEvaluator(TR::Node *node, TR::CodeGenerator *cg);
 
    // For unary ILOpcodes that can be translated to a single SSE/AVX instruction
    static TR::Register *unaryVectorArithmeticEvaluator(TR::Node *node, TR::CodeGenerator *cg);
@@ -190,9 +190,51 @@ TR::Register* OMR::X86::TreeEvaluator::SIMDloadEvaluator(TR::Node* node, TR::Cod
 TR::Register* OMR::X86::TreeEvaluator::SIMDstoreEvaluator(TR::Node* node, TR::CodeGenerator* cg)
    {
    TR::Node* valueNode = node->getChild(node->getOpCode().isIndirect() ? 1 : 0);
+   TR::Node* maskNode = node->getOpCode().isVectorMasked() ? node->getChild(2) : NULL;
    TR::MemoryReference* tempMR = generateX86MemoryReference(node, cg);
    tempMR = ConvertToPatchableMemoryReference(tempMR, node, cg);
    TR::Register* valueReg = cg->evaluate(valueNode);
+   TR::Register* maskReg = maskNode ? cg->evaluate(maskNode) : NULL;
+
+   if (maskReg)
+      {
+      // Lanes outside of the mask must not be written, so only native masking can be used
+      TR_ASSERT_FATAL_WITH_NODE(node, maskReg->getKind() == TR_VMR, "Masked vector stores require an AVX-512 mask register");
+      TR::InstOpCode maskedOpCode = TR::InstOpCode::bad;
+
+      switch (node->getDataType().getVectorElementType())
+         {
+         case TR::Int8:
+            maskedOpCode = TR::InstOpCode::VMOVDQU8MemReg;
+            break;
+         case TR::Int16:
+            maskedOpCode = TR::InstOpCode::VMOVDQU16MemReg;
+            break;
+         case TR::Int32:
+         case TR::Float:
+            maskedOpCode = TR::InstOpCode::VMOVDQU32MemReg;
+            break;
+         case TR::Int64:
+         case TR::Double:
+            maskedOpCode = TR::InstOpCode::VMOVDQU64MemReg;
+            break;
+         default:
+            TR_ASSERT_FATAL(0, "Unsupported element type for masking");
+            break;
+         }
+
+      OMR::X86::Encoding maskedEncoding = maskedOpCode.getSIMDEncoding(&cg->comp()->target().cpu, node->getDataType().getVectorLength());
+      TR_ASSERT_FATAL(maskedEncoding != OMR::X86::Bad, "No encoding method for masked vector store");
+
+      TR::Instruction* instr = generateMemMaskRegInstruction(maskedOpCode.getMnemonic(), node, tempMR, maskReg, valueReg, cg, maskedEncoding);
+
+      cg->decReferenceCount(valueNode);
+      cg->decReferenceCount(maskNode);
+      tempMR->decNodeReferenceCounts(cg);
+      if (node->getOpCode().isIndirect())
+         cg->setImplicitExceptionPoint(instr);
+      return NULL;
+      }
 
    TR::InstOpCode::Mnemonic opCode = TR::InstOpCode::MOVDQUMemReg;
    OMR::X86::Encoding encoding = Legacy;
@@ -2287,7 +2287,7 @@ int32_t TR::X86MemInstruction::estimateBinaryLength(int32_t currentEstimate)
    if (getOpCode().needsLockPrefix() || (barrier & LockPrefix))
       length++;
 
-   length += getMemoryReference()->estimateBinaryLength(cg());
+   length += getMemoryReference()->estimateBinaryLength(cg(), this);
 
    if (barrier & NeedsExplicitBarrier)
       length += estimateMemoryBarrierBinaryLength(barrier, cg());
@@ -2307,7 +2307,7 @@ TR::X86MemInstruction::enlarge(int32_t requestedEnlargementSize, int32_t maxEnla
       return OMR::X86::EnlargementResult(0, 0);
 
    OMR::X86::EnlargementResult result = getMemoryReference()->enlarge(cg(), requestedEnlargementSize,
-                                                          maxEnlargementSize, allowPartialEnlargement);
+                                                          maxEnlargementSize, allowPartialEnlargement, this);
    if (result.getEncodingGrowth() > 0)
       setEstimatedBinaryLength(getEstimatedBinaryLength() + result.getEncodingGrowth());
 
@@ -2473,7 +2473,7 @@ uint8_t TR::X86MemImmInstruction::getBinaryLengthLowerBound()
 
 int32_t TR::X86MemImmInstruction::estimateBinaryLength(int32_t currentEstimate)
    {
-   int32_t length = getMemoryReference()->estimateBinaryLength(cg());
+   int32_t length = getMemoryReference()->estimateBinaryLength(cg(), this);
 
    int32_t barrier = memoryBarrierRequired(getOpCode(), getMemoryReference(), cg(), false);
 
@@ -2766,7 +2766,7 @@ uint8_t TR::X86MemRegImmInstruction::getBinaryLengthLowerBound()
 
 int32_t TR::X86MemRegImmInstruction::estimateBinaryLength(int32_t currentEstimate)
    {
-   int32_t length = getMemoryReference()->estimateBinaryLength(cg());
+   int32_t length = getMemoryReference()->estimateBinaryLength(cg(), this);
 
    int32_t barrier = memoryBarrierRequired(getOpCode(), getMemoryReference(), cg(), false);
 
@@ -2836,7 +2836,7 @@ int32_t TR::X86RegMemInstruction::estimateBinaryLength(int32_t currentEstimate)
    {
    int32_t barrier = memoryBarrierRequired(getOpCode(), getMemoryReference(), cg(), false);
 
-   int32_t length = getMemoryReference()->estimateBinaryLength(cg());
+   int32_t length = getMemoryReference()->estimateBinaryLength(cg(), this);
 
    if (barrier & LockPrefix)
       length++;
@@ -2858,7 +2858,7 @@ TR::X86RegMemInstruction::enlarge(int32_t requestedEnlargementSize, int32_t maxE
       return OMR::X86::EnlargementResult(0, 0);
 
    OMR::X86::EnlargementResult result = getMemoryReference()->enlarge(cg(), requestedEnlargementSize,
-                                                          maxEnlargementSize, allowPartialEnlargement);
+                                                          maxEnlargementSize, allowPartialEnlargement, this);
    if (result.getEncodingGrowth() > 0)
       setEstimatedBinaryLength(getEstimatedBinaryLength() + result.getEncodingGrowth());
    return result;
@@ -2989,7 +2989,7 @@ int32_t TR::X86RegMemImmInstruction::estimateBinaryLength(int32_t currentEstimat
    {
    int32_t barrier = memoryBarrierRequired(getOpCode(), getMemoryReference(), cg(), false);
 
-   int32_t length = getMemoryReference()->estimateBinaryLength(cg());
+   int32_t length = getMemoryReference()->estimateBinaryLength(cg(), this);
 
    if (barrier & LockPrefix)
       length++;
@@ -77,8 +77,15 @@ public:
 	void
 	verifyHeap(MM_EnvironmentBase *env, MM_MarkMap *markMap) { }
 
-	void
-	fixupRoots(MM_EnvironmentBase *env, MM_CompactScheme *compactScheme) { }
+	/**
+	 * Update the example VM's root table, thread saved objects and object table to refer to
+	 * the new locations of the objects they hold. Dead objects have already been removed from
+	 * the object table when marking completed.
+	 *
+	 * @param env calling thread environment
+	 * @param compactScheme the compact scheme holding forwarding information
+	 */
+	void fixupRoots(MM_EnvironmentBase *env, MM_CompactScheme *compactScheme);
 
 	void
 	workerCleanupAfterGC(MM_EnvironmentBase *env) { }
@@ -87,9 +94,9 @@ public:
 	mainSetupForGC(MM_EnvironmentBase *env) { }
 
 	MM_CompactDelegate()
-		: _compactScheme(NULL)
+		: _omrVM(NULL)
+		, _compactScheme(NULL)
 		, _markMap(NULL)
-		, _omrVM(NULL)
 	{}
 };
 
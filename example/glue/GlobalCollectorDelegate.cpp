@@ -20,3 +20,33 @@
  *******************************************************************************/
 
 #include "GlobalCollectorDelegate.hpp"
+
+#include "GCExtensionsBase.hpp"
+#include "MarkingScheme.hpp"
+#if defined(OMR_GC_MODRON_SCAVENGER)
+#include "SublistIterator.hpp"
+#include "SublistPuddle.hpp"
+#include "SublistSlotIterator.hpp"
+#endif /* OMR_GC_MODRON_SCAVENGER */
+
+void
+MM_GlobalCollectorDelegate::postMarkProcessing(MM_EnvironmentBase *env)
+{
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	if (_extensions->scavengerEnabled && !_extensions->isScavengerRememberedSetInOverflowState()) {
+		/* Dead remembered objects would otherwise be scanned by the next scavenge after they have been swept */
+		MM_SublistPuddle *puddle = NULL;
+		GC_SublistIterator remSetIterator(&_extensions->rememberedSet);
+		while (NULL != (puddle = remSetIterator.nextList())) {
+			omrobjectptr_t *slotPtr = NULL;
+			GC_SublistSlotIterator remSetSlotIterator(puddle);
+			while (NULL != (slotPtr = (omrobjectptr_t *)remSetSlotIterator.nextSlot())) {
+				omrobjectptr_t objectPtr = *slotPtr;
+				if ((NULL == objectPtr) || !_markingScheme->isMarked(objectPtr)) {
+					remSetSlotIterator.removeSlot();
+				}
+			}
+		}
+	}
+#endif /* OMR_GC_MODRON_SCAVENGER */
+}
@@ -93,15 +93,15 @@ public:
 	void mainThreadGarbageCollectStarted(MM_EnvironmentBase *env) {}
 
 	/**
-	 * Called on GC main thread during a global collection. This is informational,
-	 * no specific actions are specified for this method.
+	 * Called on GC main thread during a global collection.
 	 *
 	 * This is called on the main thread when the marking phase of the collection is complete
-	 * and before the sweeping phase commences.
+	 * and before the sweeping phase commences. Remembered set entries for objects that were
+	 * not marked are removed here, since the sweep is about to reclaim those objects.
 	 *
 	 * @param env environment for calling thread
 	 */
-	void postMarkProcessing(MM_EnvironmentBase *env) {}
+	void postMarkProcessing(MM_EnvironmentBase *env);
 
 	/**
 	 * Called on GC main thread near the end of a global collection. This is informational,
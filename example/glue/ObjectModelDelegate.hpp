@@ -221,6 +221,20 @@ public:
 	{
 		return U_8_MAX;
 	}
+
+	/**
+	 * Returns a key identifying the class of an object for scavenger hot field sampling.
+	 * Example objects have no class, all slots of an object are references, so the size
+	 * of the object determines its layout.
+	 *
+	 * @param objectPtr pointer to the object
+	 * @return a non-zero key for the class of the object, or 0 if the object should not be profiled
+	 */
+	MMINLINE uintptr_t
+	getHotFieldProfileKey(omrobjectptr_t objectPtr)
+	{
+		return getObjectSizeInBytesWithHeader(objectPtr);
+	}
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC) */
 
 	/**
@@ -0,0 +1,364 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "JitTest.hpp"
+#include "default_compiler.hpp"
+#include "il/Node.hpp"
+#include "infra/ILWalk.hpp"
+#include "ras/IlVerifier.hpp"
+#include "ras/IlVerifierHelpers.hpp"
+
+#include <vector>
+
+/**
+ * This Verifier checks that the loop was replaced by the expected opcode.
+ */
+class ContainsOpCodeIlVerifier : public TR::IlVerifier
+   {
+   public:
+   ContainsOpCodeIlVerifier(TR::ILOpCodes opCode) : _opCode(opCode) {}
+
+   int32_t verify(TR::ResolvedMethodSymbol *sym)
+      {
+      for(TR::PreorderNodeIterator iter(sym->getFirstTreeTop(), sym->comp()); iter.currentTree(); ++iter)
+         {
+         if (iter.currentNode()->getOpCodeValue() == _opCode)
+            return 0;
+         }
+
+      return 1;
+      }
+
+   private:
+   TR::ILOpCodes _opCode;
+   };
+
+/**
+ * Test Fixture for LoopIdiomRecognizerTest that runs only idiom recognition
+ */
+class LoopIdiomRecognizerTest : public TRTest::JitOptTest
+   {
+
+   public:
+   LoopIdiomRecognizerTest()
+      {
+      addOptimization(OMR::idiomRecognition);
+      }
+
+   };
+
+/*
+ * method(int8_t *buffer, int32_t n, int32_t value)
+ *   int i = 0;
+ *   do {
+ *      buffer[i] = (int8_t)value;
+ *      i++;
+ *   } while (i < n);
+ *   return i;
+ */
+TEST_F(LoopIdiomRecognizerTest, FillLoopBecomesArrayset) {
+    SKIP_ON_ARM(MissingImplementation);
+    SKIP_ON_RISCV(MissingImplementation);
+
+    auto* inputTrees = "(method return=Int32 args=[Address, Int32, Int32]  "
+                       " (block                                            "
+                       "  (istore temp=\"i\" (iconst 0)))                  "
+                       " (block name=\"loop\"                              "
+                       "  (bstorei offset=0                                "
+                       "   (aladd (aload parm=0) (i2l (iload temp=\"i\"))) "
+                       "   (i2b (iload parm=2)))                           "
+                       "  (istore temp=\"i\" (iadd (iload temp=\"i\") (iconst 1))) "
+                       "  (ificmplt target=\"loop\" (iload temp=\"i\") (iload parm=1))) "
+                       " (block                                            "
+                       "  (ireturn (iload temp=\"i\"))))                   ";
+
+    auto trees = parseString(inputTrees);
+
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    ContainsOpCodeIlVerifier verifier(TR::arrayset);
+
+    ASSERT_EQ(0, compiler.compileWithVerifier(&verifier)) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+    auto entry_point = compiler.getEntryPoint<int32_t (*)(int8_t *, int32_t, int32_t)>();
+
+    std::vector<int8_t> buffer(128, 0);
+    EXPECT_EQ(100, entry_point(&buffer[0], 100, 0x5c));
+    for (size_t i = 0; i < buffer.size(); i++)
+       EXPECT_EQ(i < 100 ? 0x5c : 0, buffer[i]) << "at index " << i;
+
+    // The body of a bottom tested loop runs at least once
+    std::vector<int8_t> single(4, 0);
+    EXPECT_EQ(1, entry_point(&single[0], -5, 7));
+    EXPECT_EQ(7, single[0]);
+    EXPECT_EQ(0, single[1]);
+}
+
+/*
+ * method(int32_t *buffer, int64_t n, int32_t value)
+ *   long i = 2;
+ *   do {
+ *      buffer[i + 1] = value;
+ *      i++;
+ *   } while (i < n);
+ *   return i;
+ */
+TEST_F(LoopIdiomRecognizerTest, FillLoopOfIntsBecomesArrayset) {
+    SKIP_ON_ARM(MissingImplementation);
+    SKIP_ON_RISCV(MissingImplementation);
+
+    auto* inputTrees = "(method return=Int64 args=[Address, Int64, Int32]  "
+                       " (block                                            "
+                       "  (lstore temp=\"i\" (lconst 2)))                  "
+                       " (block name=\"loop\"                              "
+                       "  (istorei offset=4                                "
+                       "   (aladd (aload parm=0) (lmul (lload temp=\"i\") (lconst 4))) "
+                       "   (iload parm=2))                                 "
+                       "  (lstore temp=\"i\" (ladd (lload temp=\"i\") (lconst 1))) "
+                       "  (iflcmplt target=\"loop\" (lload temp=\"i\") (lload parm=1))) "
+                       " (block                                            "
+                       "  (lreturn (lload temp=\"i\"))))                   ";
+
+    auto trees = parseString(inputTrees);
+
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    ContainsOpCodeIlVerifier verifier(TR::arrayset);
+
+    ASSERT_EQ(0, compiler.compileWithVerifier(&verifier)) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+    auto entry_point = compiler.getEntryPoint<int64_t (*)(int32_t *, int64_t, int32_t)>();
+
+    std::vector<int32_t> buffer(40, 0);
+    EXPECT_EQ(33, entry_point(&buffer[0], 33, -123456));
+    for (size_t i = 0; i < buffer.size(); i++)
+       EXPECT_EQ((i >= 3 && i < 34) ? -123456 : 0, buffer[i]) << "at index " << i;
+}
+
+/*
+ * A stored value that changes every iteration is not a fill
+ */
+TEST_F(LoopIdiomRecognizerTest, VaryingStoreIsNotAFill) {
+    auto* inputTrees = "(method return=Int32 args=[Address, Int32]         "
+                       " (block                                            "
+                       "  (istore temp=\"i\" (iconst 0)))                  "
+                       " (block name=\"loop\"                              "
+                       "  (bstorei offset=0                                "
+                       "   (aladd (aload parm=0) (i2l (iload temp=\"i\"))) "
+                       "   (i2b (iload temp=\"i\")))                       "
+                       "  (istore temp=\"i\" (iadd (iload temp=\"i\") (iconst 1))) "
+                       "  (ificmplt target=\"loop\" (iload temp=\"i\") (iload parm=1))) "
+                       " (block                                            "
+                       "  (ireturn (iload temp=\"i\"))))                   ";
+
+    auto trees = parseString(inputTrees);
+
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    ContainsOpCodeIlVerifier verifier(TR::arrayset);
+
+    ASSERT_NE(0, compiler.compileWithVerifier(&verifier))
+       << "Loop storing the induction variable was reduced to a fill";
+}
+
+/*
+ * method(int32_t *dst, int32_t *src, int32_t n)
+ *   int i = 0;
+ *   do {
+ *      dst[i] = src[i];
+ *      i++;
+ *   } while (i < n);
+ *   return i;
+ */
+static const char *copyLoopTrees =
+    "(method return=Int32 args=[Address, Address, Int32]                  "
+    " (block                                                              "
+    "  (istore temp=\"i\" (iconst 0)))                                    "
+    " (block name=\"loop\"                                                "
+    "  (istorei offset=0                                                  "
+    "   (aladd (aload parm=0) (lshl (i2l (iload temp=\"i\")) (iconst 2))) "
+    "   (iloadi offset=0                                                  "
+    "    (aladd (aload parm=1) (lshl (i2l (iload temp=\"i\")) (iconst 2))))) "
+    "  (istore temp=\"i\" (iadd (iload temp=\"i\") (iconst 1)))           "
+    "  (ificmplt target=\"loop\" (iload temp=\"i\") (iload parm=2)))      "
+    " (block                                                              "
+    "  (ireturn (iload temp=\"i\"))))                                     ";
+
+TEST_F(LoopIdiomRecognizerTest, CopyLoopBecomesArraycopy) {
+    SKIP_ON_AARCH64(MissingImplementation);
+    SKIP_ON_RISCV(MissingImplementation);
+
+    auto trees = parseString(copyLoopTrees);
+
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    ContainsOpCodeIlVerifier verifier(TR::arraycopy);
+
+    ASSERT_EQ(0, compiler.compileWithVerifier(&verifier)) << "Compilation failed unexpectedly\n" << "Input trees: " << copyLoopTrees;
+
+    auto entry_point = compiler.getEntryPoint<int32_t (*)(int32_t *, int32_t *, int32_t)>();
+
+    std::vector<int32_t> src(64);
+    std::vector<int32_t> dst(64, -1);
+    for (size_t i = 0; i < src.size(); i++)
+       src[i] = static_cast<int32_t>(i * 3 + 1);
+
+    EXPECT_EQ(50, entry_point(&dst[0], &src[0], 50));
+    for (size_t i = 0; i < dst.size(); i++)
+       EXPECT_EQ(i < 50 ? src[i] : -1, dst[i]) << "at index " << i;
+}
+
+/*
+ * When the destination starts inside the source the loop propagates the
+ * first elements, which a block copy would not do
+ */
+TEST_F(LoopIdiomRecognizerTest, OverlappingCopyKeepsLoopSemantics) {
+    SKIP_ON_AARCH64(MissingImplementation);
+    SKIP_ON_RISCV(MissingImplementation);
+
+    auto trees = parseString(copyLoopTrees);
+
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    ContainsOpCodeIlVerifier verifier(TR::arraycopy);
+
+    ASSERT_EQ(0, compiler.compileWithVerifier(&verifier)) << "Compilation failed unexpectedly\n" << "Input trees: " << copyLoopTrees;
+
+    auto entry_point = compiler.getEntryPoint<int32_t (*)(int32_t *, int32_t *, int32_t)>();
+
+    std::vector<int32_t> buffer(32);
+    for (size_t i = 0; i < buffer.size(); i++)
+       buffer[i] = static_cast<int32_t>(i);
+
+    EXPECT_EQ(20, entry_point(&buffer[2], &buffer[0], 20));
+    for (size_t i = 0; i < 22; i++)
+       EXPECT_EQ(static_cast<int32_t>(i % 2), buffer[i]) << "at index " << i;
+    EXPECT_EQ(22, buffer[22]);
+
+    // Copying towards lower addresses matches a block copy
+    for (size_t i = 0; i < buffer.size(); i++)
+       buffer[i] = static_cast<int32_t>(i);
+
+    EXPECT_EQ(20, entry_point(&buffer[0], &buffer[2], 20));
+    for (size_t i = 0; i < 20; i++)
+       EXPECT_EQ(static_cast<int32_t>(i + 2), buffer[i]) << "at index " << i;
+}
+
+/*
+ * method(T *a, T *b, int32_t n)
+ *   int i = 0;
+ *   do {
+ *      if (a[i] != b[i])
+ *         return i;
+ *      i++;
+ *   } while (i < n);
+ *   return i + 1000;
+ */
+TEST_F(LoopIdiomRecognizerTest, CompareLoopBecomesArraycmplen) {
+    SKIP_ON_ARM(MissingImplementation);
+    SKIP_ON_RISCV(MissingImplementation);
+
+    auto* inputTrees = "(method return=Int32 args=[Address, Address, Int32] "
+                       " (block                                            "
+                       "  (istore temp=\"i\" (iconst 0)))                  "
+                       " (block name=\"loop\"                              "
+                       "  (ifbcmpne target=\"mismatch\"                    "
+                       "   (bloadi offset=0 (aladd (aload parm=0) (i2l (iload temp=\"i\")))) "
+                       "   (bloadi offset=0 (aladd (aload parm=1) (i2l (iload temp=\"i\")))))) "
+                       " (block                                            "
+                       "  (istore temp=\"i\" (iadd (iload temp=\"i\") (iconst 1))) "
+                       "  (ificmplt target=\"loop\" (iload temp=\"i\") (iload parm=2))) "
+                       " (block                                            "
+                       "  (ireturn (iadd (iload temp=\"i\") (iconst 1000)))) "
+                       " (block name=\"mismatch\"                          "
+                       "  (ireturn (iload temp=\"i\"))))                   ";
+
+    auto trees = parseString(inputTrees);
+
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    ContainsOpCodeIlVerifier verifier(TR::arraycmplen);
+
+    ASSERT_EQ(0, compiler.compileWithVerifier(&verifier)) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+    auto entry_point = compiler.getEntryPoint<int32_t (*)(uint8_t *, uint8_t *, int32_t)>();
+
+    std::vector<uint8_t> a(100, 0x5c);
+    std::vector<uint8_t> b(100, 0x5c);
+    EXPECT_EQ(1100, entry_point(&a[0], &b[0], 100));
+
+    b[63] = 0x5d;
+    EXPECT_EQ(63, entry_point(&a[0], &b[0], 100));
+    EXPECT_EQ(1063, entry_point(&a[0], &b[0], 63));
+
+    b[0] = 0;
+    EXPECT_EQ(0, entry_point(&a[0], &b[0], 0));
+    EXPECT_EQ(0, entry_point(&a[0], &b[0], 100));
+}
+
+/*
+ * The mismatch of wider elements is found at the element that holds the first
+ * mismatched byte
+ */
+TEST_F(LoopIdiomRecognizerTest, CompareLoopOfLongsBecomesArraycmplen) {
+    SKIP_ON_ARM(MissingImplementation);
+    SKIP_ON_RISCV(MissingImplementation);
+
+    auto* inputTrees = "(method return=Int32 args=[Address, Address, Int32] "
+                       " (block                                            "
+                       "  (istore temp=\"i\" (iconst 0)))                  "
+                       " (block name=\"loop\"                              "
+                       "  (iflcmpne target=\"mismatch\"                    "
+                       "   (lloadi offset=0 (aladd (aload parm=0) (lmul (i2l (iload temp=\"i\")) (lconst 8)))) "
+                       "   (lloadi offset=0 (aladd (aload parm=1) (lmul (i2l (iload temp=\"i\")) (lconst 8)))))) "
+                       " (block                                            "
+                       "  (istore temp=\"i\" (iadd (iload temp=\"i\") (iconst 1))) "
+                       "  (ificmplt target=\"loop\" (iload temp=\"i\") (iload parm=2))) "
+                       " (block                                            "
+                       "  (ireturn (iadd (iload temp=\"i\") (iconst 1000)))) "
+                       " (block name=\"mismatch\"                          "
+                       "  (ireturn (iload temp=\"i\"))))                   ";
+
+    auto trees = parseString(inputTrees);
+
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    ContainsOpCodeIlVerifier verifier(TR::arraycmplen);
+
+    ASSERT_EQ(0, compiler.compileWithVerifier(&verifier)) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+    auto entry_point = compiler.getEntryPoint<int32_t (*)(int64_t *, int64_t *, int32_t)>();
+
+    std::vector<int64_t> a(20, 0x0123456789abcdefLL);
+    std::vector<int64_t> b(20, 0x0123456789abcdefLL);
+    EXPECT_EQ(1020, entry_point(&a[0], &b[0], 20));
+
+    b[11] ^= 0x0000010000000000LL;
+    EXPECT_EQ(11, entry_point(&a[0], &b[0], 20));
+    EXPECT_EQ(1011, entry_point(&a[0], &b[0], 11));
+}
@@ -0,0 +1,345 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "JitTest.hpp"
+#include "default_compiler.hpp"
+#include "compilerunittest/CompilerUnitTest.hpp"
+#include "il/Node.hpp"
+#include "infra/ILWalk.hpp"
+#include "ras/IlVerifier.hpp"
+#include "ras/IlVerifierHelpers.hpp"
+
+#include <vector>
+
+/**
+ * This Verifier checks that the loop was vectorized with the given vector operation.
+ */
+class ContainsVectorOperationIlVerifier : public TR::IlVerifier
+   {
+   public:
+   ContainsVectorOperationIlVerifier(TR::VectorOperation operation) : _operation(operation) {}
+
+   int32_t verify(TR::ResolvedMethodSymbol *sym)
+      {
+      for(TR::PreorderNodeIterator iter(sym->getFirstTreeTop(), sym->comp()); iter.currentTree(); ++iter)
+         {
+         TR::ILOpCode &opCode = iter.currentNode()->getOpCode();
+         if (opCode.isVectorOpCode() && opCode.getVectorOperation() == _operation)
+            return 0;
+         }
+
+      return 1;
+      }
+
+   private:
+   TR::VectorOperation _operation;
+   };
+
+/**
+ * Test Fixture for LoopVectorizerTest that runs only the loop vectorizer
+ */
+class LoopVectorizerTest : public TRTest::JitOptTest
+   {
+
+   public:
+   LoopVectorizerTest()
+      {
+      addOptimization(OMR::SPMDKernelParallelization);
+      }
+
+   /**
+    * Whether the target supports 128 bit vectors of the given operations, which
+    * the vectorizer falls back to when wider ones are not supported
+    */
+   bool supports(std::initializer_list<TR::ILOpCodes> scalarOps)
+      {
+      TR::CPU cpu = TR::CPU::detect(privateOmrPortLibrary);
+      for (auto op = scalarOps.begin(); op != scalarOps.end(); ++op)
+         {
+         TR::ILOpCodes vectorOp = OMR::ILOpCode::convertScalarToVector(*op, TR::VectorLength128);
+         if (vectorOp == TR::BadILOp || !TR::CodeGenerator::getSupportsOpCodeForAutoSIMD(&cpu, vectorOp))
+            return false;
+         }
+      return true;
+      }
+
+   };
+
+/*
+ * method(int32_t *a, int32_t n)
+ *   int i = 0, sum = 0;
+ *   do {
+ *      sum = sum + a[i];
+ *      i++;
+ *   } while (i < n);
+ *   return sum;
+ */
+TEST_F(LoopVectorizerTest, SumIsVectorized) {
+    SKIP_ON_S390(KnownBug) << "Not all Z platforms have vector support (issue #1843)";
+    SKIP_ON_S390X(KnownBug) << "Not all Z platforms have vector support (issue #1843)";
+    SKIP_IF(!supports({TR::iloadi, TR::iadd}), MissingImplementation) << "Vector int add is not supported by the target platform";
+
+    auto* inputTrees = "(method return=Int32 args=[Address, Int32]         "
+                       " (block                                            "
+                       "  (istore temp=\"i\" (iconst 0))                   "
+                       "  (istore temp=\"sum\" (iconst 0)))                "
+                       " (block name=\"loop\"                              "
+                       "  (istore temp=\"sum\"                             "
+                       "   (iadd (iload temp=\"sum\")                      "
+                       "    (iloadi offset=0 (aladd (aload parm=0) (lmul (i2l (iload temp=\"i\")) (lconst 4)))))) "
+                       "  (istore temp=\"i\" (iadd (iload temp=\"i\") (iconst 1))) "
+                       "  (ificmplt target=\"loop\" (iload temp=\"i\") (iload parm=1))) "
+                       " (block                                            "
+                       "  (ireturn (iload temp=\"sum\"))))                 ";
+
+    auto trees = parseString(inputTrees);
+
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    ContainsVectorOperationIlVerifier verifier(TR::vreductionAdd);
+
+    ASSERT_EQ(0, compiler.compileWithVerifier(&verifier)) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+    auto entry_point = compiler.getEntryPoint<int32_t (*)(int32_t *, int32_t)>();
+
+    std::vector<int32_t> a(1000);
+    for (size_t i = 0; i < a.size(); i++)
+       a[i] = static_cast<int32_t>(i * 7) - 300;
+
+    // Lengths below, at and around whole vectors of every width
+    const int32_t lengths[] = { 1, 3, 4, 8, 15, 16, 17, 33, 64, 100, 1000 };
+    for (size_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++)
+       {
+       int32_t expected = 0;
+       for (int32_t i = 0; i < lengths[l]; i++)
+          expected += a[i];
+       EXPECT_EQ(expected, entry_point(&a[0], lengths[l])) << "with " << lengths[l] << " elements";
+       }
+}
+
+/*
+ * method(float *y, float *x, float a, int32_t n)
+ *   int i = 0;
+ *   do {
+ *      y[i] = a * x[i] + y[i];
+ *      i++;
+ *   } while (i < n);
+ *   return i;
+ */
+TEST_F(LoopVectorizerTest, SaxpyIsVectorized) {
+    SKIP_ON_S390(KnownBug) << "Not all Z platforms have vector support (issue #1843)";
+    SKIP_ON_S390X(KnownBug) << "Not all Z platforms have vector support (issue #1843)";
+    SKIP_IF(!supports({TR::floadi, TR::fmul, TR::fadd, TR::fconst}), MissingImplementation) << "Vector float arithmetic is not supported by the target platform";
+
+    auto* inputTrees = "(method return=Int32 args=[Address, Address, Float, Int32] "
+                       " (block                                            "
+                       "  (istore temp=\"i\" (iconst 0)))                  "
+                       " (block name=\"loop\"                              "
+                       "  (fstorei offset=0                                "
+                       "   (aladd (aload parm=0) (lmul (i2l (iload temp=\"i\")) (lconst 4))) "
+                       "   (fadd                                           "
+                       "    (fmul (fload parm=2)                           "
+                       "     (floadi offset=0 (aladd (aload parm=1) (lmul (i2l (iload temp=\"i\")) (lconst 4))))) "
+                       "    (floadi offset=0 (aladd (aload parm=0) (lmul (i2l (iload temp=\"i\")) (lconst 4)))))) "
+                       "  (istore temp=\"i\" (iadd (iload temp=\"i\") (iconst 1))) "
+                       "  (ificmplt target=\"loop\" (iload temp=\"i\") (iload parm=3))) "
+                       " (block                                            "
+                       "  (ireturn (iload temp=\"i\"))))                   ";
+
+    auto trees = parseString(inputTrees);
+
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    ContainsVectorOperationIlVerifier verifier(TR::vmul);
+
+    ASSERT_EQ(0, compiler.compileWithVerifier(&verifier)) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+    auto entry_point = compiler.getEntryPoint<int32_t (*)(float *, float *, float, int32_t)>();
+
+    const int32_t lengths[] = { 1, 7, 16, 37, 256 };
+    for (size_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++)
+       {
+       std::vector<float> x(lengths[l] + 8);
+       std::vector<float> y(lengths[l] + 8);
+       for (size_t i = 0; i < x.size(); i++)
+          {
+          x[i] = static_cast<float>(i) * 0.5f;
+          y[i] = 100.0f - static_cast<float>(i);
+          }
+
+       EXPECT_EQ(lengths[l], entry_point(&y[0], &x[0], 3.0f, lengths[l]));
+       for (size_t i = 0; i < y.size(); i++)
+          {
+          float expected = 100.0f - static_cast<float>(i);
+          if (i < static_cast<size_t>(lengths[l]))
+             expected += 3.0f * (static_cast<float>(i) * 0.5f);
+          EXPECT_FLOAT_EQ(expected, y[i]) << "at index " << i << " with " << lengths[l] << " elements";
+          }
+       }
+}
+
+/*
+ * method(int32_t *c, int32_t *a, int32_t *b, int64_t n)
+ *   long i = 0;
+ *   do {
+ *      c[i] = max(a[i], b[i]);
+ *      i++;
+ *   } while (i < n);
+ *   return i;
+ */
+TEST_F(LoopVectorizerTest, CompareIsVectorized) {
+    SKIP_ON_S390(KnownBug) << "Not all Z platforms have vector support (issue #1843)";
+    SKIP_ON_S390X(KnownBug) << "Not all Z platforms have vector support (issue #1843)";
+    SKIP_IF(!supports({TR::iloadi, TR::imax}), MissingImplementation) << "Vector int max is not supported by the target platform";
+
+    auto* inputTrees = "(method return=Int64 args=[Address, Address, Address, Int64] "
+                       " (block                                            "
+                       "  (lstore temp=\"i\" (lconst 0)))                  "
+                       " (block name=\"loop\"                              "
+                       "  (istorei offset=0                                "
+                       "   (aladd (aload parm=0) (lshl (lload temp=\"i\") (iconst 2))) "
+                       "   (imax                                           "
+                       "    (iloadi offset=0 (aladd (aload parm=1) (lshl (lload temp=\"i\") (iconst 2)))) "
+                       "    (iloadi offset=0 (aladd (aload parm=2) (lshl (lload temp=\"i\") (iconst 2)))))) "
+                       "  (lstore temp=\"i\" (ladd (lload temp=\"i\") (lconst 1))) "
+                       "  (iflcmplt target=\"loop\" (lload temp=\"i\") (lload parm=3))) "
+                       " (block                                            "
+                       "  (lreturn (lload temp=\"i\"))))                   ";
+
+    auto trees = parseString(inputTrees);
+
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    ContainsVectorOperationIlVerifier verifier(TR::vmax);
+
+    ASSERT_EQ(0, compiler.compileWithVerifier(&verifier)) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+    auto entry_point = compiler.getEntryPoint<int64_t (*)(int32_t *, int32_t *, int32_t *, int64_t)>();
+
+    std::vector<int32_t> a(150);
+    std::vector<int32_t> b(150);
+    std::vector<int32_t> c(150, 0);
+    for (size_t i = 0; i < a.size(); i++)
+       {
+       a[i] = static_cast<int32_t>((i * 37) % 101) - 50;
+       b[i] = static_cast<int32_t>((i * 53) % 97) - 48;
+       }
+
+    EXPECT_EQ(131, entry_point(&c[0], &a[0], &b[0], 131));
+    for (size_t i = 0; i < c.size(); i++)
+       EXPECT_EQ(i < 131 ? std::max(a[i], b[i]) : 0, c[i]) << "at index " << i;
+}
+
+/*
+ * method(int32_t *dst, int32_t *src, int32_t n)
+ *   int i = 0;
+ *   do {
+ *      dst[i] = src[i] + 1;
+ *      i++;
+ *   } while (i < n);
+ *   return i;
+ */
+static const char *incrementLoopTrees =
+    "(method return=Int32 args=[Address, Address, Int32]                  "
+    " (block                                                              "
+    "  (istore temp=\"i\" (iconst 0)))                                    "
+    " (block name=\"loop\"                                                "
+    "  (istorei offset=0                                                  "
+    "   (aladd (aload parm=0) (lmul (i2l (iload temp=\"i\")) (lconst 4))) "
+    "   (iadd                                                             "
+    "    (iloadi offset=0 (aladd (aload parm=1) (lmul (i2l (iload temp=\"i\")) (lconst 4)))) "
+    "    (iconst 1)))                                                     "
+    "  (istore temp=\"i\" (iadd (iload temp=\"i\") (iconst 1)))           "
+    "  (ificmplt target=\"loop\" (iload temp=\"i\") (iload parm=2)))      "
+    " (block                                                              "
+    "  (ireturn (iload temp=\"i\"))))                                     ";
+
+/*
+ * A store that feeds a load of a later iteration within one vector keeps
+ * the scalar loop, while accesses that are the same address or at least a
+ * vector apart use the vector loop
+ */
+TEST_F(LoopVectorizerTest, OverlappingAccessesKeepLoopSemantics) {
+    SKIP_ON_S390(KnownBug) << "Not all Z platforms have vector support (issue #1843)";
+    SKIP_ON_S390X(KnownBug) << "Not all Z platforms have vector support (issue #1843)";
+    SKIP_IF(!supports({TR::iloadi, TR::iadd}), MissingImplementation) << "Vector int add is not supported by the target platform";
+
+    auto trees = parseString(incrementLoopTrees);
+
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    ContainsVectorOperationIlVerifier verifier(TR::vadd);
+
+    ASSERT_EQ(0, compiler.compileWithVerifier(&verifier)) << "Compilation failed unexpectedly\n" << "Input trees: " << incrementLoopTrees;
+
+    auto entry_point = compiler.getEntryPoint<int32_t (*)(int32_t *, int32_t *, int32_t)>();
+
+    // Every element is one more than the one before it, as in the scalar loop
+    std::vector<int32_t> buffer(100, 0);
+    EXPECT_EQ(90, entry_point(&buffer[1], &buffer[0], 90));
+    for (size_t i = 0; i <= 90; i++)
+       EXPECT_EQ(static_cast<int32_t>(i), buffer[i]) << "at index " << i;
+    EXPECT_EQ(0, buffer[91]);
+
+    // In place
+    for (size_t i = 0; i < buffer.size(); i++)
+       buffer[i] = static_cast<int32_t>(i);
+    EXPECT_EQ(100, entry_point(&buffer[0], &buffer[0], 100));
+    for (size_t i = 0; i < buffer.size(); i++)
+       EXPECT_EQ(static_cast<int32_t>(i + 1), buffer[i]) << "at index " << i;
+
+    // Far enough apart for any vector
+    std::vector<int32_t> wide(200, 5);
+    EXPECT_EQ(80, entry_point(&wide[0], &wide[100], 80));
+    for (size_t i = 0; i < 80; i++)
+       EXPECT_EQ(6, wide[i]) << "at index " << i;
+}
+
+/*
+ * A loop storing its induction variable has no vector equivalent
+ */
+TEST_F(LoopVectorizerTest, InductionVariableValueIsNotVectorized) {
+    auto* inputTrees = "(method return=Int32 args=[Address, Int32]         "
+                       " (block                                            "
+                       "  (istore temp=\"i\" (iconst 0)))                  "
+                       " (block name=\"loop\"                              "
+                       "  (istorei offset=0                                "
+                       "   (aladd (aload parm=0) (lmul (i2l (iload temp=\"i\")) (lconst 4))) "
+                       "   (iload temp=\"i\"))                             "
+                       "  (istore temp=\"i\" (iadd (iload temp=\"i\") (iconst 1))) "
+                       "  (ificmplt target=\"loop\" (iload temp=\"i\") (iload parm=1))) "
+                       " (block                                            "
+                       "  (ireturn (iload temp=\"i\"))))                   ";
+
+    auto trees = parseString(inputTrees);
+
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    ContainsVectorOperationIlVerifier verifier(TR::vstorei);
+
+    ASSERT_NE(0, compiler.compileWithVerifier(&verifier))
+       << "Loop storing the induction variable was vectorized";
+}
@@ -0,0 +1,324 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "JitTest.hpp"
+#include "default_compiler.hpp"
+#include "il/Node.hpp"
+#include "infra/ILWalk.hpp"
+#include "ras/IlVerifier.hpp"
+#include "ras/IlVerifierHelpers.hpp"
+
+/**
+ * This Verifier checks if an allocation is left in the trees.
+ *
+ * None of the tests provide allocation helpers, so compilation is
+ * stopped by returning a non-zero return code before code generation.
+ */
+class NoNewIlVerifier : public TR::IlVerifier
+   {
+   public:
+   int32_t verify(TR::ResolvedMethodSymbol *sym)
+      {
+      for(TR::PreorderNodeIterator iter(sym->getFirstTreeTop(), sym->comp()); iter.currentTree(); ++iter)
+         {
+         if (iter.currentNode()->getOpCode().isNew())
+            return 1;
+         }
+
+      return 0;
+      }
+   };
+
+/**
+ * Test Fixture for ScalarReplacementTest that runs only escape analysis
+ */
+class ScalarReplacementTest : public TRTest::JitOptTest
+   {
+
+   public:
+   ScalarReplacementTest()
+      {
+      addOptimization(OMR::escapeAnalysis);
+      }
+
+   };
+
+/*
+ * method(int32_t a, int32_t b)
+ *   Pair p = new Pair();
+ *   p.x = a;
+ *   p.y = b;
+ *   return p.x + p.y;
+ */
+TEST_F(ScalarReplacementTest, ReplacesNonEscapingObject) {
+    auto* inputTrees = "(method return=Int32 args=[Int32, Int32]          "
+                       " (block                                           "
+                       "  (astore temp=\"p\" (new (aconst 0)))            "
+                       "  (istorei offset=8 (aload temp=\"p\") (iload parm=0)) "
+                       "  (istorei offset=12 (aload temp=\"p\") (iload parm=1)) "
+                       "  (ireturn                                        "
+                       "   (iadd                                          "
+                       "    (iloadi offset=8 (aload temp=\"p\"))          "
+                       "    (iloadi offset=12 (aload temp=\"p\"))))))     ";
+
+    auto trees = parseString(inputTrees);
+
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    NoNewIlVerifier verifier;
+
+    ASSERT_EQ(0, compiler.compileWithVerifier(&verifier)) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+    auto entry_point = compiler.getEntryPoint<int32_t (*)(int32_t, int32_t)>();
+    EXPECT_EQ(3, entry_point(1, 2));
+    EXPECT_EQ(0, entry_point(-7, 7));
+    EXPECT_EQ(-2147483647, entry_point(2147483647, 2));
+}
+
+/*
+ * The allocation is zero initialized, so a field that is never
+ * written reads as zero
+ */
+TEST_F(ScalarReplacementTest, UnwrittenFieldIsZero) {
+    auto* inputTrees = "(method return=Int64 args=[Int64]                 "
+                       " (block                                           "
+                       "  (astore temp=\"p\" (new (aconst 0)))            "
+                       "  (lstorei offset=8 (aload temp=\"p\") (lload parm=0)) "
+                       "  (lreturn (lloadi offset=16 (aload temp=\"p\")))))";
+
+    auto trees = parseString(inputTrees);
+
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    NoNewIlVerifier verifier;
+
+    ASSERT_EQ(0, compiler.compileWithVerifier(&verifier)) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+    auto entry_point = compiler.getEntryPoint<int64_t (*)(int64_t)>();
+    EXPECT_EQ(0, entry_point(42));
+}
+
+/*
+ * method(int32_t n)
+ *   int i = 0, sum = 0;
+ *   do {
+ *      Box b = new Box();
+ *      b.value = i;
+ *      sum += b.value;
+ *      i++;
+ *   } while (i < n);
+ *   return sum;
+ */
+TEST_F(ScalarReplacementTest, ReplacesAllocationInLoop) {
+    auto* inputTrees = "(method return=Int32 args=[Int32]                 "
+                       " (block                                           "
+                       "  (istore temp=\"i\" (iconst 0))                  "
+                       "  (istore temp=\"sum\" (iconst 0)))               "
+                       " (block name=\"loop\"                             "
+                       "  (astore temp=\"b\" (new (aconst 0)))            "
+                       "  (istorei offset=8 (aload temp=\"b\") (iload temp=\"i\")) "
+                       "  (istore temp=\"sum\"                            "
+                       "   (iadd (iload temp=\"sum\") (iloadi offset=8 (aload temp=\"b\")))) "
+                       "  (istore temp=\"i\" (iadd (iload temp=\"i\") (iconst 1))) "
+                       "  (ificmplt target=\"loop\" (iload temp=\"i\") (iload parm=0))) "
+                       " (block                                           "
+                       "  (ireturn (iload temp=\"sum\"))))                ";
+
+    auto trees = parseString(inputTrees);
+
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    NoNewIlVerifier verifier;
+
+    ASSERT_EQ(0, compiler.compileWithVerifier(&verifier)) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+    auto entry_point = compiler.getEntryPoint<int32_t (*)(int32_t)>();
+    EXPECT_EQ(0, entry_point(1));
+    EXPECT_EQ(45, entry_point(10));
+}
+
+/*
+ * An array with a constant length is replaced like an object
+ */
+TEST_F(ScalarReplacementTest, ReplacesConstantLengthArray) {
+    auto* inputTrees = "(method return=Double args=[Double, Double]       "
+                       " (block                                           "
+                       "  (astore temp=\"a\" (newarray (iconst 2) (iconst 7))) "
+                       "  (dstorei offset=0 (aload temp=\"a\") (dload parm=0)) "
+                       "  (dstorei offset=8 (aload temp=\"a\") (dload parm=1)) "
+                       "  (dreturn                                        "
+                       "   (dmul                                          "
+                       "    (dloadi offset=0 (aload temp=\"a\"))          "
+                       "    (dloadi offset=8 (aload temp=\"a\"))))))      ";
+
+    auto trees = parseString(inputTrees);
+
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    NoNewIlVerifier verifier;
+
+    ASSERT_EQ(0, compiler.compileWithVerifier(&verifier)) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+    auto entry_point = compiler.getEntryPoint<double (*)(double, double)>();
+    EXPECT_DOUBLE_EQ(6.0, entry_point(2.0, 3.0));
+}
+
+/*
+ * An access past the elements of an array cannot be replaced, since it does
+ * not read a zeroed element
+ */
+TEST_F(ScalarReplacementTest, OutOfBoundsArrayAccessEscapes) {
+    auto* inputTrees = "(method return=Double args=[Double]               "
+                       " (block                                           "
+                       "  (astore temp=\"a\" (newarray (iconst 2) (iconst 7))) "
+                       "  (dstorei offset=0 (aload temp=\"a\") (dload parm=0)) "
+                       "  (dreturn (dloadi offset=16 (aload temp=\"a\")))))  ";
+
+    auto trees = parseString(inputTrees);
+
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    NoNewIlVerifier verifier;
+
+    ASSERT_NE(0, compiler.compileWithVerifier(&verifier))
+       << "Allocation accessed out of bounds was replaced";
+}
+
+/*
+ * Primitive element sizes are taken from the accesses, so accesses of
+ * different sizes keep the array on the heap
+ */
+TEST_F(ScalarReplacementTest, MixedSizeArrayAccessEscapes) {
+    auto* inputTrees = "(method return=Int32 args=[Int32, Int64]          "
+                       " (block                                           "
+                       "  (astore temp=\"a\" (newarray (iconst 4) (iconst 10))) "
+                       "  (istorei offset=0 (aload temp=\"a\") (iload parm=0)) "
+                       "  (lstorei offset=8 (aload temp=\"a\") (lload parm=1)) "
+                       "  (ireturn (iloadi offset=0 (aload temp=\"a\")))))  ";
+
+    auto trees = parseString(inputTrees);
+
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    NoNewIlVerifier verifier;
+
+    ASSERT_NE(0, compiler.compileWithVerifier(&verifier))
+       << "Array accessed with different element sizes was replaced";
+}
+
+/*
+ * A returned object escapes and must stay allocated
+ */
+TEST_F(ScalarReplacementTest, ReturnedObjectEscapes) {
+    auto* inputTrees = "(method return=Address args=[Int32]               "
+                       " (block                                           "
+                       "  (astore temp=\"p\" (new (aconst 0)))            "
+                       "  (istorei offset=8 (aload temp=\"p\") (iload parm=0)) "
+                       "  (areturn (aload temp=\"p\"))))                  ";
+
+    auto trees = parseString(inputTrees);
+
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    NoNewIlVerifier verifier;
+
+    ASSERT_NE(0, compiler.compileWithVerifier(&verifier))
+       << "Escaping allocation was replaced";
+}
+
+/*
+ * An object stored to memory the method does not own escapes
+ */
+TEST_F(ScalarReplacementTest, StoredObjectEscapes) {
+    auto* inputTrees = "(method return=Int32 args=[Address]               "
+                       " (block                                           "
+                       "  (astore temp=\"p\" (new (aconst 0)))            "
+                       "  (astorei offset=0 (aload parm=0) (aload temp=\"p\")) "
+                       "  (ireturn (iloadi offset=8 (aload temp=\"p\")))))";
+
+    auto trees = parseString(inputTrees);
+
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    NoNewIlVerifier verifier;
+
+    ASSERT_NE(0, compiler.compileWithVerifier(&verifier))
+       << "Escaping allocation was replaced";
+}
+
+/*
+ * Accesses of different types that overlap cannot be replaced by
+ * independent temporaries
+ */
+TEST_F(ScalarReplacementTest, OverlappingFieldsAreNotReplaced) {
+    auto* inputTrees = "(method return=Int32 args=[Int64]                 "
+                       " (block                                           "
+                       "  (astore temp=\"p\" (new (aconst 0)))            "
+                       "  (lstorei offset=8 (aload temp=\"p\") (lload parm=0)) "
+                       "  (ireturn (iloadi offset=12 (aload temp=\"p\")))))";
+
+    auto trees = parseString(inputTrees);
+
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    NoNewIlVerifier verifier;
+
+    ASSERT_NE(0, compiler.compileWithVerifier(&verifier))
+       << "Allocation with overlapping fields was replaced";
+}
+
+/*
+ * method(int32_t c, int32_t v)
+ *   Box b = null;
+ *   if (c != 0) { b = new Box(); b.value = v; }
+ *   return b.value;
+ *
+ * The load after the merge may see null, so the allocation stays
+ */
+TEST_F(ScalarReplacementTest, ConditionallyStoredObjectEscapes) {
+    auto* inputTrees = "(method return=Int32 args=[Int32, Int32]          "
+                       " (block                                           "
+                       "  (ificmpeq target=\"join\" (iload parm=0) (iconst 0))) "
+                       " (block                                           "
+                       "  (astore temp=\"b\" (new (aconst 0)))            "
+                       "  (istorei offset=8 (aload temp=\"b\") (iload parm=1))) "
+                       " (block name=\"join\"                             "
+                       "  (ireturn (iloadi offset=8 (aload temp=\"b\")))))";
+
+    auto trees = parseString(inputTrees);
+
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    NoNewIlVerifier verifier;
+
+    ASSERT_NE(0, compiler.compileWithVerifier(&verifier))
+       << "Allocation loaded where its store does not dominate was replaced";
+}
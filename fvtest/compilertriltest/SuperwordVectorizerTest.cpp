@@ -0,0 +1,362 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "JitTest.hpp"
+#include "default_compiler.hpp"
+#include "compilerunittest/CompilerUnitTest.hpp"
+#include "il/Node.hpp"
+#include "infra/ILWalk.hpp"
+#include "ras/IlVerifier.hpp"
+#include "ras/IlVerifierHelpers.hpp"
+
+/**
+ * This Verifier checks how many vector stores the method was left with.
+ */
+class VectorStoreCountIlVerifier : public TR::IlVerifier
+   {
+   public:
+   VectorStoreCountIlVerifier(int32_t expectedCount) : _expectedCount(expectedCount) {}
+
+   int32_t verify(TR::ResolvedMethodSymbol *sym)
+      {
+      int32_t count = 0;
+      for(TR::PreorderNodeIterator iter(sym->getFirstTreeTop(), sym->comp()); iter.currentTree(); ++iter)
+         {
+         TR::ILOpCode &opCode = iter.currentNode()->getOpCode();
+         if (opCode.isVectorOpCode() && opCode.getVectorOperation() == TR::vstorei)
+            count++;
+         }
+
+      return count == _expectedCount ? 0 : 1;
+      }
+
+   private:
+   int32_t _expectedCount;
+   };
+
+/**
+ * Test Fixture for SuperwordVectorizerTest that runs only superword vectorization
+ */
+class SuperwordVectorizerTest : public TRTest::JitOptTest
+   {
+
+   public:
+   SuperwordVectorizerTest()
+      {
+      addOptimization(OMR::superwordVectorization);
+      }
+
+   /**
+    * Whether the target supports 128 bit vectors of the given operations
+    */
+   bool supports(std::initializer_list<TR::ILOpCodes> scalarOps)
+      {
+      TR::CPU cpu = TR::CPU::detect(privateOmrPortLibrary);
+      for (auto op = scalarOps.begin(); op != scalarOps.end(); ++op)
+         {
+         TR::ILOpCodes vectorOp = OMR::ILOpCode::convertScalarToVector(*op, TR::VectorLength128);
+         if (vectorOp == TR::BadILOp || !TR::CodeGenerator::getSupportsOpCodeForAutoSIMD(&cpu, vectorOp))
+            return false;
+         }
+      return true;
+      }
+
+   };
+
+/*
+ * method(float *dst, float *a, float *b, float s)
+ *   dst[0] = a[0] * s + b[0];
+ *   dst[1] = a[1] * s + b[1];
+ *   dst[2] = a[2] * s + b[2];
+ *   dst[3] = a[3] * s + b[3];
+ */
+TEST_F(SuperwordVectorizerTest, FloatChannelsArePacked) {
+    SKIP_ON_S390(KnownBug) << "Not all Z platforms have vector support (issue #1843)";
+    SKIP_ON_S390X(KnownBug) << "Not all Z platforms have vector support (issue #1843)";
+    SKIP_IF(!supports({TR::floadi, TR::fmul, TR::fadd, TR::fconst}), MissingImplementation) << "Vector float arithmetic is not supported by the target platform";
+
+    auto* inputTrees = "(method return=Int32 args=[Address, Address, Address, Float] "
+                       " (block                                                  "
+                       "  (fstorei offset=0 (aload parm=0)                       "
+                       "   (fadd (fmul (floadi offset=0 (aload parm=1)) (fload parm=3)) (floadi offset=0 (aload parm=2)))) "
+                       "  (fstorei offset=4 (aload parm=0)                       "
+                       "   (fadd (fmul (floadi offset=4 (aload parm=1)) (fload parm=3)) (floadi offset=4 (aload parm=2)))) "
+                       "  (fstorei offset=8 (aload parm=0)                       "
+                       "   (fadd (fmul (floadi offset=8 (aload parm=1)) (fload parm=3)) (floadi offset=8 (aload parm=2)))) "
+                       "  (fstorei offset=12 (aload parm=0)                      "
+                       "   (fadd (fmul (floadi offset=12 (aload parm=1)) (fload parm=3)) (floadi offset=12 (aload parm=2)))) "
+                       "  (ireturn (iconst 0))))                                 ";
+
+    auto trees = parseString(inputTrees);
+
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    VectorStoreCountIlVerifier verifier(1);
+
+    ASSERT_EQ(0, compiler.compileWithVerifier(&verifier)) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+    auto entry_point = compiler.getEntryPoint<int32_t (*)(float *, float *, float *, float)>();
+
+    float dst[5] = { 0.0f, 0.0f, 0.0f, 0.0f, -1.0f };
+    float a[4] = { 1.0f, 2.0f, 3.0f, 4.0f };
+    float b[4] = { 0.5f, -0.5f, 10.0f, 100.0f };
+    entry_point(dst, a, b, 2.0f);
+
+    for (int32_t i = 0; i < 4; i++)
+       EXPECT_FLOAT_EQ(a[i] * 2.0f + b[i], dst[i]) << "at index " << i;
+    EXPECT_FLOAT_EQ(-1.0f, dst[4]);
+}
+
+/*
+ * method(double *v, double *w)
+ *   v[0] = v[0] * w[0];
+ *   v[1] = v[1] * w[1];
+ */
+TEST_F(SuperwordVectorizerTest, UpdateInPlaceIsPacked) {
+    SKIP_ON_S390(KnownBug) << "Not all Z platforms have vector support (issue #1843)";
+    SKIP_ON_S390X(KnownBug) << "Not all Z platforms have vector support (issue #1843)";
+    SKIP_IF(!supports({TR::dloadi, TR::dmul}), MissingImplementation) << "Vector double multiply is not supported by the target platform";
+
+    auto* inputTrees = "(method return=Int32 args=[Address, Address]               "
+                       " (block                                                    "
+                       "  (dstorei offset=0 (aload parm=0)                         "
+                       "   (dmul (dloadi offset=0 (aload parm=0)) (dloadi offset=0 (aload parm=1)))) "
+                       "  (dstorei offset=0 (aladd (aload parm=0) (lconst 8))      "
+                       "   (dmul (dloadi offset=0 (aladd (aload parm=0) (lconst 8))) (dloadi offset=8 (aload parm=1)))) "
+                       "  (ireturn (iconst 0))))                                   ";
+
+    auto trees = parseString(inputTrees);
+
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    VectorStoreCountIlVerifier verifier(1);
+
+    ASSERT_EQ(0, compiler.compileWithVerifier(&verifier)) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+    auto entry_point = compiler.getEntryPoint<int32_t (*)(double *, double *)>();
+
+    double v[3] = { 1.5, -2.0, 7.0 };
+    double w[2] = { 4.0, 0.25 };
+    entry_point(v, w);
+
+    EXPECT_DOUBLE_EQ(6.0, v[0]);
+    EXPECT_DOUBLE_EQ(-0.5, v[1]);
+    EXPECT_DOUBLE_EQ(7.0, v[2]);
+}
+
+/*
+ * Each lane reads what the previous lane stored, so the stores cannot be
+ * moved together
+ *
+ * method(int32_t *a)
+ *   a[1] = a[0] + 1;
+ *   a[2] = a[1] + 1;
+ *   a[3] = a[2] + 1;
+ *   a[4] = a[3] + 1;
+ */
+TEST_F(SuperwordVectorizerTest, DependentLanesAreNotPacked) {
+    auto* inputTrees = "(method return=Int32 args=[Address]                         "
+                       " (block                                                    "
+                       "  (istorei offset=4 (aload parm=0) (iadd (iloadi offset=0 (aload parm=0)) (iconst 1))) "
+                       "  (istorei offset=8 (aload parm=0) (iadd (iloadi offset=4 (aload parm=0)) (iconst 1))) "
+                       "  (istorei offset=12 (aload parm=0) (iadd (iloadi offset=8 (aload parm=0)) (iconst 1))) "
+                       "  (istorei offset=16 (aload parm=0) (iadd (iloadi offset=12 (aload parm=0)) (iconst 1))) "
+                       "  (ireturn (iconst 0))))                                   ";
+
+    auto trees = parseString(inputTrees);
+
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    VectorStoreCountIlVerifier verifier(0);
+
+    ASSERT_EQ(0, compiler.compileWithVerifier(&verifier)) << "Dependent stores were packed\n" << "Input trees: " << inputTrees;
+
+    auto entry_point = compiler.getEntryPoint<int32_t (*)(int32_t *)>();
+
+    int32_t a[5] = { 10, 0, 0, 0, 0 };
+    entry_point(a);
+
+    for (int32_t i = 0; i < 5; i++)
+       EXPECT_EQ(10 + i, a[i]) << "at index " << i;
+}
+
+/*
+ * Splatting the value costs as much as the second store saves
+ *
+ * method(int64_t *a, int64_t x)
+ *   a[0] = x;
+ *   a[1] = x;
+ */
+TEST_F(SuperwordVectorizerTest, UnprofitablePairIsNotPacked) {
+    auto* inputTrees = "(method return=Int32 args=[Address, Int64]                  "
+                       " (block                                                    "
+                       "  (lstorei offset=0 (aload parm=0) (lload parm=1))         "
+                       "  (lstorei offset=8 (aload parm=0) (lload parm=1))         "
+                       "  (ireturn (iconst 0))))                                   ";
+
+    auto trees = parseString(inputTrees);
+
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    VectorStoreCountIlVerifier verifier(0);
+
+    ASSERT_EQ(0, compiler.compileWithVerifier(&verifier)) << "Unprofitable stores were packed\n" << "Input trees: " << inputTrees;
+}
+
+/*
+ * The first lane stores a value of t loaded before t changed, so the lanes
+ * do not all store the same value
+ *
+ * method(int32_t *a, int32_t x)
+ *   t = x;
+ *   old = t;
+ *   t = 100;
+ *   a[0] = old;
+ *   a[1] = t;
+ *   a[2] = t;
+ *   a[3] = t;
+ */
+TEST_F(SuperwordVectorizerTest, StaleCommonedValueIsNotSplatted) {
+    auto* inputTrees = "(method return=Int32 args=[Address, Int32]                  "
+                       " (block                                                    "
+                       "  (istore temp=\"t\" (iload parm=1))                       "
+                       "  (treetop (iload temp=\"t\" id=\"old\"))                  "
+                       "  (istore temp=\"t\" (iconst 100))                         "
+                       "  (istorei offset=0 (aload parm=0) (@id \"old\"))          "
+                       "  (istorei offset=4 (aload parm=0) (iload temp=\"t\"))     "
+                       "  (istorei offset=8 (aload parm=0) (iload temp=\"t\"))     "
+                       "  (istorei offset=12 (aload parm=0) (iload temp=\"t\"))    "
+                       "  (ireturn (iconst 0))))                                   ";
+
+    auto trees = parseString(inputTrees);
+
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    VectorStoreCountIlVerifier verifier(0);
+
+    ASSERT_EQ(0, compiler.compileWithVerifier(&verifier)) << "Stores of different values were packed\n" << "Input trees: " << inputTrees;
+
+    auto entry_point = compiler.getEntryPoint<int32_t (*)(int32_t *, int32_t)>();
+
+    int32_t a[4] = { 0, 0, 0, 0 };
+    entry_point(a, 5);
+
+    EXPECT_EQ(5, a[0]);
+    for (int32_t i = 1; i < 4; i++)
+       EXPECT_EQ(100, a[i]) << "at index " << i;
+}
+
+/*
+ * The first lane stores through a value of p loaded before p changed, so the
+ * lanes do not all store off the same base
+ *
+ * method(int32_t *a, int32_t *b)
+ *   p = a;
+ *   old = p;
+ *   p = b;
+ *   old[0] = 1;
+ *   p[1] = 1;
+ *   p[2] = 1;
+ *   p[3] = 1;
+ */
+TEST_F(SuperwordVectorizerTest, StaleCommonedBaseIsNotPacked) {
+    auto* inputTrees = "(method return=Int32 args=[Address, Address]                "
+                       " (block                                                    "
+                       "  (astore temp=\"p\" (aload parm=0))                       "
+                       "  (treetop (aload temp=\"p\" id=\"old\"))                  "
+                       "  (astore temp=\"p\" (aload parm=1))                       "
+                       "  (istorei offset=0 (@id \"old\") (iconst 1))              "
+                       "  (istorei offset=4 (aload temp=\"p\") (iconst 1))         "
+                       "  (istorei offset=8 (aload temp=\"p\") (iconst 1))         "
+                       "  (istorei offset=12 (aload temp=\"p\") (iconst 1))        "
+                       "  (ireturn (iconst 0))))                                   ";
+
+    auto trees = parseString(inputTrees);
+
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    VectorStoreCountIlVerifier verifier(0);
+
+    ASSERT_EQ(0, compiler.compileWithVerifier(&verifier)) << "Stores off different bases were packed\n" << "Input trees: " << inputTrees;
+
+    auto entry_point = compiler.getEntryPoint<int32_t (*)(int32_t *, int32_t *)>();
+
+    int32_t a[4] = { 0, 0, 0, 0 };
+    int32_t b[4] = { 0, 0, 0, 0 };
+    entry_point(a, b);
+
+    EXPECT_EQ(1, a[0]);
+    EXPECT_EQ(0, b[0]);
+    for (int32_t i = 1; i < 4; i++)
+       {
+       EXPECT_EQ(0, a[i]) << "at index " << i;
+       EXPECT_EQ(1, b[i]) << "at index " << i;
+       }
+}
+
+/*
+ * The vector store keeps the base of the first lane, so it can still be used
+ * after the pack
+ *
+ * method(int32_t *a)
+ *   a[0] = 7;
+ *   a[1] = 7;
+ *   a[2] = 7;
+ *   a[3] = 7;
+ *   return a[2];
+ */
+TEST_F(SuperwordVectorizerTest, BaseUsedAfterPackIsPacked) {
+    SKIP_ON_S390(KnownBug) << "Not all Z platforms have vector support (issue #1843)";
+    SKIP_ON_S390X(KnownBug) << "Not all Z platforms have vector support (issue #1843)";
+    SKIP_IF(!supports({TR::iloadi, TR::iconst}), MissingImplementation) << "Vector int stores and splats are not supported by the target platform";
+
+    auto* inputTrees = "(method return=Int32 args=[Address]                         "
+                       " (block                                                    "
+                       "  (istorei offset=0 (aload parm=0 id=\"a\") (iconst 7))    "
+                       "  (istorei offset=4 (@id \"a\") (iconst 7))                "
+                       "  (istorei offset=8 (@id \"a\") (iconst 7))                "
+                       "  (istorei offset=12 (@id \"a\") (iconst 7))               "
+                       "  (ireturn (iloadi offset=8 (@id \"a\")))))                ";
+
+    auto trees = parseString(inputTrees);
+
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    VectorStoreCountIlVerifier verifier(1);
+
+    ASSERT_EQ(0, compiler.compileWithVerifier(&verifier)) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+    auto entry_point = compiler.getEntryPoint<int32_t (*)(int32_t *)>();
+
+    int32_t a[5] = { 0, 0, 0, 0, -1 };
+    EXPECT_EQ(7, entry_point(a));
+
+    for (int32_t i = 0; i < 4; i++)
+       EXPECT_EQ(7, a[i]) << "at index " << i;
+    EXPECT_EQ(-1, a[4]);
+}
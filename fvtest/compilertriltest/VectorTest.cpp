@@ -28,6 +28,18 @@
 
 class VectorTest : public TRTest::JitTest {};
 
+/**
+ * Test Fixture that runs only local CSE, which copy propagates stores into loads
+ */
+class VectorLocalCSETest : public TRTest::JitOptTest
+   {
+   public:
+   VectorLocalCSETest()
+      {
+      addOptimization(OMR::localCSE);
+      }
+   };
+
 class ParameterizedBinaryVectorArithmeticTest : public VectorTest, public ::testing::WithParamInterface<std::tuple<TR::ILOpCode, TR::VectorLength>> {};
 
 int vectorSize(TR::VectorLength vl) {
@@ -794,6 +806,174 @@ TEST_F(VectorTest, VInt8BitSelect) {
     }
 }
 
+TEST_F(VectorTest, VInt32MaskReductions) {
+    SKIP_ON_S390(KnownBug) << "This test is currently disabled on Z platforms because not all Z platforms have vector support (issue #1843)";
+    SKIP_ON_S390X(KnownBug) << "This test is currently disabled on Z platforms because not all Z platforms have vector support (issue #1843)";
+    SKIP_ON_RISCV(MissingImplementation);
+
+    struct
+       {
+       TR::VectorOperation operation;
+       bool returnsInt32;
+       int64_t expected[3];
+       }
+    reductions[] =
+       {
+       { TR::mAnyTrue,    true,  { 1, 1, 0 } },
+       { TR::mAllTrue,    true,  { 0, 1, 0 } },
+       { TR::mTrueCount,  false, { 2, 4, 0 } },
+       { TR::mFirstTrue,  false, { 1, 0, 4 } },
+       { TR::mLastTrue,   false, { 3, 3, -1 } },
+       };
+
+    int32_t inputA[] = { 1, 5, 3, 7 };
+    int32_t inputB[][4] = { { 2, 4, 3, 6 }, { 0, 0, 0, 0 }, { 9, 9, 9, 9 } };
+
+    TR::CPU cpu = TR::CPU::detect(privateOmrPortLibrary);
+    TR::DataType vectorType = TR::DataType::createVectorType(TR::Int32, TR::VectorLength128);
+    TR::DataType maskType = TR::DataType::createMaskType(TR::Int32, TR::VectorLength128);
+
+    for (int32_t i = 0; i < sizeof(reductions) / sizeof(*reductions); i++) {
+        TR::ILOpCode reductionOp = TR::ILOpCode::createVectorOpCode(reductions[i].operation, vectorType);
+        TR::ILOpCode compareOp = TR::ILOpCode::createVectorOpCode(TR::vcmpgt, vectorType, maskType);
+        if (!TR::CodeGenerator::getSupportsOpCodeForAutoSIMD(&cpu, reductionOp) || !TR::CodeGenerator::getSupportsOpCodeForAutoSIMD(&cpu, compareOp))
+            continue;
+
+        char inputTrees[1024] = {0};
+        std::snprintf(inputTrees, sizeof(inputTrees),
+            "(method return=Int64 args=[Address,Address]                               "
+            "  (block                                                                  "
+            "     (lreturn %s(%sVector128Int32                                         "
+            "         (vcmpgtVector128Int32ToMask128Int32                              "
+            "             (vloadiVector128Int32 (aload parm=0))                        "
+            "             (vloadiVector128Int32 (aload parm=1))))%s)))                 ",
+            reductions[i].returnsInt32 ? "(i2l " : "", reductionOp.getName(), reductions[i].returnsInt32 ? ")" : "");
+
+        auto trees = parseString(inputTrees);
+        ASSERT_NOTNULL(trees);
+
+        Tril::DefaultCompiler compiler(trees);
+        ASSERT_EQ(0, compiler.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+        auto entry_point = compiler.getEntryPoint<int64_t (*)(int32_t[], int32_t[])>();
+
+        for (int32_t j = 0; j < 3; j++) {
+            EXPECT_EQ(reductions[i].expected[j], entry_point(inputA, inputB[j])) << reductionOp.getName() << " of input " << j;
+        }
+    }
+}
+
+TEST_F(VectorTest, VInt32MaskedLoadStore) {
+    SKIP_ON_S390(KnownBug) << "This test is currently disabled on Z platforms because not all Z platforms have vector support (issue #1843)";
+    SKIP_ON_S390X(KnownBug) << "This test is currently disabled on Z platforms because not all Z platforms have vector support (issue #1843)";
+    SKIP_ON_RISCV(MissingImplementation);
+
+    TR::CPU cpu = TR::CPU::detect(privateOmrPortLibrary);
+    TR::DataType vectorType = TR::DataType::createVectorType(TR::Int32, TR::VectorLength128);
+    TR::DataType maskType = TR::DataType::createMaskType(TR::Int32, TR::VectorLength128);
+    bool platformSupport = TR::CodeGenerator::getSupportsOpCodeForAutoSIMD(&cpu, TR::ILOpCode::createVectorOpCode(TR::vmloadi, vectorType)) &&
+                           TR::CodeGenerator::getSupportsOpCodeForAutoSIMD(&cpu, TR::ILOpCode::createVectorOpCode(TR::vmstorei, vectorType)) &&
+                           TR::CodeGenerator::getSupportsOpCodeForAutoSIMD(&cpu, TR::ILOpCode::createVectorOpCode(TR::vcmpgt, vectorType, maskType));
+    SKIP_IF(!platformSupport, MissingImplementation) << "Masked vector loads and stores are not supported by the target platform";
+
+    auto inputTrees = "(method return= NoType args=[Address,Address,Address,Address]   "
+                      "  (block                                                        "
+                      "     (vstoreiVector128Int32 offset=0                            "
+                      "         (aload parm=0)                                         "
+                      "         (vmloadiVector128Int32 (aload parm=2)                  "
+                      "             (vcmpgtVector128Int32ToMask128Int32                "
+                      "                 (vloadiVector128Int32 (aload parm=2))          "
+                      "                 (vloadiVector128Int32 (aload parm=3)))))       "
+                      "     (vmstoreiVector128Int32 offset=0                           "
+                      "         (aload parm=1)                                         "
+                      "         (vloadiVector128Int32 (aload parm=2))                  "
+                      "         (vcmpgtVector128Int32ToMask128Int32                    "
+                      "             (vloadiVector128Int32 (aload parm=2))              "
+                      "             (vloadiVector128Int32 (aload parm=3))))            "
+                      "     (return)))                                                 ";
+
+    auto trees = parseString(inputTrees);
+
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    ASSERT_EQ(0, compiler.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+    auto entry_point = compiler.getEntryPoint<void (*)(int32_t[],int32_t[],int32_t[],int32_t[])>();
+
+    int32_t loaded[] = { -1, -1, -1, -1 };
+    int32_t stored[] = { -1, -1, -1, -1 };
+    int32_t inputA[] = { 1, 5, 3, 7 };
+    int32_t inputB[] = { 2, 4, 3, 6 };
+
+    entry_point(loaded, stored, inputA, inputB);
+
+    for (int i = 0; i < (sizeof(inputA) / sizeof(*inputA)); i++) {
+        EXPECT_EQ(inputA[i] > inputB[i] ? inputA[i] : 0, loaded[i]) << "at index " << i;
+        EXPECT_EQ(inputA[i] > inputB[i] ? inputA[i] : -1, stored[i]) << "at index " << i;
+    }
+}
+
+TEST_F(VectorLocalCSETest, VInt32MaskedLoadStoreAreNotCopyPropagated) {
+    SKIP_ON_S390(KnownBug) << "This test is currently disabled on Z platforms because not all Z platforms have vector support (issue #1843)";
+    SKIP_ON_S390X(KnownBug) << "This test is currently disabled on Z platforms because not all Z platforms have vector support (issue #1843)";
+    SKIP_ON_RISCV(MissingImplementation);
+
+    TR::CPU cpu = TR::CPU::detect(privateOmrPortLibrary);
+    TR::DataType vectorType = TR::DataType::createVectorType(TR::Int32, TR::VectorLength128);
+    TR::DataType maskType = TR::DataType::createMaskType(TR::Int32, TR::VectorLength128);
+    bool platformSupport = TR::CodeGenerator::getSupportsOpCodeForAutoSIMD(&cpu, TR::ILOpCode::createVectorOpCode(TR::vmloadi, vectorType)) &&
+                           TR::CodeGenerator::getSupportsOpCodeForAutoSIMD(&cpu, TR::ILOpCode::createVectorOpCode(TR::vmstorei, vectorType)) &&
+                           TR::CodeGenerator::getSupportsOpCodeForAutoSIMD(&cpu, TR::ILOpCode::createVectorOpCode(TR::vcmpgt, vectorType, maskType));
+    SKIP_IF(!platformSupport, MissingImplementation) << "Masked vector loads and stores are not supported by the target platform";
+
+    // The masked load and the plain load each read the address the preceding store wrote
+    auto inputTrees = "(method return= NoType args=[Address,Address,Address,Address,Address,Address] "
+                      "  (block                                                        "
+                      "     (vstoreiVector128Int32 offset=0                            "
+                      "         (aload parm=4 id=\"stored\")                         "
+                      "         (vloadiVector128Int32 (aload parm=2)))                 "
+                      "     (vstoreiVector128Int32 offset=0                            "
+                      "         (aload parm=0)                                         "
+                      "         (vmloadiVector128Int32 offset=0 (@id \"stored\")     "
+                      "             (vcmpgtVector128Int32ToMask128Int32                "
+                      "                 (vloadiVector128Int32 (aload parm=2))          "
+                      "                 (vloadiVector128Int32 (aload parm=3)))))       "
+                      "     (vmstoreiVector128Int32 offset=0                           "
+                      "         (aload parm=5 id=\"masked\")                         "
+                      "         (vloadiVector128Int32 (aload parm=3))                  "
+                      "         (vcmpgtVector128Int32ToMask128Int32                    "
+                      "             (vloadiVector128Int32 (aload parm=2))              "
+                      "             (vloadiVector128Int32 (aload parm=3))))            "
+                      "     (vstoreiVector128Int32 offset=0                            "
+                      "         (aload parm=1)                                         "
+                      "         (vloadiVector128Int32 offset=0 (@id \"masked\")))    "
+                      "     (return)))                                                 ";
+
+    auto trees = parseString(inputTrees);
+
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    ASSERT_EQ(0, compiler.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+    auto entry_point = compiler.getEntryPoint<void (*)(int32_t[],int32_t[],int32_t[],int32_t[],int32_t[],int32_t[])>();
+
+    int32_t loaded[] = { -1, -1, -1, -1 };
+    int32_t merged[] = { -1, -1, -1, -1 };
+    int32_t inputA[] = { 1, 5, 3, 7 };
+    int32_t inputB[] = { 2, 4, 3, 6 };
+    int32_t stored[] = { 0, 0, 0, 0 };
+    int32_t masked[] = { 1, 5, 3, 7 };
+
+    entry_point(loaded, merged, inputA, inputB, stored, masked);
+
+    for (int i = 0; i < (sizeof(inputA) / sizeof(*inputA)); i++) {
+        EXPECT_EQ(inputA[i] > inputB[i] ? inputA[i] : 0, loaded[i]) << "at index " << i;
+        EXPECT_EQ(inputA[i] > inputB[i] ? inputB[i] : inputA[i], merged[i]) << "at index " << i;
+    }
+}
+
 /* 128/256/512-Bit Float tests*/
 #if !defined(J9ZOS390) && !defined(AIXPPC)
 /* XLC won't accept FNAN/DNAN or 0.0 / 0.0 */
@@ -19,15 +19,25 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
  *******************************************************************************/
 
+#include "AllocateDescription.hpp"
+#include "AtomicOperations.hpp"
 #include "CollectorLanguageInterface.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCConfigTest.hpp"
+#include "GCExtensionsBase.hpp"
+#include "MemoryPool.hpp"
+#include "MemorySubSpace.hpp"
+#include "mmomrhook.h"
+#include "ObjectAllocationInterface.hpp"
 #include "ObjectAllocationModel.hpp"
 #include "ObjectModel.hpp"
 #include "omrExampleVM.hpp"
 #include "omrgc.h"
 #include "SlotObject.hpp"
+#include "SparseAddressOrderedFixedSizeDataPool.hpp"
+#include "SparseVirtualMemory.hpp"
 #include "StandardWriteBarrier.hpp"
+#include "VerboseBinaryConverter.hpp"
 #include "VerboseWriterChain.hpp"
 
 //#define OMRGCTEST_PRINTFILE
@@ -43,30 +53,109 @@
 const char *gcTests[] = {"fvtest/gctest/configuration/sample_GC_config.xml"
                         , "fvtest/gctest/configuration/test_system_gc.xml"
                         , "fvtest/gctest/configuration/global_GC_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_workStealing_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_sizeClassBins_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_explicitLargePages_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_backgroundHeapRelease_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_concurrentSparseHeap_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_binaryVerboseLogging_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_adaptiveTLHThreads_config.xml"
+#if defined(OMR_GC_MODRON_COMPACTION)
+                        , "fvtest/gctest/configuration/global_GC_pipelinedCompaction_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_windowCompaction_config.xml"
+#endif
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
                         , "fvtest/gctest/configuration/optavgpause_GC_config.xml"
+                        , "fvtest/gctest/configuration/optavgpause_GC_finalCardCleaning_config.xml"
 #endif
 #if defined(OMR_GC_MODRON_SCAVENGER)
                         , "fvtest/gctest/configuration/scavenger_GC_config.xml"
                         , "fvtest/gctest/configuration/scavenger_GC_backout_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_numaAwareCopy_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_adaptiveTLH_config.xml"
 #endif
 #if defined(OMR_GC_MODRON_SCAVENGER) && defined(OMR_GC_MODRON_CONCURRENT_MARK)
                         , "fvtest/gctest/configuration/gencon_GC_config.xml"
                         , "fvtest/gctest/configuration/gencon_GC_backout_config.xml"
+                        , "fvtest/gctest/configuration/gencon_GC_scanPrefetch_config.xml"
+                        , "fvtest/gctest/configuration/gencon_GC_lockFreeTLH_config.xml"
+                        , "fvtest/gctest/configuration/gencon_GC_hotFieldSampling_config.xml"
+                        , "fvtest/gctest/configuration/gencon_GC_shardedRememberedSet_config.xml"
+                        , "fvtest/gctest/configuration/gencon_GC_elasticThreads_config.xml"
+                        , "fvtest/gctest/configuration/gencon_GC_transparentLargePages_config.xml"
+#endif
+#if defined(OMR_GC_SEGREGATED_HEAP)
+                        , "fvtest/gctest/configuration/segregated_GC_deferredSweep_config.xml"
+                        , "fvtest/gctest/configuration/segregated_GC_incremental_config.xml"
 #endif
                         };
 
 const char *perfTests[] = {"perftest/gctest/configuration/21645_core.20150126.202455.11862202.0001.xml",
-								"perftest/gctest/configuration/24404_core.20140723.091737.5812.0002.xml"};
+								"perftest/gctest/configuration/24404_core.20140723.091737.5812.0002.xml",
+								"perftest/gctest/configuration/markScaling_workPackets_1threads.xml",
+								"perftest/gctest/configuration/markScaling_workPackets_2threads.xml",
+								"perftest/gctest/configuration/markScaling_workPackets_4threads.xml",
+								"perftest/gctest/configuration/markScaling_workPackets_8threads.xml",
+								"perftest/gctest/configuration/markScaling_workStealing_1threads.xml",
+								"perftest/gctest/configuration/markScaling_workStealing_2threads.xml",
+								"perftest/gctest/configuration/markScaling_workStealing_4threads.xml",
+								"perftest/gctest/configuration/markScaling_workStealing_8threads.xml",
+								"perftest/gctest/configuration/tlhRefresh_locked_1threads.xml",
+								"perftest/gctest/configuration/tlhRefresh_locked_2threads.xml",
+								"perftest/gctest/configuration/tlhRefresh_locked_4threads.xml",
+								"perftest/gctest/configuration/tlhRefresh_locked_8threads.xml",
+								"perftest/gctest/configuration/tlhRefresh_lockFree_1threads.xml",
+								"perftest/gctest/configuration/tlhRefresh_lockFree_2threads.xml",
+								"perftest/gctest/configuration/tlhRefresh_lockFree_4threads.xml",
+								"perftest/gctest/configuration/tlhRefresh_lockFree_8threads.xml",
+								"perftest/gctest/configuration/sparseAllocFree_locked_1threads.xml",
+								"perftest/gctest/configuration/sparseAllocFree_locked_2threads.xml",
+								"perftest/gctest/configuration/sparseAllocFree_locked_4threads.xml",
+								"perftest/gctest/configuration/sparseAllocFree_locked_8threads.xml",
+								"perftest/gctest/configuration/sparseAllocFree_concurrent_1threads.xml",
+								"perftest/gctest/configuration/sparseAllocFree_concurrent_2threads.xml",
+								"perftest/gctest/configuration/sparseAllocFree_concurrent_4threads.xml",
+								"perftest/gctest/configuration/sparseAllocFree_concurrent_8threads.xml",
+								"perftest/gctest/configuration/pauseTime_optavgpause_tree.xml",
+								"perftest/gctest/configuration/pauseTime_optavgpause_lowSurvival.xml",
+								"perftest/gctest/configuration/pauseTime_optavgpause_largeArrays.xml"
+#if defined(OMR_GC_MODRON_SCAVENGER) && defined(OMR_GC_MODRON_CONCURRENT_MARK)
+								, "perftest/gctest/configuration/pauseTime_gencon_tree.xml"
+								, "perftest/gctest/configuration/pauseTime_gencon_lowSurvival.xml"
+								, "perftest/gctest/configuration/pauseTime_gencon_largeArrays.xml"
+								, "perftest/gctest/configuration/elasticThreads_smallNursery_fixed.xml"
+								, "perftest/gctest/configuration/elasticThreads_smallNursery_elastic.xml"
+								, "perftest/gctest/configuration/elasticThreads_largeNursery_fixed.xml"
+								, "perftest/gctest/configuration/elasticThreads_largeNursery_elastic.xml"
+#endif
+#if defined(OMR_GC_SEGREGATED_HEAP)
+								, "perftest/gctest/configuration/pauseTime_segregated_tree.xml"
+								, "perftest/gctest/configuration/pauseTime_segregated_lowSurvival.xml"
+								, "perftest/gctest/configuration/pauseTime_segregated_largeArrays.xml"
+								, "perftest/gctest/configuration/pauseTime_segregatedIncremental_tree.xml"
+#endif
+								};
 void
 GCConfigTest::SetUp()
+{
+	setUpConfig(GetParam());
+}
+
+void
+GCConfigTest::TearDown()
+{
+	tearDownConfig();
+}
+
+void
+GCConfigTest::setUpConfig(const char *configFile)
 {
 	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
 
 	printMemUsed("Setup()", gcTestEnv->portLib);
 
-	gcTestEnv->log("Configuration File: %s\n", GetParam());
-	MM_StartupManagerTestExample startupManager(exampleVM->_omrVM, GetParam());
+	gcTestEnv->log("Configuration File: %s\n", configFile);
+	MM_StartupManagerTestExample startupManager(exampleVM->_omrVM, configFile);
 
 	/* Initialize heap and collector */
 	omr_error_t rc = OMR_GC_IntializeHeapAndCollector(exampleVM->_omrVM, &startupManager);
@@ -89,11 +178,11 @@ GCConfigTest::SetUp()
 
 	/* load config file */
 #if defined(OMRGCTEST_PRINTFILE)
-	printFile(GetParam());
+	printFile(configFile);
 #endif
-	pugi::xml_parse_result result = doc.load_file(GetParam());
+	pugi::xml_parse_result result = doc.load_file(configFile);
 	if (!result) {
-		FAIL() << "Failed to load test configuration file (" << GetParam() << ") with error description: " << result.description() << ".";
+		FAIL() << "Failed to load test configuration file (" << configFile << ") with error description: " << result.description() << ".";
 	}
 
 	/* parse verbose information and initialize verbose manager */
@@ -114,7 +203,14 @@ GCConfigTest::SetUp()
 	gcTestEnv->log("Verbose File: %s\n", verboseFile);
 	gcTestEnv->log(LEVEL_VERBOSE, "Verbose GC log name: %s; numOfFiles: %d; numOfCycles: %d.\n", verboseFile, numOfFiles, numOfCycles);
 	verboseManager->enableVerboseGC();
-	verboseManager->setInitializedTime(omrtime_hires_clock());
+
+	/* report the GC as initialized the way a runtime does, so the log starts with the initialized stanza */
+	MM_InitializedEvent initializedEvent;
+	memset(&initializedEvent, 0, sizeof(initializedEvent));
+	initializedEvent.currentThread = exampleVM->_omrVMThread;
+	initializedEvent.timestamp = omrtime_hires_clock();
+	J9HookInterface **omrHooks = J9_HOOK_INTERFACE(env->getExtensions()->omrHookInterface);
+	(*omrHooks)->J9HookDispatch(omrHooks, J9HOOK_MM_OMR_INITIALIZED, &initializedEvent);
 
 	/* Initialize root table */
 	exampleVM->rootTable = hashTableNew(
@@ -128,7 +224,7 @@ GCConfigTest::SetUp()
 }
 
 void
-GCConfigTest::TearDown()
+GCConfigTest::tearDownConfig()
 {
 	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
 
@@ -690,6 +786,7 @@ GCConfigTest::removeObjectFromParentSlot(const char *name, ObjectEntry *parentEn
 		GC_SlotObject slotObject(exampleVM->_omrVM, currentSlot);
 		if (objEntry->objPtr == slotObject.readReferenceFromSlot()) {
 			gcTestEnv->log(LEVEL_VERBOSE, "Remove object %s(%p[0x%llx]) from parent %s(%p[0x%llx]) slot %p.\n", name, objEntry->objPtr, objEntry->objPtr->header.raw(), parentEntry->name, parentEntry->objPtr, parentEntry->objPtr->header.raw(), slotObject.readAddressFromSlot());
+			standardPreWriteBarrier(exampleVM->_omrVMThread, currentSlot);
 			slotObject.writeReferenceToSlot(NULL);
 			rt = 0;
 			break;
@@ -809,6 +906,55 @@ printFile(const char *name)
 }
 #endif
 
+/**
+ * Load a verbose log for verification. Logs written with binaryVerboseLogging are converted back
+ * to XML by VerboseBinaryConverter, so the same xqueries check both formats.
+ */
+pugi::xml_parse_result
+GCConfigTest::loadVerboseLog(pugi::xml_document *verboseDoc, const char *fileName)
+{
+	MM_GCExtensionsBase *extensions = (MM_GCExtensionsBase *)exampleVM->_omrVM->_gcOmrVMExtensions;
+	if (!extensions->binaryVerboseLogging) {
+		return verboseDoc->load_file(fileName);
+	}
+
+	pugi::xml_parse_result result;
+	FILE *input = fopen(fileName, "rb");
+	if (NULL == input) {
+		result.status = pugi::status_file_not_found;
+		return result;
+	}
+
+	FILE *output = tmpfile();
+	if (NULL == output) {
+		result.status = pugi::status_io_error;
+	} else {
+		VerboseBinaryConverter::Result rc = VerboseBinaryConverter::convert(input, output);
+		if (VerboseBinaryConverter::RC_OK != rc) {
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to convert binary verbose log %s: %s\n", __FILE__, __LINE__, fileName, VerboseBinaryConverter::getResultMessage(rc));
+			result.status = pugi::status_io_error;
+		} else {
+			OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+			long size = ftell(output);
+			char *xml = (char *)omrmem_allocate_memory(size, OMRMEM_CATEGORY_MM);
+			if (NULL == xml) {
+				result.status = pugi::status_out_of_memory;
+			} else {
+				rewind(output);
+				if ((size_t)size != fread(xml, 1, size, output)) {
+					result.status = pugi::status_io_error;
+				} else {
+					result = verboseDoc->load_buffer(xml, size);
+				}
+				omrmem_free_memory(xml);
+			}
+		}
+		fclose(output);
+	}
+	fclose(input);
+	return result;
+}
+
 int32_t
 GCConfigTest::verifyVerboseGC(pugi::xpath_node_set verboseGCs)
 {
@@ -826,11 +972,16 @@ GCConfigTest::verifyVerboseGC(pugi::xpath_node_set verboseGCs)
 		isFound[i] = false;
 	}
 
+	if (((MM_GCExtensionsBase *)exampleVM->_omrVM->_gcOmrVMExtensions)->binaryVerboseLogging) {
+		/* records still in the rings only reach the file, followed by the footer, once it is closed */
+		verboseManager->closeStreams(env);
+	}
+
 	/* Loop through multiple files if rolling log is enabled */
 	do {
 		pugi::xml_document verboseDoc;
 		if (0 == numOfFiles) {
-			verboseDoc.load_file(verboseFile);
+			loadVerboseLog(&verboseDoc, verboseFile);
 			gcTestEnv->log("Parsing verbose log %s:\n", verboseFile);
 #if defined(OMRGCTEST_PRINTFILE)
 			printFile(verboseFile);
@@ -838,7 +989,7 @@ GCConfigTest::verifyVerboseGC(pugi::xpath_node_set verboseGCs)
 		} else {
 			char currentVerboseFile[MAX_NAME_LENGTH];
 			omrstr_printf(currentVerboseFile, MAX_NAME_LENGTH, "%s.%03zu", verboseFile, seq++);
-			pugi::xml_parse_result result = verboseDoc.load_file(currentVerboseFile);
+			pugi::xml_parse_result result = loadVerboseLog(&verboseDoc, currentVerboseFile);
 			if (pugi::status_file_not_found == result.status) {
 				break;
 			}
@@ -973,8 +1124,600 @@ GCConfigTest::triggerOperation(pugi::xml_node node)
 			}
 			OMRGCTEST_CHECK_RT(rt);
 			verboseManager->getWriterChain()->endOfCycle(env);
+		} else if (0 == strcmp(node.name(), "tlhRefresh")) {
+			rt = tlhRefreshBenchmark(node);
+			OMRGCTEST_CHECK_RT(rt);
+		} else if (0 == strcmp(node.name(), "tlhAllocate")) {
+			rt = tlhAllocateThreads(node);
+			OMRGCTEST_CHECK_RT(rt);
+		} else if (0 == strcmp(node.name(), "sparseAllocFree")) {
+			rt = sparseAllocFreeBenchmark(node);
+			OMRGCTEST_CHECK_RT(rt);
+		} else if (0 == strcmp(node.name(), "idle")) {
+			/* give background GC threads time to run while the mutator does nothing */
+			int64_t timeMillis = (int64_t)atoi(node.attribute("timems").value());
+			gcTestEnv->log("Idling for %lld ms...\n", timeMillis);
+			omrthread_sleep(timeMillis);
+		}
+	}
+done:
+	return rt;
+}
+
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+typedef struct TLHRefreshControl {
+	OMR_VM *omrVM;
+	MM_MemoryPool *memoryPool;
+	uintptr_t refreshSize;
+	omrthread_monitor_t monitor;
+	uintptr_t started;
+	uintptr_t finished;
+	uintptr_t detached;
+	bool go;
+	volatile uintptr_t refreshCount;
+	volatile uintptr_t failures;
+} TLHRefreshControl;
+
+/**
+ * Worker for the tlhRefresh operation: attach, wait for the start signal, then refresh TLHs
+ * directly from the memory pool until it is exhausted.
+ */
+static int J9THREAD_PROC
+tlhRefreshWorker(void *arg)
+{
+	TLHRefreshControl *control = (TLHRefreshControl *)arg;
+	OMR_VMThread *omrVMThread = NULL;
+	uintptr_t refreshCount = 0;
+
+	if (OMR_ERROR_NONE != OMR_Thread_Init(control->omrVM, NULL, &omrVMThread, "TLHRefreshWorker")) {
+		MM_AtomicOperations::add(&control->failures, 1);
+	}
+
+	omrthread_monitor_enter(control->monitor);
+	control->started += 1;
+	omrthread_monitor_notify_all(control->monitor);
+	while (!control->go) {
+		omrthread_monitor_wait(control->monitor);
+	}
+	omrthread_monitor_exit(control->monitor);
+
+	if (NULL != omrVMThread) {
+		MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrVMThread);
+		MM_AllocateDescription allocDescription(0, 0, false, true);
+		void *addrBase = NULL;
+		void *addrTop = NULL;
+		while (NULL != control->memoryPool->allocateTLH(env, &allocDescription, control->refreshSize, addrBase, addrTop)) {
+			control->memoryPool->abandonTlhHeapChunk(addrBase, addrTop);
+			refreshCount += 1;
+		}
+		MM_AtomicOperations::add(&control->refreshCount, refreshCount);
+	}
+
+	omrthread_monitor_enter(control->monitor);
+	control->finished += 1;
+	omrthread_monitor_notify_all(control->monitor);
+	omrthread_monitor_exit(control->monitor);
+
+	if (NULL != omrVMThread) {
+		OMR_Thread_Free(omrVMThread);
+	}
+
+	omrthread_monitor_enter(control->monitor);
+	control->detached += 1;
+	omrthread_monitor_notify_all(control->monitor);
+	omrthread_monitor_exit(control->monitor);
+
+	return 0;
+}
+#endif /* defined(OMR_GC_THREAD_LOCAL_HEAP) */
+
+/**
+ * Measure TLH refresh throughput: threadCount threads refresh TLHs of refreshSize bytes straight from
+ * the default memory pool until it is exhausted, and a global collection rebuilds the free list between
+ * rounds. Reports refreshes per millisecond over all rounds.
+ */
+int32_t
+GCConfigTest::tlhRefreshBenchmark(pugi::xml_node node)
+{
+	int32_t rt = 0;
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+
+	const char *threadCountStr = node.attribute("threadCount").value();
+	const char *refreshSizeStr = node.attribute("refreshSize").value();
+	const char *roundsStr = node.attribute("rounds").value();
+	uintptr_t threadCount = (0 == strcmp(threadCountStr, "")) ? 1 : (uintptr_t)atoi(threadCountStr);
+	uintptr_t refreshSize = (0 == strcmp(refreshSizeStr, "")) ? 4096 : (uintptr_t)atoi(refreshSizeStr);
+	uintptr_t rounds = (0 == strcmp(roundsStr, "")) ? 1 : (uintptr_t)atoi(roundsStr);
+	uint64_t elapsedMicros = 0;
+	uintptr_t totalRefreshes = 0;
+
+	MM_MemorySubSpace *memorySubSpace = env->getDefaultMemorySubSpace();
+	while ((NULL != memorySubSpace) && (NULL == memorySubSpace->getMemoryPool())) {
+		memorySubSpace = memorySubSpace->getChildren();
+	}
+	if ((0 == threadCount) || (0 == refreshSize) || (NULL == memorySubSpace)) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Invalid tlhRefresh operation.\n", __FILE__, __LINE__);
+		goto done;
+	}
+
+	gcTestEnv->log("Refreshing %zu byte TLHs from %zu thread(s) for %zu round(s)...\n", refreshSize, threadCount, rounds);
+	for (uintptr_t round = 0; round < rounds; round++) {
+		TLHRefreshControl control;
+		memset(&control, 0, sizeof(control));
+		control.omrVM = exampleVM->_omrVM;
+		control.memoryPool = memorySubSpace->getMemoryPool();
+		control.refreshSize = refreshSize;
+		if (0 != omrthread_monitor_init_with_name(&control.monitor, 0, "TLHRefreshBenchmark")) {
+			rt = 1;
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to create monitor.\n", __FILE__, __LINE__);
+			goto done;
 		}
+
+		uintptr_t created = 0;
+		for (; created < threadCount; created++) {
+			omrthread_t thread = NULL;
+			if (0 != omrthread_create(&thread, 0, J9THREAD_PRIORITY_NORMAL, 0, tlhRefreshWorker, &control)) {
+				rt = 1;
+				gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to create worker thread.\n", __FILE__, __LINE__);
+				break;
+			}
+		}
+
+		omrthread_monitor_enter(control.monitor);
+		while (control.started < created) {
+			omrthread_monitor_wait(control.monitor);
+		}
+		uint64_t startTime = omrtime_hires_clock();
+		control.go = true;
+		omrthread_monitor_notify_all(control.monitor);
+		while (control.finished < created) {
+			omrthread_monitor_wait(control.monitor);
+		}
+		elapsedMicros += omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		while (control.detached < created) {
+			omrthread_monitor_wait(control.monitor);
+		}
+		omrthread_monitor_exit(control.monitor);
+		omrthread_monitor_destroy(control.monitor);
+
+		totalRefreshes += control.refreshCount;
+		if (0 != control.failures) {
+			rt = 1;
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to attach worker thread.\n", __FILE__, __LINE__);
+		}
+		OMRGCTEST_CHECK_RT(rt);
+
+		/* rebuild the free list from the abandoned TLHs for the next round */
+		rt = (int32_t)OMR_GC_SystemCollect(exampleVM->_omrVMThread, 0);
+		if (OMR_ERROR_NONE != rt) {
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to perform OMR_GC_SystemCollect with error code %d.\n", __FILE__, __LINE__, rt);
+			goto done;
+		}
+		verboseManager->getWriterChain()->endOfCycle(env);
+	}
+
+	gcTestEnv->log("TLH refreshes: %zu in %llu us (%llu refreshes/ms)\n",
+			totalRefreshes, elapsedMicros, (0 == elapsedMicros) ? 0 : ((uint64_t)totalRefreshes * 1000) / elapsedMicros);
+	if (0 == totalRefreshes) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d No TLH refreshes succeeded.\n", __FILE__, __LINE__);
 	}
+
+done:
+#endif /* defined(OMR_GC_THREAD_LOCAL_HEAP) */
+	return rt;
+}
+
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+typedef struct TLHAllocateControl {
+	OMR_VM *omrVM;
+	uintptr_t hotThreads;
+	uintptr_t hotBytes;
+	uintptr_t coldBytes;
+	uintptr_t objectSize;
+	omrthread_monitor_t monitor;
+	uintptr_t nextId;
+	uintptr_t started;
+	uintptr_t cycle;
+	uintptr_t finished;
+	uintptr_t detached;
+	bool exit;
+	uintptr_t *refreshSizes;
+	volatile uintptr_t failures;
+} TLHAllocateControl;
+
+/**
+ * Worker for the tlhAllocate operation: stay attached across collections and, each time the cycle
+ * is advanced, allocate this thread's share of objects and record the average size of the TLH
+ * refreshes it took. The first hotThreads workers allocate hotBytes per cycle, the rest coldBytes.
+ */
+static int J9THREAD_PROC
+tlhAllocateWorker(void *arg)
+{
+	TLHAllocateControl *control = (TLHAllocateControl *)arg;
+	OMR_VMThread *omrVMThread = NULL;
+
+	if (OMR_ERROR_NONE != OMR_Thread_Init(control->omrVM, NULL, &omrVMThread, "TLHAllocateWorker")) {
+		MM_AtomicOperations::add(&control->failures, 1);
+	}
+
+	omrthread_monitor_enter(control->monitor);
+	uintptr_t id = control->nextId++;
+	control->started += 1;
+	omrthread_monitor_notify_all(control->monitor);
+	for (uintptr_t cycle = 1;; cycle++) {
+		while (!control->exit && (control->cycle < cycle)) {
+			omrthread_monitor_wait(control->monitor);
+		}
+		if (control->exit) {
+			break;
+		}
+		omrthread_monitor_exit(control->monitor);
+
+		uintptr_t refreshSize = 0;
+		if (NULL != omrVMThread) {
+			MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrVMThread);
+			uintptr_t bytes = (id < control->hotThreads) ? control->hotBytes : control->coldBytes;
+			uint8_t objectAllocationModelSpace[sizeof(MM_ObjectAllocationModel)];
+			for (uintptr_t allocated = 0; allocated < bytes; allocated += control->objectSize) {
+				/* the collection between cycles is run by the main thread, never from an allocation here */
+				MM_ObjectAllocationModel *noGc = new(objectAllocationModelSpace)
+						MM_ObjectAllocationModel(env, control->objectSize, MM_ObjectAllocationModel::selectObjectAllocationFlags(false, false, false, true));
+				if (NULL == OMR_GC_AllocateObject(omrVMThread, noGc)) {
+					MM_AtomicOperations::add(&control->failures, 1);
+					break;
+				}
+			}
+			/* per thread stats are merged and cleared when the caches are flushed for the next collection */
+			MM_AllocationStats *stats = env->_objectAllocationInterface->getAllocationStats();
+			uintptr_t refreshCount = stats->tlhRefreshCount();
+			refreshSize = (0 == refreshCount) ? 0 : (stats->_tlhRequestedBytes / refreshCount);
+		}
+
+		omrthread_monitor_enter(control->monitor);
+		control->refreshSizes[id] = refreshSize;
+		control->finished += 1;
+		omrthread_monitor_notify_all(control->monitor);
+	}
+	omrthread_monitor_exit(control->monitor);
+
+	if (NULL != omrVMThread) {
+		OMR_Thread_Free(omrVMThread);
+	}
+
+	omrthread_monitor_enter(control->monitor);
+	control->detached += 1;
+	omrthread_monitor_notify_all(control->monitor);
+	omrthread_monitor_exit(control->monitor);
+
+	return 0;
+}
+#endif /* defined(OMR_GC_THREAD_LOCAL_HEAP) */
+
+/**
+ * Allocate from hotThreads threads at hotBytes per cycle and coldThreads threads at coldBytes per cycle,
+ * with a global collection after each of the given number of cycles. The threads stay attached so their
+ * TLH sizing carries over between cycles. Fails unless, in the last cycle, every hot thread refreshed
+ * with larger TLHs on average than every cold thread.
+ */
+int32_t
+GCConfigTest::tlhAllocateThreads(pugi::xml_node node)
+{
+	int32_t rt = 0;
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+
+	const char *hotThreadsStr = node.attribute("hotThreads").value();
+	const char *coldThreadsStr = node.attribute("coldThreads").value();
+	const char *hotBytesStr = node.attribute("hotBytes").value();
+	const char *coldBytesStr = node.attribute("coldBytes").value();
+	const char *objectSizeStr = node.attribute("objectSize").value();
+	const char *cyclesStr = node.attribute("cycles").value();
+	uintptr_t hotThreads = (0 == strcmp(hotThreadsStr, "")) ? 1 : (uintptr_t)atoi(hotThreadsStr);
+	uintptr_t coldThreads = (0 == strcmp(coldThreadsStr, "")) ? 1 : (uintptr_t)atoi(coldThreadsStr);
+	uintptr_t hotBytes = (uintptr_t)atoi(hotBytesStr);
+	uintptr_t coldBytes = (uintptr_t)atoi(coldBytesStr);
+	uintptr_t objectSize = (0 == strcmp(objectSizeStr, "")) ? 64 : (uintptr_t)atoi(objectSizeStr);
+	uintptr_t cycles = (0 == strcmp(cyclesStr, "")) ? 4 : (uintptr_t)atoi(cyclesStr);
+	uintptr_t threadCount = hotThreads + coldThreads;
+	uintptr_t created = 0;
+	TLHAllocateControl control;
+	memset(&control, 0, sizeof(control));
+
+	if ((0 == hotThreads) || (0 == coldThreads) || (hotBytes <= coldBytes) || (0 == objectSize) || (0 == cycles)) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Invalid tlhAllocate operation.\n", __FILE__, __LINE__);
+		goto done;
+	}
+
+	control.omrVM = exampleVM->_omrVM;
+	control.hotThreads = hotThreads;
+	control.hotBytes = hotBytes;
+	control.coldBytes = coldBytes;
+	control.objectSize = objectSize;
+	control.refreshSizes = (uintptr_t *)omrmem_allocate_memory(threadCount * sizeof(uintptr_t), OMRMEM_CATEGORY_MM);
+	if (NULL == control.refreshSizes) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to allocate native memory.\n", __FILE__, __LINE__);
+		goto done;
+	}
+	if (0 != omrthread_monitor_init_with_name(&control.monitor, 0, "TLHAllocateThreads")) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to create monitor.\n", __FILE__, __LINE__);
+		omrmem_free_memory(control.refreshSizes);
+		goto done;
+	}
+
+	gcTestEnv->log("Allocating %zu bytes per cycle from %zu hot thread(s) and %zu bytes per cycle from %zu cold thread(s) for %zu cycle(s)...\n",
+			hotBytes, hotThreads, coldBytes, coldThreads, cycles);
+	for (; created < threadCount; created++) {
+		omrthread_t thread = NULL;
+		if (0 != omrthread_create(&thread, 0, J9THREAD_PRIORITY_NORMAL, 0, tlhAllocateWorker, &control)) {
+			rt = 1;
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to create worker thread.\n", __FILE__, __LINE__);
+			break;
+		}
+	}
+
+	omrthread_monitor_enter(control.monitor);
+	while (control.started < created) {
+		omrthread_monitor_wait(control.monitor);
+	}
+	for (uintptr_t cycle = 1; (0 == rt) && (cycle <= cycles); cycle++) {
+		control.finished = 0;
+		control.cycle = cycle;
+		omrthread_monitor_notify_all(control.monitor);
+		while (control.finished < created) {
+			omrthread_monitor_wait(control.monitor);
+		}
+		omrthread_monitor_exit(control.monitor);
+
+		rt = (int32_t)OMR_GC_SystemCollect(exampleVM->_omrVMThread, 0);
+		if (OMR_ERROR_NONE != rt) {
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to perform OMR_GC_SystemCollect with error code %d.\n", __FILE__, __LINE__, rt);
+		} else {
+			verboseManager->getWriterChain()->endOfCycle(env);
+		}
+		omrthread_monitor_enter(control.monitor);
+	}
+	control.exit = true;
+	omrthread_monitor_notify_all(control.monitor);
+	while (control.detached < created) {
+		omrthread_monitor_wait(control.monitor);
+	}
+	omrthread_monitor_exit(control.monitor);
+	omrthread_monitor_destroy(control.monitor);
+
+	if (0 != control.failures) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d %zu worker thread(s) failed to attach or allocate.\n", __FILE__, __LINE__, control.failures);
+	} else if (0 == rt) {
+		uintptr_t smallestHot = UDATA_MAX;
+		uintptr_t largestCold = 0;
+		for (uintptr_t id = 0; id < threadCount; id++) {
+			if (id < hotThreads) {
+				smallestHot = OMR_MIN(smallestHot, control.refreshSizes[id]);
+			} else {
+				largestCold = OMR_MAX(largestCold, control.refreshSizes[id]);
+			}
+		}
+		gcTestEnv->log("Average TLH refresh in the last cycle: smallest hot thread %zu bytes, largest cold thread %zu bytes\n", smallestHot, largestCold);
+		if (smallestHot <= largestCold) {
+			rt = 1;
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Hot threads did not refresh larger TLHs than cold threads.\n", __FILE__, __LINE__);
+		}
+	}
+	omrmem_free_memory(control.refreshSizes);
+
+done:
+#endif /* defined(OMR_GC_THREAD_LOCAL_HEAP) */
+	return rt;
+}
+
+typedef struct SparseAllocFreeControl {
+	OMR_VM *omrVM;
+	MM_SparseVirtualMemory *sparseVirtualMemory;
+	bool verifyMapping;
+	uintptr_t iterations;
+	uintptr_t liveCount;
+	uintptr_t maxSize;
+	omrthread_monitor_t monitor;
+	uintptr_t started;
+	uintptr_t finished;
+	uintptr_t nextId;
+	bool go;
+	volatile uintptr_t operationCount;
+	volatile uintptr_t failures;
+} SparseAllocFreeControl;
+
+/**
+ * Worker for the sparseAllocFree operation: wait for the start signal, then allocate sparse regions of
+ * random size, touching their first and last bytes, and free the oldest one once liveCount regions are live.
+ * Each region is mapped to a distinct fake proxy object pointer.
+ */
+static int J9THREAD_PROC
+sparseAllocFreeWorker(void *arg)
+{
+	SparseAllocFreeControl *control = (SparseAllocFreeControl *)arg;
+	MM_SparseVirtualMemory *sparseVirtualMemory = control->sparseVirtualMemory;
+	uintptr_t failures = 0;
+	uintptr_t operations = 0;
+	void **live = (void **)calloc(control->liveCount, sizeof(void *));
+
+	omrthread_monitor_enter(control->monitor);
+	uintptr_t id = control->nextId++;
+	control->started += 1;
+	omrthread_monitor_notify_all(control->monitor);
+	while (!control->go) {
+		omrthread_monitor_wait(control->monitor);
+	}
+	omrthread_monitor_exit(control->monitor);
+
+	if (NULL == live) {
+		failures += 1;
+	} else {
+		uint32_t seed = (uint32_t)(id * 2654435761U) + 1;
+		OMR_VMThread *omrVMThread = NULL;
+		MM_EnvironmentBase *env = NULL;
+		if (OMR_ERROR_NONE == OMR_Thread_Init(control->omrVM, NULL, &omrVMThread, "SparseAllocFreeWorker")) {
+			env = MM_EnvironmentBase::getEnvironment(omrVMThread);
+		} else {
+			failures += 1;
+		}
+
+		for (uintptr_t i = 0; (NULL != env) && (i < control->iterations); i++) {
+			uintptr_t slot = i % control->liveCount;
+			if (NULL != live[slot]) {
+				if (!sparseVirtualMemory->freeSparseRegionAndUnmapFromHeapObject(env, live[slot])) {
+					failures += 1;
+				}
+				live[slot] = NULL;
+				operations += 1;
+			}
+
+			seed = (seed * 1103515245U) + 12345U;
+			uintptr_t size = 1 + ((seed >> 8) % control->maxSize);
+			/* fake proxy pointers are never dereferenced, they only have to be unique */
+			void *proxyObjPtr = (void *)((((id * control->iterations) + i) + 1) << 4);
+			uint8_t *dataPtr = (uint8_t *)sparseVirtualMemory->allocateSparseFreeEntryAndMapToHeapObject(proxyObjPtr, size);
+			if (NULL == dataPtr) {
+				failures += 1;
+				continue;
+			}
+			dataPtr[0] = 1;
+			dataPtr[size - 1] = 1;
+			if (control->verifyMapping) {
+				MM_SparseDataTableEntry *entry = sparseVirtualMemory->getSparseDataPool()->findSparseDataTableEntryForSparseDataPtr(dataPtr);
+				if ((NULL == entry) || (entry->_proxyObjPtr != proxyObjPtr) || (entry->_size < size)) {
+					failures += 1;
+				}
+			}
+			live[slot] = dataPtr;
+			operations += 1;
+		}
+
+		for (uintptr_t slot = 0; slot < control->liveCount; slot++) {
+			if ((NULL != live[slot]) && !sparseVirtualMemory->freeSparseRegionAndUnmapFromHeapObject(env, live[slot])) {
+				failures += 1;
+			}
+		}
+		if (NULL != omrVMThread) {
+			OMR_Thread_Free(omrVMThread);
+		}
+		free(live);
+	}
+
+	MM_AtomicOperations::add(&control->operationCount, operations);
+	MM_AtomicOperations::add(&control->failures, failures);
+
+	omrthread_monitor_enter(control->monitor);
+	control->finished += 1;
+	omrthread_monitor_notify_all(control->monitor);
+	omrthread_monitor_exit(control->monitor);
+
+	return 0;
+}
+
+/**
+ * Measure sparse heap allocate/free throughput: threadCount threads allocate and free regions of up to
+ * maxSize bytes from a sparse virtual memory reserved for the test heap, keeping liveCount regions live
+ * each. The sparse data pool is the one selected by concurrentSparseHeap. Reports operations per millisecond.
+ */
+int32_t
+GCConfigTest::sparseAllocFreeBenchmark(pugi::xml_node node)
+{
+	int32_t rt = 0;
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	const char *threadCountStr = node.attribute("threadCount").value();
+	const char *iterationsStr = node.attribute("iterations").value();
+	const char *liveCountStr = node.attribute("liveCount").value();
+	const char *maxSizeStr = node.attribute("maxSize").value();
+	uintptr_t threadCount = (0 == strcmp(threadCountStr, "")) ? 1 : (uintptr_t)atoi(threadCountStr);
+	uintptr_t iterations = (0 == strcmp(iterationsStr, "")) ? 1000 : (uintptr_t)atoi(iterationsStr);
+	uintptr_t liveCount = (0 == strcmp(liveCountStr, "")) ? 16 : (uintptr_t)atoi(liveCountStr);
+	uintptr_t maxSize = (0 == strcmp(maxSizeStr, "")) ? (64 * 1024) : (uintptr_t)atoi(maxSizeStr);
+	uintptr_t created = 0;
+	uint64_t elapsedMicros = 0;
+	const char *poolType = NULL;
+	const char *expectedPoolType = extensions->concurrentSparseHeap ? "MM_SparseSizeClassDataPool" : "MM_SparseAddressOrderedFixedSizeDataPool";
+	SparseAllocFreeControl control;
+	memset(&control, 0, sizeof(control));
+
+	if ((0 == threadCount) || (0 == liveCount) || (0 == maxSize)) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Invalid sparseAllocFree operation.\n", __FILE__, __LINE__);
+		goto done;
+	}
+
+	control.sparseVirtualMemory = MM_SparseVirtualMemory::newInstance(env, OMRMEM_CATEGORY_MM, extensions->heap);
+	if (NULL == control.sparseVirtualMemory) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to create sparse virtual memory.\n", __FILE__, __LINE__);
+		goto done;
+	}
+	/* the pool must be the one concurrentSparseHeap selects, or the operation would not measure or check it */
+	poolType = control.sparseVirtualMemory->getSparseDataPool()->getBaseVirtualTypeId();
+	if ((NULL == poolType) || (0 != strcmp(poolType, expectedPoolType))) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Sparse virtual memory uses %s rather than %s.\n", __FILE__, __LINE__, (NULL == poolType) ? "an unknown data pool" : poolType, expectedPoolType);
+		control.sparseVirtualMemory->kill(env);
+		goto done;
+	}
+	/* the address ordered pool hash table is only safe to read under the sparse virtual memory mutex */
+	control.omrVM = exampleVM->_omrVM;
+	control.verifyMapping = extensions->concurrentSparseHeap;
+	control.iterations = iterations;
+	control.liveCount = liveCount;
+	control.maxSize = maxSize;
+	if (0 != omrthread_monitor_init_with_name(&control.monitor, 0, "SparseAllocFreeBenchmark")) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to create monitor.\n", __FILE__, __LINE__);
+		control.sparseVirtualMemory->kill(env);
+		goto done;
+	}
+
+	gcTestEnv->log("Allocating and freeing sparse regions of up to %zu bytes from %zu thread(s), %zu iterations each (%s)...\n",
+			maxSize, threadCount, iterations, poolType);
+	for (; created < threadCount; created++) {
+		omrthread_t thread = NULL;
+		if (0 != omrthread_create(&thread, 0, J9THREAD_PRIORITY_NORMAL, 0, sparseAllocFreeWorker, &control)) {
+			rt = 1;
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to create worker thread.\n", __FILE__, __LINE__);
+			break;
+		}
+	}
+
+	omrthread_monitor_enter(control.monitor);
+	while (control.started < created) {
+		omrthread_monitor_wait(control.monitor);
+	}
+	{
+		uint64_t startTime = omrtime_hires_clock();
+		control.go = true;
+		omrthread_monitor_notify_all(control.monitor);
+		while (control.finished < created) {
+			omrthread_monitor_wait(control.monitor);
+		}
+		elapsedMicros = omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	}
+	omrthread_monitor_exit(control.monitor);
+	omrthread_monitor_destroy(control.monitor);
+
+	gcTestEnv->log("Sparse allocate/free operations: %zu in %llu us (%llu operations/ms)\n",
+			control.operationCount, elapsedMicros, (0 == elapsedMicros) ? 0 : ((uint64_t)control.operationCount * 1000) / elapsedMicros);
+	if (0 != control.failures) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d %zu sparse allocate/free operations failed.\n", __FILE__, __LINE__, control.failures);
+	} else if (0 != control.sparseVirtualMemory->getSparseDataPool()->getAllocObjectCount()) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Sparse regions are still allocated after all were freed.\n", __FILE__, __LINE__);
+	}
+	control.sparseVirtualMemory->kill(env);
+
 done:
 	return rt;
 }
@@ -1011,7 +1754,131 @@ GCConfigTest::iniXMLStr(const char *configStyle)
 	return rt;
 }
 
-TEST_P(GCConfigTest, test)
+/**
+ * Collect the values of the given space separated attributes of every node that xpathNodes selects
+ * in the verbose log of the current run, one string per node in document order.
+ */
+int32_t
+GCConfigTest::collectVerboseGCValues(const char *xpathNodesStr, const char *attributesStr, std::vector<std::string> *values)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	int32_t rt = 0;
+	uintptr_t seq = 1;
+
+	pugi::xpath_query nodeQuery(xpathNodesStr);
+	if (!nodeQuery) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Invalid xpathNodes string \"%s\" specified in configuration file.\n", __FILE__, __LINE__, xpathNodesStr);
+		return 1;
+	}
+
+	if (((MM_GCExtensionsBase *)exampleVM->_omrVM->_gcOmrVMExtensions)->binaryVerboseLogging) {
+		verboseManager->closeStreams(env);
+	}
+
+	do {
+		pugi::xml_document verboseDoc;
+		if (0 == numOfFiles) {
+			/* the log of a running VM is not closed yet, so only a missing file is an error */
+			pugi::xml_parse_result result = loadVerboseLog(&verboseDoc, verboseFile);
+			if (pugi::status_file_not_found == result.status) {
+				gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to load verbose log %s.\n", __FILE__, __LINE__, verboseFile);
+				rt = 1;
+				break;
+			}
+		} else {
+			char currentVerboseFile[MAX_NAME_LENGTH];
+			omrstr_printf(currentVerboseFile, MAX_NAME_LENGTH, "%s.%03zu", verboseFile, seq++);
+			pugi::xml_parse_result result = loadVerboseLog(&verboseDoc, currentVerboseFile);
+			if (pugi::status_file_not_found == result.status) {
+				break;
+			}
+		}
+
+		pugi::xpath_node_set xpathNodes = nodeQuery.evaluate_node_set(verboseDoc);
+		for (pugi::xpath_node_set::const_iterator it = xpathNodes.begin(); it != xpathNodes.end(); ++it) {
+			std::string value;
+			char attributes[MAX_NAME_LENGTH];
+			omrstr_printf(attributes, MAX_NAME_LENGTH, "%s", attributesStr);
+			for (char *name = strtok(attributes, " "); NULL != name; name = strtok(NULL, " ")) {
+				pugi::xml_attribute attr = it->node().attribute(name);
+				if (!attr) {
+					gcTestEnv->log(LEVEL_ERROR, "%s:%d Node <%s> selected by \"%s\" has no attribute %s.\n", __FILE__, __LINE__, it->node().name(), xpathNodesStr, name);
+					rt = 1;
+				}
+				value += std::string(value.empty() ? "" : " ") + name + "=" + attr.value();
+			}
+			values->push_back(value);
+		}
+	} while (seq <= numOfFiles);
+
+	return rt;
+}
+
+/**
+ * Collect the values every baselineGC element of the verification compares, so they can be checked
+ * against the baseline configuration once this run is complete.
+ */
+int32_t
+GCConfigTest::collectBaselineGC(pugi::xpath_node_set baselineGCs)
+{
+	int32_t rt = 0;
+	for (pugi::xpath_node_set::const_iterator it = baselineGCs.begin(); it != baselineGCs.end(); ++it) {
+		BaselineComparison comparison;
+		comparison.config = it->node().attribute("config").value();
+		comparison.xpathNodes = it->node().attribute("xpathNodes").value();
+		comparison.attributes = it->node().attribute("attributes").value();
+		rt |= collectVerboseGCValues(comparison.xpathNodes.c_str(), comparison.attributes.c_str(), &comparison.values);
+		if (comparison.values.empty()) {
+			gcTestEnv->log(LEVEL_ERROR, "*FAILED* Could not find xpath node \"%s\" in verbose output.\n", comparison.xpathNodes.c_str());
+			rt = 1;
+		}
+		baselineComparisons.push_back(comparison);
+	}
+	return rt;
+}
+
+/**
+ * Run the baseline configuration of each collected comparison in place of the current one, and check
+ * that its verbose log has the same values. The baseline's own verification is not run.
+ */
+int32_t
+GCConfigTest::verifyBaselineGC()
+{
+	int32_t rt = 0;
+	std::vector<BaselineComparison> comparisons;
+	comparisons.swap(baselineComparisons);
+
+	for (std::vector<BaselineComparison>::const_iterator it = comparisons.begin(); it != comparisons.end(); ++it) {
+		gcTestEnv->log("\n+++++++++++++++++++++++++++++Baseline+++++++++++++++++++++++++++\n");
+		tearDownConfig();
+		setUpConfig(it->config.c_str());
+		if (::testing::Test::HasFatalFailure()) {
+			return 1;
+		}
+		runConfig(false);
+		if (::testing::Test::HasFatalFailure()) {
+			return 1;
+		}
+
+		std::vector<std::string> baselineValues;
+		rt |= collectVerboseGCValues(it->xpathNodes.c_str(), it->attributes.c_str(), &baselineValues);
+		gcTestEnv->log("Comparing \"%s\" on xpath \"%s\" with %s:\n", it->attributes.c_str(), it->xpathNodes.c_str(), it->config.c_str());
+		if (baselineValues != it->values) {
+			rt = 1;
+			gcTestEnv->log(LEVEL_ERROR, "\t*FAILED* %zu nodes in this run, %zu in the baseline\n", it->values.size(), baselineValues.size());
+			for (size_t i = 0; i < OMR_MAX(it->values.size(), baselineValues.size()); i++) {
+				gcTestEnv->log(LEVEL_ERROR, "\t%s| %s\n",
+						(i < it->values.size()) ? it->values[i].c_str() : "", (i < baselineValues.size()) ? baselineValues[i].c_str() : "");
+			}
+		} else {
+			gcTestEnv->log("*PASSED*\n");
+		}
+	}
+	return rt;
+}
+
+void
+GCConfigTest::runConfig(bool verify)
 {
 	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
 
@@ -1038,6 +1905,9 @@ TEST_P(GCConfigTest, test)
 			}
 			gcTestEnv->log("Time elapsed in allocation: %lld ms\n", (omrtime_current_time_millis() - startTime));
 		} else if (0 == strcmp(configChild.name(), "verification")) {
+			if (!verify) {
+				continue;
+			}
 			gcTestEnv->log("\n++++++++++++++++++++++++++Verification++++++++++++++++++++++++++\n");
 			/* verboseGC verification */
 			char verboseNodeSet[MAX_NAME_LENGTH];
@@ -1046,6 +1916,10 @@ TEST_P(GCConfigTest, test)
 			pugi::xpath_node_set verboseGCs = configChild.select_nodes(verboseNodeSet);
 			rt = verifyVerboseGC(verboseGCs);
 			ASSERT_EQ(0, rt) << "Failed in verbose GC verification.";
+			/* baselineGC values are compared once the baseline configuration has run, after this one */
+			omrstr_printf(verboseNodeSet, MAX_NAME_LENGTH, "baselineGC[not(@spec) or @spec = '%s']", STRINGFY(SPEC));
+			rt = collectBaselineGC(configChild.select_nodes(verboseNodeSet));
+			ASSERT_EQ(0, rt) << "Failed to collect values to compare with the baseline configuration.";
 			gcTestEnv->log("[ Verification Successful ]\n\n");
 		} else if (0 == strcmp(configChild.name(), "operation")) {
 			gcTestEnv->log("\n++++++++++++++++++++++++++++Operation+++++++++++++++++++++++++++\n");
@@ -1059,6 +1933,14 @@ TEST_P(GCConfigTest, test)
 	}
 }
 
+TEST_P(GCConfigTest, test)
+{
+	runConfig(true);
+	if (!HasFatalFailure()) {
+		ASSERT_EQ(0, verifyBaselineGC()) << "Failed in baseline GC comparison.";
+	}
+}
+
 INSTANTIATE_TEST_CASE_P(gcFunctionalTest,GCConfigTest,
         ::testing::ValuesIn(gcTests));
 
@@ -19,6 +19,9 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
  *******************************************************************************/
 
+#include <string>
+#include <vector>
+
 #include "AllocateDescription.hpp"
 #include "CollectorLanguageInterface.hpp"
 #include "GCConfigObjectTable.hpp"
@@ -69,6 +72,17 @@ typedef struct XmlStr {
 	const char *structure;
 } XmlStr;
 
+/**
+ * A baselineGC verification: the attribute values this run produced on the selected nodes, to be
+ * compared with the values the baseline configuration produces.
+ */
+typedef struct BaselineComparison {
+	std::string config;
+	std::string xpathNodes;
+	std::string attributes;
+	std::vector<std::string> values;
+} BaselineComparison;
+
 class GCConfigTest : public ::testing::Test, public ::testing::WithParamInterface<const char *>
 {
 	/*
@@ -87,6 +101,8 @@ protected:
 	char *verboseFile;
 	uintptr_t numOfFiles;
 
+	std::vector<BaselineComparison> baselineComparisons;
+
 	/*
 	 * Function members
 	 */
@@ -107,9 +123,16 @@ protected:
 #if defined(OMRGCTEST_PRINTFILE)
 	void printFile(const char *name);
 #endif
+	pugi::xml_parse_result loadVerboseLog(pugi::xml_document *verboseDoc, const char *fileName);
 	int32_t verifyVerboseGC(pugi::xpath_node_set verboseGCs);
+	int32_t collectVerboseGCValues(const char *xpathNodesStr, const char *attributesStr, std::vector<std::string> *values);
+	int32_t collectBaselineGC(pugi::xpath_node_set baselineGCs);
+	int32_t verifyBaselineGC();
 	int32_t parseGarbagePolicy(pugi::xml_node node);
 	int32_t triggerOperation(pugi::xml_node node);
+	int32_t tlhRefreshBenchmark(pugi::xml_node node);
+	int32_t tlhAllocateThreads(pugi::xml_node node);
+	int32_t sparseAllocFreeBenchmark(pugi::xml_node node);
 	int32_t iniXMLStr(const char *configStyle);
 
 	/* This implementation assumes that existing entries hashed into the rootTable and objectTable can
@@ -146,6 +169,10 @@ protected:
 		return hashedEntry;
 	}
 
+	void setUpConfig(const char *configFile);
+	void tearDownConfig();
+	void runConfig(bool verify);
+
 	virtual void SetUp();
 	virtual void TearDown();
 
@@ -55,6 +55,8 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 		}
 
 		if (result) {
+			/* reported as the policy in the verbose initialized stanza */
+			extensions->gcModeString = "optavgpause";
 			for (pugi::xml_attribute attr = option.node().first_attribute(); attr; attr = attr.next_attribute()) {
 				if (0 == strcmp(attr.name(), "memoryMax")) {
 					extensions->memoryMax = atoi(attr.value()) * unitSize;
@@ -83,16 +85,103 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 				} else if (0 == strcmp(attr.name(), "maxSizeDefaultMemorySpace")) {
 					extensions->maxSizeDefaultMemorySpace = atoi(attr.value()) * unitSize;
 				} else if (0 == strcmp(attr.name(), "gcthreadCount")) {
-					/* TODO: support multi-thread GC*/
+					extensions->gcThreadCount = atoi(attr.value());
+					extensions->gcThreadCountSpecified = true;
+					extensions->gcThreadCountForced = true;
+				} else if (0 == strcmp(attr.name(), "elasticTaskThreads")) {
+					extensions->elasticTaskThreads = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "elasticTaskThreadWork")) {
+					extensions->elasticTaskThreadWork = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "largePagePolicy")) {
+					if (0 == j9_cmdla_stricmp(attr.value(), "transparent")) {
+						extensions->largePagePolicy = MM_GCExtensionsBase::LARGE_PAGE_POLICY_TRANSPARENT;
+					} else if (0 == j9_cmdla_stricmp(attr.value(), "explicit")) {
+						extensions->largePagePolicy = MM_GCExtensionsBase::LARGE_PAGE_POLICY_EXPLICIT;
+					} else {
+						extensions->largePagePolicy = MM_GCExtensionsBase::LARGE_PAGE_POLICY_NONE;
+					}
+				} else if (0 == strcmp(attr.name(), "backgroundHeapRelease")) {
+					extensions->backgroundHeapRelease = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "heapReleaseInterval")) {
+					extensions->heapReleaseInterval = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "heapReleaseAge")) {
+					extensions->heapReleaseAge = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "heapReleaseMinimumChunkSize")) {
+					extensions->heapReleaseMinimumChunkSize = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "heapReleaseMaximumOccupancy")) {
+					extensions->heapReleaseMaximumOccupancy = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "binaryVerboseLogging")) {
+					extensions->binaryVerboseLogging = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "concurrentSparseHeap")) {
+					extensions->concurrentSparseHeap = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "workStealingMarking")) {
+					extensions->workStealingMarking = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "scanPrefetchDistance")) {
+					extensions->scanPrefetchDistance = atoi(attr.value());
+#if defined(OMR_GC_MODRON_COMPACTION)
+				} else if (0 == strcmp(attr.name(), "compactOnGlobalGC")) {
+					extensions->compactOnGlobalGC = (0 == j9_cmdla_stricmp(attr.value(), "true")) ? 1 : 0;
+					extensions->noCompactOnGlobalGC = (0 == extensions->compactOnGlobalGC) ? 1 : 0;
+				} else if (0 == strcmp(attr.name(), "pipelinedCompaction")) {
+					extensions->pipelinedCompaction = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "compactWindowSize")) {
+					extensions->compactWindowSize = atoi(attr.value()) * unitSize;
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
+#if defined(OMR_GC_MODRON_SCAVENGER)
+				} else if (0 == strcmp(attr.name(), "scavengerHotFieldSampling")) {
+					extensions->scavengerHotFieldSampling = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "scavengerHotFieldSampleRate")) {
+					extensions->scavengerHotFieldSampleRate = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "gcCountBetweenHotFieldSort")) {
+					extensions->gcCountBetweenHotFieldSort = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "scavengerShardedRememberedSet")) {
+					extensions->scavengerShardedRememberedSet = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "scavengerRememberedSetChunkSize")) {
+					extensions->scavengerRememberedSetChunkSize = atoi(attr.value());
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+#if defined(OMR_GC_SEGREGATED_HEAP)
+				} else if (0 == strcmp(attr.name(), "incrementalSegregatedGC")) {
+					extensions->incrementalSegregatedGC = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+					extensions->deferredSegregatedSweep = extensions->deferredSegregatedSweep || extensions->incrementalSegregatedGC;
+				} else if (0 == strcmp(attr.name(), "deferredSegregatedSweep")) {
+					extensions->deferredSegregatedSweep = extensions->incrementalSegregatedGC || (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "segregatedQuantumMicros")) {
+					extensions->segregatedQuantumMicros = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "segregatedTargetUtilization")) {
+					extensions->segregatedTargetUtilization = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "segregatedGCTrigger")) {
+					extensions->segregatedGCTrigger = atoi(attr.value());
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+				} else if (0 == strcmp(attr.name(), "freeListSizeClassBins")) {
+					extensions->freeListSizeClassBins = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "adaptiveTLHSizing")) {
+					extensions->adaptiveTLHSizing = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "adaptiveTLHRefreshTarget")) {
+					extensions->adaptiveTLHRefreshTarget = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "lockFreeTLHRefresh")) {
+					extensions->lockFreeTLHRefresh = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "tlhCarveChunkSize")) {
+					extensions->tlhCarveChunkSize = atoi(attr.value()) * unitSize;
+				} else if (0 == strcmp(attr.name(), "splitFreeListSplitAmount")) {
+					extensions->splitFreeListSplitAmount = atoi(attr.value());
+					extensions->splitFreeListAmountForced = true;
 				} else if (0 == strcmp(attr.name(), "GCPolicy")) {
 					if (0 == j9_cmdla_stricmp(attr.value(), "gencon")) {
 #if defined(OMR_GC_MODRON_SCAVENGER)
 						extensions->scavengerEnabled = true;
+						extensions->gcModeString = "gencon";
 #else
 						gcTestEnv->log(LEVEL_ERROR, "WARNING: GCPolicy=gencon ignored, requires OMR_GC_MODRON_SCAVENGER (see configure_common.mk)\n");
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+					} else if (0 == j9_cmdla_stricmp(attr.value(), "segregated")) {
+#if defined(OMR_GC_SEGREGATED_HEAP)
+						_useSegregatedGC = true;
+						extensions->gcModeString = "segregated";
+#else
+						gcTestEnv->log(LEVEL_ERROR, "WARNING: GCPolicy=segregated ignored, requires OMR_GC_SEGREGATED_HEAP (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 					} else  if (0 != j9_cmdla_stricmp(attr.value(), "optavgpause")) {
-						gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized GC policy (expected gencon or optavgpause): %s\n", attr.value());
+						gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized GC policy (expected gencon, optavgpause or segregated): %s\n", attr.value());
 						result = false;
 					}
 				} else if (0 == strcmp(attr.name(), "concurrentMark")) {
@@ -101,11 +190,23 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 #else
 					gcTestEnv->log(LEVEL_ERROR, "WARNING: concurrentMark=true ignored, requires OMR_GC_MODRON_CONCURRENT_MARK (see configure_common.mk)\n");
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK)*/
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+				} else if (0 == strcmp(attr.name(), "concurrentSlack")) {
+					extensions->concurrentSlack = atoi(attr.value()) * unitSize;
+				} else if (0 == strcmp(attr.name(), "concurrentLevel")) {
+					extensions->concurrentLevel = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "optimizeConcurrentWB")) {
+					extensions->optimizeConcurrentWB = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
 #if defined(OMR_GC_MODRON_SCAVENGER)
 				} else if (0 == strcmp(attr.name(), "forceBackOut")) {
 					extensions->fvtest_forceScavengerBackout = (0 == j9_cmdla_stricmp(attr.value(), "true"));
 				} else if (0 == strcmp(attr.name(), "forcePoisonEvacuate")) {
 					extensions->fvtest_forcePoisonEvacuate = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "scavengerNumaAwareCopy")) {
+					extensions->scavengerNumaAwareCopy = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "simulatedNumaNodes")) {
+					extensions->_numaManager.setSimulatedNodeCountForFVTest(atoi(attr.value()));
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 				} else if ((0 == strcmp(attr.name(), "verboseLog")) || (0 == strcmp(attr.name(), "numOfFiles")) || (0 == strcmp(attr.name(), "numOfCycles")) || (0 == strcmp(attr.name(), "sizeUnit"))) {
 				} else {
@@ -0,0 +1,244 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "CardScanKernel.hpp"
+#include "MarkMapScanKernel.hpp"
+#include "ScanKernel.hpp"
+#include "gcTestHelpers.hpp"
+
+#include <gtest/gtest.h>
+
+/* deterministic generator for the synthetic card tables and mark maps */
+static uintptr_t
+nextRandom(uint64_t *seed)
+{
+	*seed = (*seed * 6364136223846793005ULL) + 1442695040888963407ULL;
+	return (uintptr_t)(*seed >> 33);
+}
+
+/**
+ * Collect the kernels of one family that this processor can run.
+ * @param getFunction[in] The getFunction() of the kernel family
+ * @param kinds[out] The supported kinds, scalar first
+ * @param functions[out] The scan function of each supported kind
+ * @return the number of supported kinds
+ */
+template <typename Function>
+static uintptr_t
+getSupportedKernels(Function (*getFunction)(MM_ScanKernel::Kind), MM_ScanKernel::Kind *kinds, Function *functions)
+{
+	OMRPortLibrary *portLibrary = gcTestEnv->getPortLibrary();
+	uintptr_t count = 0;
+
+	for (uintptr_t k = 0; k < MM_ScanKernel::kindCount; k++) {
+		MM_ScanKernel::Kind kind = (MM_ScanKernel::Kind)k;
+		if (MM_ScanKernel::isSupported(portLibrary, kind)) {
+			kinds[count] = kind;
+			functions[count] = getFunction(kind);
+			EXPECT_TRUE(NULL != functions[count]) << MM_ScanKernel::getName(kind);
+			count += 1;
+		}
+	}
+
+	return count;
+}
+
+TEST(gcFunctionalTestCardScanKernel, agreesWithScalar)
+{
+	const uintptr_t tableCards = 131;
+	/* a card the mask does not select (CARD_CLEAN_SAFE when cleaning for final card cleaning on weakly ordered platforms) */
+	const Card ignoredCard = (Card)(CARD_DIRTY << 7);
+	Card table[tableCards + 1];
+	MM_ScanKernel::Kind kinds[MM_ScanKernel::kindCount];
+	MM_CardScanKernel::FindDirtyCard functions[MM_ScanKernel::kindCount];
+	uintptr_t kernels = getSupportedKernels(MM_CardScanKernel::getFunction, kinds, functions);
+
+	for (uintptr_t k = 0; k < kernels; k++) {
+		MM_ScanKernel::Kind kind = kinds[k];
+		MM_CardScanKernel::FindDirtyCard findDirtyCard = functions[k];
+		ASSERT_TRUE(NULL != findDirtyCard);
+
+		/* every start offset (so vectors straddle any alignment) against every position of the first dirty card */
+		for (uintptr_t start = 0; start < 40; start++) {
+			for (uintptr_t dirty = start; dirty <= tableCards; dirty++) {
+				memset(table, CARD_CLEAN, sizeof(table));
+				for (uintptr_t ignored = start; ignored < dirty; ignored += 3) {
+					table[ignored] = ignoredCard;
+				}
+				table[dirty] = (Card)(CARD_DIRTY | ignoredCard);
+				if ((dirty + 1) < tableCards) {
+					table[dirty + 1] = CARD_DIRTY;
+				}
+				Card *expected = (dirty < tableCards) ? &table[dirty] : &table[tableCards];
+				ASSERT_EQ(expected, findDirtyCard(&table[start], &table[tableCards], CARD_DIRTY))
+					<< MM_ScanKernel::getName(kind) << " start=" << start << " dirty=" << dirty;
+				ASSERT_EQ(MM_CardScanKernel::findDirtyCardScalar(&table[start], &table[tableCards], CARD_DIRTY), findDirtyCard(&table[start], &table[tableCards], CARD_DIRTY));
+				/* a mask that selects the ignored cards too stops at the first of them */
+				Card *expectedEither = ((start < dirty) && (start < tableCards)) ? &table[start] : expected;
+				ASSERT_EQ(expectedEither, findDirtyCard(&table[start], &table[tableCards], (Card)(CARD_DIRTY | ignoredCard)))
+					<< MM_ScanKernel::getName(kind) << " start=" << start << " dirty=" << dirty;
+			}
+		}
+	}
+}
+
+TEST(perfTestCardScanKernel, cardCleaningThroughput)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->getPortLibrary());
+	const uintptr_t tableCards = 16 * 1024 * 1024;
+	const uintptr_t repeats = 8;
+	/* mean length, in cards, of the clean runs between dirty cards: heavily mutated to nearly clean heaps */
+	const uintptr_t meanCleanRuns[] = { 1, 8, 64, 512, 8192 };
+
+	MM_ScanKernel::Kind kinds[MM_ScanKernel::kindCount];
+	MM_CardScanKernel::FindDirtyCard functions[MM_ScanKernel::kindCount];
+	uintptr_t kernels = getSupportedKernels(MM_CardScanKernel::getFunction, kinds, functions);
+
+	Card *table = (Card *)omrmem_allocate_memory(tableCards * sizeof(Card), OMRMEM_CATEGORY_MM);
+	ASSERT_TRUE(NULL != table);
+
+	for (uintptr_t r = 0; r < (sizeof(meanCleanRuns) / sizeof(meanCleanRuns[0])); r++) {
+		uint64_t seed = 42;
+		Card *cursor = table;
+		Card *top = table + tableCards;
+		memset(table, CARD_CLEAN, tableCards * sizeof(Card));
+		while (cursor < top) {
+			cursor += nextRandom(&seed) % (2 * meanCleanRuns[r]);
+			if (cursor < top) {
+				*cursor = CARD_DIRTY;
+				cursor += 1;
+			}
+		}
+
+		for (uintptr_t k = 0; k < kernels; k++) {
+			MM_ScanKernel::Kind kind = kinds[k];
+			MM_CardScanKernel::FindDirtyCard findDirtyCard = functions[k];
+
+			/* the shape of the finalCleanCards() batch loop: find each dirty card, then step over it */
+			uintptr_t dirtyCards = 0;
+			uint64_t startTime = omrtime_hires_clock();
+			for (uintptr_t i = 0; i < repeats; i++) {
+				Card *current = MM_CardScanKernel::findDirtyCard(findDirtyCard, table, top, CARD_DIRTY);
+				while (current < top) {
+					dirtyCards += 1;
+					current = MM_CardScanKernel::findDirtyCard(findDirtyCard, current + 1, top, CARD_DIRTY);
+				}
+			}
+			uint64_t elapsedMicros = omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+			uint64_t cardsScanned = (uint64_t)repeats * tableCards;
+
+			gcTestEnv->log("mean clean run %4zu cards, %-6s: %8zu dirty cards, %llu us, %llu M cards/s\n",
+					meanCleanRuns[r], MM_ScanKernel::getName(kind), dirtyCards / repeats, elapsedMicros,
+					(0 == elapsedMicros) ? 0 : cardsScanned / elapsedMicros);
+		}
+	}
+
+	omrmem_free_memory(table);
+}
+
+TEST(gcFunctionalTestMarkMapScanKernel, agreesWithScalar)
+{
+	const uintptr_t mapWords = 67;
+	uintptr_t map[mapWords + 1];
+	MM_ScanKernel::Kind kinds[MM_ScanKernel::kindCount];
+	MM_MarkMapScanKernel::FindMarkedWord functions[MM_ScanKernel::kindCount];
+	uintptr_t kernels = getSupportedKernels(MM_MarkMapScanKernel::getFunction, kinds, functions);
+
+	for (uintptr_t k = 0; k < kernels; k++) {
+		MM_ScanKernel::Kind kind = kinds[k];
+		MM_MarkMapScanKernel::FindMarkedWord findMarkedWord = functions[k];
+		ASSERT_TRUE(NULL != findMarkedWord);
+
+		/* every start offset (so vectors straddle any alignment) against every position of the first marked word */
+		for (uintptr_t start = 0; start < 8; start++) {
+			for (uintptr_t marked = start; marked <= mapWords; marked++) {
+				memset(map, 0, sizeof(map));
+				/* a top bit only, so byte-wise compares of the vector kernels are exercised on the last byte */
+				map[marked] = ((uintptr_t)1) << ((sizeof(uintptr_t) * 8) - 1);
+				if ((marked + 1) < mapWords) {
+					map[marked + 1] = 1;
+				}
+				uintptr_t *expected = (marked < mapWords) ? &map[marked] : &map[mapWords];
+				ASSERT_EQ(expected, findMarkedWord(&map[start], &map[mapWords]))
+					<< MM_ScanKernel::getName(kind) << " start=" << start << " marked=" << marked;
+				ASSERT_EQ(MM_MarkMapScanKernel::findMarkedWordScalar(&map[start], &map[mapWords]), findMarkedWord(&map[start], &map[mapWords]));
+			}
+		}
+	}
+}
+
+TEST(perfTestMarkMapScanKernel, sweepThroughput)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->getPortLibrary());
+	const uintptr_t mapWords = 4 * 1024 * 1024;
+	const uintptr_t repeats = 8;
+	/* mean length, in words, of the free runs between marked words: dense to nearly empty heaps */
+	const uintptr_t meanFreeRuns[] = { 1, 4, 32, 256, 4096 };
+
+	MM_ScanKernel::Kind kinds[MM_ScanKernel::kindCount];
+	MM_MarkMapScanKernel::FindMarkedWord functions[MM_ScanKernel::kindCount];
+	uintptr_t kernels = getSupportedKernels(MM_MarkMapScanKernel::getFunction, kinds, functions);
+
+	uintptr_t *map = (uintptr_t *)omrmem_allocate_memory(mapWords * sizeof(uintptr_t), OMRMEM_CATEGORY_MM);
+	ASSERT_TRUE(NULL != map);
+
+	for (uintptr_t r = 0; r < (sizeof(meanFreeRuns) / sizeof(meanFreeRuns[0])); r++) {
+		uint64_t seed = 42;
+		uintptr_t *cursor = map;
+		uintptr_t *top = map + mapWords;
+		memset(map, 0, mapWords * sizeof(uintptr_t));
+		while (cursor < top) {
+			cursor += nextRandom(&seed) % (2 * meanFreeRuns[r]);
+			if (cursor < top) {
+				*cursor = nextRandom(&seed) | 1;
+				cursor += 1;
+			}
+		}
+
+		for (uintptr_t k = 0; k < kernels; k++) {
+			MM_ScanKernel::Kind kind = kinds[k];
+			MM_MarkMapScanKernel::FindMarkedWord findMarkedWord = functions[k];
+
+			/* the shape of the sweepChunk() body loop: skip each free run, then step over the marked word */
+			uintptr_t freeRuns = 0;
+			uint64_t startTime = omrtime_hires_clock();
+			for (uintptr_t i = 0; i < repeats; i++) {
+				uintptr_t *current = map;
+				while (current < top) {
+					if (0 == *current) {
+						current = MM_MarkMapScanKernel::findMarkedWord(findMarkedWord, current + 1, top);
+						freeRuns += 1;
+					} else {
+						current += 1;
+					}
+				}
+			}
+			uint64_t elapsedMicros = omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+			uint64_t mapBytes = (uint64_t)repeats * mapWords * sizeof(uintptr_t);
+
+			gcTestEnv->log("mean free run %4zu words, %-6s: %8zu free runs, %llu us, %llu MB/s of mark map\n",
+					meanFreeRuns[r], MM_ScanKernel::getName(kind), freeRuns / repeats, elapsedMicros,
+					(0 == elapsedMicros) ? 0 : mapBytes / elapsedMicros);
+		}
+	}
+
+	omrmem_free_memory(map);
+}
@@ -0,0 +1,309 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+#include "VerboseBinaryConverter.hpp"
+#include "gcTestHelpers.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+/* builds records the way MM_VerboseWriterFileLoggingBinary lays them out */
+class RecordBuilder
+{
+public:
+	std::vector<uint8_t> bytes;
+
+	void
+	defineFormat(uint32_t id, const char *format)
+	{
+		size_t start = beginRecord(VERBOSE_BINARY_RECORD_FORMAT, 0, 0);
+		VerboseBinaryFormatDefinition definition;
+		definition.id = id;
+		definition.length = (uint32_t)strlen(format);
+		append(&definition, sizeof(definition));
+		append(format, definition.length);
+		endRecord(start);
+	}
+
+	size_t
+	beginRecord(uint8_t type, uint64_t sequence, uint16_t buffer)
+	{
+		size_t start = bytes.size();
+		VerboseBinaryRecordHeader header;
+		memset(&header, 0, sizeof(header));
+		header.type = type;
+		header.buffer = buffer;
+		header.sequence = sequence;
+		append(&header, sizeof(header));
+		return start;
+	}
+
+	void
+	endRecord(size_t start)
+	{
+		pad();
+		uint32_t size = (uint32_t)(bytes.size() - start);
+		memcpy(&bytes[start], &size, sizeof(size));
+	}
+
+	void
+	line(uint32_t format, uint16_t indent, const std::vector<uint64_t> &slots, const std::vector<const char *> &strings)
+	{
+		VerboseBinaryLine line;
+		memset(&line, 0, sizeof(line));
+		line.format = format;
+		line.indent = indent;
+		append(&line, sizeof(line));
+		append(slots.empty() ? NULL : &slots[0], slots.size() * sizeof(uint64_t));
+		for (size_t i = 0; i < strings.size(); i++) {
+			string(strings[i]);
+		}
+	}
+
+	void
+	text(const char *text)
+	{
+		line(VERBOSE_BINARY_FORMAT_TEXT, 0, std::vector<uint64_t>(), std::vector<const char *>(1, text));
+	}
+
+	void
+	textStanza(uint8_t type, uint64_t sequence, uint16_t buffer, const char *text)
+	{
+		size_t start = beginRecord(type, sequence, buffer);
+		this->text(text);
+		endRecord(start);
+	}
+
+private:
+	void
+	append(const void *data, size_t length)
+	{
+		bytes.insert(bytes.end(), (const uint8_t *)data, ((const uint8_t *)data) + length);
+	}
+
+	void
+	pad()
+	{
+		while (0 != (bytes.size() % VERBOSE_BINARY_ALIGNMENT)) {
+			bytes.push_back(0);
+		}
+	}
+
+	void
+	string(const char *value)
+	{
+		uint32_t length = (NULL == value) ? VERBOSE_BINARY_NULL_STRING : (uint32_t)strlen(value);
+		append(&length, sizeof(length));
+		if (NULL != value) {
+			append(value, length);
+		}
+		pad();
+	}
+};
+
+static VerboseBinaryConverter::Result
+convertRecords(const std::vector<uint8_t> &records, std::string *xml, const char *magic = VERBOSE_BINARY_MAGIC)
+{
+	FILE *input = tmpfile();
+	FILE *output = tmpfile();
+	if ((NULL == input) || (NULL == output)) {
+		return VerboseBinaryConverter::RC_READ_FAILED;
+	}
+
+	VerboseBinaryFileHeader header;
+	memset(&header, 0, sizeof(header));
+	strcpy(header.magic, magic);
+	header.version = VERBOSE_BINARY_VERSION;
+	header.byteOrderMark = VERBOSE_BINARY_BYTE_ORDER_MARK;
+	header.pointerSize = (uint8_t)sizeof(uintptr_t);
+	fwrite(&header, sizeof(header), 1, input);
+	if (!records.empty()) {
+		fwrite(&records[0], 1, records.size(), input);
+	}
+	rewind(input);
+
+	VerboseBinaryConverter::Result rc = VerboseBinaryConverter::convert(input, output);
+
+	rewind(output);
+	char buffer[256];
+	size_t read = 0;
+	xml->clear();
+	while (0 != (read = fread(buffer, 1, sizeof(buffer), output))) {
+		xml->append(buffer, read);
+	}
+	fclose(input);
+	fclose(output);
+	return rc;
+}
+
+static const char *header = "<?xml version=\"1.0\" ?>\n\n<verbosegc xmlns=\"http://www.ibm.com/j9/verbosegc\" version=\"test\">\n\n";
+static const char *footer = "</verbosegc>\n";
+static const char *gcStartFormat = "<gc-start id=\"%zu\" type=\"%s\" contextid=\"%zu\" timestamp=\"%s\">";
+static const char *gcEndFormat = "</gc-start>";
+
+/* the gc-start stanza as the writer encodes it */
+static void
+gcStart(RecordBuilder *builder, uint64_t sequence, uint16_t buffer, uint64_t id)
+{
+	size_t start = builder->beginRecord(VERBOSE_BINARY_RECORD_STANZA, sequence, buffer);
+	std::vector<uint64_t> slots;
+	slots.push_back(id);
+	slots.push_back(0);
+	slots.push_back(3);
+	slots.push_back(0);
+	std::vector<const char *> strings;
+	strings.push_back("scavenge");
+	strings.push_back("2026-01-01T00:00:00.000");
+	builder->line(0, 0, slots, strings);
+	builder->line(1, 0, std::vector<uint64_t>(), std::vector<const char *>());
+	builder->endRecord(start);
+}
+
+static std::string
+gcStartText(uint64_t id)
+{
+	char text[256];
+	snprintf(text, sizeof(text), "<gc-start id=\"%llu\" type=\"scavenge\" contextid=\"3\" timestamp=\"2026-01-01T00:00:00.000\">\n</gc-start>\n", (unsigned long long)id);
+	return text;
+}
+
+TEST(gcFunctionalTestVerboseBinaryConverter, restoresSequenceOrder)
+{
+	RecordBuilder buffer0;
+	RecordBuilder buffer1;
+	buffer0.textStanza(VERBOSE_BINARY_RECORD_STANZA, 1, 0, header);
+	gcStart(&buffer1, 2, 1, 4);
+	gcStart(&buffer0, 3, 0, 5);
+	gcStart(&buffer1, 4, 1, 6);
+	buffer0.textStanza(VERBOSE_BINARY_RECORD_FOOTER, 5, 0, footer);
+
+	/* formats are defined as they are first seen and the drain thread writes each buffer out in turn */
+	RecordBuilder file;
+	file.defineFormat(0, gcStartFormat);
+	file.defineFormat(1, gcEndFormat);
+	file.bytes.insert(file.bytes.end(), buffer0.bytes.begin(), buffer0.bytes.end());
+	file.bytes.insert(file.bytes.end(), buffer1.bytes.begin(), buffer1.bytes.end());
+
+	std::string xml;
+	ASSERT_EQ(VerboseBinaryConverter::RC_OK, convertRecords(file.bytes, &xml));
+	ASSERT_EQ(std::string(header) + gcStartText(4) + gcStartText(5) + gcStartText(6) + footer, xml);
+}
+
+TEST(gcFunctionalTestVerboseBinaryConverter, formatsFieldsAsOmrstrDoes)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	const char *timeFormat = "<exclusive-start timems=\"%llu.%03.3llu\" threads=\"%zu\" lastid=\"%p\" lastname=\"%s\" />";
+	const char *numberFormat = "<numbers flags=\"%x\" mask=\"%X\" delta=\"%d\" big=\"%lld\" pad=\"%5s|%-4d|%.2s|%*d\" ratio=\"%.3f\" wide=\"%08.2f\" kind=\"%c\" percent=\"100%%\" />";
+	void *lastid = (void *)(uintptr_t)0x1234abcd;
+	char expected[1024];
+	std::string expectedXml(header);
+
+	RecordBuilder file;
+	file.defineFormat(7, timeFormat);
+	file.defineFormat(2, numberFormat);
+	file.textStanza(VERBOSE_BINARY_RECORD_STANZA, 1, 0, header);
+	size_t start = file.beginRecord(VERBOSE_BINARY_RECORD_STANZA, 2, 0);
+	{
+		std::vector<uint64_t> slots;
+		slots.push_back(12);
+		slots.push_back(7);
+		slots.push_back(4);
+		slots.push_back((uintptr_t)lastid);
+		slots.push_back(0);
+		file.line(7, 1, slots, std::vector<const char *>(1, (const char *)NULL));
+		omrstr_printf(expected, sizeof(expected), timeFormat, (uint64_t)12, (uint64_t)7, (uintptr_t)4, lastid, (const char *)NULL);
+		expectedXml += std::string("  ") + expected + "\n";
+	}
+	{
+		double ratio = 0.3337;
+		double wide = -2.5;
+		uint64_t ratioBits = 0;
+		uint64_t wideBits = 0;
+		memcpy(&ratioBits, &ratio, sizeof(ratio));
+		memcpy(&wideBits, &wide, sizeof(wide));
+		std::vector<uint64_t> slots;
+		slots.push_back(0xbeef);
+		slots.push_back(0xbeef);
+		/* 32 bit values are read as such, so the writer stores them zero extended */
+		slots.push_back((uint32_t)-42);
+		slots.push_back((uint64_t)-5000000000LL);
+		slots.push_back(0);
+		slots.push_back((uint32_t)-7);
+		slots.push_back(0);
+		slots.push_back(6);
+		slots.push_back(12);
+		slots.push_back(ratioBits);
+		slots.push_back(wideBits);
+		slots.push_back('Q');
+		std::vector<const char *> strings;
+		strings.push_back("ab");
+		strings.push_back("xyz");
+		file.line(2, 2, slots, strings);
+		omrstr_printf(expected, sizeof(expected), numberFormat, 0xbeef, 0xbeef, -42, (int64_t)-5000000000LL, "ab", -7, "xyz", 6, 12, ratio, wide, 'Q');
+		expectedXml += std::string("    ") + expected + "\n";
+	}
+	file.text("  <text-line />\n");
+	expectedXml += "  <text-line />\n";
+	file.endRecord(start);
+
+	std::string xml;
+	ASSERT_EQ(VerboseBinaryConverter::RC_OK, convertRecords(file.bytes, &xml));
+	ASSERT_EQ(expectedXml + footer, xml);
+}
+
+TEST(gcFunctionalTestVerboseBinaryConverter, dropsIncompleteStanzas)
+{
+	RecordBuilder file;
+	file.defineFormat(0, gcStartFormat);
+	file.defineFormat(1, gcEndFormat);
+	file.textStanza(VERBOSE_BINARY_RECORD_STANZA, 1, 0, header);
+	gcStart(&file, 2, 0, 4);
+	gcStart(&file, 3, 0, 5);
+	/* a file cut short mid-stanza, without the footer */
+	file.bytes.resize(file.bytes.size() - VERBOSE_BINARY_ALIGNMENT);
+
+	std::string xml;
+	ASSERT_EQ(VerboseBinaryConverter::RC_OK, convertRecords(file.bytes, &xml));
+	ASSERT_EQ(std::string(header) + gcStartText(4) + footer, xml);
+}
+
+TEST(gcFunctionalTestVerboseBinaryConverter, rejectsUndefinedFormats)
+{
+	RecordBuilder file;
+	file.defineFormat(1, gcEndFormat);
+	gcStart(&file, 1, 0, 4);
+
+	std::string xml;
+	ASSERT_EQ(VerboseBinaryConverter::RC_BAD_FORMAT, convertRecords(file.bytes, &xml));
+}
+
+TEST(gcFunctionalTestVerboseBinaryConverter, rejectsOtherFiles)
+{
+	RecordBuilder file;
+	file.textStanza(VERBOSE_BINARY_RECORD_STANZA, 1, 0, header);
+
+	std::string xml;
+	ASSERT_EQ(VerboseBinaryConverter::RC_BAD_FORMAT, convertRecords(file.bytes, &xml, "<?xml v"));
+	ASSERT_TRUE(xml.empty());
+}
@@ -152,6 +152,15 @@ TR::Node* GenericNodeConverter::impl(const ASTNode* tree, IlGenState* state) {
         symref->setOffset(offset);
         node = TR::Node::createWithSymRef(opcode.getOpCodeValue(), childCount, symref);
     }
+    else if (opcode.isNew()) {
+        // allocations are calls to the allocation helpers provided by the front end
+        TraceIL("  is allocation\n");
+        auto symref = opcode.getOpCodeValue() == TR::New
+                    ? state->symRefTab()->findOrCreateNewObjectSymbolRef(state->methodSymbol())
+                    : state->symRefTab()->findOrCreateNewArraySymbolRef(state->methodSymbol());
+        state->methodSymbol()->setHasNews(true);
+        node = TR::Node::createWithSymRef(opcode.getOpCodeValue(), childCount, symref);
+    }
     else if (opcode.isIf()) {
         const auto targetName = tree->getArgByName("target")->getValue()->getString();
         auto targetId = state->findBlockByName(targetName);
@@ -0,0 +1,350 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "BackgroundHeapReleaser.hpp"
+
+#include <string.h>
+
+#include "omrport.h"
+#include "modronbase.h"
+
+#include "Forge.hpp"
+#include "Heap.hpp"
+#include "HeapLinkedFreeHeader.hpp"
+#include "HeapMemorySubSpaceIterator.hpp"
+#include "HeapResizeStats.hpp"
+#include "Math.hpp"
+#include "MemoryPool.hpp"
+#include "MemorySubSpace.hpp"
+
+typedef struct ReleaserThreadInfo {
+	OMR_VM *omrVM;
+	MM_BackgroundHeapReleaser *releaser;
+	OMR_VMThread *omrVMThread; /**< set by the new thread; NULL if it failed to attach */
+	bool started; /**< set by the new thread once it has attempted to attach */
+} ReleaserThreadInfo;
+
+/**
+ * Background heap releaser thread procedure
+ *
+ * @parm info Address of ReleaserThreadInfo structure
+ */
+static int J9THREAD_PROC
+background_heap_releaser_thread_proc(void *info)
+{
+	ReleaserThreadInfo *releaserThreadInfo = (ReleaserThreadInfo *)info;
+	MM_BackgroundHeapReleaser *releaser = releaserThreadInfo->releaser;
+	OMR_VM *omrVM = releaserThreadInfo->omrVM;
+
+	OMR_VMThread *omrVMThread = MM_EnvironmentBase::attachVMThread(omrVM, "Background Heap Releaser", MM_EnvironmentBase::ATTACH_GC_HELPER_THREAD);
+
+	/* Signal that the releaser has started (or not); info is on the creating thread's stack and must not be used after this */
+	omrthread_monitor_enter(releaser->_releaserMonitor);
+	releaserThreadInfo->omrVMThread = omrVMThread;
+	releaserThreadInfo->started = true;
+	omrthread_monitor_notify_all(releaser->_releaserMonitor);
+	omrthread_monitor_exit(releaser->_releaserMonitor);
+
+	if (NULL != omrVMThread) {
+		releaser->releaserEntryPoint(omrVMThread);
+	}
+
+	return 0;
+}
+
+MM_BackgroundHeapReleaser *
+MM_BackgroundHeapReleaser::newInstance(MM_EnvironmentBase *env)
+{
+	MM_BackgroundHeapReleaser *releaser = (MM_BackgroundHeapReleaser *)env->getForge()->allocate(sizeof(MM_BackgroundHeapReleaser), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != releaser) {
+		new(releaser) MM_BackgroundHeapReleaser(env);
+		if (!releaser->initialize(env)) {
+			releaser->kill(env);
+			releaser = NULL;
+		}
+	}
+	return releaser;
+}
+
+void
+MM_BackgroundHeapReleaser::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_BackgroundHeapReleaser::initialize(MM_EnvironmentBase *env)
+{
+	uintptr_t tableBytes = sizeof(Entry) * _tableSize;
+	_previousTable = (Entry *)env->getForge()->allocate(tableBytes, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	_currentTable = (Entry *)env->getForge()->allocate(tableBytes, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if ((NULL == _previousTable) || (NULL == _currentTable)) {
+		return false;
+	}
+	memset(_previousTable, 0, tableBytes);
+	memset(_currentTable, 0, tableBytes);
+
+	if (0 != omrthread_monitor_init_with_name(&_releaserMonitor, 0, "MM_BackgroundHeapReleaser::releaserMonitor")) {
+		return false;
+	}
+
+	return true;
+}
+
+void
+MM_BackgroundHeapReleaser::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _previousTable) {
+		env->getForge()->free(_previousTable);
+		_previousTable = NULL;
+	}
+
+	if (NULL != _currentTable) {
+		env->getForge()->free(_currentTable);
+		_currentTable = NULL;
+	}
+
+	if (NULL != _releaserMonitor) {
+		omrthread_monitor_destroy(_releaserMonitor);
+		_releaserMonitor = NULL;
+	}
+}
+
+bool
+MM_BackgroundHeapReleaser::startReleaserThread(MM_GCExtensionsBase *extensions)
+{
+	ReleaserThreadInfo releaserThreadInfo;
+	releaserThreadInfo.omrVM = extensions->getOmrVM();
+	releaserThreadInfo.releaser = this;
+	releaserThreadInfo.omrVMThread = NULL;
+	releaserThreadInfo.started = false;
+
+	omrthread_monitor_enter(_releaserMonitor);
+	_releaserRequest = RELEASER_WAIT;
+	intptr_t threadForkResult = createThreadWithCategory(NULL, OMR_OS_STACK_SIZE, J9THREAD_PRIORITY_MIN,
+			0, background_heap_releaser_thread_proc, (void *)&releaserThreadInfo, J9THREAD_CATEGORY_SYSTEM_GC_THREAD);
+	if (0 == threadForkResult) {
+		while (!releaserThreadInfo.started) {
+			omrthread_monitor_wait(_releaserMonitor);
+		}
+		_releaserStarted = (NULL != releaserThreadInfo.omrVMThread);
+	}
+	omrthread_monitor_exit(_releaserMonitor);
+
+	return _releaserStarted;
+}
+
+void
+MM_BackgroundHeapReleaser::shutdownReleaserThread(MM_GCExtensionsBase *extensions)
+{
+	omrthread_monitor_enter(_releaserMonitor);
+	_releaserRequest = RELEASER_SHUTDOWN;
+	omrthread_monitor_notify_all(_releaserMonitor);
+	while (RELEASER_TERMINATED != _releaserRequest) {
+		omrthread_monitor_wait(_releaserMonitor);
+	}
+	omrthread_monitor_exit(_releaserMonitor);
+	_releaserStarted = false;
+}
+
+void
+MM_BackgroundHeapReleaser::releaserEntryPoint(OMR_VMThread *omrVMThread)
+{
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrVMThread);
+	ReleaserRequest request = RELEASER_WAIT;
+
+	/* Thread is not a mutator */
+	env->initializeGCThread();
+
+	while (true) {
+		omrthread_monitor_enter(_releaserMonitor);
+		if (RELEASER_WAIT == _releaserRequest) {
+			omrthread_monitor_wait_timed(_releaserMonitor, (int64_t)_extensions->heapReleaseInterval, 0);
+		}
+		request = _releaserRequest;
+		omrthread_monitor_exit(_releaserMonitor);
+
+		if (RELEASER_SHUTDOWN == request) {
+			break;
+		}
+
+		/* Holding VM access keeps a GC from rebuilding the free lists under the pass */
+		env->acquireVMAccess();
+		releasePass(env);
+		env->releaseVMAccess();
+	}
+
+	MM_EnvironmentBase::detachVMThread(_extensions->getOmrVM(), omrVMThread, MM_EnvironmentBase::ATTACH_GC_HELPER_THREAD);
+
+	omrthread_monitor_enter(_releaserMonitor);
+	_releaserRequest = RELEASER_TERMINATED;
+	omrthread_monitor_notify_all(_releaserMonitor);
+	omrthread_exit(_releaserMonitor);
+}
+
+MM_BackgroundHeapReleaser::Entry *
+MM_BackgroundHeapReleaser::findEntry(Entry *table, uintptr_t base, bool add)
+{
+	uintptr_t index = hash(base);
+	for (uintptr_t probe = 0; probe < _maxProbes; probe++) {
+		Entry *entry = &table[(index + probe) & (_tableSize - 1)];
+		if (base == entry->base) {
+			return entry;
+		} else if (0 == entry->base) {
+			if (add) {
+				entry->base = base;
+				return entry;
+			}
+			break;
+		}
+	}
+	return NULL;
+}
+
+void
+MM_BackgroundHeapReleaser::releasePass(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	MM_Heap *heap = _extensions->heap;
+	uint64_t startTime = omrtime_hires_clock();
+
+	uintptr_t tenureSize = heap->getActiveMemorySize(MEMORY_TYPE_OLD);
+	uintptr_t tenureFree = heap->getApproximateActiveFreeMemorySize(MEMORY_TYPE_OLD);
+	uintptr_t occupancy = (0 == tenureSize) ? 100 : (((tenureSize - OMR_MIN(tenureFree, tenureSize)) * 100) / tenureSize);
+	_lowOccupancy = (occupancy <= _extensions->heapReleaseMaximumOccupancy);
+	_passReleasedBytes = 0;
+	memset(_currentTable, 0, sizeof(Entry) * _tableSize);
+
+	/* The walk takes each pool lock in turn; give up between pools if a GC is waiting for exclusive access */
+	bool complete = true;
+	MM_HeapMemorySubSpaceIterator subSpaceIterator(heap);
+	MM_MemorySubSpace *subSpace = NULL;
+	while (NULL != (subSpace = subSpaceIterator.nextSubSpace())) {
+		if (subSpace->isLeafSubSpace() && (MEMORY_TYPE_OLD == (subSpace->getTypeFlags() & MEMORY_TYPE_OLD))) {
+			if (env->isExclusiveAccessRequestWaiting()) {
+				complete = false;
+				break;
+			}
+			subSpace->getMemoryPool()->releaseAgedFreeMemoryPages(env, this);
+		}
+	}
+
+	uintptr_t recommittedBytes = 0;
+	for (uintptr_t i = 0; i < _tableSize; i++) {
+		Entry *previous = &_previousTable[i];
+		if ((0 != previous->base) && !previous->found) {
+			if (complete) {
+				/* A released chunk that is no longer free has been allocated from, its pages are committed again on touch */
+				recommittedBytes += previous->releasedBytes;
+			} else {
+				/* Not visited by an abandoned pass, keep it as it was */
+				Entry *current = findEntry(_currentTable, previous->base, true);
+				if (NULL != current) {
+					*current = *previous;
+				}
+			}
+		}
+	}
+
+	uintptr_t releasedFreePageBytes = 0;
+	for (uintptr_t i = 0; i < _tableSize; i++) {
+		_currentTable[i].found = false;
+		releasedFreePageBytes += _currentTable[i].releasedBytes;
+	}
+
+	Entry *swap = _previousTable;
+	_previousTable = _currentTable;
+	_currentTable = swap;
+
+	heap->getResizeStats()->recordBackgroundReleasePass(_passReleasedBytes, recommittedBytes, releasedFreePageBytes, heap->getActiveMemorySize());
+
+	if (0 != _passReleasedBytes) {
+		uint64_t endTime = omrtime_hires_clock();
+		TRIGGER_J9HOOK_MM_PRIVATE_HEAP_RESIZE(
+			_extensions->privateHookInterface,
+			env->getOmrVMThread(),
+			endTime,
+			J9HOOK_MM_PRIVATE_HEAP_RESIZE,
+			HEAP_RELEASE_FREE_PAGES,
+			MEMORY_TYPE_OLD,
+			/* GC Time Ratio not applicable for "release free heap pages" */
+			0,
+			_passReleasedBytes,
+			tenureSize,
+			omrtime_hires_delta(startTime, endTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS),
+			RELEASE_FREE_PAGES_BACKGROUND
+			);
+	}
+}
+
+uintptr_t
+MM_BackgroundHeapReleaser::ageFreeEntries(MM_EnvironmentBase *env, MM_HeapLinkedFreeHeader *freeEntry)
+{
+	bool const compressed = env->compressObjectReferences();
+	MM_Heap *heap = _extensions->heap;
+	uintptr_t pageSize = heap->getPageSize();
+	uintptr_t releasedBytes = 0;
+
+	for (MM_HeapLinkedFreeHeader *currentFreeEntry = freeEntry; NULL != currentFreeEntry; currentFreeEntry = currentFreeEntry->getNext(compressed)) {
+		if (currentFreeEntry->getSize() < _extensions->heapReleaseMinimumChunkSize) {
+			continue;
+		}
+
+		/* the free entry header stays committed */
+		uintptr_t base = MM_Math::roundToCeiling(pageSize, (uintptr_t)currentFreeEntry + sizeof(MM_HeapLinkedFreeHeader));
+		uintptr_t top = MM_Math::roundToFloor(pageSize, (uintptr_t)currentFreeEntry->afterEnd());
+		if (top <= base) {
+			continue;
+		}
+
+		Entry *current = findEntry(_currentTable, base, true);
+		if (NULL == current) {
+			/* table is full around this chunk, leave it committed */
+			continue;
+		}
+		current->top = top;
+
+		Entry *previous = findEntry(_previousTable, base, false);
+		if ((NULL != previous) && (top == previous->top)) {
+			previous->found = true;
+			current->age = previous->age;
+			current->releasedBytes = previous->releasedBytes;
+		}
+
+		if (_lowOccupancy) {
+			current->age += 1;
+		} else {
+			current->age = 0;
+		}
+
+		if ((0 == current->releasedBytes) && (current->age >= _extensions->heapReleaseAge)) {
+			if (heap->decommitMemory((void *)base, top - base, NULL, currentFreeEntry->afterEnd())) {
+				current->releasedBytes = top - base;
+				releasedBytes += top - base;
+			}
+		}
+	}
+
+	_passReleasedBytes += releasedBytes;
+	return releasedBytes;
+}
@@ -0,0 +1,157 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(BACKGROUNDHEAPRELEASER_HPP_)
+#define BACKGROUNDHEAPRELEASER_HPP_
+
+#include "omrcfg.h"
+#include "omr.h"
+#include "omrthread.h"
+
+#include "BaseVirtual.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+
+class MM_HeapLinkedFreeHeader;
+
+/**
+ * Returns the pages of long lived free tenure chunks to the operating system from a background thread.
+ *
+ * Every -Xgc:heapReleaseInterval milliseconds the releaser walks the free lists of the tenure pools.
+ * Free chunks of at least -Xgc:heapReleaseMinimumChunkSize bytes are tracked by their page aligned
+ * interior; a chunk ages by one for every pass that finds it unchanged while tenure occupancy is at or
+ * below -Xgc:heapReleaseMaximumOccupancy percent, and a pass above it resets all ages. A chunk that
+ * reaches -Xgc:heapReleaseAge is decommitted, leaving the free entry header committed. Decommit must
+ * keep the range mapped (MADV_DONTNEED on Linux), so that the pages are committed again lazily when
+ * the chunk is allocated from.
+ *
+ * A released chunk that is no longer found on the free lists is assumed to have been allocated from
+ * and is counted as commit churn. The released and resident byte counts are estimates from the
+ * tracked chunks, the port library has no way to query the resident set of the heap.
+ *
+ * @ingroup GC_Base
+ */
+class MM_BackgroundHeapReleaser : public MM_BaseVirtual
+{
+/* Data members */
+public:
+	typedef enum {
+		RELEASER_WAIT = 0, /**< Sleep until the next pass is due */
+		RELEASER_SHUTDOWN, /**< Exit at the next opportunity */
+		RELEASER_TERMINATED /**< Set by the releaser thread once it has detached */
+	} ReleaserRequest;
+
+	omrthread_monitor_t _releaserMonitor; /**< Protects _releaserRequest and wakes the releaser thread */
+
+private:
+	enum {
+		_tableSize = 1024, /**< Number of free chunks that can be tracked (must be a power of two) */
+		_maxProbes = 16 /**< Open addressing probe limit before a chunk is left untracked */
+	};
+
+	struct Entry {
+		uintptr_t base; /**< First page of the chunk interior, 0 for an unused entry */
+		uintptr_t top; /**< End of the last whole page of the chunk */
+		uintptr_t age; /**< Number of consecutive low occupancy passes that found the chunk unchanged */
+		uintptr_t releasedBytes; /**< Bytes of the chunk that have been decommitted, 0 if it is still committed */
+		bool found; /**< Set on the previous pass table entry when the current pass finds the chunk again */
+	};
+
+	MM_GCExtensionsBase *_extensions;
+	volatile ReleaserRequest _releaserRequest;
+	bool _releaserStarted; /**< True if the releaser thread attached successfully */
+	Entry *_previousTable; /**< Chunks found by the previous pass */
+	Entry *_currentTable; /**< Chunks found by the pass in progress */
+	bool _lowOccupancy; /**< True if chunks age during the pass in progress */
+	uintptr_t _passReleasedBytes; /**< Bytes decommitted by the pass in progress */
+
+/* Methods */
+private:
+	MMINLINE static uintptr_t hash(uintptr_t base)
+	{
+		uintptr_t key = base >> 12;
+		return (key ^ (key >> 10) ^ (key >> 20)) & (_tableSize - 1);
+	}
+
+	Entry *findEntry(Entry *table, uintptr_t base, bool add);
+
+	/**
+	 * Walk the free lists of the tenure pools, release the chunks that have aged enough and update the
+	 * counters in the heap resize stats. Must be called with VM access.
+	 */
+	void releasePass(MM_EnvironmentBase *env);
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+public:
+	static MM_BackgroundHeapReleaser *newInstance(MM_EnvironmentBase *env);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Start the releaser thread and wait for it to attach.
+	 * @return true if the thread attached successfully
+	 */
+	bool startReleaserThread(MM_GCExtensionsBase *extensions);
+
+	/**
+	 * Ask the releaser thread to exit and wait until it has detached.
+	 */
+	void shutdownReleaserThread(MM_GCExtensionsBase *extensions);
+
+	/**
+	 * Main loop of the releaser thread.
+	 */
+	void releaserEntryPoint(OMR_VMThread *omrVMThread);
+
+	/**
+	 * Age the free entries of a free list and decommit the interior of those that are old enough.
+	 * Called by the memory pools with the lock protecting the list held.
+	 * @param freeEntry the head of the free list
+	 * @return bytes decommitted
+	 */
+	uintptr_t ageFreeEntries(MM_EnvironmentBase *env, MM_HeapLinkedFreeHeader *freeEntry);
+
+	MMINLINE bool isStarted() { return _releaserStarted; }
+
+	MM_BackgroundHeapReleaser(MM_EnvironmentBase *env)
+		: MM_BaseVirtual()
+		, _releaserMonitor(NULL)
+		, _extensions(env->getExtensions())
+		, _releaserRequest(RELEASER_WAIT)
+		, _releaserStarted(false)
+		, _previousTable(NULL)
+		, _currentTable(NULL)
+		, _lowOccupancy(false)
+		, _passReleasedBytes(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* BACKGROUNDHEAPRELEASER_HPP_ */
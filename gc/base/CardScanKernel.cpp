@@ -0,0 +1,153 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#include "CardScanKernel.hpp"
+
+#include "ScanKernelTarget.hpp"
+
+MM_CardScanKernel::FindDirtyCard
+MM_CardScanKernel::getFunction(MM_ScanKernel::Kind kind)
+{
+	FindDirtyCard function = NULL;
+
+	switch (kind) {
+	case MM_ScanKernel::scalar:
+		function = findDirtyCardScalar;
+		break;
+#if defined(OMR_ARCH_X86)
+	case MM_ScanKernel::sse2:
+		function = findDirtyCardSSE2;
+		break;
+	case MM_ScanKernel::avx2:
+		function = findDirtyCardAVX2;
+		break;
+#endif /* defined(OMR_ARCH_X86) */
+#if defined(OMR_ARCH_AARCH64)
+	case MM_ScanKernel::neon:
+		function = findDirtyCardNEON;
+		break;
+#endif /* defined(OMR_ARCH_AARCH64) */
+	default:
+		break;
+	}
+
+	return function;
+}
+
+Card *
+MM_CardScanKernel::findDirtyCardScalar(Card *current, Card *top, Card cardMask)
+{
+	/* test a slot of cards at a time once aligned, as card cleaning always has */
+	while ((current < top) && (0 != ((uintptr_t)current % sizeof(uintptr_t)))) {
+		if (0 != (*current & cardMask)) {
+			return current;
+		}
+		current += 1;
+	}
+
+	uintptr_t slotMask = (uintptr_t)cardMask * (UDATA_MAX / (uintptr_t)U_8_MAX);
+	while (((uintptr_t)(top - current) >= sizeof(uintptr_t)) && (0 == (*(uintptr_t *)current & slotMask))) {
+		current += sizeof(uintptr_t);
+	}
+
+	while ((current < top) && (0 == (*current & cardMask))) {
+		current += 1;
+	}
+	return current;
+}
+
+#if defined(OMR_ARCH_X86)
+SCAN_KERNEL_TARGET("sse2") Card *
+MM_CardScanKernel::findDirtyCardSSE2(Card *current, Card *top, Card cardMask)
+{
+	const uintptr_t cardsPerVector = sizeof(__m128i);
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i mask = _mm_set1_epi8((char)cardMask);
+
+	/* two vectors per iteration: the OR lets one compare cover both */
+	while ((uintptr_t)(top - current) >= (2 * cardsPerVector)) {
+		__m128i low = _mm_and_si128(_mm_loadu_si128((const __m128i *)current), mask);
+		__m128i high = _mm_and_si128(_mm_loadu_si128((const __m128i *)(current + cardsPerVector)), mask);
+		if (0xFFFF != _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_or_si128(low, high), zero))) {
+			return current + MM_ScanKernel::firstNonZeroByte(
+					(uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(low, zero)),
+					(uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(high, zero)),
+					sizeof(__m128i));
+		}
+		current += 2 * cardsPerVector;
+	}
+
+	return findDirtyCardScalar(current, top, cardMask);
+}
+
+SCAN_KERNEL_TARGET("avx2") Card *
+MM_CardScanKernel::findDirtyCardAVX2(Card *current, Card *top, Card cardMask)
+{
+	const uintptr_t cardsPerVector = sizeof(__m256i);
+	const __m256i mask = _mm256_set1_epi8((char)cardMask);
+	Card *found = NULL;
+
+	while ((uintptr_t)(top - current) >= (2 * cardsPerVector)) {
+		__m256i low = _mm256_loadu_si256((const __m256i *)current);
+		__m256i high = _mm256_loadu_si256((const __m256i *)(current + cardsPerVector));
+		if (!_mm256_testz_si256(_mm256_or_si256(low, high), mask)) {
+			const __m256i zero = _mm256_setzero_si256();
+			found = current + MM_ScanKernel::firstNonZeroByte(
+					(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_and_si256(low, mask), zero)),
+					(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_and_si256(high, mask), zero)),
+					sizeof(__m256i));
+			break;
+		}
+		current += 2 * cardsPerVector;
+	}
+	/* leave the upper ymm state clean before running (possibly SSE) code again */
+	_mm256_zeroupper();
+
+	return (NULL != found) ? found : findDirtyCardScalar(current, top, cardMask);
+}
+#endif /* defined(OMR_ARCH_X86) */
+
+#if defined(OMR_ARCH_AARCH64)
+Card *
+MM_CardScanKernel::findDirtyCardNEON(Card *current, Card *top, Card cardMask)
+{
+	const uintptr_t cardsPerVector = sizeof(uint8x16_t);
+	const uint8x16_t mask = vdupq_n_u8(cardMask);
+
+	while ((uintptr_t)(top - current) >= (2 * cardsPerVector)) {
+		uint8x16_t low = vld1q_u8((const uint8_t *)current);
+		uint8x16_t high = vld1q_u8((const uint8_t *)(current + cardsPerVector));
+		if (0 != vmaxvq_u8(vandq_u8(vorrq_u8(low, high), mask))) {
+			break;
+		}
+		current += 2 * cardsPerVector;
+	}
+
+	return findDirtyCardScalar(current, top, cardMask);
+}
+#endif /* defined(OMR_ARCH_AARCH64) */
@@ -0,0 +1,106 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(CARDSCANKERNEL_HPP_)
+#define CARDSCANKERNEL_HPP_
+
+#include "omrcfg.h"
+#include "omr.h"
+#include "omrgcconsts.h"
+#include "omrmodroncore.h"
+#include "omrport.h"
+
+#include "ScanKernel.hpp"
+
+/**
+ * Kernels that find the next card of interest in a card table. Card tables are mostly clean, so
+ * card cleaning spends most of its time walking runs of clean cards; the vector kernels test 16
+ * (SSE2, NEON) or 32 (AVX2) cards per instruction against the cleaning mask.
+ *
+ * The kernel is chosen by MM_ScanKernel::select() once, when the card table is initialized.
+ *
+ * @ingroup GC_Base
+ */
+class MM_CardScanKernel
+{
+	/* Data Members */
+public:
+	/**
+	 * Find the first card in [current, top) with any bit of cardMask set.
+	 * @param current[in] The first card to test
+	 * @param top[in] One past the last card to test
+	 * @param cardMask[in] The card bits of interest
+	 * @return the address of the first matching card, or top if no card matches
+	 */
+	typedef Card *(*FindDirtyCard)(Card *current, Card *top, Card cardMask);
+
+	enum {
+		_scalarProbeCards = 8 /**< Cards tested inline before a run is handed to the kernel */
+	};
+
+	/* Member Functions */
+public:
+	/**
+	 * Find the first card in [current, top) with any bit of cardMask set. Dirty cards tend to cluster,
+	 * so the next few cards are tested inline and only longer clean runs pay for the call into the kernel.
+	 * @param kernel[in] The scan function returned by getFunction()
+	 * @param current[in] The first card to test
+	 * @param top[in] One past the last card to test
+	 * @param cardMask[in] The card bits of interest
+	 * @return the address of the first matching card, or top if no card matches
+	 */
+	MMINLINE static Card *
+	findDirtyCard(FindDirtyCard kernel, Card *current, Card *top, Card cardMask)
+	{
+		Card *probeTop = ((uintptr_t)(top - current) > (uintptr_t)_scalarProbeCards) ? (current + _scalarProbeCards) : top;
+		while (current < probeTop) {
+			if (0 != (*current & cardMask)) {
+				return current;
+			}
+			current += 1;
+		}
+		return (current < top) ? kernel(current, top, cardMask) : top;
+	}
+
+	/**
+	 * @param kind[in] A kernel that was compiled in
+	 * @return the scan function for kind, or NULL if it was not compiled in
+	 */
+	static FindDirtyCard getFunction(MM_ScanKernel::Kind kind);
+
+	static Card *findDirtyCardScalar(Card *current, Card *top, Card cardMask);
+#if defined(OMR_ARCH_X86)
+	static Card *findDirtyCardSSE2(Card *current, Card *top, Card cardMask);
+	static Card *findDirtyCardAVX2(Card *current, Card *top, Card cardMask);
+#endif /* defined(OMR_ARCH_X86) */
+#if defined(OMR_ARCH_AARCH64)
+	static Card *findDirtyCardNEON(Card *current, Card *top, Card cardMask);
+#endif /* defined(OMR_ARCH_AARCH64) */
+};
+
+#endif /* CARDSCANKERNEL_HPP_ */
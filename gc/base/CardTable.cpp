@@ -53,6 +53,7 @@ MM_CardTable::initialize(MM_EnvironmentBase *env, MM_Heap *heap)
 		_heapBase = (void *)heap->getHeapBase();
 		_heapAlloc = (void *)heap->getHeapTop();
 		_cardTableVirtualStart = (Card *) ((uintptr_t)_cardTableStart - (((uintptr_t)getHeapBase()) >> CARD_SIZE_SHIFT));
+		extensions->cardTablePageSize = memoryManager->getPageSize(&_cardTableMemoryHandle);
 		initialized = true;
 	}
 
@@ -497,7 +497,10 @@ MM_Configuration::initializeGCParameters(MM_EnvironmentBase *env)
 	}
 	if (extensions->scavengerEnabled) {
 		if (MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_NONE == extensions->scavengerScanOrdering) {
-			extensions->scavengerScanOrdering = MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_HIERARCHICAL;
+			/* sampled hot fields are only followed by the dynamic breadth first depth copy */
+			extensions->scavengerScanOrdering = extensions->scavengerHotFieldSampling
+					? MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_DYNAMIC_BREADTH_FIRST
+					: MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_HIERARCHICAL;
 		} else if (MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_DYNAMIC_BREADTH_FIRST == extensions->scavengerScanOrdering) {
 			extensions->adaptiveGcCountBetweenHotFieldSort = true;
 		}
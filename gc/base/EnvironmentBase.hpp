@@ -37,6 +37,7 @@
 #include "GCExtensionsBase.hpp"
 #include "LargeObjectAllocateStats.hpp"
 #include "MarkStats.hpp"
+#include "PrefetchQueue.hpp"
 #include "RootScannerStats.hpp"
 #include "ScavengerStats.hpp"
 #include "SweepStats.hpp"
@@ -131,6 +132,7 @@ public:
 	MM_ObjectAllocationInterface *_objectAllocationInterface; /**< Per-thread interface that guides object allocation decisions */
 
 	MM_WorkStack _workStack;
+	MM_PrefetchQueue _prefetchQueue; /**< Slots deferred by the marking and scavenging scan loops when -Xgc:scanPrefetchDistance is set */
 
 	ThreadType  _threadType;
 	MM_CycleState *_cycleState;	/**< The current GC cycle that this thread is operating on */
@@ -732,6 +734,7 @@ public:
 #endif /* OMR_GC_SEGREGATED_HEAP */
 		,_objectAllocationInterface(NULL)
 		,_workStack()
+		,_prefetchQueue()
 		,_threadType(MUTATOR_THREAD)
 		,_cycleState(NULL)
 		,_isInNoGCAllocationCall(false)
@@ -789,6 +792,7 @@ public:
 #endif /* OMR_GC_SEGREGATED_HEAP */
 		,_objectAllocationInterface(NULL)
 		,_workStack()
+		,_prefetchQueue()
 		,_threadType(MUTATOR_THREAD)
 		,_cycleState(NULL)
 		,_isInNoGCAllocationCall(false)
@@ -282,6 +282,7 @@ public:
 #endif /* OMR_GC_DOUBLE_MAP_ARRAYLETS */
 	bool isVirtualLargeObjectHeapRequested;
 	bool isVirtualLargeObjectHeapEnabled;
+	bool concurrentSparseHeap; /**< if true, the sparse heap data pool is used without a global lock (per size class free lists and a lock free data pointer table) */
 
 	uintptr_t requestedPageSize;	/**< Memory page size for Object Heap */
 	uintptr_t requestedPageFlags;	/**< Memory page flags for Object Heap */
@@ -290,6 +291,16 @@ public:
 	uintptr_t sparseHeapPageSize;	/**< Memory page size for Sparse Object Heap */
 	uintptr_t sparseHeapPageFlags;	/**< Memory page flags for Sparse Object Heap */
 
+	enum LargePagePolicy {
+		LARGE_PAGE_POLICY_NONE = 0, /**< heap and GC metadata use requestedPageSize and gcmetadataPageSize as configured */
+		LARGE_PAGE_POLICY_TRANSPARENT, /**< heap and GC metadata are laid out in whole, aligned transparent huge pages */
+		LARGE_PAGE_POLICY_EXPLICIT, /**< heap and GC metadata are reserved in the default explicitly configured large page size */
+	};
+	LargePagePolicy largePagePolicy; /**< Large page policy for the heap, mark map, card table and region table (set through -Xgc:largePagePolicy=) */
+	uintptr_t markMapPageSize; /**< Page size obtained for the mark map, 0 if it has not been allocated */
+	uintptr_t cardTablePageSize; /**< Page size obtained for the card table, 0 if it has not been allocated */
+	uintptr_t regionTablePageSize; /**< Page size obtained for the region table, 0 if it has not been allocated in virtual memory */
+
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	MM_SublistPool rememberedSet;
 	uintptr_t oldHeapSizeOnLastGlobalGC;
@@ -352,6 +363,10 @@ public:
 	uintptr_t tlhIncrementSize;
 	uintptr_t tlhSurvivorDiscardThreshold; /**< below this size GC (Scavenger) will discard survivor copy cache TLH, if alloc not succeeded (otherwise we reuse memory for next TLH) */
 	uintptr_t tlhTenureDiscardThreshold; /**< below this size GC (Scavenger) will discard tenure copy cache TLH, if alloc not succeeded (otherwise we reuse memory for next TLH) */
+	bool adaptiveTLHSizing; /**< Set by -Xgc:adaptiveTLHSizing. Size each thread's TLH refreshes from its allocation rate in previous cycles instead of growing by a fixed increment */
+	uintptr_t adaptiveTLHRefreshTarget; /**< Number of TLH refreshes per thread per GC cycle the adaptive sizing policy aims for */
+	bool lockFreeTLHRefresh; /**< Set by -Xgc:lockFreeTLHRefresh. Non-split address ordered list pools carve TLHs from a detached chunk with compare-and-swap instead of taking the pool lock */
+	uintptr_t tlhCarveChunkSize; /**< Size of the chunks detached from the free list for lock-free TLH refreshes */
 
 	MM_AllocationStats allocationStats; /**< Statistics for allocations. */
 	uintptr_t bytesAllocatedMost;
@@ -362,6 +377,7 @@ public:
 	bool splitFreeListAmountForced; /**< Flag to distinguish if splitFreeListAmount is externally enforced (for example, specified by command line) or determined heuristically */
 	uintptr_t splitFreeListNumberChunksPrepared; /**< Used in MPSAOL postProcess. Shared for all MPSAOLs. Do not overwrite during postProcess for any MPSAOL. */
 	bool enableHybridMemoryPool;
+	bool freeListSizeClassBins; /**< Set by -Xgc:freeListSizeClassBins. Non-split address ordered list pools start allocate searches from per size class bins instead of the LRU hint table */
 
 	bool largeObjectArea;
 #if defined(OMR_GC_LARGE_OBJECT_AREA)
@@ -412,6 +428,8 @@ public:
 	uintptr_t workpacketCount; /**< this value is ONLY set if -Xgcworkpackets is specified - otherwise the workpacket count is determined heuristically */
 	uintptr_t packetListSplit; /**< the number of ways to split packet lists, set by command line option, or determined heuristically based on the number of GC threads */
 	bool packetListSplitForced;  /**< Flag to distinguish if packetListSplit is externally enforced (for example, specified by command line) */
+	bool workStealingMarking; /**< Enabled by -Xgc:workStealingMarking. Stop-the-world mark keeps full packets on per-thread work-stealing deques instead of the shared packet lists */
+	uintptr_t scanPrefetchDistance; /**< Set by -Xgc:scanPrefetchDistance=. Number of slots the marking and scavenging scan loops prefetch ahead of processing (0 disables, capped at MM_PrefetchQueue::_capacity) */
 	uintptr_t markingArraySplitMaximumAmount; /**< maximum number of elements to split array scanning work in marking scheme */
 	uintptr_t markingArraySplitMinimumAmount; /**< minimum number of elements to split array scanning work in marking scheme */
 
@@ -469,6 +487,8 @@ public:
 	bool gcThreadCountSpecified; /**< true if number of GC threads is specified in command line options. */
 	bool gcThreadCountForced; /**< true if user forced a fixed number of GC threads. Default is false, but a command line option could set it if not wanting adaptive threading */
 	uintptr_t dispatcherHybridNotifyThreadBound; /**< Bound for determining hybrid notification type (Individual notifies for count < MIN(bound, maxThreads/2), otherwise notify_all) */
+	bool elasticTaskThreads; /**< Set by -Xgc:elasticTaskThreads. Scavenge, mark, sweep and compact tasks wake only as many threads as their estimated work needs, even if the thread count was forced */
+	uintptr_t elasticTaskThreadWork; /**< Bytes of estimated task work that justify waking one more GC thread (set through -Xgc:elasticTaskThreadWork=) */
 
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
 	enum ScavengerScanOrdering {
@@ -492,6 +512,8 @@ public:
 	uintptr_t depthCopyMax;
 	uint32_t maxHotFieldListLength;
 	uintptr_t minCpuUtil;
+	bool scavengerHotFieldSampling; /**< Enabled by -Xgc:scavengerHotFieldSampling. The scavenger samples which reference slots of each class lead to surviving objects, and depth copies the hottest ones for classes without a language provided hot field */
+	uintptr_t scavengerHotFieldSampleRate; /**< Set by -Xgc:scavengerHotFieldSampleRate=. Sampling threads profile one in this many scanned objects */
 	/* End of options relating to dynamicBreadthFirstScanOrdering */
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	uintptr_t scvTenureRatioHigh;
@@ -525,6 +547,9 @@ public:
 	uintptr_t scvArraySplitMinimumAmount; /**< minimum number of elements to split array scanning work in the scavenger */
 	uintptr_t scavengerScanCacheMaximumSize; /**< maximum size of scan and copy caches before rounding, zero (default) means calculate them */
 	uintptr_t scavengerScanCacheMinimumSize; /**< minimum size of scan and copy caches before rounding, zero (default) means calculate them */
+	bool scavengerNumaAwareCopy; /**< Enabled by -Xgc:scavengerNumaAwareCopy. Survivor space is split into per-NUMA-node slices and each GC thread copies into the slice of its own node */
+	bool scavengerShardedRememberedSet; /**< Enabled by -Xgc:scavengerShardedRememberedSet. The remembered set list is scanned and pruned in chunks dealt out to per-thread shards, rather than a puddle at a time */
+	uintptr_t scavengerRememberedSetChunkSize; /**< Set by -Xgc:scavengerRememberedSetChunkSize=. Remembered set entries per chunk, 0 (default) to size chunks from the remembered set size and GC thread count */
 	bool tiltedScavenge;
 	bool debugTiltedScavenge;
 	double survivorSpaceMinimumSizeRatio;
@@ -591,6 +616,8 @@ public:
 	uintptr_t compactOnSystemGC;
 	uintptr_t nocompactOnSystemGC;
 	bool compactToSatisfyAllocate;
+	bool pipelinedCompaction; /**< Enabled by -Xgc:pipelinedCompaction. Parallel compaction moves objects within groups of sub areas and fixes up settled groups without waiting for all moves to finish */
+	uintptr_t compactWindowSize; /**< Set by -Xgc:compactWindowSize=. Fragmentation and compact-on-every-GC compactions only evacuate the most fragmented run of old space of at most this many bytes (0 compacts the whole heap) */
 #endif /* defined(OMR_GC_MODRON_COMPACTION) */
 
 	bool payAllocationTax;
@@ -606,6 +633,8 @@ public:
 	uintptr_t concurrentSlack; /**< number of bytes to add to the concurrent kickoff threshold buffer */
 	uintptr_t cardCleanPass2Boost;
 	uintptr_t cardCleaningPasses;
+	bool simdCardScan; /**< Cleared by -Xgc:noSIMDCardScan. Card cleaning skips clean cards with the widest vector kernel the processor supports */
+	uintptr_t finalCardCleanBatchSize; /**< Number of cards a thread claims at once during final card cleaning */
 
 	UDATA fvtest_concurrentCardTablePreparationDelay; /**< Delay for concurrent card table preparation in milliseconds */
 
@@ -713,6 +742,11 @@ public:
 	uintptr_t allocationCacheInitialSize;
 	uintptr_t allocationCacheIncrementSize;
 	bool nonDeterministicSweep;
+	bool deferredSegregatedSweep; /**< Set by -Xgc:deferredSegregatedSweep. The segregated collector only publishes the mark map in the pause; regions are swept on demand by allocation and by a background sweeper thread */
+	bool incrementalSegregatedGC; /**< Set by -Xgc:incrementalSegregatedGC. The segregated collector marks and sweeps in time bounded quanta paid for by allocating threads, implies deferredSegregatedSweep */
+	uintptr_t segregatedQuantumMicros; /**< Pause budget of one incremental segregated GC quantum, in microseconds */
+	uintptr_t segregatedTargetUtilization; /**< Percentage of time left to the mutator between incremental segregated GC quanta */
+	uintptr_t segregatedGCTrigger; /**< Heap occupancy percentage at which an incremental segregated GC cycle starts */
 /* OMR_GC_REALTIME (in for all) */
 
 	MM_ConfigurationOptions configurationOptions; /**< holds the options struct, used during startup for selecting a Configuration */
@@ -724,6 +758,7 @@ public:
 	bool verboseExtensions;
 	bool verboseNewFormat; /**< a flag, enabled by -XXgc:verboseNewFormat, to enable the new verbose GC format */
 	bool bufferedLogging; /**< Enabled by -Xgc:bufferedLogging.  Use buffered filestreams when writing logs (e.g. verbose:gc) to a file */
+	bool binaryVerboseLogging; /**< Enabled by -Xgc:binaryVerboseLogging.  Write verbose:gc files as binary records holding the format and raw values of each line, see MM_VerboseWriterFileLoggingBinary. tools/verbosegcconv formats them as XML */
 
 	uintptr_t lowAllocationThreshold; /**< the lower bound of the allocation threshold range */
 	uintptr_t highAllocationThreshold; /**< the upper bound of the allocation threshold range */
@@ -862,10 +897,16 @@ public:
 	bool trackMutatorThreadCategory; /**< Whether we should switch thread categories for mutators doing GC work */
 
 	uintptr_t darkMatterSampleRate;/**< the weight of darkMatterSample for standard gc, default:32, if the weight = 0, disable darkMatterSampling */
+	bool simdSweep; /**< Cleared by -Xgc:noSIMDSweep. Sweep skips empty mark map words with the widest vector kernel the processor supports */
 
 	bool pretouchHeapOnExpand; /**< True to pretouch memory during initial heap inflation or heap expansion */
 
 	uintptr_t decommitMinimumFree; /**< percentage of free heap to be retained as committed, default=0 for gencon, complete tenture free memory will be decommitted */
+	bool backgroundHeapRelease; /**< Set by -Xgc:backgroundHeapRelease. A background thread decommits free tenure chunks that stay free while occupancy is low */
+	uintptr_t heapReleaseInterval; /**< Milliseconds between passes of the background heap releaser */
+	uintptr_t heapReleaseAge; /**< Consecutive low occupancy passes a free chunk must survive before it is released */
+	uintptr_t heapReleaseMinimumChunkSize; /**< Free chunks smaller than this are never released by the background heap releaser */
+	uintptr_t heapReleaseMaximumOccupancy; /**< Tenure occupancy percentage above which the background heap releaser resets the age of free chunks */
 
 #if defined(OMR_GC_IDLE_HEAP_MANAGER)
 	bool gcOnIdle; /**< Enables releasing free heap pages if true while systemGarbageCollect invoked with IDLE GC code, default is false */
@@ -1519,12 +1560,17 @@ public:
 #endif /* defined(OMR_GC_DOUBLE_MAP_ARRAYLETS) */
 		, isVirtualLargeObjectHeapRequested(false)
 		, isVirtualLargeObjectHeapEnabled(false)
+		, concurrentSparseHeap(false)
 		, requestedPageSize(0)
 		, requestedPageFlags(OMRPORT_VMEM_PAGE_FLAG_NOT_USED)
 		, gcmetadataPageSize(0)
 		, gcmetadataPageFlags(OMRPORT_VMEM_PAGE_FLAG_NOT_USED)
 		, sparseHeapPageSize(0)
 		, sparseHeapPageFlags(OMRPORT_VMEM_PAGE_FLAG_NOT_USED)
+		, largePagePolicy(LARGE_PAGE_POLICY_NONE)
+		, markMapPageSize(0)
+		, cardTablePageSize(0)
+		, regionTablePageSize(0)
 #if defined(OMR_GC_MODRON_SCAVENGER)
 		, rememberedSet()
 		, oldHeapSizeOnLastGlobalGC(UDATA_MAX)
@@ -1572,6 +1618,10 @@ public:
 		, tlhIncrementSize(4096)
 		, tlhSurvivorDiscardThreshold(tlhMinimumSize)
 		, tlhTenureDiscardThreshold(tlhMinimumSize)
+		, adaptiveTLHSizing(false)
+		, adaptiveTLHRefreshTarget(32)
+		, lockFreeTLHRefresh(false)
+		, tlhCarveChunkSize(1024 * 1024)
 		, allocationStats()
 		, bytesAllocatedMost(0)
 		, vmThreadAllocatedMost(NULL)
@@ -1580,6 +1630,7 @@ public:
 		, splitFreeListAmountForced(false)
 		, splitFreeListNumberChunksPrepared(0)
 		, enableHybridMemoryPool(false)
+		, freeListSizeClassBins(false)
 		, largeObjectArea(false)
 #if defined(OMR_GC_LARGE_OBJECT_AREA)
 		, largeObjectMinimumSize(64 * 1024)
@@ -1616,6 +1667,8 @@ public:
 		, workpacketCount(0) /* only set if -Xgcworkpackets specified */
 		, packetListSplit(0)
 		, packetListSplitForced(false)
+		, workStealingMarking(false)
+		, scanPrefetchDistance(0)
 		, markingArraySplitMaximumAmount(DEFAULT_ARRAY_SPLIT_MAXIMUM_SIZE)
 		, markingArraySplitMinimumAmount(DEFAULT_ARRAY_SPLIT_MINIMUM_SIZE)
 		, rootScannerStatsEnabled(false)
@@ -1664,6 +1717,8 @@ public:
 		, gcThreadCountSpecified(false)
 		, gcThreadCountForced(false)
 		, dispatcherHybridNotifyThreadBound(16)
+		, elasticTaskThreads(false)
+		, elasticTaskThreadWork(256 * 1024)
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
 		, scavengerScanOrdering(OMR_GC_SCAVENGER_SCANORDERING_NONE)
 		/* Start of options relating to dynamicBreadthFirstScanOrdering */
@@ -1680,6 +1735,8 @@ public:
 		, depthCopyMax(3)
 		, maxHotFieldListLength(10)
 		, minCpuUtil (1)
+		, scavengerHotFieldSampling(false)
+		, scavengerHotFieldSampleRate(32)
 		/* End of options relating to dynamicBreadthFirstScanOrdering */
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC) */
 #if defined(OMR_GC_MODRON_SCAVENGER)
@@ -1714,6 +1771,9 @@ public:
 		, scvArraySplitMinimumAmount(DEFAULT_ARRAY_SPLIT_MINIMUM_SIZE)
 		, scavengerScanCacheMaximumSize(DEFAULT_SCAN_CACHE_MAXIMUM_SIZE)
 		, scavengerScanCacheMinimumSize(DEFAULT_SCAN_CACHE_MINIMUM_SIZE)
+		, scavengerNumaAwareCopy(false)
+		, scavengerShardedRememberedSet(false)
+		, scavengerRememberedSetChunkSize(0)
 		, tiltedScavenge(true)
 		, debugTiltedScavenge(false)
 		, survivorSpaceMinimumSizeRatio(0.10)
@@ -1763,6 +1823,8 @@ public:
 		, compactOnSystemGC(0)
 		, nocompactOnSystemGC(0)
 		, compactToSatisfyAllocate(false)
+		, pipelinedCompaction(false)
+		, compactWindowSize(0)
 #endif /* defined(OMR_GC_MODRON_COMPACTION) */
 		, payAllocationTax(false)
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
@@ -1776,6 +1838,8 @@ public:
 		, concurrentSlack(0)
 		, cardCleanPass2Boost(2)
 		, cardCleaningPasses(2)
+		, simdCardScan(true)
+		, finalCardCleanBatchSize(64)
 		, fvtest_concurrentCardTablePreparationDelay(0)
 		, fvtest_forceConcurrentTLHMarkMapCommitFailure(0)
 		, fvtest_forceConcurrentTLHMarkMapCommitFailureCounter(0)
@@ -1857,12 +1921,18 @@ public:
 		, allocationCacheInitialSize(256)
 		, allocationCacheIncrementSize(256)
 		, nonDeterministicSweep(false)
+		, deferredSegregatedSweep(false)
+		, incrementalSegregatedGC(false)
+		, segregatedQuantumMicros(3000)
+		, segregatedTargetUtilization(70)
+		, segregatedGCTrigger(60)
 		, configuration(NULL)
 		, verboseGCManager(NULL)
 		, verbosegcCycleTime(1000)  /* by default metronome outputs verbosegc every 1sec */
 		, verboseExtensions(false)
 		, verboseNewFormat(true)
 		, bufferedLogging(false)
+		, binaryVerboseLogging(false)
 		, lowAllocationThreshold(UDATA_MAX)
 		, highAllocationThreshold(UDATA_MAX)
 		, disableInlineCacheForAllocationThreshold(false)
@@ -1963,8 +2033,14 @@ public:
 		, referenceChainWalkerMarkMap(NULL)
 		, trackMutatorThreadCategory(false)
 		, darkMatterSampleRate(32)
+		, simdSweep(true)
 		, pretouchHeapOnExpand(false)
 		, decommitMinimumFree(0)
+		, backgroundHeapRelease(false)
+		, heapReleaseInterval(1000)
+		, heapReleaseAge(5)
+		, heapReleaseMinimumChunkSize(2 * 1024 * 1024)
+		, heapReleaseMaximumOccupancy(50)
 #if defined(OMR_GC_IDLE_HEAP_MANAGER)
 		, gcOnIdle(false)
 		, compactOnIdle(false)
@@ -76,6 +76,12 @@ MM_HeapMap::tearDown(MM_EnvironmentBase *env)
 	_heapMapBits = NULL;
 }
 
+uintptr_t
+MM_HeapMap::getPageSize()
+{
+	return _extensions->memoryManager->getPageSize(&_heapMapMemoryHandle);
+}
+
 /**
  * Heap Map re-sizing
  *
@@ -130,6 +130,11 @@ public:
 	MMINLINE uintptr_t *getHeapMapBits() { return _heapMapBits; }
 	MMINLINE const uintptr_t *getHeapMapBits() const { return _heapMapBits; }
 
+	/**
+	 * @return the size of the pages the heap map was actually allocated in
+	 */
+	uintptr_t getPageSize();
+
 	MMINLINE uintptr_t getObjectGrain() { return ((uintptr_t)1) << _heapMapBitShift; };
 		
 	MMINLINE void
@@ -30,7 +30,9 @@
 #include "Bits.hpp"
 #include "Forge.hpp"
 #include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
 #include "HeapRegionDescriptor.hpp"
+#include "MemoryManager.hpp"
 
 class MemorySubSpace;
 
@@ -47,6 +49,7 @@ MM_HeapRegionManager::MM_HeapRegionManager(MM_EnvironmentBase* env, uintptr_t re
 	, _tableDescriptorSize(tableDescriptorSize)
 	, _regionDescriptorInitializer(regionDescriptorInitializer)
 	, _regionDescriptorDestructor(regionDescriptorDestructor)
+	, _regionTableMemoryHandle()
 	, _totalHeapSize(0)
 {
 	_typeId = __FUNCTION__;
@@ -265,7 +268,23 @@ MM_HeapRegionManager::internalAllocateAndInitializeRegionTable(MM_EnvironmentBas
 	uintptr_t regionSize = getRegionSize();
 	uintptr_t regionCount = size / regionSize;
 	uintptr_t sizeInBytes = regionCount * _tableDescriptorSize;
-	MM_HeapRegionDescriptor* table = (MM_HeapRegionDescriptor*)env->getForge()->allocate(sizeInBytes, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	MM_HeapRegionDescriptor* table = NULL;
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	if (MM_GCExtensionsBase::LARGE_PAGE_POLICY_NONE != extensions->largePagePolicy) {
+		/* place the table in GC metadata memory so that region lookups share its large pages */
+		MM_MemoryManager *memoryManager = extensions->memoryManager;
+		if (memoryManager->createVirtualMemoryForMetadata(env, &_regionTableMemoryHandle, sizeof(uintptr_t), sizeInBytes)) {
+			void *tableBase = memoryManager->getHeapBase(&_regionTableMemoryHandle);
+			if (memoryManager->commitMemory(&_regionTableMemoryHandle, tableBase, sizeInBytes)) {
+				table = (MM_HeapRegionDescriptor*)tableBase;
+				extensions->regionTablePageSize = memoryManager->getPageSize(&_regionTableMemoryHandle);
+			} else {
+				memoryManager->destroyVirtualMemory(env, &_regionTableMemoryHandle);
+			}
+		}
+	} else {
+		table = (MM_HeapRegionDescriptor*)env->getForge()->allocate(sizeInBytes, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	}
 	if (NULL != table) {
 		/* the table has been allocated so initialize the descriptors inside it and the meta-data to use the table */
 		memset((void*)table, 0, sizeInBytes);
@@ -295,7 +314,13 @@ MM_HeapRegionManager::internalFreeRegionTable(MM_EnvironmentBase* env, MM_HeapRe
 		}
 	}
 
-	env->getForge()->free(tableBase);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	if (MM_GCExtensionsBase::LARGE_PAGE_POLICY_NONE != extensions->largePagePolicy) {
+		extensions->memoryManager->destroyVirtualMemory(env, &_regionTableMemoryHandle);
+		extensions->regionTablePageSize = 0;
+	} else {
+		env->getForge()->free(tableBase);
+	}
 }
 
 MM_HeapRegionDescriptor*
@@ -29,11 +29,11 @@
 #include "BaseVirtual.hpp"
 #include "HeapRegionDescriptor.hpp"
 #include "LightweightNonReentrantRWLock.hpp"
+#include "MemoryHandle.hpp"
 #include "ModronAssertions.h"
 
 class MM_EnvironmentBase;
 class MM_HeapRegionManager;
-class MM_MemoryHandle;
 class MM_MemorySubSpace;
 class MM_HeapMemorySnapshot;
 
@@ -81,6 +81,7 @@ protected:
 	uintptr_t _tableDescriptorSize; /**< The size, in bytes, of the HeapRegionDescriptor subclass used by this manager */
 	MM_RegionDescriptorInitializer _regionDescriptorInitializer; /**< A function pointer used to initialize a newly allocated HRD */
 	MM_RegionDescriptorDestructor _regionDescriptorDestructor; /**< A function pointer used to destroy HRDs, or NULL */
+	MM_MemoryHandle _regionTableMemoryHandle; /**< memory handle for the region table when it is placed in GC metadata memory by the large page policy */
 
 	uintptr_t _totalHeapSize; /**< The size, in bytes, of all currently active regions on the heap (that is, both table descriptors attached to subspaces and aux descriptors in the list) */
 
@@ -0,0 +1,138 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#include "MarkMapScanKernel.hpp"
+
+#include "ScanKernelTarget.hpp"
+
+MM_MarkMapScanKernel::FindMarkedWord
+MM_MarkMapScanKernel::getFunction(MM_ScanKernel::Kind kind)
+{
+	FindMarkedWord function = NULL;
+
+	switch (kind) {
+	case MM_ScanKernel::scalar:
+		function = findMarkedWordScalar;
+		break;
+#if defined(OMR_ARCH_X86)
+	case MM_ScanKernel::sse2:
+		function = findMarkedWordSSE2;
+		break;
+	case MM_ScanKernel::avx2:
+		function = findMarkedWordAVX2;
+		break;
+#endif /* defined(OMR_ARCH_X86) */
+#if defined(OMR_ARCH_AARCH64)
+	case MM_ScanKernel::neon:
+		function = findMarkedWordNEON;
+		break;
+#endif /* defined(OMR_ARCH_AARCH64) */
+	default:
+		break;
+	}
+
+	return function;
+}
+
+uintptr_t *
+MM_MarkMapScanKernel::findMarkedWordScalar(uintptr_t *current, uintptr_t *top)
+{
+	while ((current < top) && (0 == *current)) {
+		current += 1;
+	}
+	return current;
+}
+
+#if defined(OMR_ARCH_X86)
+SCAN_KERNEL_TARGET("sse2") uintptr_t *
+MM_MarkMapScanKernel::findMarkedWordSSE2(uintptr_t *current, uintptr_t *top)
+{
+	const uintptr_t wordsPerVector = sizeof(__m128i) / sizeof(uintptr_t);
+	const __m128i zero = _mm_setzero_si128();
+
+	/* two vectors per iteration: the OR lets one compare cover both */
+	while ((uintptr_t)(top - current) >= (2 * wordsPerVector)) {
+		__m128i low = _mm_loadu_si128((const __m128i *)current);
+		__m128i high = _mm_loadu_si128((const __m128i *)(current + wordsPerVector));
+		if (0xFFFF != _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_or_si128(low, high), zero))) {
+			/* find the word from the byte masks rather than rescanning the vectors word by word */
+			return current + (MM_ScanKernel::firstNonZeroByte(
+					(uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(low, zero)),
+					(uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(high, zero)),
+					sizeof(__m128i)) / sizeof(uintptr_t));
+		}
+		current += 2 * wordsPerVector;
+	}
+
+	return findMarkedWordScalar(current, top);
+}
+
+SCAN_KERNEL_TARGET("avx2") uintptr_t *
+MM_MarkMapScanKernel::findMarkedWordAVX2(uintptr_t *current, uintptr_t *top)
+{
+	const uintptr_t wordsPerVector = sizeof(__m256i) / sizeof(uintptr_t);
+	uintptr_t *found = NULL;
+
+	while ((uintptr_t)(top - current) >= (2 * wordsPerVector)) {
+		__m256i low = _mm256_loadu_si256((const __m256i *)current);
+		__m256i high = _mm256_loadu_si256((const __m256i *)(current + wordsPerVector));
+		__m256i either = _mm256_or_si256(low, high);
+		if (!_mm256_testz_si256(either, either)) {
+			const __m256i zero = _mm256_setzero_si256();
+			found = current + (MM_ScanKernel::firstNonZeroByte(
+					(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(low, zero)),
+					(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(high, zero)),
+					sizeof(__m256i)) / sizeof(uintptr_t));
+			break;
+		}
+		current += 2 * wordsPerVector;
+	}
+	/* leave the upper ymm state clean before running (possibly SSE) code again */
+	_mm256_zeroupper();
+
+	return (NULL != found) ? found : findMarkedWordScalar(current, top);
+}
+#endif /* defined(OMR_ARCH_X86) */
+
+#if defined(OMR_ARCH_AARCH64)
+uintptr_t *
+MM_MarkMapScanKernel::findMarkedWordNEON(uintptr_t *current, uintptr_t *top)
+{
+	const uintptr_t wordsPerVector = sizeof(uint64x2_t) / sizeof(uintptr_t);
+
+	while ((uintptr_t)(top - current) >= (2 * wordsPerVector)) {
+		uint64x2_t low = vld1q_u64((const uint64_t *)current);
+		uint64x2_t high = vld1q_u64((const uint64_t *)(current + wordsPerVector));
+		if (0 != vmaxvq_u32(vreinterpretq_u32_u64(vorrq_u64(low, high)))) {
+			break;
+		}
+		current += 2 * wordsPerVector;
+	}
+
+	return findMarkedWordScalar(current, top);
+}
+#endif /* defined(OMR_ARCH_AARCH64) */
@@ -0,0 +1,102 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(MARKMAPSCANKERNEL_HPP_)
+#define MARKMAPSCANKERNEL_HPP_
+
+#include "omrcfg.h"
+#include "omr.h"
+#include "omrgcconsts.h"
+#include "omrport.h"
+
+#include "ScanKernel.hpp"
+
+/**
+ * Kernels that skip runs of empty mark map words. Sweep spends most of its time on free ranges
+ * walking all-zero mark words; the vector kernels test several words per instruction and only
+ * drop to scalar code for the vector that holds the first non-empty word.
+ *
+ * The kernel is chosen by MM_ScanKernel::select() once, at sweep initialization.
+ *
+ * @ingroup GC_Base
+ */
+class MM_MarkMapScanKernel
+{
+	/* Data Members */
+public:
+	/**
+	 * Find the first non-empty mark map word in [current, top).
+	 * @param current[in] The first word to test
+	 * @param top[in] One past the last word to test
+	 * @return the address of the first non-zero word, or top if every word is zero
+	 */
+	typedef uintptr_t *(*FindMarkedWord)(uintptr_t *current, uintptr_t *top);
+
+	enum {
+		_scalarProbeWords = 4 /**< Words tested inline before a run is handed to the kernel */
+	};
+
+	/* Member Functions */
+public:
+	/**
+	 * Find the first non-empty mark map word in [current, top). Most free runs in a live heap are only
+	 * a few words long, so the first words are tested inline and only longer runs pay for the call into kernel.
+	 * @param kernel[in] The scan function returned by getFunction()
+	 * @param current[in] The first word to test
+	 * @param top[in] One past the last word to test
+	 * @return the address of the first non-zero word, or top if every word is zero
+	 */
+	MMINLINE static uintptr_t *
+	findMarkedWord(FindMarkedWord kernel, uintptr_t *current, uintptr_t *top)
+	{
+		uintptr_t *probeTop = ((uintptr_t)(top - current) > (uintptr_t)_scalarProbeWords) ? (current + _scalarProbeWords) : top;
+		while (current < probeTop) {
+			if (0 != *current) {
+				return current;
+			}
+			current += 1;
+		}
+		return (current < top) ? kernel(current, top) : top;
+	}
+
+	/**
+	 * @param kind[in] A kernel that was compiled in
+	 * @return the scan function for kind, or NULL if it was not compiled in
+	 */
+	static FindMarkedWord getFunction(MM_ScanKernel::Kind kind);
+
+	static uintptr_t *findMarkedWordScalar(uintptr_t *current, uintptr_t *top);
+#if defined(OMR_ARCH_X86)
+	static uintptr_t *findMarkedWordSSE2(uintptr_t *current, uintptr_t *top);
+	static uintptr_t *findMarkedWordAVX2(uintptr_t *current, uintptr_t *top);
+#endif /* defined(OMR_ARCH_X86) */
+#if defined(OMR_ARCH_AARCH64)
+	static uintptr_t *findMarkedWordNEON(uintptr_t *current, uintptr_t *top);
+#endif /* defined(OMR_ARCH_AARCH64) */
+};
+
+#endif /* MARKMAPSCANKERNEL_HPP_ */
@@ -90,6 +90,7 @@ MM_MarkingScheme::initialize(MM_EnvironmentBase *env)
 	if (!_markMap) {
 		goto error_no_memory;
 	}
+	_extensions->markMapPageSize = _markMap->getPageSize();
 
 	_workPackets = createWorkPackets(env);
 	if (NULL == _workPackets) {
@@ -297,16 +298,21 @@ MM_MarkingScheme::scanObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr)
 	GC_ObjectScannerState objectScannerState;
 	GC_ObjectScanner *objectScanner = _delegate.getObjectScanner(env, objectPtr, &objectScannerState, SCAN_REASON_PACKET, &sizeToDo);
 	if (NULL != objectScanner) {
-		bool isLeafSlot = false;
-		GC_SlotObject *slotObject;
+		uintptr_t prefetchDistance = OMR_MIN(_extensions->scanPrefetchDistance, (uintptr_t)MM_PrefetchQueue::_capacity);
+		if (0 == prefetchDistance) {
+			bool isLeafSlot = false;
+			GC_SlotObject *slotObject;
 #if defined(OMR_GC_LEAF_BITS)
-		while (NULL != (slotObject = objectScanner->getNextSlot(&isLeafSlot))) {
+			while (NULL != (slotObject = objectScanner->getNextSlot(&isLeafSlot))) {
 #else /* OMR_GC_LEAF_BITS */
-		while (NULL != (slotObject = objectScanner->getNextSlot())) {
+			while (NULL != (slotObject = objectScanner->getNextSlot())) {
 #endif /* OMR_GC_LEAF_BITS */
-			fixupForwardedSlot(slotObject);
+				fixupForwardedSlot(slotObject);
 
-			inlineMarkObjectNoCheck(env, slotObject->readReferenceFromSlot(), isLeafSlot);
+				inlineMarkObjectNoCheck(env, slotObject->readReferenceFromSlot(), isLeafSlot);
+			}
+		} else {
+			scanObjectSlotsPrefetched(env, objectScanner, prefetchDistance);
 		}
 	}
 	return sizeToDo;
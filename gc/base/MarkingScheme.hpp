@@ -36,6 +36,7 @@
 #include "ModronAssertions.h"
 #include "ObjectModel.hpp"
 #include "ObjectScannerState.hpp"
+#include "PrefetchQueue.hpp"
 #include "WorkStack.hpp"
 
 /**
@@ -238,15 +239,20 @@ public:
 		if (NULL != objectScanner) {
 			bool isLeafSlot = false;
 			GC_SlotObject *slotObject;
+			uintptr_t prefetchDistance = OMR_MIN(_extensions->scanPrefetchDistance, (uintptr_t)MM_PrefetchQueue::_capacity);
+			if (0 == prefetchDistance) {
 #if defined(OMR_GC_LEAF_BITS)
-			while (NULL != (slotObject = objectScanner->getNextSlot(&isLeafSlot))) {
+				while (NULL != (slotObject = objectScanner->getNextSlot(&isLeafSlot))) {
 #else /* OMR_GC_LEAF_BITS */
-			while (NULL != (slotObject = objectScanner->getNextSlot())) {
+				while (NULL != (slotObject = objectScanner->getNextSlot())) {
 #endif /* OMR_GC_LEAF_BITS */
-				fixupForwardedSlot(slotObject);
+					fixupForwardedSlot(slotObject);
 
-				/* with concurrentMark mutator may NULL the slot so must fetch and check here */
-				inlineMarkObject(env, slotObject->readReferenceFromSlot(), isLeafSlot);
+					/* with concurrentMark mutator may NULL the slot so must fetch and check here */
+					inlineMarkObject(env, slotObject->readReferenceFromSlot(), isLeafSlot);
+				}
+			} else {
+				scanObjectSlotsPrefetched(env, objectScanner, prefetchDistance);
 			}
 		}
 
@@ -261,6 +267,60 @@ public:
 		return sizeToDo;
 	}
 
+	/**
+	 * Mark the targets of all remaining slots of an object, deferring each through the prefetch
+	 * queue so that its mark map word (and, for non-leaf targets, its header) is being fetched
+	 * while later slots are found. Shared by both scanObject() variants.
+	 * @param[in] env calling thread environment
+	 * @param[in] objectScanner scanner positioned on the object's slots
+	 * @param[in] prefetchDistance number of slots to hold in the queue before marking the oldest
+	 */
+	MMINLINE void
+	scanObjectSlotsPrefetched(MM_EnvironmentBase *env, GC_ObjectScanner *objectScanner, uintptr_t prefetchDistance)
+	{
+		MM_PrefetchQueue *prefetchQueue = &env->_prefetchQueue;
+		bool isLeafSlot = false;
+		GC_SlotObject *slotObject;
+#if defined(OMR_GC_LEAF_BITS)
+		while (NULL != (slotObject = objectScanner->getNextSlot(&isLeafSlot))) {
+#else /* OMR_GC_LEAF_BITS */
+		while (NULL != (slotObject = objectScanner->getNextSlot())) {
+#endif /* OMR_GC_LEAF_BITS */
+			fixupForwardedSlot(slotObject);
+
+			/* with concurrentMark mutator may NULL the slot so must fetch and check here */
+			omrobjectptr_t slotReference = slotObject->readReferenceFromSlot();
+			if (NULL != slotReference) {
+				if (prefetchQueue->getCount() >= prefetchDistance) {
+					markPrefetchedObject(env, prefetchQueue->pop());
+				}
+				/* marking touches the mark map word first and the object itself only when it is later scanned */
+				MM_PrefetchQueue::prefetch(_markMap->getSlotPtrForAddress(slotReference));
+				if (!isLeafSlot) {
+					MM_PrefetchQueue::prefetch(slotReference);
+				}
+				prefetchQueue->push(NULL, slotReference, isLeafSlot);
+			}
+		}
+		while (!prefetchQueue->isEmpty()) {
+			markPrefetchedObject(env, prefetchQueue->pop());
+		}
+	}
+
+	/**
+	 * Mark an object whose slot was deferred through the prefetch queue by scanObject().
+	 * @param[in] env calling thread environment
+	 * @param[in] entry the dequeued entry
+	 */
+	MMINLINE void
+	markPrefetchedObject(MM_EnvironmentBase *env, MM_PrefetchQueue::Entry *entry)
+	{
+		env->_markStats._prefetchQueueEntries += 1;
+		if (inlineMarkObjectNoCheck(env, entry->object, entry->leaf)) {
+			env->_markStats._prefetchQueueMarked += 1;
+		}
+	}
+
 	MM_MarkingDelegate *getMarkingDelegate() { return &_delegate; }
 
 	MM_MarkMap *getMarkMap() { return _markMap; }
@@ -34,6 +34,7 @@
 #define EIGHT_GB_ADDRESS ((void *)((uintptr_t)8 * 1024 * 1024 * 1024))
 #define SIXTEEN_GB_ADDRESS ((void *)((uintptr_t)16 * 1024 * 1024 * 1024))
 #define THIRTY_TWO_GB_ADDRESS ((void *)((uintptr_t)32 * 1024 * 1024 * 1024))
+#define TRANSPARENT_HUGE_PAGE_SIZE ((uintptr_t)2 * 1024 * 1024)
 
 MM_MemoryManager *
 MM_MemoryManager::newInstance(MM_EnvironmentBase *env)
@@ -60,9 +61,46 @@ MM_MemoryManager::kill(MM_EnvironmentBase *env)
 bool
 MM_MemoryManager::initialize(MM_EnvironmentBase *env)
 {
+	applyLargePagePolicy(env);
 	return true;
 }
 
+void
+MM_MemoryManager::applyLargePagePolicy(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	uintptr_t largePageSize = 0;
+	uintptr_t largePageFlags = OMRPORT_VMEM_PAGE_FLAG_NOT_USED;
+
+	omrvmem_default_large_page_size_ex(OMRPORT_VMEM_MEMORY_MODE_READ | OMRPORT_VMEM_MEMORY_MODE_WRITE, &largePageSize, &largePageFlags);
+
+	switch (extensions->largePagePolicy) {
+	case MM_GCExtensionsBase::LARGE_PAGE_POLICY_TRANSPARENT:
+#if defined(LINUX)
+		/*
+		 * Transparent huge pages are PMD sized. That is the default large page size if explicit large pages are
+		 * configured, otherwise the port library does not report it so use the PMD size of 4K page platforms.
+		 * Reservations are advised with MADV_HUGEPAGE by the port library, the kernel can only back the parts of
+		 * them that are whole, aligned huge pages.
+		 */
+		_transparentHugePageSize = (0 != largePageSize) ? largePageSize : TRANSPARENT_HUGE_PAGE_SIZE;
+#endif /* defined(LINUX) */
+		break;
+	case MM_GCExtensionsBase::LARGE_PAGE_POLICY_EXPLICIT:
+		if (0 != largePageSize) {
+			extensions->requestedPageSize = largePageSize;
+			extensions->requestedPageFlags = largePageFlags;
+			extensions->gcmetadataPageSize = largePageSize;
+			extensions->gcmetadataPageFlags = largePageFlags;
+		}
+		break;
+	case MM_GCExtensionsBase::LARGE_PAGE_POLICY_NONE:
+	default:
+		break;
+	}
+}
+
 bool
 MM_MemoryManager::createVirtualMemoryForHeap(MM_EnvironmentBase *env, MM_MemoryHandle *handle, uintptr_t heapAlignment, uintptr_t size, uintptr_t tailPadding, void *preferredAddress, void *ceiling)
 {
@@ -78,6 +116,11 @@ MM_MemoryManager::createVirtualMemoryForHeap(MM_EnvironmentBase *env, MM_MemoryH
 	uintptr_t pageFlags = extensions->requestedPageFlags;
 	Assert_MM_true(0 != pageSize);
 
+	/* align the heap to transparent huge pages if that does not make it shorter than requested */
+	if ((heapAlignment < _transparentHugePageSize) && (0 == (size % _transparentHugePageSize))) {
+		heapAlignment = _transparentHugePageSize;
+	}
+
 	uintptr_t allocateSize = size;
 
 	uintptr_t concurrentScavengerPageSize = 0;
@@ -537,6 +580,14 @@ MM_MemoryManager::createVirtualMemoryForMetadata(MM_EnvironmentBase *env, MM_Mem
 				 */
 				allocateSize = MM_Math::roundToCeiling(minimumAllocationUnit, allocateSize);
 				isOverAllocationRequested = true;
+			} else if (0 != _transparentHugePageSize) {
+				/*
+				 * Reserve whole transparent huge pages, aligned, so that all of the metadata can be backed by them.
+				 * The extra huge page covers the alignment of the base, the remainder is used as preallocated memory
+				 */
+				alignment = _transparentHugePageSize;
+				allocateSize = MM_Math::roundToCeiling(_transparentHugePageSize, allocateSize) + _transparentHugePageSize;
+				isOverAllocationRequested = true;
 			}
 
 			/*
@@ -38,6 +38,7 @@ class MM_MemoryManager : public MM_BaseNonVirtual {
 	 */
 private:
 	MM_MemoryHandle _preAllocated; /**< stored preallocated memory parameters in case of over-allocation */
+	uintptr_t _transparentHugePageSize; /**< size of a transparent huge page, 0 unless the transparent large page policy is in effect */
 
 protected:
 public:
@@ -94,6 +95,15 @@ private:
 		return result;
 	}
 
+	/**
+	 * Apply the large page policy selected in the extensions: find the transparent huge page size
+	 * for the transparent policy, or switch heap and GC metadata to the default large page size
+	 * for the explicit policy. Must be called before the heap is reserved.
+	 *
+	 * @param env environment
+	 */
+	void applyLargePagePolicy(MM_EnvironmentBase *env);
+
 protected:
 	/**
 	 * Provide an initialization for the class
@@ -105,6 +115,7 @@ protected:
 
 	MM_MemoryManager(MM_EnvironmentBase *env)
 		: _preAllocated()
+		, _transparentHugePageSize(0)
 	{
 		_typeId = __FUNCTION__;
 	};
@@ -316,6 +327,16 @@ public:
 		return memory->getPageFlags();
 	};
 
+	/**
+	 * Return the size of the transparent huge pages heap and GC metadata are laid out in
+	 *
+	 * @return transparent huge page size, 0 if the transparent large page policy is not in effect
+	 */
+	MMINLINE uintptr_t getTransparentHugePageSize()
+	{
+		return _transparentHugePageSize;
+	};
+
 	/**
 	 * Return the maximum size of the heap.
 	 *
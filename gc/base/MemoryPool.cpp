@@ -221,6 +221,9 @@ MM_MemoryPool::resetHeapStatistics(bool memoryPoolCollected)
 	_allocBytes = 0;
 	_allocDiscardedBytes = 0;
 	_allocSearchCount = 0;
+	_allocSizeClassBinStarts = 0;
+	_allocTLHCarveCount = 0;
+	_allocTLHCarveChunkCount = 0;
 }
 
 /**
@@ -235,6 +238,9 @@ MM_MemoryPool::mergeHeapStats(MM_HeapStats *heapStats, bool active)
 	
 	heapStats->_allocDiscardedBytes += _allocDiscardedBytes;
 	heapStats->_allocSearchCount += _allocSearchCount;
+	heapStats->_allocSizeClassBinStarts += _allocSizeClassBinStarts;
+	heapStats->_allocTLHCarveCount += _allocTLHCarveCount;
+	heapStats->_allocTLHCarveChunkCount += _allocTLHCarveChunkCount;
 
 	if (active) {
 		heapStats->_activeFreeEntryCount += getActualFreeEntryCount();
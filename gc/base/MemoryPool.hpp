@@ -37,6 +37,7 @@
 
 class MM_HeapLinkedFreeHeader;
 class MM_AllocateDescription;
+class MM_BackgroundHeapReleaser;
 class MM_HeapRegionDescriptor;
 class MM_LargeObjectAllocateStats;
 class MM_SweepPoolManager;
@@ -96,6 +97,9 @@ protected:
 	
 	uintptr_t _allocDiscardedBytes;
 	uintptr_t _allocSearchCount;
+	uintptr_t _allocSizeClassBinStarts; /**< allocate searches that started from a size class bin rather than the list head */
+	uintptr_t _allocTLHCarveCount; /**< TLHs carved from a detached chunk (counted without synchronization, so lost increments make it approximate) */
+	uintptr_t _allocTLHCarveChunkCount; /**< chunks detached from the free list to carve TLHs from */
 
 	MM_GCExtensionsBase *_extensions; /**< GC Extensions for this JVM */
 	
@@ -316,6 +320,13 @@ public:
 	 * same TLH and must be higher than addrBase
 	 */ 
 	void abandonTlhHeapChunk(void *addrBase, void *addrTop);
+
+	/**
+	 * Return the unused part of any chunk the pool has set aside for lock-free TLH refreshes,
+	 * leaving the heap walkable. Must only be called while no thread can refresh a TLH from the pool
+	 * (e.g. when caches are flushed for a collection or a heap walk).
+	 */
+	virtual void flushTLHCarveChunk() {}
 #endif /* OMR_GC_THREAD_LOCAL_HEAP */
 
 	virtual void *findFreeEntryEndingAtAddr(MM_EnvironmentBase *env, void *addr);
@@ -423,6 +434,12 @@ public:
 	 */
 	virtual uintptr_t releaseFreeMemoryPages(MM_EnvironmentBase* env);
 
+	/**
+	 * Let the background heap releaser age the free entries of the pool and release those that are old enough.
+	 * @return bytes of free memory in the pool released/decommited back to OS
+	 */
+	virtual uintptr_t releaseAgedFreeMemoryPages(MM_EnvironmentBase* env, MM_BackgroundHeapReleaser* releaser) { return 0; }
+
 #if defined(J9VM_OPT_CRIU_SUPPORT)
 	/**
 	 * Make adjustments to the Memory Pool to accommodate the restore configuration.
@@ -458,6 +475,9 @@ public:
 		_lastFreeBytes(0),
 		_allocDiscardedBytes(0),
 		_allocSearchCount(0),
+		_allocSizeClassBinStarts(0),
+		_allocTLHCarveCount(0),
+		_allocTLHCarveChunkCount(0),
 		_extensions(env->getExtensions()),
 		_largeObjectAllocateStats(NULL),
 		_darkMatterBytes(0),
@@ -492,6 +512,9 @@ public:
 		_lastFreeBytes(0),
 		_allocDiscardedBytes(0),
 		_allocSearchCount(0),
+		_allocSizeClassBinStarts(0),
+		_allocTLHCarveCount(0),
+		_allocTLHCarveChunkCount(0),
 		_extensions(env->getExtensions()),
 		_largeObjectAllocateStats(NULL),
 		_darkMatterBytes(0),
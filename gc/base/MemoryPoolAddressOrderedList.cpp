@@ -30,6 +30,8 @@
 #include "MemoryPoolAddressOrderedList.hpp"
 
 #include "AllocateDescription.hpp"
+#include "AtomicOperations.hpp"
+#include "BackgroundHeapReleaser.hpp"
 #include "Debug.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
@@ -157,6 +159,13 @@ MM_MemoryPoolAddressOrderedList::initialize(MM_EnvironmentBase *env)
 	}
 	_hintInactive = previousInactiveHint;
 
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+	if (ext->lockFreeTLHRefresh) {
+		/* a chunk that does not hold several TLHs would only add a compare-and-swap to the locked path */
+		_carveChunkSize = OMR_MAX(ext->tlhCarveChunkSize, tlhMaximumSize);
+	}
+#endif /* OMR_GC_THREAD_LOCAL_HEAP */
+
 	return true;
 }
 
@@ -206,6 +215,12 @@ MM_MemoryPoolAddressOrderedList::tearDown(MM_EnvironmentBase *env)
 	
 	_largeObjectCollectorAllocateStats = NULL;
 
+	if (NULL != _sizeClassBins) {
+		env->getForge()->free(_sizeClassBins);
+		_sizeClassBins = NULL;
+		_sizeClassBinCount = 0;
+	}
+
 	_heapLock.tearDown();
 	_resetLock.tearDown();
 }
@@ -231,6 +246,10 @@ MM_MemoryPoolAddressOrderedList::clearHints()
 	_hintInactive = inactiveHint;
 	_hintActive = NULL;
 	_hintLru = 1;
+
+	for (uintptr_t binIndex = 0; binIndex < _sizeClassBinCount; binIndex++) {
+		_sizeClassBins[binIndex].heapFreeHeader = NULL;
+	}
 }
 
 MMINLINE void
@@ -391,6 +410,12 @@ MM_MemoryPoolAddressOrderedList::removeHint(MM_HeapLinkedFreeHeader *freeEntry)
 			hint = hint->next;
 		}
 	}
+
+	for (uintptr_t binIndex = 0; binIndex < _sizeClassBinCount; binIndex++) {
+		if (_sizeClassBins[binIndex].heapFreeHeader == freeEntry) {
+			_sizeClassBins[binIndex].heapFreeHeader = NULL;
+		}
+	}
 }
 
 MMINLINE void
@@ -411,10 +436,16 @@ MM_MemoryPoolAddressOrderedList::updateHint(MM_HeapLinkedFreeHeader *oldFreeEntr
 			hint = hint->next;
 		}
 	}
+
+	for (uintptr_t binIndex = 0; binIndex < _sizeClassBinCount; binIndex++) {
+		if (_sizeClassBins[binIndex].heapFreeHeader == oldFreeEntry) {
+			_sizeClassBins[binIndex].heapFreeHeader = newFreeEntry;
+		}
+	}
 }
 
 /**
- * Update all hints to point no further than the given free entry.
+ * Update all hints and size class bins to point no further than the given free entry.
  * For all active hints, find any which have a pointer greater than the given free entry.  If found, reset
  * the pointer to be the free entry.  This is used when free entries are added to the middle of a free list;
  * hints may point beyond valid free entries in the list.
@@ -431,6 +462,47 @@ MM_MemoryPoolAddressOrderedList::updateHintsBeyondEntry(MM_HeapLinkedFreeHeader
 		/* Move to the next hint */
 		hint = hint->next;
 	}
+
+	/* Every entry up to freeEntry is still below the size of a bin that was beyond it */
+	for (uintptr_t binIndex = 0; binIndex < _sizeClassBinCount; binIndex++) {
+		if (_sizeClassBins[binIndex].heapFreeHeader > freeEntry) {
+			_sizeClassBins[binIndex].heapFreeHeader = freeEntry;
+		}
+	}
+}
+
+/**
+ * Find the size class bin to start an allocate search from.
+ * @param lookupSize the size being allocated
+ * @param binIndex[out] the size class of lookupSize, to be passed to updateSizeClassBin()
+ * @return the bin if every free entry up to and including its heapFreeHeader is smaller than lookupSize, NULL otherwise
+ */
+MMINLINE J9ModronAllocateHint *
+MM_MemoryPoolAddressOrderedList::findSizeClassBin(uintptr_t lookupSize, uintptr_t &binIndex)
+{
+	binIndex = OMR_MIN(_largeObjectAllocateStats->getSizeClassIndex(lookupSize), _sizeClassBinCount - 1);
+	J9ModronAllocateHint *bin = &_sizeClassBins[binIndex];
+
+	/* entries below the head of the list have been consumed by TLH allocates */
+	if ((NULL == bin->heapFreeHeader) || (NULL == _heapFreeList) || (bin->heapFreeHeader < _heapFreeList) || (bin->size >= lookupSize)) {
+		return NULL;
+	}
+	return bin;
+}
+
+/**
+ * Record that every free entry up to and including freeEntry is at most lookupSize bytes, if that lets
+ * searches of the size class start further along the list than they currently do.
+ */
+MMINLINE void
+MM_MemoryPoolAddressOrderedList::updateSizeClassBin(uintptr_t binIndex, MM_HeapLinkedFreeHeader *freeEntry, uintptr_t lookupSize)
+{
+	J9ModronAllocateHint *bin = &_sizeClassBins[binIndex];
+
+	if ((NULL == bin->heapFreeHeader) || (bin->heapFreeHeader < _heapFreeList) || (freeEntry > bin->heapFreeHeader)) {
+		bin->heapFreeHeader = freeEntry;
+		bin->size = lookupSize;
+	}
 }
 
 /****************************************
@@ -446,6 +518,7 @@ MM_MemoryPoolAddressOrderedList::internalAllocate(MM_EnvironmentBase *env, uintp
 	uintptr_t recycleEntrySize;
 	uintptr_t walkCount;
 	J9ModronAllocateHint *allocateHintUsed;
+	uintptr_t binIndex = 0;
 	void *addrBase;
 	uintptr_t largestFreeEntry = 0;
 	
@@ -464,7 +537,11 @@ retry:
 	candidateHintSize = 0;
 
 	/* Large object - use a hint if it is available */
-	allocateHintUsed = findHint(sizeInBytesRequired);
+	if (NULL != _sizeClassBins) {
+		allocateHintUsed = findSizeClassBin(sizeInBytesRequired, binIndex);
+	} else {
+		allocateHintUsed = findHint(sizeInBytesRequired);
+	}
 	if(allocateHintUsed) {
 		currentFreeEntry = allocateHintUsed->heapFreeHeader;
 		candidateHintSize = allocateHintUsed->size;
@@ -513,7 +590,11 @@ retry:
 	}
 
 	_largeObjectAllocateStats->decrementFreeEntrySizeClassStats(currentFreeEntry->getSize());
-	if((walkCount >= J9MODRON_ALLOCATION_MANAGER_HINT_MAX_WALK) || ((walkCount > 1) && allocateHintUsed)) {
+	if (NULL != _sizeClassBins) {
+		if (NULL != previousFreeEntry) {
+			updateSizeClassBin(binIndex, previousFreeEntry, candidateHintSize);
+		}
+	} else if((walkCount >= J9MODRON_ALLOCATION_MANAGER_HINT_MAX_WALK) || ((walkCount > 1) && allocateHintUsed)) {
 		addHint(previousFreeEntry, candidateHintSize);
 	}
 
@@ -524,6 +605,9 @@ retry:
 	_allocCount += 1;
 	_allocBytes += sizeInBytesRequired;
 	_allocSearchCount += walkCount;
+	if ((NULL != _sizeClassBins) && (NULL != allocateHintUsed)) {
+		_allocSizeClassBinStarts += 1;
+	}
 
 	/* Determine what to do with the recycled portion of the free entry */
 	recycleEntrySize = currentFreeEntry->getSize() - sizeInBytesRequired;
@@ -770,13 +854,103 @@ MM_MemoryPoolAddressOrderedList::getConsumedSizeForTLH(MM_EnvironmentBase *env,
 	return consumedSize;
 }
 
+bool
+MM_MemoryPoolAddressOrderedList::carveTLH(MM_EnvironmentBase *env, uintptr_t maximumSizeInBytesRequired, void * &addrBase, void * &addrTop)
+{
+	uintptr_t alloc = _carveAlloc;
+
+	while (0 != alloc) {
+		/* pairs with the write barriers in refillCarveChunk(): a top read after a new alloc belongs to the new chunk */
+		MM_AtomicOperations::readBarrier();
+		uintptr_t top = _carveTop;
+		if ((top <= alloc) || ((top - alloc) < _minimumFreeEntrySize)) {
+			/* empty, or alloc was read from a chunk that has since been replaced (the CAS would fail anyway) */
+			break;
+		}
+
+		uintptr_t remaining = top - alloc;
+		uintptr_t consumedSize = OMR_MIN(maximumSizeInBytesRequired, remaining);
+		if ((remaining - consumedSize) < _minimumFreeEntrySize) {
+			consumedSize = remaining;
+		}
+
+		uintptr_t witnessed = MM_AtomicOperations::lockCompareExchange(&_carveAlloc, alloc, alloc + consumedSize);
+		if (witnessed == alloc) {
+			addrBase = (void *)alloc;
+			addrTop = (void *)(alloc + consumedSize);
+			_allocTLHCarveCount += 1;
+			return true;
+		}
+		alloc = witnessed;
+	}
+
+	return false;
+}
+
+bool
+MM_MemoryPoolAddressOrderedList::refillCarveChunk(MM_EnvironmentBase *env)
+{
+	void *chunkBase = NULL;
+	void *chunkTop = NULL;
+
+	Assert_MM_true(_carveAlloc == _carveTop);
+
+	/* The chunk is accounted as a single TLH allocate; the TLHs carved from it are not added to the TLH size class stats */
+	if (!internalAllocateTLH(env, _carveChunkSize, chunkBase, chunkTop, false, NULL)) {
+		return false;
+	}
+	_allocTLHCarveChunkCount += 1;
+
+	/* Close the old chunk before publishing the new top, so a thread still holding an old alloc can not pair it with the new top */
+	_carveAlloc = 0;
+	MM_AtomicOperations::writeBarrier();
+	_carveTop = (uintptr_t)chunkTop;
+	MM_AtomicOperations::writeBarrier();
+	_carveAlloc = (uintptr_t)chunkBase;
+
+	return true;
+}
+
+void
+MM_MemoryPoolAddressOrderedList::flushTLHCarveChunk()
+{
+	uintptr_t alloc = _carveAlloc;
+	uintptr_t top = _carveTop;
+
+	if ((0 != alloc) && (alloc < top)) {
+		/* the remainder is at least a minimum free entry, so it can go back on the free list */
+		recycleHeapChunk((void *)alloc, (void *)top);
+	}
+	_carveAlloc = 0;
+	_carveTop = 0;
+}
+
 void *
 MM_MemoryPoolAddressOrderedList::allocateTLH(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription,
 											uintptr_t maximumSizeInBytesRequired, void * &addrBase, void * &addrTop)
 {
 	void *tlhBase = NULL;
+	bool allocated = false;
+
+	if ((0 != _carveChunkSize) && !isAlignmentForParallelGCRequired()) {
+		allocated = carveTLH(env, maximumSizeInBytesRequired, addrBase, addrTop);
+		if (!allocated) {
+			_heapLock.acquire();
+			/* another thread may have refilled the chunk while this one waited for the lock, and
+			 * lock-free carvers may empty a new chunk before this thread gets a TLH from it
+			 */
+			while (!(allocated = carveTLH(env, maximumSizeInBytesRequired, addrBase, addrTop))) {
+				if (!refillCarveChunk(env)) {
+					break;
+				}
+			}
+			_heapLock.release();
+		}
+	} else {
+		allocated = internalAllocateTLH(env, maximumSizeInBytesRequired, addrBase, addrTop, true, _largeObjectAllocateStats);
+	}
 
-	if (internalAllocateTLH(env, maximumSizeInBytesRequired, addrBase, addrTop, true, _largeObjectAllocateStats)) {
+	if (allocated) {
 		tlhBase = addrBase;
 	}
 
@@ -823,6 +997,8 @@ MM_MemoryPoolAddressOrderedList::reset(Cause cause)
 
 	clearHints();
 	_heapFreeList = (MM_HeapLinkedFreeHeader *)NULL;
+	_carveAlloc = 0;
+	_carveTop = 0;
 	_scannableBytes = 0;
 	_nonScannableBytes = 0;
 	_firstCardUnalignedFreeEntry = FREE_ENTRY_END;
@@ -1848,6 +2024,16 @@ MM_MemoryPoolAddressOrderedList::releaseFreeMemoryPages(MM_EnvironmentBase* env)
 	return releasedBytes;
 }
 
+uintptr_t
+MM_MemoryPoolAddressOrderedList::releaseAgedFreeMemoryPages(MM_EnvironmentBase* env, MM_BackgroundHeapReleaser* releaser)
+{
+	uintptr_t releasedBytes = 0;
+	_heapLock.acquire();
+	releasedBytes = releaser->ageFreeEntries(env, _heapFreeList);
+	_heapLock.release();
+	return releasedBytes;
+}
+
 MM_HeapLinkedFreeHeader *
 MM_MemoryPoolAddressOrderedList::doFreeEntryCardAlignmentUpTo(MM_EnvironmentBase *env, MM_HeapLinkedFreeHeader *lastFreeEntryToAlign)
 {
@@ -1935,6 +2121,30 @@ MM_MemoryPoolAddressOrderedList::setParallelGCAlignment(MM_EnvironmentBase *env,
 	}
 }
 
+bool
+MM_MemoryPoolAddressOrderedList::enableSizeClassBins(MM_EnvironmentBase *env)
+{
+	uintptr_t binCount = _largeObjectAllocateStats->getMaxSizeClasses();
+	if (0 == binCount) {
+		return false;
+	}
+
+	_sizeClassBins = (J9ModronAllocateHint *)env->getForge()->allocate(binCount * sizeof(J9ModronAllocateHint), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL == _sizeClassBins) {
+		return false;
+	}
+
+	for (uintptr_t binIndex = 0; binIndex < binCount; binIndex++) {
+		_sizeClassBins[binIndex].next = NULL;
+		_sizeClassBins[binIndex].size = 0;
+		_sizeClassBins[binIndex].heapFreeHeader = NULL;
+		_sizeClassBins[binIndex].lru = 0;
+	}
+	_sizeClassBinCount = binCount;
+
+	return true;
+}
+
 void
 MM_MemoryPoolAddressOrderedList::setSubSpace(MM_MemorySubSpace *memorySubSpace)
 {
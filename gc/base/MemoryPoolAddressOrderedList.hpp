@@ -60,6 +60,15 @@ private:
 	struct J9ModronAllocateHint* _hintInactive;
 	struct J9ModronAllocateHint _hintStorage[HINT_ELEMENT_COUNT];
 	uintptr_t _hintLru;
+
+	/* Size class bin support */
+	struct J9ModronAllocateHint *_sizeClassBins; /**< Per size class search start for allocations, or NULL if bins are disabled */
+	uintptr_t _sizeClassBinCount; /**< Number of entries in _sizeClassBins */
+
+	/* Lock-free TLH refresh support */
+	volatile uintptr_t _carveAlloc; /**< First unused byte of the chunk TLHs are carved from, or 0 if there is no chunk */
+	volatile uintptr_t _carveTop; /**< First byte after the chunk TLHs are carved from */
+	uintptr_t _carveChunkSize; /**< Size of the chunks detached from the free list for lock-free TLH refreshes, or 0 if disabled */
 	
 	MM_LargeObjectAllocateStats *_largeObjectCollectorAllocateStats;  /**< Same as _largeObjectAllocateStats except specifically for collector allocates */
 
@@ -81,10 +90,27 @@ private:
 	void updateHint(MM_HeapLinkedFreeHeader *oldFreeEntry, MM_HeapLinkedFreeHeader *newFreeEntry);
 	void clearHints();
 	void updateHintsBeyondEntry(MM_HeapLinkedFreeHeader *freeEntry);
+	J9ModronAllocateHint *findSizeClassBin(uintptr_t lookupSize, uintptr_t &binIndex);
+	void updateSizeClassBin(uintptr_t binIndex, MM_HeapLinkedFreeHeader *freeEntry, uintptr_t lookupSize);
 	void *internalAllocate(MM_EnvironmentBase *env, uintptr_t sizeInBytesRequired, bool lockingRequired, MM_LargeObjectAllocateStats *largeObjectAllocateStats);
 	bool internalAllocateTLH(MM_EnvironmentBase *env, uintptr_t maximumSizeInBytesRequired, void * &addrBase, void * &addrTop, bool lockingRequired, MM_LargeObjectAllocateStats *largeObjectAllocateStats);
 	uintptr_t getConsumedSizeForTLH(MM_EnvironmentBase *env, MM_HeapLinkedFreeHeader *freeEntry, uintptr_t maximumSizeInBytesRequired);
 
+	/**
+	 * Carve a TLH from the detached chunk with a compare-and-swap on the chunk's allocation pointer.
+	 * A remainder too small to be a free entry is handed out with the TLH, so the chunk is only ever
+	 * left empty or with room for another TLH.
+	 * @return true if a TLH was carved, false if the chunk is empty
+	 */
+	bool carveTLH(MM_EnvironmentBase *env, uintptr_t maximumSizeInBytesRequired, void * &addrBase, void * &addrTop);
+
+	/**
+	 * Detach a new chunk from the head of the free list to carve TLHs from. The previous chunk must be empty.
+	 * Must be called with the heap lock held.
+	 * @return true if a chunk was detached, false if the pool is empty
+	 */
+	bool refillCarveChunk(MM_EnvironmentBase *env);
+
 	/* Align a TLH to meet boundary restrictions. Certain phases of some GCs may require that TLHs not span heap chunks for parallel processing. */
 	bool alignTLHForParallelGC(MM_EnvironmentBase *env, MM_HeapLinkedFreeHeader *freeEntry, uintptr_t *consumedSize);
 
@@ -127,6 +153,7 @@ public:
 	virtual void *allocateTLH(MM_EnvironmentBase *env,  MM_AllocateDescription *allocDescription, uintptr_t maximumSizeInBytesRequired, void * &addrBase, void * &addrTop);
 	virtual void *collectorAllocate(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool lockingRequired);
 	virtual void *collectorAllocateTLH(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, uintptr_t maximumSizeInBytesRequired, void * &addrBase, void * &addrTop, bool lockingRequired);
+	virtual void flushTLHCarveChunk();
 		
 	virtual bool initialize(MM_EnvironmentBase *env);
 	virtual void tearDown(MM_EnvironmentBase *env);
@@ -187,9 +214,19 @@ public:
 	virtual void recalculateMemoryPoolStatistics(MM_EnvironmentBase *env);
 
 	virtual uintptr_t releaseFreeMemoryPages(MM_EnvironmentBase* env);
+	virtual uintptr_t releaseAgedFreeMemoryPages(MM_EnvironmentBase* env, MM_BackgroundHeapReleaser* releaser);
 
 	void setParallelGCAlignment(MM_EnvironmentBase *env, bool alignmentEnabled);
 
+	/**
+	 * Index allocation searches by the free entry size classes of the pool's MM_LargeObjectAllocateStats.
+	 * Each size class remembers the furthest free entry known to be preceded only by entries too small for
+	 * that class, so a search resumes there instead of at the head of the list (the address ordered list is
+	 * kept as is for coalescing). Replaces the LRU hint table for object allocates.
+	 * @return true on success, false if the bins could not be allocated
+	 */
+	bool enableSizeClassBins(MM_EnvironmentBase *env);
+
 	/**
 	 * remove a free entry from freelist
 	 */
@@ -253,6 +290,11 @@ public:
 	MM_MemoryPoolAddressOrderedList(MM_EnvironmentBase *env, uintptr_t minimumFreeEntrySize) :
 		MM_MemoryPoolAddressOrderedListBase(env, minimumFreeEntrySize)
 		,_heapFreeList(NULL)
+		,_sizeClassBins(NULL)
+		,_sizeClassBinCount(0)
+		,_carveAlloc(0)
+		,_carveTop(0)
+		,_carveChunkSize(0)
 		,_largeObjectCollectorAllocateStats(NULL)
 		,_firstCardUnalignedFreeEntry(FREE_ENTRY_END)
 		,_prevCardUnalignedFreeEntry(FREE_ENTRY_END)
@@ -265,6 +307,11 @@ public:
 	MM_MemoryPoolAddressOrderedList(MM_EnvironmentBase *env, uintptr_t minimumFreeEntrySize, const char *name) :
 		MM_MemoryPoolAddressOrderedListBase(env, minimumFreeEntrySize, name)
 		,_heapFreeList(NULL)
+		,_sizeClassBins(NULL)
+		,_sizeClassBinCount(0)
+		,_carveAlloc(0)
+		,_carveTop(0)
+		,_carveChunkSize(0)
 		,_largeObjectCollectorAllocateStats(NULL)
 		,_firstCardUnalignedFreeEntry(FREE_ENTRY_END)
 		,_prevCardUnalignedFreeEntry(FREE_ENTRY_END)
@@ -1134,3 +1134,11 @@ MM_MemoryPoolLargeObjects::releaseFreeMemoryPages(MM_EnvironmentBase* env)
 	releasedMemory += _memoryPoolLargeObjects->releaseFreeMemoryPages(env);
 	return releasedMemory;
 }
+
+uintptr_t
+MM_MemoryPoolLargeObjects::releaseAgedFreeMemoryPages(MM_EnvironmentBase* env, MM_BackgroundHeapReleaser* releaser)
+{
+	uintptr_t releasedMemory = _memoryPoolSmallObjects->releaseAgedFreeMemoryPages(env, releaser);
+	releasedMemory += _memoryPoolLargeObjects->releaseAgedFreeMemoryPages(env, releaser);
+	return releasedMemory;
+}
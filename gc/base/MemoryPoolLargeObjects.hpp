@@ -262,6 +262,7 @@ public:
 	}
 
 	virtual uintptr_t releaseFreeMemoryPages(MM_EnvironmentBase* env);
+	virtual uintptr_t releaseAgedFreeMemoryPages(MM_EnvironmentBase* env, MM_BackgroundHeapReleaser* releaser);
 
 	/**
 	 * Create a MemoryPoolLargeObjects object.
@@ -29,6 +29,7 @@
 #include "MemoryPoolSplitAddressOrderedList.hpp"
 
 #include "AllocateDescription.hpp"
+#include "BackgroundHeapReleaser.hpp"
 #include "Debug.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
@@ -1311,6 +1312,21 @@ MM_MemoryPoolSplitAddressOrderedList::releaseFreeMemoryPages(MM_EnvironmentBase*
 	return releasedMemory;
 }
 
+uintptr_t
+MM_MemoryPoolSplitAddressOrderedList::releaseAgedFreeMemoryPages(MM_EnvironmentBase* env, MM_BackgroundHeapReleaser* releaser)
+{
+	uintptr_t releasedMemory = 0;
+
+	for (uintptr_t i = 0; i < _heapFreeListCount; i++) {
+		_heapFreeLists[i]._lock.acquire();
+		_heapFreeLists[i]._timesLocked += 1;
+		releasedMemory += releaser->ageFreeEntries(env, _heapFreeLists[i]._freeList);
+		_heapFreeLists[i]._lock.release();
+	}
+
+	return releasedMemory;
+}
+
 #if defined(J9VM_OPT_CRIU_SUPPORT)
 bool
 MM_MemoryPoolSplitAddressOrderedList::reinitializeForRestore(MM_EnvironmentBase *env)
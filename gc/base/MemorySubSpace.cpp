@@ -960,8 +960,7 @@ MM_MemorySubSpace::systemGarbageCollect(MM_EnvironmentBase* env, uint32_t gcCode
 				releasedBytes,
 				getActiveMemorySize(),
 				omrtime_hires_delta(startTime, endTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS),
-				/* reason enum variable not applicable/used, so passing univeral value 1 = not found*/
-				1 
+				RELEASE_FREE_PAGES_IDLE
 				);
 		}
 	}
@@ -32,6 +32,7 @@
 
 #include "EnvironmentBase.hpp"
 #include "Forge.hpp"
+#include "Math.hpp"
 #include "ModronAssertions.h"
 #include "NUMAManager.hpp"
 
@@ -207,6 +208,37 @@ MM_NUMAManager::getAffinityLeaderCount() const
 	return _affinityLeaderCount;
 }
 
+uintptr_t
+MM_NUMAManager::getAffinityLeaderNodeID(uintptr_t j9NodeNumber) const
+{
+	uintptr_t numaNodeID = 0;
+
+	for (uintptr_t i = 0; i < _affinityLeaderCount; i++) {
+		if (_affinityLeaders[i].j9NodeNumber == j9NodeNumber) {
+			numaNodeID = i + 1;
+			break;
+		}
+	}
+
+	return numaNodeID;
+}
+
+void *
+MM_NUMAManager::getAffinityLeaderSliceBase(void *lowAddress, void *highAddress, uintptr_t alignment, uintptr_t sliceIndex) const
+{
+	Assert_MM_true(sliceIndex <= _affinityLeaderCount);
+	Assert_MM_true(lowAddress <= highAddress);
+
+	void *sliceBase = highAddress;
+	if (sliceIndex < _affinityLeaderCount) {
+		uintptr_t sliceSize = ((uintptr_t)highAddress - (uintptr_t)lowAddress) / _affinityLeaderCount;
+		sliceBase = (void *)MM_Math::roundToFloor(alignment, (uintptr_t)lowAddress + (sliceSize * sliceIndex));
+		sliceBase = OMR_MAX(sliceBase, lowAddress);
+	}
+
+	return sliceBase;
+}
+
 uintptr_t
 MM_NUMAManager::getMaximumNodeNumber() const
 {
@@ -85,6 +85,27 @@ public:
 		return j9NodeNumber;
 	}
 
+	/**
+	 * Get logical node ID (starting from 1) of the affinity leader with the given low-level NUMA node number.
+	 * This is the inverse of getJ9NodeNumber().
+	 * @param j9NodeNumber[in] The low-level NUMA node number, as returned by the port library
+	 * @return The logical node ID, or 0 if NUMA is not enabled or the node is not an affinity leader
+	 */
+	uintptr_t getAffinityLeaderNodeID(uintptr_t j9NodeNumber) const;
+
+	/**
+	 * Split the address range [lowAddress, highAddress) into getAffinityLeaderCount() contiguous slices, one per
+	 * affinity leader in ascending address order, and return the base of the requested slice. Slice boundaries are
+	 * aligned to the given alignment, so callers that bind memory and callers that allocate from the slices agree on
+	 * where each slice starts, regardless of whether NUMA is physical or simulated.
+	 * @param lowAddress[in] The base of the range
+	 * @param highAddress[in] The top of the range
+	 * @param alignment[in] The required alignment of the slice boundaries (must be a power of two)
+	 * @param sliceIndex[in] The zero-based slice index, where getAffinityLeaderCount() returns highAddress
+	 * @return The base address of the slice
+	 */
+	void *getAffinityLeaderSliceBase(void *lowAddress, void *highAddress, uintptr_t alignment, uintptr_t sliceIndex) const;
+
 	/**
 	 * Called to update internal NUMA caches (could be due to a change in the machine's NUMA state or a change in whether or not we want to enable NUMA (either real or simulated))
 	 * @param env[in] The main GC thread
@@ -27,8 +27,10 @@
 
 #include "GCExtensionsBase.hpp"
 #include "Heap.hpp"
+#include "HeapMemorySubSpaceIterator.hpp"
 #include "GlobalCollector.hpp"
 #include "MemoryPool.hpp"
+#include "MemorySubSpace.hpp"
 #include "ObjectAllocationInterface.hpp"
 #include "ObjectHeapIterator.hpp"
 #include "ObjectModel.hpp"
@@ -84,6 +86,33 @@ GC_OMRVMInterface::getOmrHookInterface(MM_GCExtensionsBase *extensions)
 	return J9_HOOK_INTERFACE(extensions->omrHookInterface);
 }
 
+/**
+ * Flush the caches held by the memory pools themselves (currently the chunks set aside for lock-free TLH refreshes).
+ * Thread caches are flushed separately; no thread may be allocating while this runs.
+ */
+void
+GC_OMRVMInterface::flushMemoryPoolCaches(MM_GCExtensionsBase *extensions)
+{
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+	if (extensions->lockFreeTLHRefresh) {
+		MM_HeapMemorySubSpaceIterator subSpaceIterator(extensions->heap);
+		MM_MemorySubSpace *subSpace = NULL;
+
+		while (NULL != (subSpace = subSpaceIterator.nextSubSpace())) {
+			MM_MemoryPool *memoryPool = subSpace->getMemoryPool();
+			if (NULL != memoryPool) {
+				if (NULL != memoryPool->getChildren()) {
+					memoryPool = memoryPool->getChildren();
+				}
+				for (; NULL != memoryPool; memoryPool = memoryPool->getNext()) {
+					memoryPool->flushTLHCarveChunk();
+				}
+			}
+		}
+	}
+#endif /* OMR_GC_THREAD_LOCAL_HEAP */
+}
+
 /**
  * Flush Cache for walk.
  */
@@ -104,6 +133,8 @@ GC_OMRVMInterface::flushCachesForWalk(OMR_VM *omrVM)
 		MM_EnvironmentBase *envToFlush = MM_EnvironmentBase::getEnvironment(omrVMThread);
 		GC_OMRVMThreadInterface::flushCachesForWalk(envToFlush);
 	}
+
+	flushMemoryPoolCaches(MM_GCExtensionsBase::getExtensions(omrVM));
 }
 
 /**
@@ -142,6 +173,8 @@ GC_OMRVMInterface::flushCachesForGC(MM_EnvironmentBase *env)
 
 	extensions->bytesAllocatedMost = allocatedBytesMax;
 	extensions->vmThreadAllocatedMost = vmThreadMax;
+
+	flushMemoryPoolCaches(extensions);
 }
 
 /**
@@ -37,6 +37,7 @@ struct J9HookInterface;
 class GC_OMRVMInterface
 {
 private:
+	static void flushMemoryPoolCaches(MM_GCExtensionsBase *extensions);
 protected:
 public:
 	static void flushCachesForWalk(OMR_VM* omrVM);
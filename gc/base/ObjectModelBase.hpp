@@ -813,6 +813,19 @@ public:
 		return _delegate.getHotFieldOffset3(forwardedHeader);
 	}
 
+	/**
+	 * Returns a key identifying the class of an object for scavenger hot field sampling. Objects with the
+	 * same key are assumed to have the same reference slot layout.
+	 *
+	 * @param objectPtr pointer to the object
+	 * @return a non-zero key for the class of the object, or 0 if the object should not be profiled
+	 */
+	MMINLINE uintptr_t
+	getHotFieldProfileKey(omrobjectptr_t objectPtr)
+	{
+		return _delegate.getHotFieldProfileKey(objectPtr);
+	}
+
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC) */
 
 #if defined(OMR_GC_MODRON_SCAVENGER)
@@ -472,13 +472,15 @@ MM_ParallelDispatcher::recomputeActiveThreadCountForTask(MM_EnvironmentBase *env
 	 *
 	 *  1) User forced a thread count (e.g Xgcthreads)
 	 *  2) Adaptive threading flag is not set (-XX:-AdaptiveGCThreading)
-	 *  3) or simply the task wasn't recommended a thread count (currently only recommended for STW Scavenge Tasks)
+	 *  3) or simply the task wasn't recommended a thread count (the STW Scavenge task, and with
+	 *     -Xgc:elasticTaskThreads the mark, sweep and compact tasks, recommend thread counts)
 	 */
 	if (UDATA_MAX != task->getRecommendedWorkingThreads()) {
 		/* Bound the recommended thread count. Determine the  upper bound for the thread count,
-		 * This will either be the user specified gcMaxThreadCount (-XgcmaxthreadsN) or else default max
+		 * This will either be the user specified gcMaxThreadCount (-XgcmaxthreadsN) or else default max.
+		 * An explicit thread count from the caller still takes precedence.
 		 */
-		taskActiveThreadCount = OMR_MIN(_threadCount, task->getRecommendedWorkingThreads());
+		taskActiveThreadCount = OMR_MIN(OMR_MIN(_threadCount, threadCount), task->getRecommendedWorkingThreads());
 
 		_activeThreadCount = taskActiveThreadCount;
 
@@ -489,6 +491,21 @@ MM_ParallelDispatcher::recomputeActiveThreadCountForTask(MM_EnvironmentBase *env
  	return taskActiveThreadCount;
 }
 
+uintptr_t
+MM_ParallelDispatcher::recommendThreadsForWork(MM_EnvironmentBase *env, uintptr_t workBytes)
+{
+	uintptr_t recommendedThreads = UDATA_MAX;
+
+	if (_extensions->elasticTaskThreads && (UDATA_MAX != workBytes)) {
+		uintptr_t threadWork = _extensions->elasticTaskThreadWork;
+		recommendedThreads = (workBytes / threadWork) + ((0 != (workBytes % threadWork)) ? 1 : 0);
+		/* never more than the heap size and processors would allow, and at least the calling thread */
+		recommendedThreads = OMR_MAX(OMR_MIN(recommendedThreads, adjustThreadCount(_threadCount)), 1);
+	}
+
+	return recommendedThreads;
+}
+
 uintptr_t 
 MM_ParallelDispatcher::adjustThreadCount(uintptr_t maxThreadCount)
 {
@@ -207,6 +207,17 @@ public:
 #endif /* defined(J9VM_OPT_CRIU_SUPPORT) */
 
 	virtual bool condYieldFromGCWrapper(MM_EnvironmentBase *env, uint64_t timeSlack = 0) { return false; }
+
+	/**
+	 * Recommend a thread count for a task from an estimate of its work (-Xgc:elasticTaskThreads), for tasks
+	 * to return from getRecommendedWorkingThreads(). Collections with little work then wake only as many
+	 * threads as they can keep busy rather than the whole pool.
+	 *
+	 * @param[in] env the current environment
+	 * @param[in] workBytes estimated bytes the task will scan, copy or sweep (UDATA_MAX if unknown)
+	 * @return the recommended thread count, or UDATA_MAX if elastic task threads are disabled or the work is unknown
+	 */
+	uintptr_t recommendThreadsForWork(MM_EnvironmentBase *env, uintptr_t workBytes);
 	
 	MMINLINE uintptr_t threadCount() { return _threadCount; }
 	MMINLINE uintptr_t threadCountMaximum() { return _threadCountMaximum; }
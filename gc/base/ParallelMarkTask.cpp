@@ -44,6 +44,7 @@ void
 MM_ParallelMarkTask::run(MM_EnvironmentBase *env)
 {
 	env->_workStack.prepareForWork(env, (MM_WorkPackets *)(_markingScheme->getWorkPackets()));
+	env->_workStack.attachStealingDeque(env);
 
 	_markingScheme->markLiveObjectsInit(env, _initMarkMap);
 
@@ -55,6 +55,7 @@ private:
 	const bool _initMarkMap;
 	MM_CycleState *_cycleState;  /**< Collection cycle state active for the task */
 	const MarkAction _action;
+	uintptr_t _recommendedThreads; /**< Collector recommended threads for the task (UDATA_MAX for no recommendation) */
 	
 public:
 	virtual uintptr_t getVMStateID();
@@ -62,6 +63,8 @@ public:
 	virtual void run(MM_EnvironmentBase *env);
 	virtual void setup(MM_EnvironmentBase *env);
 	virtual void cleanup(MM_EnvironmentBase *env);
+
+	virtual uintptr_t getRecommendedWorkingThreads() { return _recommendedThreads; };
 	
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	virtual void synchronizeGCThreads(MM_EnvironmentBase *env, const char *id);
@@ -77,12 +80,14 @@ public:
 			MM_MarkingScheme *markingScheme, 
 			bool initMarkMap,
 			MM_CycleState *cycleState,
-			MarkAction action = MARK_ALL) :
+			MarkAction action = MARK_ALL,
+			uintptr_t recommendedThreads = UDATA_MAX) :
 		MM_ParallelTask(env, dispatcher)
 		,_markingScheme(markingScheme)
 		,_initMarkMap(initMarkMap)
 		,_cycleState(cycleState)
 		,_action(action)
+		,_recommendedThreads(recommendedThreads)
 	{
 		_typeId = __FUNCTION__;
 	};
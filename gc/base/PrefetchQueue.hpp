@@ -0,0 +1,142 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(PREFETCHQUEUE_HPP_)
+#define PREFETCHQUEUE_HPP_
+
+#include "omrcfg.h"
+#include "omr.h"
+
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+#include <xmmintrin.h>
+#endif /* defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64)) */
+
+#include "BaseNonVirtual.hpp"
+
+/**
+ * Small per-thread FIFO of reference slots whose targets have been prefetched but not yet
+ * processed (marked or copied).
+ *
+ * Scan loops push each slot as it is found, issuing a prefetch for the memory the deferred
+ * work will touch, and only process the oldest entry once the queue holds the configured
+ * prefetch distance. This gives the prefetch a few slots' worth of work to hide the miss behind.
+ * The queue is always drained before the scan loop returns, so it is empty between objects.
+ *
+ * @ingroup GC_Base
+ */
+class MM_PrefetchQueue : public MM_BaseNonVirtual
+{
+/* Data members */
+public:
+	enum {
+		_capacity = 16, /**< Maximum prefetch distance (must be a power of two) */
+		_indexMask = _capacity - 1
+	};
+
+	/**
+	 * A deferred slot and the object it referred to when it was queued.
+	 */
+	struct Entry {
+		fomrobject_t *slot; /**< Address of the reference slot, or NULL if the consumer does not update slots */
+		omrobjectptr_t object; /**< Object read from the slot at the time it was queued */
+		bool leaf; /**< Slot was reported as a leaf slot by the object scanner */
+	};
+
+private:
+	Entry _entries[_capacity];
+	uintptr_t _head; /**< Index of the oldest entry */
+	uintptr_t _tail; /**< Index one past the newest entry */
+
+/* Methods */
+public:
+	/**
+	 * Issue a non-binding prefetch for the cache line holding address. Compiles to nothing
+	 * on toolchains without a prefetch intrinsic.
+	 * @param address[in] The address to prefetch
+	 */
+	MMINLINE static void
+	prefetch(const void *address)
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		__builtin_prefetch(address);
+#elif defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+		_mm_prefetch((const char *)address, _MM_HINT_T0);
+#endif /* defined(__GNUC__) || defined(__clang__) */
+	}
+
+	/**
+	 * @return the number of entries currently queued
+	 */
+	MMINLINE uintptr_t getCount() { return _tail - _head; }
+
+	/**
+	 * @return true if no entries are queued
+	 */
+	MMINLINE bool isEmpty() { return _head == _tail; }
+
+	/**
+	 * Append an entry. The caller must pop an entry first if the queue holds _capacity entries.
+	 * @param slot[in] The address of the reference slot (may be NULL)
+	 * @param object[in] The object read from the slot
+	 * @param leaf[in] Whether the slot is a leaf slot
+	 */
+	MMINLINE void
+	push(fomrobject_t *slot, omrobjectptr_t object, bool leaf)
+	{
+		Entry *entry = &_entries[_tail & _indexMask];
+		entry->slot = slot;
+		entry->object = object;
+		entry->leaf = leaf;
+		_tail += 1;
+	}
+
+	/**
+	 * Remove the oldest entry. The queue must not be empty. The returned entry remains valid
+	 * only until the next push().
+	 * @return the oldest entry
+	 */
+	MMINLINE Entry *
+	pop()
+	{
+		Entry *entry = &_entries[_head & _indexMask];
+		_head += 1;
+		return entry;
+	}
+
+	/**
+	 * Create a PrefetchQueue object.
+	 */
+	MM_PrefetchQueue() :
+		MM_BaseNonVirtual(),
+		_head(0),
+		_tail(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* PREFETCHQUEUE_HPP_ */
@@ -0,0 +1,94 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#include "ScanKernel.hpp"
+
+#include "EnvironmentBase.hpp"
+
+MM_ScanKernel::Kind
+MM_ScanKernel::select(MM_EnvironmentBase *env, bool allowSIMD)
+{
+	OMRPortLibrary *portLibrary = env->getPortLibrary();
+	Kind kind = scalar;
+
+	if (allowSIMD) {
+		if (isSupported(portLibrary, avx2)) {
+			kind = avx2;
+		} else if (isSupported(portLibrary, sse2)) {
+			kind = sse2;
+		} else if (isSupported(portLibrary, neon)) {
+			kind = neon;
+		}
+	}
+
+	return kind;
+}
+
+bool
+MM_ScanKernel::isSupported(OMRPortLibrary *portLibrary, Kind kind)
+{
+	bool supported = false;
+
+	if (scalar == kind) {
+		supported = true;
+	} else {
+		OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+		OMRProcessorDesc processorDesc;
+		if (0 == omrsysinfo_get_processor_description(&processorDesc)) {
+			/* kernels are only built for their own architecture */
+			switch (kind) {
+#if defined(OMR_ARCH_X86)
+			case sse2:
+				supported = (TRUE == omrsysinfo_processor_has_feature(&processorDesc, OMR_FEATURE_X86_SSE2));
+				break;
+			case avx2:
+				/* the OS must also save the upper halves of the ymm registers */
+				supported = (TRUE == omrsysinfo_processor_has_feature(&processorDesc, OMR_FEATURE_X86_AVX2))
+						&& (TRUE == omrsysinfo_processor_has_feature(&processorDesc, OMR_FEATURE_X86_AVX))
+						&& (TRUE == omrsysinfo_processor_has_feature(&processorDesc, OMR_FEATURE_X86_OSXSAVE));
+				break;
+#endif /* defined(OMR_ARCH_X86) */
+#if defined(OMR_ARCH_AARCH64)
+			case neon:
+				supported = (TRUE == omrsysinfo_processor_has_feature(&processorDesc, OMR_FEATURE_ARM64_ASIMD));
+				break;
+#endif /* defined(OMR_ARCH_AARCH64) */
+			default:
+				break;
+			}
+		}
+	}
+
+	return supported;
+}
+
+const char *
+MM_ScanKernel::getName(Kind kind)
+{
+	static const char * const names[kindCount] = { "scalar", "sse2", "avx2", "neon" };
+	return (kind < kindCount) ? names[kind] : "unknown";
+}
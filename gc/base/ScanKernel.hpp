@@ -0,0 +1,104 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(SCANKERNEL_HPP_)
+#define SCANKERNEL_HPP_
+
+#include "omrcfg.h"
+#include "omr.h"
+#include "omrport.h"
+
+#include "Bits.hpp"
+
+class MM_EnvironmentBase;
+
+/**
+ * Instruction set selection shared by the vectorized scan kernels (MM_CardScanKernel, MM_MarkMapScanKernel).
+ * Each kernel family provides one implementation per Kind; which one runs is decided here, once, from the
+ * features reported by omrsysinfo_get_processor_description().
+ *
+ * @ingroup GC_Base
+ */
+class MM_ScanKernel
+{
+	/* Data Members */
+public:
+	enum Kind {
+		scalar = 0,
+		sse2,
+		avx2,
+		neon,
+		kindCount
+	};
+
+	/* Member Functions */
+public:
+	/**
+	 * Pick the widest kernel the processor supports.
+	 * @param env[in] The calling thread
+	 * @param allowSIMD[in] If false, the scalar kernel is always chosen
+	 * @return the kernel to use
+	 */
+	static Kind select(MM_EnvironmentBase *env, bool allowSIMD);
+
+	/**
+	 * @param portLibrary[in] The port library used to query the processor
+	 * @param kind[in] The kernel to test for
+	 * @return true if kind is built for this architecture and the processor supports it
+	 */
+	static bool isSupported(OMRPortLibrary *portLibrary, Kind kind);
+
+	/**
+	 * @param kind[in] A kernel
+	 * @return the name of the kernel, as reported by the benchmarks
+	 */
+	static const char *getName(Kind kind);
+
+	/**
+	 * Locate the first non-zero byte in the pair of vectors that ended a vector scan loop.
+	 * @param lowZeroBytes[in] Byte mask (bit n set if byte n is zero) of the low vector
+	 * @param highZeroBytes[in] Byte mask of the high vector
+	 * @param vectorBytes[in] The size of each vector
+	 * @return the index of the first non-zero byte, counting from the start of the low vector
+	 */
+	MMINLINE static uintptr_t
+	firstNonZeroByte(uint32_t lowZeroBytes, uint32_t highZeroBytes, uintptr_t vectorBytes)
+	{
+		/* a full vector of zero bytes sets every mask bit, which the complement turns into an empty mask */
+		const uint32_t allZero = (uint32_t)(((uint64_t)1 << vectorBytes) - 1);
+		uint32_t lowNonZeroBytes = allZero & ~lowZeroBytes;
+		uintptr_t byteIndex = 0;
+		if (0 != lowNonZeroBytes) {
+			byteIndex = MM_Bits::leadingZeroes(lowNonZeroBytes);
+		} else {
+			byteIndex = vectorBytes + MM_Bits::leadingZeroes(allZero & ~highZeroBytes);
+		}
+		return byteIndex;
+	}
+};
+
+#endif /* SCANKERNEL_HPP_ */
@@ -0,0 +1,56 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+/**
+ * @file
+ * @ingroup GC_Base
+ *
+ * Intrinsics and target attributes for the scan kernel implementations. Only the translation units
+ * that implement kernels include this; everything else goes through MM_ScanKernel.
+ */
+
+#if !defined(SCANKERNELTARGET_HPP_)
+#define SCANKERNELTARGET_HPP_
+
+#include "omrcfg.h"
+
+#if defined(OMR_ARCH_X86)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else /* defined(_MSC_VER) */
+#include <immintrin.h>
+#endif /* defined(_MSC_VER) */
+#endif /* defined(OMR_ARCH_X86) */
+
+#if defined(OMR_ARCH_AARCH64)
+#include <arm_neon.h>
+#endif /* defined(OMR_ARCH_AARCH64) */
+
+/* GCC and clang only accept vector intrinsics in functions compiled for the matching target */
+#if defined(__GNUC__) || defined(__clang__)
+#define SCAN_KERNEL_TARGET(isa) __attribute__((target(isa)))
+#else /* defined(__GNUC__) || defined(__clang__) */
+#define SCAN_KERNEL_TARGET(isa)
+#endif /* defined(__GNUC__) || defined(__clang__) */
+
+#endif /* SCANKERNELTARGET_HPP_ */
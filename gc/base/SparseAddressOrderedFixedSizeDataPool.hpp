@@ -110,7 +110,7 @@ public:
 	 * @return address of free region or NULL if there's no such contiguous free region
 	 */
 
-	void *findFreeListEntry(uintptr_t size);
+	virtual void *findFreeListEntry(uintptr_t size);
 
 	/**
 	 * A region was freed, now we insert that back into the freeList ordered by address
@@ -118,7 +118,7 @@ public:
 	 * @param address	void*		Address associated to region to be returned
 	 * @param size		uintptr_t	Size of region to be returned to freeList
 	 */
-	bool returnFreeListEntry(void *address, uintptr_t size);
+	virtual bool returnFreeListEntry(void *address, uintptr_t size);
 
 	/**
 	 * Add object entry to the hash table that maps the proxyObjPtr to the data pointer
@@ -129,7 +129,7 @@ public:
 	 *
 	 * @return true if object is added successfully to the hash table , false otherwise
 	 */
-	bool mapSparseDataPtrToHeapProxyObjectPtr(void *dataPtr, void *proxyObjPtr, uintptr_t size);
+	virtual bool mapSparseDataPtrToHeapProxyObjectPtr(void *dataPtr, void *proxyObjPtr, uintptr_t size);
 
 	/**
 	 * Remove entry from the hash table that is associated the object data pointer provided
@@ -138,7 +138,7 @@ public:
 	 *
 	 * @return true if key associated to dataPtr is removed successfully, false otherwise
 	 */
-	bool unmapSparseDataPtrFromHeapProxyObjectPtr(void *dataPtr);
+	virtual bool unmapSparseDataPtrFromHeapProxyObjectPtr(void *dataPtr);
 
 	/**
 	 * Get MM_SparseDataTableEntry associated with data pointer
@@ -146,7 +146,7 @@ public:
 	 * @param dataPtr	void*	Data pointer
 	 * @return in-heap proxy object pointer of data pointer
 	 */
-	MM_SparseDataTableEntry *findSparseDataTableEntryForSparseDataPtr(void *dataPtr);
+	virtual MM_SparseDataTableEntry *findSparseDataTableEntryForSparseDataPtr(void *dataPtr);
 	/**
 	 * Get data size in bytes associated with the data pointer
 	 *
@@ -211,11 +211,11 @@ public:
 	 *
 	 * @return true if the sparse data entry was successfully updated, false otherwise
 	 */
-	bool updateSparseDataEntryAfterObjectHasMoved(void *dataPtr, void *proxyObjPtr);
+	virtual bool updateSparseDataEntryAfterObjectHasMoved(void *dataPtr, void *proxyObjPtr);
 
 protected:
 	bool initialize(MM_EnvironmentBase *env, void *sparseHeapBase);
-	void tearDown(MM_EnvironmentBase *env);
+	virtual void tearDown(MM_EnvironmentBase *env);
 
 	MM_SparseAddressOrderedFixedSizeDataPool(MM_EnvironmentBase *env, uintptr_t sparseDataPoolSize)
 		: MM_BaseVirtual()
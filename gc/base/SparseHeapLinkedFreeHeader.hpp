@@ -91,6 +91,7 @@ public:
 	}
 
 	friend class MM_SparseAddressOrderedFixedSizeDataPool;
+	friend class MM_SparseSizeClassDataPool;
 
 };
 
@@ -0,0 +1,446 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "omrcomp.h"
+#include "modronbase.h"
+#include "ModronAssertions.h"
+
+#include "AtomicOperations.hpp"
+#include "Forge.hpp"
+#include "Math.hpp"
+#include "SparseSizeClassDataPool.hpp"
+
+#define SPARSE_SIZE_CLASS_NODE_POOL_INIT_SIZE 8
+
+/**
+ * Free region collected while coalescing the size class lists.
+ */
+typedef struct SparseFreeRegion {
+	uintptr_t address;
+	uintptr_t size;
+} SparseFreeRegion;
+
+static int
+compareSparseFreeRegions(const void *left, const void *right)
+{
+	uintptr_t leftAddress = ((const SparseFreeRegion *)left)->address;
+	uintptr_t rightAddress = ((const SparseFreeRegion *)right)->address;
+	return (leftAddress < rightAddress) ? -1 : ((leftAddress > rightAddress) ? 1 : 0);
+}
+
+MM_SparseSizeClassDataPool *
+MM_SparseSizeClassDataPool::newInstance(MM_EnvironmentBase *env, void *sparseHeapBase, uintptr_t sparseDataPoolSize, uintptr_t pageSize)
+{
+	MM_SparseSizeClassDataPool *sparseDataPool = (MM_SparseSizeClassDataPool *)env->getForge()->allocate(sizeof(MM_SparseSizeClassDataPool), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != sparseDataPool) {
+		Trc_MM_SparseAddressOrderedFixedSizeDataPool_allocation_success(sparseHeapBase, (void *)sparseDataPoolSize);
+		sparseDataPool = new(sparseDataPool) MM_SparseSizeClassDataPool(env, sparseDataPoolSize, pageSize);
+		if (!sparseDataPool->initialize(env, sparseHeapBase, sparseDataPoolSize)) {
+			sparseDataPool->kill(env);
+			sparseDataPool = NULL;
+		}
+	} else {
+		Trc_MM_SparseAddressOrderedFixedSizeDataPool_allocation_failure(sparseHeapBase, sparseDataPoolSize);
+	}
+
+	return sparseDataPool;
+}
+
+bool
+MM_SparseSizeClassDataPool::initialize(MM_EnvironmentBase *env, void *sparseHeapBase, uintptr_t sparseDataPoolSize)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	Assert_MM_true(0 == (_pageSize & (_pageSize - 1)));
+	_pageSizeLog2 = MM_Math::floorLog2(_pageSize);
+	_sparseHeapBase = (uintptr_t)sparseHeapBase;
+	_bumpAlloc = _sparseHeapBase;
+	_bumpTop = _sparseHeapBase + MM_Math::roundToFloor(_pageSize, sparseDataPoolSize);
+
+	if (!_coalesceLock.initialize(env, &_extensions->lnrlOptions, "MM_SparseSizeClassDataPool:_coalesceLock")) {
+		return false;
+	}
+
+	_sizeClasses = (SizeClass *)env->getForge()->allocate(sizeof(SizeClass) * _sizeClassCount, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL == _sizeClasses) {
+		return false;
+	}
+	for (uintptr_t i = 0; i < _sizeClassCount; i++) {
+		SizeClass *sizeClass = &_sizeClasses[i];
+		new(&sizeClass->lock) MM_LightweightNonReentrantLock();
+		sizeClass->freeList = NULL;
+		sizeClass->nodePool = NULL;
+	}
+	for (uintptr_t i = 0; i < _sizeClassCount; i++) {
+		SizeClass *sizeClass = &_sizeClasses[i];
+		if (!sizeClass->lock.initialize(env, &_extensions->lnrlOptions, "MM_SparseSizeClassDataPool:sizeClassLock")) {
+			return false;
+		}
+		sizeClass->nodePool = pool_new(sizeof(MM_SparseHeapLinkedFreeHeader), SPARSE_SIZE_CLASS_NODE_POOL_INIT_SIZE, 0, 0, OMR_GET_CALLSITE(), OMRMEM_CATEGORY_MM, POOL_FOR_PORT(OMRPORTLIB));
+		if (NULL == sizeClass->nodePool) {
+			return false;
+		}
+	}
+
+	uintptr_t pageCount = (_bumpTop - _sparseHeapBase) >> _pageSizeLog2;
+	_dataTableSize = (pageCount + _leafEntryCount - 1) / _leafEntryCount;
+	uintptr_t dataTableBytes = sizeof(MM_SparseDataTableEntry *) * _dataTableSize;
+	_dataTable = (MM_SparseDataTableEntry *volatile *)env->getForge()->allocate(dataTableBytes, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL == _dataTable) {
+		return false;
+	}
+	memset((void *)_dataTable, 0, dataTableBytes);
+
+	/* the whole sparse heap starts as bump space, the base class free list is not used */
+	_freeListPoolFreeNodesCount = 0;
+	Trc_MM_SparseAddressOrderedFixedSizeDataPool_initialization_success(sparseHeapBase, NULL, NULL, NULL);
+
+	return true;
+}
+
+void
+MM_SparseSizeClassDataPool::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _dataTable) {
+		for (uintptr_t i = 0; i < _dataTableSize; i++) {
+			if (NULL != _dataTable[i]) {
+				env->getForge()->free(_dataTable[i]);
+			}
+		}
+		env->getForge()->free((void *)_dataTable);
+		_dataTable = NULL;
+	}
+
+	if (NULL != _sizeClasses) {
+		for (uintptr_t i = 0; i < _sizeClassCount; i++) {
+			SizeClass *sizeClass = &_sizeClasses[i];
+			if (NULL != sizeClass->nodePool) {
+				pool_kill(sizeClass->nodePool);
+				sizeClass->nodePool = NULL;
+			}
+			sizeClass->lock.tearDown();
+		}
+		env->getForge()->free(_sizeClasses);
+		_sizeClasses = NULL;
+	}
+
+	_coalesceLock.tearDown();
+
+	MM_SparseAddressOrderedFixedSizeDataPool::tearDown(env);
+}
+
+void *
+MM_SparseSizeClassDataPool::findFreeListEntry(uintptr_t size)
+{
+	Assert_MM_true(0 == (size & (_pageSize - 1)));
+	void *returnAddr = allocateFromSizeClasses(size);
+
+	if (NULL == returnAddr) {
+		returnAddr = allocateFromBumpSpace(size);
+	}
+
+	if (NULL == returnAddr) {
+		/* returned regions may be adjacent to each other or to the bump space */
+		coalesceSizeClasses();
+		returnAddr = allocateFromSizeClasses(size);
+		if (NULL == returnAddr) {
+			returnAddr = allocateFromBumpSpace(size);
+		}
+	}
+
+	if (NULL != returnAddr) {
+		MM_AtomicOperations::subtract((volatile uintptr_t *)&_approximateFreeMemorySize, size);
+		MM_AtomicOperations::add((volatile uintptr_t *)&_freeListPoolAllocBytes, size);
+		MM_AtomicOperations::add((volatile uintptr_t *)&_allocObjectCount, 1);
+		Trc_MM_SparseAddressOrderedFixedSizeDataPool_freeListEntryFoundForData_success(returnAddr, (void *)size, _freeListPoolFreeNodesCount, (void *)_approximateFreeMemorySize, (void *)_freeListPoolAllocBytes);
+	}
+
+	return returnAddr;
+}
+
+bool
+MM_SparseSizeClassDataPool::returnFreeListEntry(void *dataAddr, uintptr_t size)
+{
+	Assert_MM_true(0 == (size & (_pageSize - 1)));
+	addToSizeClass((uintptr_t)dataAddr, size);
+
+	MM_AtomicOperations::add((volatile uintptr_t *)&_approximateFreeMemorySize, size);
+	MM_AtomicOperations::subtract((volatile uintptr_t *)&_freeListPoolAllocBytes, size);
+	MM_AtomicOperations::subtract((volatile uintptr_t *)&_allocObjectCount, 1);
+	_lastFreeBytes = size;
+
+	Trc_MM_SparseAddressOrderedFixedSizeDataPool_returnFreeListEntry_success(dataAddr, (void *)size, _freeListPoolFreeNodesCount, (void *)_approximateFreeMemorySize, (void *)_freeListPoolAllocBytes);
+	return true;
+}
+
+void *
+MM_SparseSizeClassDataPool::allocateFromSizeClasses(uintptr_t size)
+{
+	for (uintptr_t index = getSizeClassIndex(size); index < _sizeClassCount; index++) {
+		SizeClass *sizeClass = &_sizeClasses[index];
+		if (NULL == sizeClass->freeList) {
+			/* unlocked peek, a region returned meanwhile is found by the next request */
+			continue;
+		}
+
+		uintptr_t address = 0;
+		uintptr_t regionSize = 0;
+		sizeClass->lock.acquire();
+		MM_SparseHeapLinkedFreeHeader *previous = NULL;
+		MM_SparseHeapLinkedFreeHeader *current = sizeClass->freeList;
+		/* every region of a larger class fits, so only the first class is searched past its head */
+		while ((NULL != current) && (current->_size < size)) {
+			previous = current;
+			current = current->_next;
+		}
+		if (NULL != current) {
+			address = (uintptr_t)current->_address;
+			regionSize = current->_size;
+			if (NULL == previous) {
+				sizeClass->freeList = current->_next;
+			} else {
+				previous->_next = current->_next;
+			}
+			pool_removeElement(sizeClass->nodePool, current);
+			MM_AtomicOperations::subtract((volatile uintptr_t *)&_freeListPoolFreeNodesCount, 1);
+		}
+		sizeClass->lock.release();
+
+		if (0 != address) {
+			if (regionSize > size) {
+				addToSizeClass(address + size, regionSize - size);
+			}
+			return (void *)address;
+		}
+	}
+
+	return NULL;
+}
+
+void *
+MM_SparseSizeClassDataPool::allocateFromBumpSpace(uintptr_t size)
+{
+	uintptr_t address = _bumpAlloc;
+	while ((_bumpTop - address) >= size) {
+		uintptr_t oldAddress = MM_AtomicOperations::lockCompareExchange(&_bumpAlloc, address, address + size);
+		if (oldAddress == address) {
+			return (void *)address;
+		}
+		address = oldAddress;
+	}
+	return NULL;
+}
+
+void
+MM_SparseSizeClassDataPool::addToSizeClass(uintptr_t address, uintptr_t size)
+{
+	SizeClass *sizeClass = &_sizeClasses[getSizeClassIndex(size)];
+	sizeClass->lock.acquire();
+	MM_SparseHeapLinkedFreeHeader *node = (MM_SparseHeapLinkedFreeHeader *)pool_newElement(sizeClass->nodePool);
+	/* losing a region would leak sparse heap address space */
+	Assert_MM_true(NULL != node);
+	node->setAddress((void *)address);
+	node->setSize(size);
+	node->_next = sizeClass->freeList;
+	sizeClass->freeList = node;
+	sizeClass->lock.release();
+	MM_AtomicOperations::add((volatile uintptr_t *)&_freeListPoolFreeNodesCount, 1);
+}
+
+void
+MM_SparseSizeClassDataPool::coalesceSizeClasses()
+{
+	_coalesceLock.acquire();
+	for (uintptr_t i = 0; i < _sizeClassCount; i++) {
+		_sizeClasses[i].lock.acquire();
+	}
+
+	uintptr_t regionCount = 0;
+	for (uintptr_t i = 0; i < _sizeClassCount; i++) {
+		for (MM_SparseHeapLinkedFreeHeader *node = _sizeClasses[i].freeList; NULL != node; node = node->_next) {
+			regionCount += 1;
+		}
+	}
+
+	SparseFreeRegion *regions = NULL;
+	if (1 < regionCount) {
+		regions = (SparseFreeRegion *)_extensions->getForge()->allocate(sizeof(SparseFreeRegion) * regionCount, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	}
+
+	if (NULL != regions) {
+		uintptr_t count = 0;
+		for (uintptr_t i = 0; i < _sizeClassCount; i++) {
+			SizeClass *sizeClass = &_sizeClasses[i];
+			MM_SparseHeapLinkedFreeHeader *node = sizeClass->freeList;
+			while (NULL != node) {
+				MM_SparseHeapLinkedFreeHeader *next = node->_next;
+				regions[count].address = (uintptr_t)node->_address;
+				regions[count].size = node->_size;
+				count += 1;
+				pool_removeElement(sizeClass->nodePool, node);
+				node = next;
+			}
+			sizeClass->freeList = NULL;
+		}
+		qsort(regions, count, sizeof(SparseFreeRegion), compareSparseFreeRegions);
+
+		uintptr_t merged = 0;
+		for (uintptr_t i = 1; i < count; i++) {
+			if ((regions[merged].address + regions[merged].size) == regions[i].address) {
+				regions[merged].size += regions[i].size;
+			} else {
+				merged += 1;
+				regions[merged] = regions[i];
+			}
+		}
+		count = merged + 1;
+
+		/* the highest region goes back to the bump space if nothing has been bump allocated after it */
+		SparseFreeRegion *last = &regions[count - 1];
+		uintptr_t lastTop = last->address + last->size;
+		if (lastTop == MM_AtomicOperations::lockCompareExchange(&_bumpAlloc, lastTop, last->address)) {
+			count -= 1;
+		}
+
+		for (uintptr_t i = 0; i < count; i++) {
+			SizeClass *sizeClass = &_sizeClasses[getSizeClassIndex(regions[i].size)];
+			MM_SparseHeapLinkedFreeHeader *node = (MM_SparseHeapLinkedFreeHeader *)pool_newElement(sizeClass->nodePool);
+			Assert_MM_true(NULL != node);
+			node->setAddress((void *)regions[i].address);
+			node->setSize(regions[i].size);
+			node->_next = sizeClass->freeList;
+			sizeClass->freeList = node;
+		}
+		_freeListPoolFreeNodesCount = count;
+
+		_extensions->getForge()->free(regions);
+	}
+
+	for (uintptr_t i = _sizeClassCount; i > 0; i--) {
+		_sizeClasses[i - 1].lock.release();
+	}
+	_coalesceLock.release();
+}
+
+MM_SparseDataTableEntry *
+MM_SparseSizeClassDataPool::getDataTableSlot(void *dataPtr, bool install)
+{
+	uintptr_t address = (uintptr_t)dataPtr;
+	if ((address < _sparseHeapBase) || (address >= _bumpTop) || (0 != (address & (_pageSize - 1)))) {
+		return NULL;
+	}
+
+	uintptr_t page = (address - _sparseHeapBase) >> _pageSizeLog2;
+	uintptr_t leafIndex = page / _leafEntryCount;
+	MM_SparseDataTableEntry *leaf = _dataTable[leafIndex];
+	if ((NULL == leaf) && install) {
+		uintptr_t leafBytes = sizeof(MM_SparseDataTableEntry) * _leafEntryCount;
+		MM_SparseDataTableEntry *newLeaf = (MM_SparseDataTableEntry *)_extensions->getForge()->allocate(leafBytes, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		if (NULL != newLeaf) {
+			for (uintptr_t i = 0; i < _leafEntryCount; i++) {
+				new(&newLeaf[i]) MM_SparseDataTableEntry();
+			}
+			/* publish the initialized leaf, another thread may have installed one first */
+			MM_AtomicOperations::storeSync();
+			leaf = (MM_SparseDataTableEntry *)MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&_dataTable[leafIndex], (uintptr_t)NULL, (uintptr_t)newLeaf);
+			if (NULL == leaf) {
+				leaf = newLeaf;
+			} else {
+				_extensions->getForge()->free(newLeaf);
+			}
+		}
+	}
+
+	return (NULL == leaf) ? NULL : &leaf[page % _leafEntryCount];
+}
+
+bool
+MM_SparseSizeClassDataPool::mapSparseDataPtrToHeapProxyObjectPtr(void *dataPtr, void *proxyObjPtr, uintptr_t size)
+{
+	bool ret = false;
+	MM_SparseDataTableEntry *slot = getDataTableSlot(dataPtr, true);
+
+	if (NULL != slot) {
+		slot->_proxyObjPtr = proxyObjPtr;
+		slot->_size = size;
+		/* readers match on _dataPtr, so it is published last */
+		MM_AtomicOperations::storeSync();
+		slot->_dataPtr = dataPtr;
+		ret = true;
+		Trc_MM_SparseAddressOrderedFixedSizeDataPool_insertEntry_success(dataPtr, (void *)size, proxyObjPtr);
+	} else {
+		Trc_MM_SparseAddressOrderedFixedSizeDataPool_insertEntry_failure(dataPtr, (void *)size, proxyObjPtr);
+	}
+
+	return ret;
+}
+
+bool
+MM_SparseSizeClassDataPool::unmapSparseDataPtrFromHeapProxyObjectPtr(void *dataPtr)
+{
+	bool ret = false;
+	MM_SparseDataTableEntry *slot = getDataTableSlot(dataPtr, false);
+
+	if ((NULL != slot) && (slot->_dataPtr == dataPtr)) {
+		slot->_dataPtr = NULL;
+		MM_AtomicOperations::storeSync();
+		ret = true;
+		Trc_MM_SparseAddressOrderedFixedSizeDataPool_removeEntry_success(dataPtr);
+	} else {
+		Trc_MM_SparseAddressOrderedFixedSizeDataPool_removeEntry_failure(dataPtr);
+	}
+
+	return ret;
+}
+
+MM_SparseDataTableEntry *
+MM_SparseSizeClassDataPool::findSparseDataTableEntryForSparseDataPtr(void *dataPtr)
+{
+	MM_SparseDataTableEntry *slot = getDataTableSlot(dataPtr, false);
+
+	if ((NULL != slot) && (slot->_dataPtr == dataPtr)) {
+		MM_AtomicOperations::loadSync();
+		return slot;
+	}
+
+	return NULL;
+}
+
+bool
+MM_SparseSizeClassDataPool::updateSparseDataEntryAfterObjectHasMoved(void *dataPtr, void *proxyObjPtr)
+{
+	bool ret = true;
+	MM_SparseDataTableEntry *entry = findSparseDataTableEntryForSparseDataPtr(dataPtr);
+
+	if (NULL != entry) {
+		Trc_MM_SparseAddressOrderedFixedSizeDataPool_updateEntry_success(dataPtr, entry->_proxyObjPtr, proxyObjPtr);
+		entry->_proxyObjPtr = proxyObjPtr;
+	} else {
+		Trc_MM_SparseAddressOrderedFixedSizeDataPool_findEntry_failure(dataPtr);
+		ret = false;
+	}
+
+	return ret;
+}
@@ -0,0 +1,144 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#if !defined(SPARSESIZECLASSDATAPOOL_HPP_)
+#define SPARSESIZECLASSDATAPOOL_HPP_
+
+#include "omrpool.h"
+#include "LightweightNonReentrantLock.hpp"
+#include "Math.hpp"
+#include "SparseAddressOrderedFixedSizeDataPool.hpp"
+
+/**
+ * Sparse data pool that can be used by several threads without external synchronization
+ * (selected with -Xgc:concurrentSparseHeap).
+ *
+ * Free regions are kept in per size class lists, size class i holding regions of [2^i, 2^(i+1))
+ * pages, each list with its own lock. Space that has never been allocated is handed out by bumping
+ * a pointer with compare-and-swap. Regions are not coalesced when they are returned; when neither
+ * the lists nor the bump space can satisfy a request, all lists are locked, merged by address and
+ * redistributed, and a merged region that ends at the bump pointer is given back to the bump space.
+ *
+ * The data pointer to proxy object mapping is a two level table indexed by page: lookups read
+ * it without any lock, leaves are installed with compare-and-swap on first use and kept until the
+ * pool is killed. Allocation guarantees that a data pointer is owned by a single object at a time,
+ * so an entry is only ever written by the thread that allocated or is freeing its data.
+ *
+ * @ingroup GC_Base_Core
+ */
+class MM_SparseSizeClassDataPool : public MM_SparseAddressOrderedFixedSizeDataPool
+{
+/*
+ * Data members
+ */
+public:
+	enum {
+		_sizeClassCount = 32, /**< Size classes of free regions, the last one also holds every larger region */
+		_leafEntryCount = 512 /**< Pages covered by one leaf of the data table */
+	};
+
+private:
+	struct SizeClass {
+		MM_LightweightNonReentrantLock lock; /**< Protects freeList and nodePool */
+		MM_SparseHeapLinkedFreeHeader *volatile freeList; /**< Free regions of this size class, most recently returned first */
+		J9Pool *nodePool; /**< Nodes of freeList */
+	};
+
+	SizeClass *_sizeClasses;
+	MM_LightweightNonReentrantLock _coalesceLock; /**< Serializes coalescing of the size class lists */
+	uintptr_t _pageSize; /**< Granule of the sparse heap, every region is a multiple of it */
+	uintptr_t _pageSizeLog2;
+	uintptr_t _sparseHeapBase;
+	volatile uintptr_t _bumpAlloc; /**< Start of the space that is not on any free list */
+	uintptr_t _bumpTop; /**< End of the sparse heap */
+	MM_SparseDataTableEntry *volatile *_dataTable; /**< One leaf pointer per _leafEntryCount pages, NULL until first used */
+	uintptr_t _dataTableSize; /**< Number of leaf pointers in _dataTable */
+
+/*
+ * Function members
+ */
+public:
+	static MM_SparseSizeClassDataPool *newInstance(MM_EnvironmentBase *env, void *sparseHeapBase, uintptr_t sparseDataPoolSize, uintptr_t pageSize);
+
+	virtual void *findFreeListEntry(uintptr_t size);
+	virtual bool returnFreeListEntry(void *address, uintptr_t size);
+	virtual bool mapSparseDataPtrToHeapProxyObjectPtr(void *dataPtr, void *proxyObjPtr, uintptr_t size);
+	virtual bool unmapSparseDataPtrFromHeapProxyObjectPtr(void *dataPtr);
+	virtual MM_SparseDataTableEntry *findSparseDataTableEntryForSparseDataPtr(void *dataPtr);
+	virtual bool updateSparseDataEntryAfterObjectHasMoved(void *dataPtr, void *proxyObjPtr);
+
+protected:
+	bool initialize(MM_EnvironmentBase *env, void *sparseHeapBase, uintptr_t sparseDataPoolSize);
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+	MM_SparseSizeClassDataPool(MM_EnvironmentBase *env, uintptr_t sparseDataPoolSize, uintptr_t pageSize)
+		: MM_SparseAddressOrderedFixedSizeDataPool(env, sparseDataPoolSize)
+		, _sizeClasses(NULL)
+		, _coalesceLock()
+		, _pageSize(pageSize)
+		, _pageSizeLog2(0)
+		, _sparseHeapBase(0)
+		, _bumpAlloc(0)
+		, _bumpTop(0)
+		, _dataTable(NULL)
+		, _dataTableSize(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+
+private:
+	MMINLINE uintptr_t getSizeClassIndex(uintptr_t size)
+	{
+		uintptr_t index = MM_Math::floorLog2(size >> _pageSizeLog2);
+		return (index < _sizeClassCount) ? index : (_sizeClassCount - 1);
+	}
+
+	/**
+	 * Take a region of at least size bytes from the size class lists, returning what is left of it.
+	 * @return the region address, or NULL if no list has a region that is large enough
+	 */
+	void *allocateFromSizeClasses(uintptr_t size);
+
+	/**
+	 * Take a region from the space that has never been allocated.
+	 * @return the region address, or NULL if the space is exhausted
+	 */
+	void *allocateFromBumpSpace(uintptr_t size);
+
+	/**
+	 * Add a region to the list of its size class.
+	 */
+	void addToSizeClass(uintptr_t address, uintptr_t size);
+
+	/**
+	 * Merge adjacent free regions of all size classes and give the region ending at the bump pointer back to the bump space.
+	 */
+	void coalesceSizeClasses();
+
+	/**
+	 * Find the data table entry slot for a data pointer, optionally installing its leaf.
+	 * @return the slot, or NULL if dataPtr is not a page of the sparse heap or its leaf is not installed
+	 */
+	MM_SparseDataTableEntry *getDataTableSlot(void *dataPtr, bool install);
+};
+
+#endif /* SPARSESIZECLASSDATAPOOL_HPP_ */
@@ -35,6 +35,7 @@
 #include "ModronAssertions.h"
 #include "SparseVirtualMemory.hpp"
 #include "SparseAddressOrderedFixedSizeDataPool.hpp"
+#include "SparseSizeClassDataPool.hpp"
 
 /****************************************
  * Initialization
@@ -75,9 +76,16 @@ MM_SparseVirtualMemory::initialize(MM_EnvironmentBase* env, uint32_t memoryCateg
 
 	if (success) {
 		void *sparseHeapBase = getHeapBase();
-		_sparseDataPool = MM_SparseAddressOrderedFixedSizeDataPool::newInstance(env, sparseHeapBase, off_heap_size);
-		if ((NULL == _sparseDataPool) || omrthread_monitor_init_with_name(&_largeObjectVirtualMemoryMutex, 0, "SparseVirtualMemory::_largeObjectVirtualMemoryMutex")) {
-			success = false;
+		if (env->getExtensions()->concurrentSparseHeap) {
+			_sparseDataPool = MM_SparseSizeClassDataPool::newInstance(env, sparseHeapBase, off_heap_size, _pageSize);
+			if (NULL == _sparseDataPool) {
+				success = false;
+			}
+		} else {
+			_sparseDataPool = MM_SparseAddressOrderedFixedSizeDataPool::newInstance(env, sparseHeapBase, off_heap_size);
+			if ((NULL == _sparseDataPool) || omrthread_monitor_init_with_name(&_largeObjectVirtualMemoryMutex, 0, "SparseVirtualMemory::_largeObjectVirtualMemoryMutex")) {
+				success = false;
+			}
 		}
 	}
 
@@ -116,9 +124,9 @@ MM_SparseVirtualMemory::kill(MM_EnvironmentBase *env)
 bool
 MM_SparseVirtualMemory::updateSparseDataEntryAfterObjectHasMoved(void *dataPtr, void *objPtr)
 {
-	omrthread_monitor_enter(_largeObjectVirtualMemoryMutex);
+	enterDataPoolMutex();
 	bool ret = _sparseDataPool->updateSparseDataEntryAfterObjectHasMoved(dataPtr, objPtr);
-	omrthread_monitor_exit(_largeObjectVirtualMemoryMutex);
+	exitDataPoolMutex();
 	return ret;
 }
 
@@ -128,7 +136,7 @@ MM_SparseVirtualMemory::allocateSparseFreeEntryAndMapToHeapObject(void *proxyObj
 	/* Commiting and decommiting memory sizes must be multiple of pagesize */
 	uintptr_t adjustedSize = MM_Math::roundToCeiling(_pageSize, size);
 
-	omrthread_monitor_enter(_largeObjectVirtualMemoryMutex);
+	enterDataPoolMutex();
 	void *sparseHeapAddr = _sparseDataPool->findFreeListEntry(adjustedSize);
 	bool success = MM_VirtualMemory::commitMemory(sparseHeapAddr, adjustedSize);
 
@@ -144,7 +152,7 @@ MM_SparseVirtualMemory::allocateSparseFreeEntryAndMapToHeapObject(void *proxyObj
 		Assert_MM_unreachable();
 	}
 
-	omrthread_monitor_exit(_largeObjectVirtualMemoryMutex);
+	exitDataPoolMutex();
 
 	if (success) {
 		Trc_MM_SparseVirtualMemory_commitMemory_success(sparseHeapAddr, (void*)adjustedSize, proxyObjPtr);
@@ -159,16 +167,20 @@ MM_SparseVirtualMemory::allocateSparseFreeEntryAndMapToHeapObject(void *proxyObj
 bool
 MM_SparseVirtualMemory::freeSparseRegionAndUnmapFromHeapObject(MM_EnvironmentBase* env, void *dataPtr)
 {
+	enterDataPoolMutex();
 	uintptr_t dataSize = _sparseDataPool->findObjectDataSizeForSparseDataPtr(dataPtr);
+	exitDataPoolMutex();
 	bool ret = true;
 
 	if ((NULL != dataPtr) && (0 != dataSize)) {
 		Assert_MM_true(0 == (dataSize % _pageSize));
 		ret = decommitMemory(env, dataPtr, dataSize);
 		if (ret) {
-			omrthread_monitor_enter(_largeObjectVirtualMemoryMutex);
-			ret = (_sparseDataPool->returnFreeListEntry(dataPtr, dataSize) && _sparseDataPool->unmapSparseDataPtrFromHeapProxyObjectPtr(dataPtr));
-			omrthread_monitor_exit(_largeObjectVirtualMemoryMutex);
+			enterDataPoolMutex();
+			/* unmap first, once returned the region may be reallocated and mapped by another thread */
+			ret = _sparseDataPool->unmapSparseDataPtrFromHeapProxyObjectPtr(dataPtr);
+			ret = _sparseDataPool->returnFreeListEntry(dataPtr, dataSize) && ret;
+			exitDataPoolMutex();
 			Trc_MM_SparseVirtualMemory_decommitMemory_success(dataPtr, (void*)dataSize);
 		} else {
 			Trc_MM_SparseVirtualMemory_decommitMemory_failure(dataPtr, (void*)dataSize);
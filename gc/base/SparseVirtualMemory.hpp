@@ -59,13 +59,26 @@ class MM_SparseVirtualMemory : public MM_VirtualMemory {
 private:
 	MM_Heap *_heap; /**< reference to in-heap */
 	MM_SparseAddressOrderedFixedSizeDataPool *_sparseDataPool; /**< Structure that manages data and free region of sparse virtual memory */
-	omrthread_monitor_t _largeObjectVirtualMemoryMutex; /**< Monitor that manages access to sparse virtual memory */
+	omrthread_monitor_t _largeObjectVirtualMemoryMutex; /**< Monitor that manages access to sparse virtual memory, NULL if _sparseDataPool synchronizes itself */
 protected:
 public:
 /*
  * Function members
  */
 private:
+	MMINLINE void enterDataPoolMutex()
+	{
+		if (NULL != _largeObjectVirtualMemoryMutex) {
+			omrthread_monitor_enter(_largeObjectVirtualMemoryMutex);
+		}
+	}
+
+	MMINLINE void exitDataPoolMutex()
+	{
+		if (NULL != _largeObjectVirtualMemoryMutex) {
+			omrthread_monitor_exit(_largeObjectVirtualMemoryMutex);
+		}
+	}
 
 protected:
 	bool initialize(MM_EnvironmentBase* env, uint32_t memoryCategory);
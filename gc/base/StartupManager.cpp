@@ -37,19 +37,87 @@
 #if defined(OMR_GC_MODRON_COMPACTION)
 #define OMR_XCOMPACTGC "-Xcompactgc"
 #define OMR_XCOMPACTGC_LENGTH 11
+#define OMR_XGCPIPELINED_COMPACTION "-Xgc:pipelinedCompaction"
+#define OMR_XGCPIPELINED_COMPACTION_LENGTH 24
+#define OMR_XGCCOMPACT_WINDOW_SIZE "-Xgc:compactWindowSize="
+#define OMR_XGCCOMPACT_WINDOW_SIZE_LENGTH 23
 #endif /* OMR_GC_MODRON_COMPACTION */
 #if defined(OMR_GC_MODRON_SCAVENGER)
 #define OMR_XGCPOLICY "-Xgcpolicy:"
 #define OMR_XGCPOLICY_LENGTH 11
 #define OMR_GCPOLICY_GENCON "gencon"
 #define OMR_GCPOLICY_GENCON_LENGTH 6
+#define OMR_XGCSCAVENGER_NUMA_AWARE_COPY "-Xgc:scavengerNumaAwareCopy"
+#define OMR_XGCSCAVENGER_NUMA_AWARE_COPY_LENGTH 27
+#define OMR_XGCSCAVENGER_HOT_FIELD_SAMPLING "-Xgc:scavengerHotFieldSampling"
+#define OMR_XGCSCAVENGER_HOT_FIELD_SAMPLING_LENGTH 30
+#define OMR_XGCSCAVENGER_HOT_FIELD_SAMPLE_RATE "-Xgc:scavengerHotFieldSampleRate="
+#define OMR_XGCSCAVENGER_HOT_FIELD_SAMPLE_RATE_LENGTH 33
+#define OMR_XGCSCAVENGER_SHARDED_REMEMBERED_SET "-Xgc:scavengerShardedRememberedSet"
+#define OMR_XGCSCAVENGER_SHARDED_REMEMBERED_SET_LENGTH 34
+#define OMR_XGCSCAVENGER_REMEMBERED_SET_CHUNK_SIZE "-Xgc:scavengerRememberedSetChunkSize="
+#define OMR_XGCSCAVENGER_REMEMBERED_SET_CHUNK_SIZE_LENGTH 37
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+#define OMR_XGCNO_SIMD_CARD_SCAN "-Xgc:noSIMDCardScan"
+#define OMR_XGCNO_SIMD_CARD_SCAN_LENGTH 19
+#define OMR_XGCFINAL_CARD_CLEAN_BATCH_SIZE "-Xgc:finalCardCleanBatchSize="
+#define OMR_XGCFINAL_CARD_CLEAN_BATCH_SIZE_LENGTH 29
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
 #define OMR_XVERBOSEGCLOG "-Xverbosegclog:"
 #define OMR_XVERBOSEGCLOG_LENGTH 15
 #define OMR_XGCBUFFERED_LOGGING "-Xgc:bufferedLogging"
 #define OMR_XGCBUFFERED_LOGGING_LENGTH 20
+#define OMR_XGCBINARY_VERBOSE_LOGGING "-Xgc:binaryVerboseLogging"
+#define OMR_XGCBINARY_VERBOSE_LOGGING_LENGTH 25
 #define OMR_XGCTHREADS "-Xgcthreads"
 #define OMR_XGCTHREADS_LENGTH 11
+#define OMR_XGCWORKSTEALING_MARKING "-Xgc:workStealingMarking"
+#define OMR_XGCWORKSTEALING_MARKING_LENGTH 24
+#define OMR_XGCSCAN_PREFETCH_DISTANCE "-Xgc:scanPrefetchDistance="
+#define OMR_XGCSCAN_PREFETCH_DISTANCE_LENGTH 26
+#define OMR_XGCFREELIST_SIZE_CLASS_BINS "-Xgc:freeListSizeClassBins"
+#define OMR_XGCFREELIST_SIZE_CLASS_BINS_LENGTH 26
+#define OMR_XGCADAPTIVE_TLH_SIZING "-Xgc:adaptiveTLHSizing"
+#define OMR_XGCADAPTIVE_TLH_SIZING_LENGTH 22
+#define OMR_XGCADAPTIVE_TLH_REFRESH_TARGET "-Xgc:adaptiveTLHRefreshTarget="
+#define OMR_XGCADAPTIVE_TLH_REFRESH_TARGET_LENGTH 30
+#define OMR_XGCLOCK_FREE_TLH_REFRESH "-Xgc:lockFreeTLHRefresh"
+#define OMR_XGCLOCK_FREE_TLH_REFRESH_LENGTH 23
+#define OMR_XGCTLH_CARVE_CHUNK_SIZE "-Xgc:tlhCarveChunkSize="
+#define OMR_XGCTLH_CARVE_CHUNK_SIZE_LENGTH 23
+#define OMR_XGCNO_SIMD_SWEEP "-Xgc:noSIMDSweep"
+#define OMR_XGCNO_SIMD_SWEEP_LENGTH 16
+#define OMR_XGCELASTIC_TASK_THREADS "-Xgc:elasticTaskThreads"
+#define OMR_XGCELASTIC_TASK_THREADS_LENGTH 23
+#define OMR_XGCELASTIC_TASK_THREAD_WORK "-Xgc:elasticTaskThreadWork="
+#define OMR_XGCELASTIC_TASK_THREAD_WORK_LENGTH 27
+#define OMR_XGCLARGE_PAGE_POLICY "-Xgc:largePagePolicy="
+#define OMR_XGCLARGE_PAGE_POLICY_LENGTH 22
+#define OMR_XGCBACKGROUND_HEAP_RELEASE "-Xgc:backgroundHeapRelease"
+#define OMR_XGCBACKGROUND_HEAP_RELEASE_LENGTH 26
+#define OMR_XGCHEAP_RELEASE_INTERVAL "-Xgc:heapReleaseInterval="
+#define OMR_XGCHEAP_RELEASE_INTERVAL_LENGTH 25
+#define OMR_XGCHEAP_RELEASE_AGE "-Xgc:heapReleaseAge="
+#define OMR_XGCHEAP_RELEASE_AGE_LENGTH 20
+#define OMR_XGCHEAP_RELEASE_MINIMUM_CHUNK_SIZE "-Xgc:heapReleaseMinimumChunkSize="
+#define OMR_XGCHEAP_RELEASE_MINIMUM_CHUNK_SIZE_LENGTH 33
+#define OMR_XGCHEAP_RELEASE_MAXIMUM_OCCUPANCY "-Xgc:heapReleaseMaximumOccupancy="
+#define OMR_XGCHEAP_RELEASE_MAXIMUM_OCCUPANCY_LENGTH 33
+#define OMR_XGCCONCURRENT_SPARSE_HEAP "-Xgc:concurrentSparseHeap"
+#define OMR_XGCCONCURRENT_SPARSE_HEAP_LENGTH 25
+#if defined(OMR_GC_SEGREGATED_HEAP)
+#define OMR_XGCDEFERRED_SEGREGATED_SWEEP "-Xgc:deferredSegregatedSweep"
+#define OMR_XGCDEFERRED_SEGREGATED_SWEEP_LENGTH 28
+#define OMR_XGCINCREMENTAL_SEGREGATED_GC "-Xgc:incrementalSegregatedGC"
+#define OMR_XGCINCREMENTAL_SEGREGATED_GC_LENGTH 28
+#define OMR_XGCSEGREGATED_QUANTUM_MICROS "-Xgc:segregatedQuantumMicros="
+#define OMR_XGCSEGREGATED_QUANTUM_MICROS_LENGTH 29
+#define OMR_XGCSEGREGATED_TARGET_UTILIZATION "-Xgc:segregatedTargetUtilization="
+#define OMR_XGCSEGREGATED_TARGET_UTILIZATION_LENGTH 33
+#define OMR_XGCSEGREGATED_GC_TRIGGER "-Xgc:segregatedGCTrigger="
+#define OMR_XGCSEGREGATED_GC_TRIGGER_LENGTH 25
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 
 uintptr_t
 MM_StartupManager::getUDATAValue(char *option, uintptr_t *outputValue)
@@ -264,6 +332,17 @@ MM_StartupManager::handleOption(MM_GCExtensionsBase *extensions, char *option)
 		extensions->nocompactOnSystemGC = 0;
 		extensions->compactOnSystemGC = 0;
 	}
+	else if (0 == strncmp(option, OMR_XGCPIPELINED_COMPACTION, OMR_XGCPIPELINED_COMPACTION_LENGTH)) {
+		extensions->pipelinedCompaction = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCCOMPACT_WINDOW_SIZE, OMR_XGCCOMPACT_WINDOW_SIZE_LENGTH)) {
+		uintptr_t value = 0;
+		if (!getUDATAMemoryValue(option + OMR_XGCCOMPACT_WINDOW_SIZE_LENGTH, &value)) {
+			result = false;
+		} else {
+			extensions->compactWindowSize = value;
+		}
+	}
 #endif /* OMR_GC_MODRON_COMPACTION */
 	else if (0 == strncmp(option, OMR_XVERBOSEGCLOG, OMR_XVERBOSEGCLOG_LENGTH)) {
 		verboseFileName = (char *) omrmem_allocate_memory(strlen(option+OMR_XVERBOSEGCLOG_LENGTH)+1, OMRMEM_CATEGORY_MM);
@@ -276,6 +355,176 @@ MM_StartupManager::handleOption(MM_GCExtensionsBase *extensions, char *option)
 	else if (0 == strncmp(option, OMR_XGCBUFFERED_LOGGING, OMR_XGCBUFFERED_LOGGING_LENGTH)) {
 		extensions->bufferedLogging = true;
 	}
+	else if (0 == strncmp(option, OMR_XGCBINARY_VERBOSE_LOGGING, OMR_XGCBINARY_VERBOSE_LOGGING_LENGTH)) {
+		extensions->binaryVerboseLogging = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCWORKSTEALING_MARKING, OMR_XGCWORKSTEALING_MARKING_LENGTH)) {
+		extensions->workStealingMarking = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCSCAN_PREFETCH_DISTANCE, OMR_XGCSCAN_PREFETCH_DISTANCE_LENGTH)) {
+		uintptr_t prefetchDistance = 0;
+		if (0 >= getUDATAValue(option + OMR_XGCSCAN_PREFETCH_DISTANCE_LENGTH, &prefetchDistance)) {
+			result = false;
+		} else {
+			extensions->scanPrefetchDistance = prefetchDistance;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCFREELIST_SIZE_CLASS_BINS, OMR_XGCFREELIST_SIZE_CLASS_BINS_LENGTH)) {
+		extensions->freeListSizeClassBins = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCADAPTIVE_TLH_REFRESH_TARGET, OMR_XGCADAPTIVE_TLH_REFRESH_TARGET_LENGTH)) {
+		uintptr_t refreshTarget = 0;
+		if ((0 >= getUDATAValue(option + OMR_XGCADAPTIVE_TLH_REFRESH_TARGET_LENGTH, &refreshTarget)) || (0 == refreshTarget)) {
+			result = false;
+		} else {
+			extensions->adaptiveTLHRefreshTarget = refreshTarget;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCADAPTIVE_TLH_SIZING, OMR_XGCADAPTIVE_TLH_SIZING_LENGTH)) {
+		extensions->adaptiveTLHSizing = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCLOCK_FREE_TLH_REFRESH, OMR_XGCLOCK_FREE_TLH_REFRESH_LENGTH)) {
+		extensions->lockFreeTLHRefresh = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCTLH_CARVE_CHUNK_SIZE, OMR_XGCTLH_CARVE_CHUNK_SIZE_LENGTH)) {
+		uintptr_t chunkSize = 0;
+		if (!getUDATAMemoryValue(option + OMR_XGCTLH_CARVE_CHUNK_SIZE_LENGTH, &chunkSize)) {
+			result = false;
+		} else {
+			extensions->tlhCarveChunkSize = chunkSize;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCNO_SIMD_SWEEP, OMR_XGCNO_SIMD_SWEEP_LENGTH)) {
+		extensions->simdSweep = false;
+	}
+	else if (0 == strncmp(option, OMR_XGCELASTIC_TASK_THREAD_WORK, OMR_XGCELASTIC_TASK_THREAD_WORK_LENGTH)) {
+		uintptr_t threadWork = 0;
+		if (!getUDATAMemoryValue(option + OMR_XGCELASTIC_TASK_THREAD_WORK_LENGTH, &threadWork) || (0 == threadWork)) {
+			result = false;
+		} else {
+			extensions->elasticTaskThreadWork = threadWork;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCELASTIC_TASK_THREADS, OMR_XGCELASTIC_TASK_THREADS_LENGTH)) {
+		extensions->elasticTaskThreads = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCLARGE_PAGE_POLICY, OMR_XGCLARGE_PAGE_POLICY_LENGTH)) {
+		char *policy = option + OMR_XGCLARGE_PAGE_POLICY_LENGTH;
+		if (0 == strcmp(policy, "none")) {
+			extensions->largePagePolicy = MM_GCExtensionsBase::LARGE_PAGE_POLICY_NONE;
+		} else if (0 == strcmp(policy, "transparent")) {
+			extensions->largePagePolicy = MM_GCExtensionsBase::LARGE_PAGE_POLICY_TRANSPARENT;
+		} else if (0 == strcmp(policy, "explicit")) {
+			extensions->largePagePolicy = MM_GCExtensionsBase::LARGE_PAGE_POLICY_EXPLICIT;
+		} else {
+			result = false;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCBACKGROUND_HEAP_RELEASE, OMR_XGCBACKGROUND_HEAP_RELEASE_LENGTH)) {
+		extensions->backgroundHeapRelease = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCHEAP_RELEASE_INTERVAL, OMR_XGCHEAP_RELEASE_INTERVAL_LENGTH)) {
+		uintptr_t interval = 0;
+		if ((0 >= getUDATAValue(option + OMR_XGCHEAP_RELEASE_INTERVAL_LENGTH, &interval)) || (0 == interval)) {
+			result = false;
+		} else {
+			extensions->heapReleaseInterval = interval;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCHEAP_RELEASE_AGE, OMR_XGCHEAP_RELEASE_AGE_LENGTH)) {
+		uintptr_t age = 0;
+		if ((0 >= getUDATAValue(option + OMR_XGCHEAP_RELEASE_AGE_LENGTH, &age)) || (0 == age)) {
+			result = false;
+		} else {
+			extensions->heapReleaseAge = age;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCHEAP_RELEASE_MINIMUM_CHUNK_SIZE, OMR_XGCHEAP_RELEASE_MINIMUM_CHUNK_SIZE_LENGTH)) {
+		if (!getUDATAMemoryValue(option + OMR_XGCHEAP_RELEASE_MINIMUM_CHUNK_SIZE_LENGTH, &extensions->heapReleaseMinimumChunkSize)) {
+			result = false;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCHEAP_RELEASE_MAXIMUM_OCCUPANCY, OMR_XGCHEAP_RELEASE_MAXIMUM_OCCUPANCY_LENGTH)) {
+		uintptr_t occupancy = 0;
+		if ((0 >= getUDATAValue(option + OMR_XGCHEAP_RELEASE_MAXIMUM_OCCUPANCY_LENGTH, &occupancy)) || (100 < occupancy)) {
+			result = false;
+		} else {
+			extensions->heapReleaseMaximumOccupancy = occupancy;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCCONCURRENT_SPARSE_HEAP, OMR_XGCCONCURRENT_SPARSE_HEAP_LENGTH)) {
+		extensions->concurrentSparseHeap = true;
+	}
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	else if (0 == strncmp(option, OMR_XGCDEFERRED_SEGREGATED_SWEEP, OMR_XGCDEFERRED_SEGREGATED_SWEEP_LENGTH)) {
+		extensions->deferredSegregatedSweep = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCINCREMENTAL_SEGREGATED_GC, OMR_XGCINCREMENTAL_SEGREGATED_GC_LENGTH)) {
+		extensions->incrementalSegregatedGC = true;
+		extensions->deferredSegregatedSweep = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCSEGREGATED_QUANTUM_MICROS, OMR_XGCSEGREGATED_QUANTUM_MICROS_LENGTH)) {
+		uintptr_t quantumMicros = 0;
+		if ((0 >= getUDATAValue(option + OMR_XGCSEGREGATED_QUANTUM_MICROS_LENGTH, &quantumMicros)) || (0 == quantumMicros)) {
+			result = false;
+		} else {
+			extensions->segregatedQuantumMicros = quantumMicros;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCSEGREGATED_TARGET_UTILIZATION, OMR_XGCSEGREGATED_TARGET_UTILIZATION_LENGTH)) {
+		uintptr_t utilization = 0;
+		if ((0 >= getUDATAValue(option + OMR_XGCSEGREGATED_TARGET_UTILIZATION_LENGTH, &utilization)) || (100 <= utilization)) {
+			result = false;
+		} else {
+			extensions->segregatedTargetUtilization = utilization;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCSEGREGATED_GC_TRIGGER, OMR_XGCSEGREGATED_GC_TRIGGER_LENGTH)) {
+		uintptr_t trigger = 0;
+		if ((0 >= getUDATAValue(option + OMR_XGCSEGREGATED_GC_TRIGGER_LENGTH, &trigger)) || (0 == trigger) || (100 < trigger)) {
+			result = false;
+		} else {
+			extensions->segregatedGCTrigger = trigger;
+		}
+	}
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	else if (0 == strncmp(option, OMR_XGCSCAVENGER_NUMA_AWARE_COPY, OMR_XGCSCAVENGER_NUMA_AWARE_COPY_LENGTH)) {
+		extensions->scavengerNumaAwareCopy = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCSCAVENGER_HOT_FIELD_SAMPLING, OMR_XGCSCAVENGER_HOT_FIELD_SAMPLING_LENGTH)) {
+		extensions->scavengerHotFieldSampling = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCSCAVENGER_HOT_FIELD_SAMPLE_RATE, OMR_XGCSCAVENGER_HOT_FIELD_SAMPLE_RATE_LENGTH)) {
+		uintptr_t sampleRate = 0;
+		if ((0 >= getUDATAValue(option + OMR_XGCSCAVENGER_HOT_FIELD_SAMPLE_RATE_LENGTH, &sampleRate)) || (0 == sampleRate)) {
+			result = false;
+		} else {
+			extensions->scavengerHotFieldSampleRate = sampleRate;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCSCAVENGER_SHARDED_REMEMBERED_SET, OMR_XGCSCAVENGER_SHARDED_REMEMBERED_SET_LENGTH)) {
+		extensions->scavengerShardedRememberedSet = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCSCAVENGER_REMEMBERED_SET_CHUNK_SIZE, OMR_XGCSCAVENGER_REMEMBERED_SET_CHUNK_SIZE_LENGTH)) {
+		if (0 >= getUDATAValue(option + OMR_XGCSCAVENGER_REMEMBERED_SET_CHUNK_SIZE_LENGTH, &extensions->scavengerRememberedSetChunkSize)) {
+			result = false;
+		}
+	}
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+	else if (0 == strncmp(option, OMR_XGCNO_SIMD_CARD_SCAN, OMR_XGCNO_SIMD_CARD_SCAN_LENGTH)) {
+		extensions->simdCardScan = false;
+	}
+	else if (0 == strncmp(option, OMR_XGCFINAL_CARD_CLEAN_BATCH_SIZE, OMR_XGCFINAL_CARD_CLEAN_BATCH_SIZE_LENGTH)) {
+		uintptr_t batchSize = 0;
+		if ((0 >= getUDATAValue(option + OMR_XGCFINAL_CARD_CLEAN_BATCH_SIZE_LENGTH, &batchSize)) || (0 == batchSize)) {
+			result = false;
+		} else {
+			extensions->finalCardCleanBatchSize = batchSize;
+		}
+	}
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
 #if defined(OMR_GC_MORDON_SCAVENGER)
 	else if (0 == strncmp(option, OMR_XGCPOLICY, OMR_XGCPOLICY_LENGTH)) {
 		char *gcpolicy = option + OMR_XGCPOLICY_LENGTH;
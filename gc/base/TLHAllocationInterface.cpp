@@ -286,6 +286,12 @@ MM_TLHAllocationInterface::flushCache(MM_EnvironmentBase *env)
 		/* Clear out realHeapTop field; tlh code below will take care of rest */
 		_owningEnv->enableInlineTLHAllocate();
 	}	
+
+	/* whatever is left in the caches now is wasted for this cycle */
+	_stats._tlhFlushedBytes += _tlhAllocationSupport.getRemainingSize();
+#if defined(OMR_GC_NON_ZERO_TLH)
+	_stats._tlhFlushedBytes += _tlhAllocationSupportNonZero.getRemainingSize();
+#endif /* defined(OMR_GC_NON_ZERO_TLH) */
 #endif /* OMR_GC_THREAD_LOCAL_HEAP */		
 	
 	extensions->allocationStats.merge(&_stats);
@@ -96,6 +96,9 @@ MM_TLHAllocationSupport::clear(MM_EnvironmentBase *env)
 	setAllZeroes();
 
 	_tlh->refreshSize = extensions->tlhInitialSize;
+	_cycleBytes = 0;
+	_cycleRefreshCount = 0;
+	_allocationRate = 0;
 }
 
 void
@@ -110,7 +113,41 @@ MM_TLHAllocationSupport::restart(MM_EnvironmentBase *env)
 	/* Clear current information accumulated */
 	setAllZeroes();
 
-	_tlh->refreshSize = MM_Math::roundToCeiling(extensions->tlhInitialSize, refreshSize / 2);
+	if (extensions->adaptiveTLHSizing) {
+		/* Average in the cycle just completed; an idle thread's estimate halves every cycle */
+		_allocationRate = (_allocationRate + _cycleBytes) / 2;
+		if (0 == _allocationRate) {
+			_tlh->refreshSize = extensions->tlhInitialSize;
+		} else {
+			/* Size the TLH so the expected allocation takes the target number of refreshes. What is
+			 * left in the TLH at the next GC is wasted, so this also bounds waste to about one
+			 * refresh target's share of the thread's allocation.
+			 */
+			uintptr_t adaptiveSize = _allocationRate / extensions->adaptiveTLHRefreshTarget;
+			adaptiveSize = MM_Math::roundToCeiling(extensions->getObjectAlignmentInBytes(), adaptiveSize);
+			adaptiveSize = OMR_MAX(adaptiveSize, extensions->tlhInitialSize);
+			_tlh->refreshSize = OMR_MIN(adaptiveSize, extensions->tlhMaximumSize);
+		}
+	} else {
+		_tlh->refreshSize = MM_Math::roundToCeiling(extensions->tlhInitialSize, refreshSize / 2);
+	}
+	_cycleBytes = 0;
+	_cycleRefreshCount = 0;
+}
+
+void
+MM_TLHAllocationSupport::adaptRefreshSize(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	uintptr_t refreshSize = getRefreshSize();
+
+	if (refreshSize < extensions->tlhMaximumSize) {
+		if (0 == _allocationRate) {
+			setRefreshSize(refreshSize + extensions->tlhIncrementSize);
+		} else if (_cycleRefreshCount > extensions->adaptiveTLHRefreshTarget) {
+			setRefreshSize(OMR_MIN(refreshSize * 2, extensions->tlhMaximumSize));
+		}
+	}
 }
 
 bool
@@ -254,9 +291,13 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 			stats->_tlhRequestedBytes += getRefreshSize();
 			/* TODO VMDESIGN 1322: adjust the amount consumed by the TLH refresh since a TLH refresh
 			 * may not give you the size requested */
+			_cycleBytes += getSize();
+			_cycleRefreshCount += 1;
 			/* Increase thread hungriness */
 			/* TODO: TLH values (max/min/inc) should be per tlh, or somewhere else? */
-			if (getRefreshSize() < tlhMaximumSize) {
+			if (extensions->adaptiveTLHSizing) {
+				adaptRefreshSize(env);
+			} else if (getRefreshSize() < tlhMaximumSize) {
 				setRefreshSize(getRefreshSize() + extensions->tlhIncrementSize);
 			}
 			reserveTLHTopForGC(env);
@@ -84,6 +84,10 @@ private:
 	const bool _zeroTLH; /**< if true this TLH is primary (might be cleared by batchClearTLH), if false this is secondary TLH (and it would not be cleared ever) */
 
 	uintptr_t _reservedBytesForGC; /**< Number of bytes reserved in the TLH by collector. If set, we are guaranteed to have this remaining size available when we flush/clear TLH. */
+
+	uintptr_t _cycleBytes; /**< Bytes handed to this thread by TLH refreshes since the last GC */
+	uintptr_t _cycleRefreshCount; /**< Number of TLH refreshes since the last GC */
+	uintptr_t _allocationRate; /**< Decaying estimate of the TLH bytes this thread consumes per GC cycle (adaptive TLH sizing only) */
 public:
 protected:
 private:
@@ -183,6 +187,14 @@ private:
 	 */
 	void restart(MM_EnvironmentBase *env);
 
+	/**
+	 * Choose the refresh size following a successful refresh when adaptive TLH sizing is enabled.
+	 * A thread with no allocation history grows by the fixed increment, as without adaptive sizing.
+	 * A thread whose refreshes exceed the per-cycle target is allocating faster than its history
+	 * predicted, so its refresh size is doubled to bring the refresh rate back down.
+	 */
+	void adaptRefreshSize(MM_EnvironmentBase *env);
+
 	/**
 	 * Reserve part (top) of TLH for GC if collector requires
 	 */
@@ -251,7 +263,10 @@ private:
 		_abandonedList(NULL),
 		_abandonedListSize(0),
 		_zeroTLH(zeroTLH),
-		_reservedBytesForGC(0)
+		_reservedBytesForGC(0),
+		_cycleBytes(0),
+		_cycleRefreshCount(0),
+		_allocationRate(0)
 	{};
 
 	/*
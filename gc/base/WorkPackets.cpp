@@ -36,6 +36,7 @@
 #include "Task.hpp"
 #include "WorkPackets.hpp"
 #include "WorkPacketOverflow.hpp"
+#include "WorkStealingDeque.hpp"
 
 /**
  * Instantiate a MM_WorkPackets
@@ -159,6 +160,18 @@ MM_WorkPackets::initialize(MM_EnvironmentBase *env)
 			return false;
 		}
 	}
+
+	if (_extensions->workStealingMarking) {
+		/* one deque per GC worker; workers are identified by their worker ID */
+		_stealingDequeCount = _extensions->gcThreadCount;
+		_stealingDeques = (MM_WorkStealingDeque *)env->getForge()->allocate(sizeof(MM_WorkStealingDeque) * _stealingDequeCount, OMR::GC::AllocationCategory::WORK_PACKETS, OMR_GET_CALLSITE());
+		if (NULL == _stealingDeques) {
+			return false;
+		}
+		for (uintptr_t i = 0; i < _stealingDequeCount; i++) {
+			new(&_stealingDeques[i]) MM_WorkStealingDeque();
+		}
+	}
 	
 	return true;
 }
@@ -250,6 +263,12 @@ MM_WorkPackets::tearDown(MM_EnvironmentBase *env)
 		_overflowHandler = NULL;
 	}
 
+	if (NULL != _stealingDeques) {
+		env->getForge()->free(_stealingDeques);
+		_stealingDeques = NULL;
+		_stealingDequeCount = 0;
+	}
+
 	for (uintptr_t i = 0; i < _packetsBlocksTop; i++) {
 		if (NULL != _packetsStart[i]) {
 			env->getForge()->free(_packetsStart[i]);
@@ -525,6 +544,46 @@ MM_WorkPackets::getInputPacket(MM_EnvironmentBase *env)
 	return packet;
 }
 
+MM_WorkStealingDeque *
+MM_WorkPackets::getStealingDeque(MM_EnvironmentBase *env)
+{
+	MM_WorkStealingDeque *deque = NULL;
+	uintptr_t workerID = env->getWorkerID();
+
+	if (workerID < _stealingDequeCount) {
+		deque = &_stealingDeques[workerID];
+	}
+
+	return deque;
+}
+
+/**
+ * Steal a packet from another worker's deque. Victims are visited round-robin starting
+ * after the caller so that concurrent thieves spread out over different deques.
+ *
+ * @return a stolen packet, or NULL if every other deque was empty
+ */
+MM_Packet *
+MM_WorkPackets::stealInputPacket(MM_EnvironmentBase *env)
+{
+	MM_Packet *packet = NULL;
+	uintptr_t workerID = env->getWorkerID();
+
+	for (uintptr_t i = 1; (NULL == packet) && (i < _stealingDequeCount); i++) {
+		MM_WorkStealingDeque *victim = &_stealingDeques[(workerID + i) % _stealingDequeCount];
+		if (!victim->isEmpty()) {
+			packet = victim->steal();
+		}
+	}
+
+	if (NULL != packet) {
+		packet->setOwner(env);
+		env->_workPacketStats.workPacketsStolen += 1;
+	}
+
+	return packet;
+}
+
 /**
  * Get an output packet
  * 
@@ -40,6 +40,7 @@
 #include "WorkPacketOverflow.hpp"
 
 class MM_EnvironmentBase;
+class MM_WorkStealingDeque;
 class MM_GCExtensionsBase;
 class MM_Packet;
 
@@ -89,6 +90,9 @@ protected:
 	MM_WorkPacketOverflow *_overflowHandler;
 	MM_GCExtensionsBase *_extensions;
 
+	MM_WorkStealingDeque *_stealingDeques; /**< Per-worker packet deques, only allocated if work stealing is enabled */
+	uintptr_t _stealingDequeCount; /**< Number of entries in _stealingDeques */
+
 	void emptyToOverflow(MM_EnvironmentBase *env, MM_Packet *packet, MM_OverflowType type);
 	virtual MM_Packet *getInputPacketFromOverflow(MM_EnvironmentBase *env);
 	bool initWorkPacketsBlock(MM_EnvironmentBase *env);
@@ -119,6 +123,28 @@ public:
 	
 	MM_Packet *getDeferredPacket(MM_EnvironmentBase *env);
 	void putDeferredPacket(MM_EnvironmentBase *env, MM_Packet *packet);
+
+	/**
+	 * Returns TRUE if packets are distributed through per-thread work-stealing deques.
+	 */
+	MMINLINE bool isWorkStealingEnabled()
+	{
+		return (NULL != _stealingDeques);
+	}
+
+	/**
+	 * Fetch the work-stealing deque owned by the calling GC worker.
+	 * @param env[in] The calling GC worker
+	 * @return the deque, or NULL if work stealing is disabled or the worker has no deque
+	 */
+	MM_WorkStealingDeque *getStealingDeque(MM_EnvironmentBase *env);
+
+	/**
+	 * Attempt to steal a packet from the deque of another GC worker.
+	 * @param env[in] The calling GC worker
+	 * @return a stolen packet, or NULL if none could be stolen
+	 */
+	MM_Packet *stealInputPacket(MM_EnvironmentBase *env);
 	
 	/**
 	 * Returns TRUE if an input packet is available, FALSE otherwise.
@@ -246,7 +272,9 @@ public:
 		_inputListMonitor(NULL),
 		_inputListWaitCount(0),
 		_inputListDoneIndex(0),
-		_overflowHandler(NULL)
+		_overflowHandler(NULL),
+		_stealingDeques(NULL),
+		_stealingDequeCount(0)
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -27,6 +27,7 @@
 
 #include "EnvironmentBase.hpp"
 #include "WorkPackets.hpp"
+#include "WorkStealingDeque.hpp"
 #include "Packet.hpp"
 #include "Task.hpp"
 
@@ -62,6 +63,16 @@ MM_WorkStack::prepareForWork(MM_EnvironmentBase *env, MM_WorkPackets *workPacket
 	}
 }
 
+void
+MM_WorkStack::attachStealingDeque(MM_EnvironmentBase *env)
+{
+	Assert_MM_true(NULL != _workPackets);
+	_stealingDeque = _workPackets->getStealingDeque(env);
+	if (NULL != _stealingDeque) {
+		Assert_MM_true(_stealingDeque->isEmpty());
+	}
+}
+
 /**
  * Flush stack object
  * 
@@ -71,6 +82,13 @@ MM_WorkStack::prepareForWork(MM_EnvironmentBase *env, MM_WorkPackets *workPacket
 void
 MM_WorkStack::flush(MM_EnvironmentBase *env)
 {
+	if (NULL != _stealingDeque) {
+		MM_Packet *packet = NULL;
+		while (NULL != (packet = _stealingDeque->pop())) {
+			_workPackets->putPacket(env, packet);
+		}
+		_stealingDeque = NULL;
+	}
 	if(NULL != _inputPacket) {
 		_workPackets->putPacket(env, _inputPacket);
 		_inputPacket = NULL;
@@ -222,11 +240,20 @@ MM_WorkStack::popFailed(MM_EnvironmentBase *env)
 	return NULL;
 }
 
+void
+MM_WorkStack::releaseOutputPacket(MM_EnvironmentBase *env, MM_Packet *packet)
+{
+	/* Keep the packet thread-local unless somebody is starving for work */
+	if ((NULL == _stealingDeque) || (0 != _workPackets->getThreadWaitCount()) || !_stealingDeque->push(packet)) {
+		_workPackets->putOutputPacket(env, packet);
+	}
+}
+
 void MM_WorkStack::pushFailed(MM_EnvironmentBase *env, void *element)
 {
 	if(_outputPacket) {
 		/* The output packet is full - move it to the input list */
-		_workPackets->putOutputPacket(env, _outputPacket);
+		releaseOutputPacket(env, _outputPacket);
 	}
 
 	/* Get a new output packet */
@@ -244,7 +271,7 @@ void MM_WorkStack::pushFailed(MM_EnvironmentBase *env, void *element1, void *ele
 {
 	if(_outputPacket) {
 		/* The output packet is full - move it to the input list */
-		_workPackets->putOutputPacket(env, _outputPacket);
+		releaseOutputPacket(env, _outputPacket);
 	}
 
 	/* Get a new output packet */
@@ -298,7 +325,25 @@ MM_WorkStack::inputPacketAvailableFromWorkPackets(MM_EnvironmentBase *env)
 bool
 MM_WorkStack::retrieveInputPacket(MM_EnvironmentBase *env)
 {
+	if (NULL != _stealingDeque) {
+		/* Packets we produced ourselves are the cheapest (and most cache-friendly) to consume */
+		_inputPacket = _stealingDeque->pop();
+		if (NULL != _inputPacket) {
+			if (0 != _workPackets->getThreadWaitCount()) {
+				/* Other threads are idle; waiting threads only watch the shared lists so hand them one */
+				MM_Packet *sharedPacket = _stealingDeque->pop();
+				if (NULL != sharedPacket) {
+					_workPackets->putOutputPacket(env, sharedPacket);
+				}
+			}
+			return true;
+		}
+	}
+
 	_inputPacket = _workPackets->getInputPacketNoWait(env);
+	if ((NULL == _inputPacket) && (NULL != _stealingDeque)) {
+		_inputPacket = _workPackets->stealInputPacket(env);
+	}
 	if (NULL == _inputPacket) {
 		/* If the output packet contains at least a free entry - invert the input/output */
 		if((NULL != _outputPacket) && !_outputPacket->isEmpty()) {
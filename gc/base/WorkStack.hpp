@@ -36,6 +36,7 @@
 
 class MM_EnvironmentBase;
 class MM_WorkPackets;
+class MM_WorkStealingDeque;
 
 /**
  * @todo Provide class documentation
@@ -49,6 +50,7 @@ private:
 	MM_Packet *_inputPacket;
 	MM_Packet *_outputPacket;
 	MM_Packet *_deferredPacket;
+	MM_WorkStealingDeque *_stealingDeque; /**< Thread-local deque of full packets, NULL unless work stealing is active for the current task */
 	
 	uintptr_t 		_pushCount;
 
@@ -85,6 +87,15 @@ private:
 	 */
 	void *popNoWaitFailed(MM_EnvironmentBase *env);
 
+	/**
+	 * Release a full output packet. If a work-stealing deque is attached and no other thread
+	 * is waiting for work, the packet is kept on the thread-local deque; otherwise it is
+	 * published to the shared packet lists.
+	 * @param env[in] The thread which owns the work stack
+	 * @param packet[in] The packet to release
+	 */
+	void releaseOutputPacket(MM_EnvironmentBase *env, MM_Packet *packet);
+
 public:
 	void reset(MM_EnvironmentBase *env, MM_WorkPackets *workPackets);
 	/**
@@ -93,6 +104,15 @@ public:
 	 * @param workPackets[in] The work packets we want the receiver to use during the mark
 	 */
 	void prepareForWork(MM_EnvironmentBase *env, MM_WorkPackets *workPackets);
+
+	/**
+	 * Attach the calling worker's work-stealing deque, if the work packets were created with
+	 * work stealing enabled. Must only be called from a stop-the-world task, after prepareForWork().
+	 * The deque is detached (and drained back to the shared lists) by flush().
+	 * @param env[in] The thread which owns the work stack
+	 */
+	void attachStealingDeque(MM_EnvironmentBase *env);
+
 	void flush(MM_EnvironmentBase *env);
 
 	/**
@@ -231,7 +251,8 @@ public:
 		_workPackets(NULL),
 		_inputPacket(NULL),
 		_outputPacket(NULL),
-		_deferredPacket(NULL)
+		_deferredPacket(NULL),
+		_stealingDeque(NULL)
 	{
 		_typeId = __FUNCTION__;
 	};
@@ -0,0 +1,156 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(WORKSTEALINGDEQUE_HPP_)
+#define WORKSTEALINGDEQUE_HPP_
+
+#include "omrcfg.h"
+#include "omr.h"
+
+#include "AtomicOperations.hpp"
+#include "BaseNonVirtual.hpp"
+#include "Packet.hpp"
+
+/**
+ * Bounded Chase-Lev work-stealing deque of work packets.
+ *
+ * The owning thread pushes and pops packets at the bottom without any atomic
+ * read-modify-write in the common case; other threads steal from the top with a
+ * single compare-and-swap. The deque never grows: when it is full the caller is
+ * expected to return the packet to the shared MM_WorkPackets lists instead.
+ *
+ * @ingroup GC_Base
+ */
+class MM_WorkStealingDeque : public MM_BaseNonVirtual
+{
+/* Data members */
+public:
+	enum {
+		_capacity = 32, /**< Maximum number of packets held (must be a power of two) */
+		_indexMask = _capacity - 1,
+		_cacheLineSize = 64
+	};
+
+private:
+	volatile uintptr_t _top; /**< Index of the oldest packet; advanced by thieves (and the owner taking the last packet) */
+	uint8_t _topPadding[_cacheLineSize - sizeof(uintptr_t)]; /**< Keep thieves' CAS traffic off the owner's cache line */
+	volatile uintptr_t _bottom; /**< Index one past the newest packet; written only by the owner */
+	uint8_t _bottomPadding[_cacheLineSize - sizeof(uintptr_t)];
+	MM_Packet * volatile _packets[_capacity];
+
+/* Methods */
+public:
+	/**
+	 * Push a packet at the bottom of the deque. Must only be called by the owning thread.
+	 * @param packet[in] The packet to push
+	 * @return true if the packet was pushed, false if the deque is full
+	 */
+	MMINLINE bool push(MM_Packet *packet)
+	{
+		uintptr_t bottom = _bottom;
+		uintptr_t top = _top;
+		if ((bottom - top) >= (uintptr_t)_capacity) {
+			return false;
+		}
+		_packets[bottom & _indexMask] = packet;
+		/* the packet must be visible before thieves can observe the new bottom */
+		MM_AtomicOperations::writeBarrier();
+		_bottom = bottom + 1;
+		return true;
+	}
+
+	/**
+	 * Pop the most recently pushed packet. Must only be called by the owning thread.
+	 * @return the packet, or NULL if the deque is empty (or the last packet was stolen)
+	 */
+	MMINLINE MM_Packet *pop()
+	{
+		uintptr_t bottom = _bottom - 1;
+		_bottom = bottom;
+		/* the store to bottom must be globally visible before top is read (store-load ordering) */
+		MM_AtomicOperations::readWriteBarrier();
+		uintptr_t top = _top;
+
+		if ((intptr_t)(bottom - top) < 0) {
+			/* deque was already empty */
+			_bottom = top;
+			return NULL;
+		}
+
+		MM_Packet *packet = _packets[bottom & _indexMask];
+		if (bottom == top) {
+			/* last packet - race against thieves for it */
+			if (top != MM_AtomicOperations::lockCompareExchange(&_top, top, top + 1)) {
+				packet = NULL;
+			}
+			_bottom = top + 1;
+		}
+		return packet;
+	}
+
+	/**
+	 * Steal the oldest packet. May be called by any thread.
+	 * @return the packet, or NULL if the deque is empty or the steal lost a race
+	 */
+	MMINLINE MM_Packet *steal()
+	{
+		uintptr_t top = _top;
+		MM_AtomicOperations::readWriteBarrier();
+		uintptr_t bottom = _bottom;
+
+		if ((intptr_t)(bottom - top) <= 0) {
+			return NULL;
+		}
+
+		MM_Packet *packet = _packets[top & _indexMask];
+		if (top != MM_AtomicOperations::lockCompareExchange(&_top, top, top + 1)) {
+			return NULL;
+		}
+		return packet;
+	}
+
+	/**
+	 * @return true if the deque currently appears empty (racy when called by a non-owner)
+	 */
+	MMINLINE bool isEmpty()
+	{
+		return (intptr_t)(_bottom - _top) <= 0;
+	}
+
+	/**
+	 * Create a WorkStealingDeque object.
+	 */
+	MM_WorkStealingDeque() :
+		MM_BaseNonVirtual(),
+		_top(0),
+		_bottom(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* WORKSTEALINGDEQUE_HPP_ */
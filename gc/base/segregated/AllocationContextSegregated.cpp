@@ -36,6 +36,7 @@
 #include "SegregatedAllocationInterface.hpp"
 #include "SegregatedMarkingScheme.hpp"
 #include "SizeClasses.hpp"
+#include "SweepSchemeSegregated.hpp"
 
 #include "AllocationContextSegregated.hpp"
 #include "HeapRegionQueue.hpp"
@@ -43,6 +44,7 @@
 #if defined(OMR_GC_SEGREGATED_HEAP)
 
 #define MAX_UINT ((uintptr_t) (-1))
+#define DEFERRED_SWEEP_ALLOCATION_INCREMENT 32 /**< Regions an allocating thread sweeps before retrying when it runs out of free regions during a deferred sweep */
 
 MM_AllocationContextSegregated *
 MM_AllocationContextSegregated::newInstance(MM_EnvironmentBase *env, MM_GlobalAllocationManagerSegregated *gam, MM_RegionPoolSegregated *regionPool)
@@ -223,6 +225,30 @@ MM_AllocationContextSegregated::trySweepAndAllocateRegionFromSmallSizeClass(MM_E
 	return result;
 }
 
+uintptr_t
+MM_AllocationContextSegregated::sweepDeferredRegions(MM_EnvironmentBase *env)
+{
+	uintptr_t regionsSwept = 0;
+	if (_regionPool->isDeferredSweepPending()) {
+		OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+		uint64_t startTime = omrtime_hires_clock();
+		regionsSwept = _regionPool->getSweepScheme()->sweepDeferredIncrement(env, DEFERRED_SWEEP_ALLOCATION_INCREMENT);
+		if (0 != regionsSwept) {
+			/* Sweeping on demand is what incremental quanta try to avoid, account for it until the next quantum */
+			MM_MetronomeStats *metronomeStats = &env->getExtensions()->globalGCStats.metronomeStats;
+			uint64_t delay = omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+			MM_AtomicOperations::add(&metronomeStats->nonDeterministicSweepCount, regionsSwept);
+			if (regionsSwept > metronomeStats->nonDeterministicSweepConsecutive) {
+				metronomeStats->nonDeterministicSweepConsecutive = regionsSwept;
+			}
+			if (delay > metronomeStats->nonDeterministicSweepDelay) {
+				metronomeStats->nonDeterministicSweepDelay = delay;
+			}
+		}
+	}
+	return regionsSwept;
+}
+
 bool
 MM_AllocationContextSegregated::tryAllocateFromRegionPool(MM_EnvironmentBase *env, uintptr_t sizeClass)
 {
@@ -305,8 +331,10 @@ MM_AllocationContextSegregated::preAllocateSmall(MM_EnvironmentBase *env, uintpt
 				if (!trySweepAndAllocateRegionFromSmallSizeClass(env, sizeClass, &sweepCount, &sweepStartTime)) {
 					/* Attempt to get an unused region */
 					if (!tryAllocateFromRegionPool(env, sizeClass)) {
-						/* Really out of regions */
-						done = true;
+						/* Sweep some regions left by a deferred sweep and retry, or we are really out of regions */
+						if (0 == sweepDeferredRegions(env)) {
+							done = true;
+						}
 					}
 				}
 			}
@@ -351,6 +379,10 @@ retry:
 		goto retry;
 	}
 
+	if (0 != sweepDeferredRegions(env)) {
+		goto retry;
+	}
+
 	arrayletAllocationUnlock();
 
 	return NULL;
@@ -369,6 +401,10 @@ MM_AllocationContextSegregated::allocateLarge(MM_EnvironmentBase *env, uintptr_t
 		excess = (2 * excess) + 1;
 	}
 
+	while ((region == NULL) && (0 != sweepDeferredRegions(env))) {
+		region = _regionPool->allocateFromRegionPool(env, neededRegions, OMR_SIZECLASSES_LARGE, MAX_UINT);
+	}
+
 	uintptr_t *result = (region == NULL) ? NULL : (uintptr_t *)region->getLowAddress();
 
 	/* Flush the large page right away. */
@@ -378,6 +414,11 @@ MM_AllocationContextSegregated::allocateLarge(MM_EnvironmentBase *env, uintptr_t
 
 		/* reset ACL counts */
 		region->getMemoryPoolACL()->resetCounts();
+
+		if (_markingScheme->isIncrementalMarkActive()) {
+			/* Allocate black, like the premarked small cells, so the incremental mark keeps the object */
+			_markingScheme->getMarkMap()->atomicSetBit((omrobjectptr_t)result);
+		}
 	}
 
 	return result;
@@ -206,6 +206,13 @@ protected:
 
 	bool tryAllocateFromRegionPool(MM_EnvironmentBase *env, uintptr_t sizeClass);
 
+	/**
+	 * If the region pool has a deferred sweep pending, sweep a few of its regions on this thread
+	 * so that an allocation that found no free region can retry before triggering a GC.
+	 * @return the number of regions swept
+	 */
+	uintptr_t sweepDeferredRegions(MM_EnvironmentBase *env);
+
 private:
 
 };
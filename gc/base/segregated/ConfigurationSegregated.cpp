@@ -89,6 +89,7 @@ MM_ConfigurationSegregated::initialize(MM_EnvironmentBase *env)
 		if (NULL != env->getOmrVM()->_sizeClasses) {
 			extensions->setSegregatedHeap(true);
 			extensions->setStandardGC(true);
+			extensions->payAllocationTax = extensions->incrementalSegregatedGC;
 			extensions->arrayletsPerRegion = extensions->regionSize / env->getOmrVM()->_arrayletLeafSize;
 			success = true;
 		}
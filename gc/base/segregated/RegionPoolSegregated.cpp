@@ -325,7 +325,20 @@ MM_RegionPoolSegregated::allocateFromRegionPool(MM_EnvironmentBase *env, uintptr
 void
 MM_RegionPoolSegregated::joinBucketListsForSplitIndex(MM_EnvironmentBase *env)
 {
-	uintptr_t splitIndex = env->getWorkerID() % _splitAvailableListSplitCount;
+	joinBucketListsForSplitIndex(env->getWorkerID() % _splitAvailableListSplitCount);
+}
+
+void
+MM_RegionPoolSegregated::joinBucketLists(MM_EnvironmentBase *env)
+{
+	for (uintptr_t splitIndex = 0; splitIndex < _splitAvailableListSplitCount; splitIndex++) {
+		joinBucketListsForSplitIndex(splitIndex);
+	}
+}
+
+void
+MM_RegionPoolSegregated::joinBucketListsForSplitIndex(uintptr_t splitIndex)
+{
 	for (int32_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
 		MM_LockingHeapRegionQueue *primaryQueue = &(_smallAvailableRegions[sizeClass][PRIMARY_BUCKET])[splitIndex];
 		for (int32_t i=1; i<NUM_DEFRAG_BUCKETS; i++) {
@@ -138,6 +138,8 @@ private:
 	bool _isSweepingSmall; /**< if GC is sweeping small pages */
 	uintptr_t _splitAvailableListSplitCount; /* number of split available region queues per size class per defragment bucket */
 	uint8_t _skipAvailableRegionForAllocation[OMR_SIZECLASSES_NUM_SMALL+1]; /* per size class flag to indicate if there is any available regions left for allocation for that size class */
+	volatile uintptr_t _publishedSweepEpoch; /**< Incremented each time a cycle publishes its mark map for deferred sweeping */
+	volatile uintptr_t _completedSweepEpoch; /**< Epoch of the last deferred sweep that has been completed */
 
 
 protected:
@@ -157,6 +159,8 @@ private:
 	{
 		MM_AtomicOperations::subtract(&_regionsInUse, value);
 	}
+
+	void joinBucketListsForSplitIndex(uintptr_t splitIndex);
 	
 protected:
 public:
@@ -257,8 +261,29 @@ public:
 	MMINLINE uintptr_t getDarkMatterCellCount(uintptr_t sizeClass) { return _darkMatterCellCount[sizeClass]; }
 
 	void joinBucketListsForSplitIndex(MM_EnvironmentBase *env);
+
+	/**
+	 * Join the bucket lists of every split index. Used when a deferred sweep completes, since the
+	 * threads that swept it (allocating mutators and the background sweeper) do not cover every split index.
+	 */
+	void joinBucketLists(MM_EnvironmentBase *env);
+
+	/**
+	 * Start a new deferred sweep epoch. The regions moved to the sweep lists by moveInUseToSweep()
+	 * are swept lazily until completeSweepEpoch() is called.
+	 * @return the new epoch
+	 */
+	MMINLINE uintptr_t publishSweepEpoch() { return ++_publishedSweepEpoch; }
+	MMINLINE void completeSweepEpoch() { _completedSweepEpoch = _publishedSweepEpoch; }
+	MMINLINE uintptr_t getPublishedSweepEpoch() const { return _publishedSweepEpoch; }
+
+	/**
+	 * @return true if a deferred sweep has been published and not yet completed
+	 */
+	MMINLINE bool isDeferredSweepPending() const { return _publishedSweepEpoch != _completedSweepEpoch; }
 	
 	void setSweepScheme(MM_SweepSchemeSegregated *sweepScheme) { _sweepScheme = sweepScheme; }
+	MM_SweepSchemeSegregated *getSweepScheme() { return _sweepScheme; }
 
 	/**
 	 * Create a RegionPoolSegregated object.
@@ -277,6 +302,8 @@ public:
 		, _largeSweepRegions(NULL)
 		, _regionsInUse(0)
 		, _isSweepingSmall(false)
+		, _publishedSweepEpoch(0)
+		, _completedSweepEpoch(0)
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -146,6 +146,7 @@ void*
 MM_SegregatedAllocationInterface::allocateObject(MM_EnvironmentBase *env, MM_AllocateDescription *allocateDescription, MM_MemorySpace *memorySpace, bool shouldCollectOnFailure)
 {
 	void* cell = NULL;
+	bool refilled = true;
 	uintptr_t sizeInBytes = allocateDescription->getBytesRequested();
 	/* Record the memory space from which the allocation takes place in the AD */
 	allocateDescription->setMemorySpace(memorySpace);
@@ -156,6 +157,7 @@ MM_SegregatedAllocationInterface::allocateObject(MM_EnvironmentBase *env, MM_All
 		/* Ensure we're allocating from the heap (not immortal or scopes) and that the allocation will be from a small region. */
 		if (memorySpace == env->getExtensions()->heap->getDefaultMemorySpace() && (sizeInBytes <= OMR_SIZECLASSES_MAX_SMALL_SIZE_BYTES)) {
 			cell = allocateFromCache(env, sizeInBytes);
+			refilled = (NULL == cell);
 			if (NULL == cell) {
 				MM_AllocationContextSegregated *ac = (MM_AllocationContextSegregated *) env->getAllocationContext();
 				if (ac != NULL) {
@@ -174,6 +176,7 @@ MM_SegregatedAllocationInterface::allocateObject(MM_EnvironmentBase *env, MM_All
 			cell = memorySpace->getDefaultMemorySubSpace()->allocateObject(env, allocateDescription, NULL, NULL, shouldCollectOnFailure);
 		} else if (sizeInBytes <= OMR_SIZECLASSES_MAX_SMALL_SIZE_BYTES) {
 			cell = allocateFromCache(env, sizeInBytes);
+			refilled = (NULL == cell);
 			if (NULL == cell) {
 				MM_AllocationContextSegregated *ac = (MM_AllocationContextSegregated *) env->getAllocationContext();
 				if (ac != NULL) {
@@ -183,6 +186,16 @@ MM_SegregatedAllocationInterface::allocateObject(MM_EnvironmentBase *env, MM_All
 		}
 	}
 
+#if defined(OMR_GC_ALLOCATION_TAX)
+	/* Cache refills and large allocations give the incremental collector a chance to run a quantum,
+	 * whether or not this allocation may collect on failure, as concurrent collectors do
+	 */
+	if ((NULL != cell) && refilled && env->getExtensions()->payAllocationTax) {
+		allocateDescription->setAllocationTaxSize(sizeInBytes);
+		allocateDescription->setMemorySubSpace(memorySpace->getDefaultMemorySubSpace());
+	}
+#endif /* defined(OMR_GC_ALLOCATION_TAX) */
+
 	if ((NULL != cell) && !allocateDescription->isCompletedFromTlh()) {
 		_stats._allocationBytes += allocateDescription->getContiguousBytes();
 		++_stats._allocationCount;
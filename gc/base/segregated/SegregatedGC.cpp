@@ -20,6 +20,8 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
  *******************************************************************************/
 
+#include "omrutil.h"
+
 #include "CollectionStatisticsStandard.hpp"
 #include "CollectorLanguageInterface.hpp"
 #include "EnvironmentBase.hpp"
@@ -30,7 +32,9 @@
 #include "MemoryPoolSegregated.hpp"
 #include "ParallelDispatcher.hpp"
 #include "ParallelMarkTask.hpp"
+#include "RegionPoolSegregated.hpp"
 #include "SegregatedAllocationInterface.hpp"
+#include "SegregatedMarkIncrementTask.hpp"
 #include "SegregatedMarkingScheme.hpp"
 #include "SegregatedSweepTask.hpp"
 #include "SweepSchemeSegregated.hpp"
@@ -48,6 +52,56 @@
 
 #if defined(OMR_GC_SEGREGATED_HEAP)
 
+/**
+ * Regions the background sweeper sweeps between checks for a pending exclusive access request.
+ */
+#define BACKGROUND_SWEEP_INCREMENT 16
+
+/**
+ * Longest the background sweeper waits for an exclusive access request to be granted before it tries to continue.
+ */
+#define BACKGROUND_SWEEP_YIELD_MILLIS 1
+
+/**
+ * Regions a sweep quantum sweeps between checks of its deadline.
+ */
+#define INCREMENTAL_SWEEP_INCREMENT 4
+
+typedef struct SweeperThreadInfo {
+	OMR_VM *omrVM;
+	MM_SegregatedGC *collector;
+	OMR_VMThread *omrVMThread; /**< set by the new thread; NULL if it failed to attach */
+	bool started; /**< set by the new thread once it has attempted to attach */
+} SweeperThreadInfo;
+
+/**
+ * Background sweeper thread procedure
+ *
+ * @parm info Address of SweeperThreadInfo structure
+ */
+static int J9THREAD_PROC
+background_sweeper_thread_proc(void *info)
+{
+	SweeperThreadInfo *sweeperThreadInfo = (SweeperThreadInfo *)info;
+	MM_SegregatedGC *collector = sweeperThreadInfo->collector;
+	OMR_VM *omrVM = sweeperThreadInfo->omrVM;
+
+	OMR_VMThread *omrVMThread = MM_EnvironmentBase::attachVMThread(omrVM, "Segregated Background Sweeper", MM_EnvironmentBase::ATTACH_GC_HELPER_THREAD);
+
+	/* Signal that the sweeper has started (or not); info is on the creating thread's stack and must not be used after this */
+	omrthread_monitor_enter(collector->_sweeperMonitor);
+	sweeperThreadInfo->omrVMThread = omrVMThread;
+	sweeperThreadInfo->started = true;
+	omrthread_monitor_notify_all(collector->_sweeperMonitor);
+	omrthread_monitor_exit(collector->_sweeperMonitor);
+
+	if (NULL != omrVMThread) {
+		collector->backgroundSweeperEntryPoint(omrVMThread);
+	}
+
+	return 0;
+}
+
 /**
  * Initialization
  */
@@ -94,6 +148,21 @@ MM_SegregatedGC::initialize(MM_EnvironmentBase *env)
 	}
 
 	_sweepScheme->setClearMarkMapAfterSweep(false);
+
+	if (_extensions->deferredSegregatedSweep) {
+		if (0 != omrthread_monitor_init_with_name(&_sweeperMonitor, 0, "MM_SegregatedGC::sweeperMonitor")) {
+			return false;
+		}
+	}
+
+	if (_extensions->incrementalSegregatedGC) {
+		OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+		uintptr_t utilization = _extensions->segregatedTargetUtilization;
+		_quantumTicks = (omrtime_hires_frequency() * _extensions->segregatedQuantumMicros) / 1000000;
+		/* The mutator gets utilization percent of every quantum plus the interval that follows it */
+		_mutatorIntervalTicks = (_quantumTicks * utilization) / (100 - utilization);
+	}
+
 	return true;
 }
 
@@ -112,6 +181,11 @@ MM_SegregatedGC::tearDown(MM_EnvironmentBase *env)
 		_sweepScheme->kill(env);
 		_sweepScheme = NULL;
 	}
+
+	if (NULL != _sweeperMonitor) {
+		omrthread_monitor_destroy(_sweeperMonitor);
+		_sweeperMonitor = NULL;
+	}
 }
 
 bool
@@ -129,12 +203,243 @@ MM_SegregatedGC::heapRemoveRange(MM_EnvironmentBase *env, MM_MemorySubSpace *sub
 bool
 MM_SegregatedGC::collectorStartup(MM_GCExtensionsBase* extensions)
 {
-	return true;
+	bool result = true;
+	if (extensions->deferredSegregatedSweep) {
+		result = startBackgroundSweeper(extensions);
+	}
+	return result;
 }
 
 void
 MM_SegregatedGC::collectorShutdown(MM_GCExtensionsBase *extensions)
 {
+	if (_sweeperStarted) {
+		shutdownBackgroundSweeper(extensions);
+	}
+}
+
+/**
+ * Start the background sweeper thread and wait for it to attach.
+ * @return true if the thread attached successfully
+ */
+bool
+MM_SegregatedGC::startBackgroundSweeper(MM_GCExtensionsBase *extensions)
+{
+	SweeperThreadInfo sweeperThreadInfo;
+	sweeperThreadInfo.omrVM = extensions->getOmrVM();
+	sweeperThreadInfo.collector = this;
+	sweeperThreadInfo.omrVMThread = NULL;
+	sweeperThreadInfo.started = false;
+
+	omrthread_monitor_enter(_sweeperMonitor);
+	_sweeperRequest = SWEEPER_WAIT;
+	/* The sweeper runs at minimum priority, it is only meant to use spare cycles; allocating threads sweep what they need themselves */
+	intptr_t threadForkResult = createThreadWithCategory(NULL, OMR_OS_STACK_SIZE, J9THREAD_PRIORITY_MIN,
+			0, background_sweeper_thread_proc, (void *)&sweeperThreadInfo, J9THREAD_CATEGORY_SYSTEM_GC_THREAD);
+	if (0 == threadForkResult) {
+		while (!sweeperThreadInfo.started) {
+			omrthread_monitor_wait(_sweeperMonitor);
+		}
+		_sweeperStarted = (NULL != sweeperThreadInfo.omrVMThread);
+	}
+	omrthread_monitor_exit(_sweeperMonitor);
+
+	return _sweeperStarted;
+}
+
+/**
+ * Ask the background sweeper to exit and wait until it has detached.
+ */
+void
+MM_SegregatedGC::shutdownBackgroundSweeper(MM_GCExtensionsBase *extensions)
+{
+	omrthread_monitor_enter(_sweeperMonitor);
+	_sweeperRequest = SWEEPER_SHUTDOWN;
+	omrthread_monitor_notify_all(_sweeperMonitor);
+	while (SWEEPER_TERMINATED != _sweeperRequest) {
+		omrthread_monitor_wait(_sweeperMonitor);
+	}
+	omrthread_monitor_exit(_sweeperMonitor);
+	_sweeperStarted = false;
+}
+
+void
+MM_SegregatedGC::notifyBackgroundSweeper(SweeperRequest request)
+{
+	omrthread_monitor_enter(_sweeperMonitor);
+	if (SWEEPER_SHUTDOWN > _sweeperRequest) {
+		_sweeperRequest = request;
+		omrthread_monitor_notify_all(_sweeperMonitor);
+	}
+	omrthread_monitor_exit(_sweeperMonitor);
+}
+
+void
+MM_SegregatedGC::backgroundSweeperEntryPoint(OMR_VMThread *omrVMThread)
+{
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrVMThread);
+	SweeperRequest request = SWEEPER_WAIT;
+
+	/* Thread is not a mutator */
+	env->initializeGCThread();
+
+	while (SWEEPER_SHUTDOWN != request) {
+		omrthread_monitor_enter(_sweeperMonitor);
+		while (SWEEPER_WAIT == (request = _sweeperRequest)) {
+			omrthread_monitor_wait(_sweeperMonitor);
+		}
+		omrthread_monitor_exit(_sweeperMonitor);
+
+		if (SWEEPER_SWEEP == request) {
+			/* Holding VM access keeps a GC from starting (and completing the sweep) under us. Each increment
+			 * leaves no region half processed, so VM access can be released between any two of them.
+			 */
+			env->acquireVMAccess();
+			bool moreToSweep = true;
+			while (moreToSweep && !env->isExclusiveAccessRequestWaiting()) {
+				moreToSweep = (0 != _sweepScheme->sweepDeferredIncrement(env, BACKGROUND_SWEEP_INCREMENT));
+			}
+			env->releaseVMAccess();
+
+			omrthread_monitor_enter(_sweeperMonitor);
+			if (SWEEPER_SWEEP == _sweeperRequest) {
+				if (!moreToSweep) {
+					/* Go back to waiting unless a new sweep has been published (or shutdown requested) meanwhile */
+					_sweeperRequest = SWEEPER_WAIT;
+				} else {
+					/* Stopped for an exclusive access request. Reacquiring VM access right away would only spin until the
+					 * request is granted, so wait to be notified of the next sweep (or shutdown) instead. The wait is
+					 * bounded since the request need not be for a collection, which is what publishes the next sweep.
+					 */
+					omrthread_monitor_wait_timed(_sweeperMonitor, BACKGROUND_SWEEP_YIELD_MILLIS, 0);
+				}
+			}
+			omrthread_monitor_exit(_sweeperMonitor);
+		}
+	}
+
+	MM_EnvironmentBase::detachVMThread(_extensions->getOmrVM(), omrVMThread, MM_EnvironmentBase::ATTACH_GC_HELPER_THREAD);
+
+	omrthread_monitor_enter(_sweeperMonitor);
+	_sweeperRequest = SWEEPER_TERMINATED;
+	omrthread_monitor_notify_all(_sweeperMonitor);
+	omrthread_exit(_sweeperMonitor);
+}
+
+void
+MM_SegregatedGC::payAllocationTax(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, MM_MemorySubSpace *baseSubSpace, MM_AllocateDescription *allocDescription)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+
+	if (omrtime_hires_clock() < (_lastQuantumEndTime + _mutatorIntervalTicks)) {
+		/* The mutator has not had its share of time since the last quantum */
+		return;
+	}
+
+	if (_markingScheme->isIncrementalMarkActive()) {
+		incrementalMarkQuantum(env, subspace);
+	} else {
+		MM_MemoryPoolSegregated *memoryPool = (MM_MemoryPoolSegregated *)env->getDefaultMemorySubSpace()->getMemoryPool();
+		bool swept = false;
+		if (memoryPool->getRegionPool()->isDeferredSweepPending()) {
+			swept = incrementalSweepQuantum(env);
+		}
+		if (!swept && isIncrementalTriggerReached(env)) {
+			incrementalMarkQuantum(env, subspace);
+		}
+	}
+}
+
+bool
+MM_SegregatedGC::isIncrementalTriggerReached(MM_EnvironmentBase *env)
+{
+	MM_MemoryPoolSegregated *memoryPool = (MM_MemoryPoolSegregated *)env->getDefaultMemorySubSpace()->getMemoryPool();
+	uintptr_t triggerBytes = (_extensions->heap->getActiveMemorySize() / 100) * _extensions->segregatedGCTrigger;
+	return memoryPool->getBytesInUse() >= triggerBytes;
+}
+
+bool
+MM_SegregatedGC::incrementalSweepQuantum(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	uint64_t startTime = omrtime_hires_clock();
+	uint64_t deadline = startTime + _quantumTicks;
+
+	/* Sweeping is safe alongside allocation, no exclusive access is needed */
+	if (0 == _sweepScheme->sweepDeferredIncrement(env, INCREMENTAL_SWEEP_INCREMENT)) {
+		return false;
+	}
+
+	_extensions->globalGCStats.metronomeStats.clearStart();
+	reportMetronomeIncrementStart(env, startTime);
+	while ((omrtime_hires_clock() < deadline) && (0 != _sweepScheme->sweepDeferredIncrement(env, INCREMENTAL_SWEEP_INCREMENT))) {
+		/* keep sweeping until the deadline */
+	}
+	_lastQuantumEndTime = omrtime_hires_clock();
+	reportMetronomeIncrementEnd(env);
+
+	return true;
+}
+
+void
+MM_SegregatedGC::incrementalMarkQuantum(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+
+	if (!env->acquireExclusiveVMAccessForGC(this, true)) {
+		/* Another thread ran a quantum or a collection while this one waited */
+		return;
+	}
+
+	bool initialIncrement = !_markingScheme->isIncrementalMarkActive();
+	if (initialIncrement) {
+		/* The mark map is about to be cleared, the previous cycle's sweep must be finished first */
+		_deferredRegionsSweptInPause = _sweepScheme->completeDeferredSweep(env);
+		if (!isIncrementalTriggerReached(env)) {
+			env->releaseExclusiveVMAccessForGC();
+			return;
+		}
+	}
+
+	uint64_t startTime = omrtime_hires_clock();
+	MM_MetronomeStats *metronomeStats = &_extensions->globalGCStats.metronomeStats;
+	metronomeStats->clearStart();
+	metronomeStats->_microsToStopMutators = omrtime_hires_delta(0, env->getExclusiveAccessTime(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	reportMetronomeIncrementStart(env, startTime);
+
+	MM_CycleState *previousCycleState = env->_cycleState;
+	if (initialIncrement) {
+		reportMetronomeTriggerStart(env);
+		_extensions->globalGCStats.clear();
+		_cycleState = MM_CycleState();
+		_cycleState._collectionStatistics = &_collectionStatistics;
+		_cycleState._gcCode = MM_GCCode(J9MMCONSTANT_IMPLICIT_GC_DEFAULT);
+		_cycleState._type = _cycleType;
+		_cycleState._activeSubSpace = subSpace;
+
+		/* Caches handed out before the mark map is cleared hold unmarked cells, refills from now on are premarked */
+		GC_OMRVMInterface::flushCachesForGC(env);
+		_markingScheme->mainSetupForGC(env);
+		_markingScheme->setIncrementalMarkActive(true);
+	}
+	env->_cycleState = &_cycleState;
+
+	MM_SegregatedMarkIncrementTask markIncrementTask(env, _dispatcher, _markingScheme, env->_cycleState, initialIncrement, startTime + _quantumTicks);
+	_dispatcher->run(env, &markIncrementTask, 1);
+	_extensions->globalGCStats.markStats._incrementalQuanta += 1;
+
+	env->_cycleState = previousCycleState;
+	_lastQuantumEndTime = omrtime_hires_clock();
+	reportMetronomeIncrementEnd(env);
+
+	if (markIncrementTask.isMarkComplete()) {
+		/* Finish the cycle; the final increment rescans the roots and sweeps */
+		garbageCollect(env, subSpace, NULL, J9MMCONSTANT_IMPLICIT_GC_DEFAULT, NULL, NULL, NULL);
+		_lastQuantumEndTime = omrtime_hires_clock();
+		reportMetronomeTriggerEnd(env);
+	}
+
+	env->releaseExclusiveVMAccessForGC();
 }
 
 void *
@@ -175,8 +480,13 @@ MM_SegregatedGC::abortCollection(MM_EnvironmentBase* env, CollectionAbortReason
 bool
 MM_SegregatedGC::internalGarbageCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace, MM_AllocateDescription *allocDescription)
 {
+	/* An incremental mark in progress is completed by this collection rather than restarted */
+	bool incrementalMark = _markingScheme->isIncrementalMarkActive();
+
 	env->_cycleState->_activeSubSpace->reset();
-	_extensions->globalGCStats.clear();
+	if (!incrementalMark) {
+		_extensions->globalGCStats.clear();
+	}
 	_extensions->globalGCStats.gcCount++;
 
 	/*
@@ -197,14 +507,32 @@ MM_SegregatedGC::internalGarbageCollect(MM_EnvironmentBase *env, MM_MemorySubSpa
 	markStats->_startTime = omrtime_hires_clock();
 	/* OMRTODO investigate / fix this function call */
 
-	_markingScheme->mainSetupForGC(env);
+	if (incrementalMark) {
+		/* Mutators are stopped, the deletion barrier is no longer needed once its references are queued */
+		_markingScheme->setIncrementalMarkActive(false);
+		if (_markingScheme->hasDeletedReferencesOverflowed()) {
+			/* The barrier lost references, only a full mark is correct */
+			incrementalMark = false;
+			markStats->clear();
+			_markingScheme->mainSetupForGC(env);
+		} else {
+			env->_workStack.prepareForWork(env, _markingScheme->getWorkPackets());
+			uintptr_t deletedReferences = _markingScheme->pushDeletedReferences(env);
+			env->_workStack.flush(env);
+			/* The mark task clears this thread's stats, so count the queued references in the cycle's */
+			markStats->_objectsMarked += deletedReferences;
+			markStats->_deletedReferences += deletedReferences;
+		}
+	} else {
+		_markingScheme->mainSetupForGC(env);
+	}
 
 //	if (env->_cycleState->_gcCode.isOutOfMemoryGC()) {
 //		env->_cycleState->_referenceObjectOptions |= MM_CycleState::references_soft_as_weak;
 //	}
 
-	/* run the mark */
-	bool initMarkMap = true; // reset the markmap?
+	/* run the mark, keeping what the incremental mark has already marked */
+	bool initMarkMap = !incrementalMark;
 	MM_ParallelMarkTask markTask(env, _dispatcher, _markingScheme, initMarkMap, env->_cycleState);
 	_dispatcher->run(env, &markTask);
 
@@ -220,10 +548,17 @@ MM_SegregatedGC::internalGarbageCollect(MM_EnvironmentBase *env, MM_MemorySubSpa
 	 * Sweeping
 	 */
 	MM_SweepStats *sweepStats = &_extensions->globalGCStats.sweepStats;
+	MM_MemoryPoolSegregated *memoryPool = (MM_MemoryPoolSegregated *) env->getDefaultMemorySubSpace()->getMemoryPool();
 	reportSweepStart(env);
 	sweepStats->_startTime = omrtime_hires_clock();
-	MM_SegregatedSweepTask sweepTask(env, _dispatcher, _sweepScheme, (MM_MemoryPoolSegregated *) env->getDefaultMemorySubSpace()->getMemoryPool());
-	_dispatcher->run(env, &sweepTask);
+	sweepStats->deferredRegionsSweptInPause = _deferredRegionsSweptInPause;
+	if (_extensions->deferredSegregatedSweep) {
+		/* Only hand the regions to the sweep lists; allocation contexts and the background sweeper sweep them after the pause */
+		_sweepScheme->publishDeferredSweep(env, memoryPool);
+	} else {
+		MM_SegregatedSweepTask sweepTask(env, _dispatcher, _sweepScheme, memoryPool);
+		_dispatcher->run(env, &sweepTask);
+	}
 	MM_MemorySubSpace *activeSubSpace = env->_cycleState->_activeSubSpace;
 	bool isExplicitGC = env->_cycleState->_gcCode.isExplicitGC();
 	/* We now have accurate free space statistics so recalculate any expand/contract amount */
@@ -244,6 +579,10 @@ MM_SegregatedGC::internalGarbageCollect(MM_EnvironmentBase *env, MM_MemorySubSpa
 		((MM_SegregatedAllocationInterface *)(walkEnv->_objectAllocationInterface))->restartCache(walkEnv);
 	}
 
+	if (_sweeperStarted) {
+		notifyBackgroundSweeper(SWEEPER_SWEEP);
+	}
+
 	return true;
 }
 
@@ -261,6 +600,19 @@ MM_SegregatedGC::internalPreCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *
 
 	MM_MemoryPoolSegregated *memoryPool = (MM_MemoryPoolSegregated *) env->getDefaultMemorySubSpace()->getMemoryPool();
 
+	/* Regions left by the previous cycle's deferred sweep must be swept with its mark map, before this cycle clears it.
+	 * Normally the background sweeper has already done this and only the free region coalescing is left.
+	 */
+	if (_extensions->deferredSegregatedSweep) {
+		uintptr_t regionsSwept = _sweepScheme->completeDeferredSweep(env);
+		if (_markingScheme->isIncrementalMarkActive()) {
+			/* The sweep was completed when the incremental mark started */
+			_deferredRegionsSweptInPause += regionsSwept;
+		} else {
+			_deferredRegionsSweptInPause = regionsSwept;
+		}
+	}
+
 	/* The minimum free entry size is always re-adjusted at the end of a cycle.
 	 * But if the current cycle is triggered due to OOM, at the start of the cycle
 	 * set the minimum free entry size to the smallest size class.
@@ -412,6 +764,72 @@ MM_SegregatedGC::reportSweepEnd(MM_EnvironmentBase *env)
 		J9HOOK_MM_PRIVATE_SWEEP_END);
 }
 
+void
+MM_SegregatedGC::reportMetronomeIncrementStart(MM_EnvironmentBase *env, uint64_t timestamp)
+{
+	TRIGGER_J9HOOK_MM_PRIVATE_METRONOME_INCREMENT_START(
+		_extensions->privateHookInterface,
+		env->getOmrVMThread(),
+		timestamp,
+		J9HOOK_MM_PRIVATE_METRONOME_INCREMENT_START,
+		_extensions->globalGCStats.metronomeStats._microsToStopMutators);
+}
+
+void
+MM_SegregatedGC::reportMetronomeIncrementEnd(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	MM_MetronomeStats *metronomeStats = &_extensions->globalGCStats.metronomeStats;
+
+	TRIGGER_J9HOOK_MM_PRIVATE_METRONOME_INCREMENT_END(
+		_extensions->privateHookInterface,
+		env->getOmrVMThread(),
+		omrtime_hires_clock(),
+		J9HOOK_MM_PRIVATE_METRONOME_INCREMENT_END,
+		_extensions->heap->getApproximateActiveFreeMemorySize(),
+		0, /* immortalFree */
+		metronomeStats->classLoaderUnloadedCount,
+		metronomeStats->classesUnloadedCount,
+		metronomeStats->anonymousClassesUnloadedCount,
+		metronomeStats->nonDeterministicSweepCount,
+		metronomeStats->nonDeterministicSweepConsecutive,
+		metronomeStats->nonDeterministicSweepDelay,
+		0, /* weakReferenceClearCount */
+		0, /* softReferenceClearCount */
+		0, /* softReferenceThreshold */
+		0, /* dynamicSoftReferenceThreshold */
+		0, /* phantomReferenceClearCount */
+		metronomeStats->finalizableCount,
+		metronomeStats->getWorkPacketOverflowCount(),
+		metronomeStats->getObjectOverflowCount());
+
+	metronomeStats->clearEnd();
+}
+
+void
+MM_SegregatedGC::reportMetronomeTriggerStart(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+
+	TRIGGER_J9HOOK_MM_PRIVATE_METRONOME_TRIGGER_START(
+		_extensions->privateHookInterface,
+		env->getOmrVMThread(),
+		omrtime_hires_clock(),
+		J9HOOK_MM_PRIVATE_METRONOME_TRIGGER_START);
+}
+
+void
+MM_SegregatedGC::reportMetronomeTriggerEnd(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+
+	TRIGGER_J9HOOK_MM_PRIVATE_METRONOME_TRIGGER_END(
+		_extensions->privateHookInterface,
+		env->getOmrVMThread(),
+		omrtime_hires_clock(),
+		J9HOOK_MM_PRIVATE_METRONOME_TRIGGER_END);
+}
+
 void
 MM_SegregatedGC::reportGCStart(MM_EnvironmentBase *env)
 {
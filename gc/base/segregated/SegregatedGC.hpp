@@ -50,6 +50,25 @@ protected:
 	MM_CollectionStatisticsStandard _collectionStatistics; /** Common collect stats (memory, time etc.) */
 private:
 public:
+	/**
+	 * Requests to the background sweeper thread used with -Xgc:deferredSegregatedSweep
+	 */
+	typedef enum {
+		SWEEPER_WAIT = 0, /**< nothing to sweep, wait to be notified */
+		SWEEPER_SWEEP, /**< a deferred sweep has been published, sweep it */
+		SWEEPER_SHUTDOWN, /**< exit the thread */
+		SWEEPER_TERMINATED /**< set by the thread once it has detached */
+	} SweeperRequest;
+
+	omrthread_monitor_t _sweeperMonitor; /**< Protects _sweeperRequest and wakes the background sweeper */
+	volatile SweeperRequest _sweeperRequest;
+	bool _sweeperStarted; /**< True if the background sweeper thread attached successfully */
+	uintptr_t _deferredRegionsSweptInPause; /**< Regions the current cycle found left of the previous deferred sweep, reported in its sweep stats */
+
+	uint64_t _quantumTicks; /**< Pause budget of an incremental quantum, in omrtime_hires_clock() ticks */
+	uint64_t _mutatorIntervalTicks; /**< Time left to the mutator after each quantum to meet the target utilization */
+	volatile uint64_t _lastQuantumEndTime; /**< omrtime_hires_clock() value at the end of the last quantum */
+
 	/* OMRTODO Remove _objectsMarked and _scanBytes, they are used to fake marking to create more interesting verbose output */
 	uintptr_t _scanBytes;
 	uintptr_t _objectsMarked;
@@ -73,6 +92,32 @@ protected:
 	void reportSweepStart(MM_EnvironmentBase *env);
 	void reportSweepEnd(MM_EnvironmentBase *env);
 
+	void reportMetronomeIncrementStart(MM_EnvironmentBase *env, uint64_t timestamp);
+	void reportMetronomeIncrementEnd(MM_EnvironmentBase *env);
+	void reportMetronomeTriggerStart(MM_EnvironmentBase *env);
+	void reportMetronomeTriggerEnd(MM_EnvironmentBase *env);
+
+	/**
+	 * @return true if heap occupancy has reached -Xgc:segregatedGCTrigger
+	 */
+	bool isIncrementalTriggerReached(MM_EnvironmentBase *env);
+
+	/**
+	 * Sweep regions left by the last deferred sweep on the calling thread for at most one quantum.
+	 * @return true if regions were swept
+	 */
+	bool incrementalSweepQuantum(MM_EnvironmentBase *env);
+
+	/**
+	 * Run one quantum of the incremental mark with exclusive VM access, starting a cycle if none is in progress.
+	 * Once no marking work is left, finish the cycle with a collection.
+	 */
+	void incrementalMarkQuantum(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace);
+
+	bool startBackgroundSweeper(MM_GCExtensionsBase *extensions);
+	void shutdownBackgroundSweeper(MM_GCExtensionsBase *extensions);
+	void notifyBackgroundSweeper(SweeperRequest request);
+
 public:
 	static MM_SegregatedGC *newInstance(MM_EnvironmentBase *env);
 	virtual void kill(MM_EnvironmentBase *env);
@@ -94,6 +139,20 @@ public:
 
 	virtual uintptr_t getVMStateID() { return 100; }
 
+	/**
+	 * Scheduler of -Xgc:incrementalSegregatedGC, run by allocating threads when they refill their caches.
+	 * Once the mutator has had its share of time since the last quantum, runs a sweep quantum while a deferred
+	 * sweep is pending, then starts an incremental mark when heap occupancy reaches the trigger and runs its
+	 * quanta until the mark is done.
+	 */
+	virtual void payAllocationTax(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, MM_MemorySubSpace *baseSubSpace, MM_AllocateDescription *allocDescription);
+
+	/**
+	 * Main loop of the background sweeper thread. Sweeps regions left by a deferred sweep in small
+	 * increments, releasing VM access whenever another thread requests exclusive access.
+	 */
+	void backgroundSweeperEntryPoint(OMR_VMThread *omrVMThread);
+
 	virtual bool heapAddRange(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, uintptr_t size, void *lowAddress, void *highAddress);
 	virtual bool heapRemoveRange(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace,uintptr_t size, void *lowAddress, void *highAddress, void *lowValidAddress, void *highValidAddress);
 
@@ -119,6 +178,13 @@ public:
 		, _markingScheme(NULL)
 		, _sweepScheme(NULL)
 		, _dispatcher(_extensions->dispatcher)
+		, _sweeperMonitor(NULL)
+		, _sweeperRequest(SWEEPER_WAIT)
+		, _sweeperStarted(false)
+		, _deferredRegionsSweptInPause(0)
+		, _quantumTicks(0)
+		, _mutatorIntervalTicks(0)
+		, _lastQuantumEndTime(0)
 		, _scanBytes(0)
 		, _objectsMarked(0)
 	{
@@ -0,0 +1,59 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "ModronAssertions.h"
+
+#include "EnvironmentBase.hpp"
+#include "SegregatedMarkingScheme.hpp"
+#include "WorkStack.hpp"
+
+#include "SegregatedMarkIncrementTask.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+void
+MM_SegregatedMarkIncrementTask::run(MM_EnvironmentBase *env)
+{
+	env->_workStack.prepareForWork(env, _markingScheme->getWorkPackets());
+
+	_markingScheme->markLiveObjectsInit(env, _initialIncrement);
+	if (_initialIncrement) {
+		_markingScheme->markLiveObjectsRoots(env, true);
+	}
+	_markComplete = _markingScheme->scanUntil(env, _deadline);
+
+	env->_workStack.flush(env);
+}
+
+void
+MM_SegregatedMarkIncrementTask::setup(MM_EnvironmentBase *env)
+{
+	Assert_MM_true(_cycleState == env->_cycleState);
+}
+
+void
+MM_SegregatedMarkIncrementTask::cleanup(MM_EnvironmentBase *env)
+{
+	_markingScheme->workerCleanupAfterGC(env);
+}
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
@@ -0,0 +1,78 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#if !defined(SEGREGATEDMARKINCREMENTTASK_HPP_)
+#define SEGREGATEDMARKINCREMENTTASK_HPP_
+
+#include "omrmodroncore.h"
+
+#include "ParallelTask.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+class MM_CycleState;
+class MM_SegregatedMarkingScheme;
+
+/**
+ * One quantum of an incremental segregated mark (-Xgc:incrementalSegregatedGC). The first increment of a
+ * cycle clears the mark map and marks the roots; every increment then traces until its deadline. Work left
+ * at the deadline stays in the work packets for the next increment.
+ */
+class MM_SegregatedMarkIncrementTask : public MM_ParallelTask
+{
+/* Data members / types */
+public:
+protected:
+private:
+	MM_SegregatedMarkingScheme *_markingScheme;
+	MM_CycleState *_cycleState; /**< Collection cycle state active for the task */
+	const bool _initialIncrement; /**< Clear the mark map and mark the roots before tracing */
+	const uint64_t _deadline; /**< omrtime_hires_clock() value at which tracing stops */
+	bool _markComplete; /**< Set if the increment left no marking work */
+
+/* Methods */
+public:
+	virtual uintptr_t getVMStateID() { return OMRVMSTATE_GC_MARK; };
+
+	virtual void run(MM_EnvironmentBase *env);
+	virtual void setup(MM_EnvironmentBase *env);
+	virtual void cleanup(MM_EnvironmentBase *env);
+
+	bool isMarkComplete() { return _markComplete; }
+
+	MM_SegregatedMarkIncrementTask(MM_EnvironmentBase *env, MM_ParallelDispatcher *dispatcher, MM_SegregatedMarkingScheme *markingScheme, MM_CycleState *cycleState, bool initialIncrement, uint64_t deadline)
+		: MM_ParallelTask(env, dispatcher)
+		, _markingScheme(markingScheme)
+		, _cycleState(cycleState)
+		, _initialIncrement(initialIncrement)
+		, _deadline(deadline)
+		, _markComplete(false)
+	{
+		_typeId = __FUNCTION__;
+	}
+protected:
+private:
+};
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
+#endif /* SEGREGATEDMARKINCREMENTTASK_HPP_ */
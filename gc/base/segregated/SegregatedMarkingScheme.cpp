@@ -20,12 +20,26 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
  *******************************************************************************/
 
+#include "ModronAssertions.h"
+
 #include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "WorkStack.hpp"
 
 #include "SegregatedMarkingScheme.hpp"
 
 #if defined(OMR_GC_SEGREGATED_HEAP)
 
+/**
+ * Initial capacity of the deleted references buffer, in entries. It doubles whenever it fills up.
+ */
+#define DELETED_REFERENCES_INITIAL_SIZE 1024
+
+/**
+ * Objects scanned between two reads of the clock in scanUntil()
+ */
+#define SCAN_UNTIL_CLOCK_CHECK_INTERVAL 64
+
 /**
  * Allocate and initialize a new instance of the receiver.
  * @return a new instance of the receiver, or NULL on failure.
@@ -57,4 +71,107 @@ MM_SegregatedMarkingScheme::kill(MM_EnvironmentBase *env)
 	env->getForge()->free(this);
 }
 
+bool
+MM_SegregatedMarkingScheme::initialize(MM_EnvironmentBase *env)
+{
+	if (!MM_MarkingScheme::initialize(env)) {
+		return false;
+	}
+
+	if (_extensions->incrementalSegregatedGC) {
+		if (!_deletedReferencesLock.initialize(env, &_extensions->lnrlOptions, "MM_SegregatedMarkingScheme:_deletedReferencesLock")) {
+			return false;
+		}
+		_deletedReferences = (omrobjectptr_t *)env->getForge()->allocate(DELETED_REFERENCES_INITIAL_SIZE * sizeof(omrobjectptr_t), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		if (NULL == _deletedReferences) {
+			return false;
+		}
+		_deletedReferencesSize = DELETED_REFERENCES_INITIAL_SIZE;
+	}
+
+	return true;
+}
+
+void
+MM_SegregatedMarkingScheme::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _deletedReferences) {
+		env->getForge()->free(_deletedReferences);
+		_deletedReferences = NULL;
+	}
+	_deletedReferencesLock.tearDown();
+
+	MM_MarkingScheme::tearDown(env);
+}
+
+void
+MM_SegregatedMarkingScheme::setIncrementalMarkActive(bool active)
+{
+	if (active) {
+		_deletedReferencesCount = 0;
+		_deletedReferencesOverflow = false;
+	}
+	_incrementalMarkActive = active;
+}
+
+void
+MM_SegregatedMarkingScheme::addDeletedReference(MM_EnvironmentBase *env, omrobjectptr_t objectPtr)
+{
+	_deletedReferencesLock.acquire();
+	if (_deletedReferencesCount == _deletedReferencesSize) {
+		uintptr_t newSize = _deletedReferencesSize * 2;
+		omrobjectptr_t *newReferences = (omrobjectptr_t *)env->getForge()->allocate(newSize * sizeof(omrobjectptr_t), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		if (NULL != newReferences) {
+			memcpy(newReferences, _deletedReferences, _deletedReferencesCount * sizeof(omrobjectptr_t));
+			env->getForge()->free(_deletedReferences);
+			_deletedReferences = newReferences;
+			_deletedReferencesSize = newSize;
+		}
+	}
+	if (_deletedReferencesCount < _deletedReferencesSize) {
+		_deletedReferences[_deletedReferencesCount] = objectPtr;
+		_deletedReferencesCount += 1;
+	} else {
+		/* The object is marked but will never be scanned */
+		_deletedReferencesOverflow = true;
+	}
+	_deletedReferencesLock.release();
+}
+
+uintptr_t
+MM_SegregatedMarkingScheme::pushDeletedReferences(MM_EnvironmentBase *env)
+{
+	_deletedReferencesLock.acquire();
+	uintptr_t count = _deletedReferencesCount;
+	for (uintptr_t i = 0; i < count; i++) {
+		env->_workStack.push(env, (void *)_deletedReferences[i]);
+	}
+	_deletedReferencesCount = 0;
+	_deletedReferencesLock.release();
+
+	env->_markStats._objectsMarked += count;
+	env->_markStats._deletedReferences += count;
+	return count;
+}
+
+bool
+MM_SegregatedMarkingScheme::scanUntil(MM_EnvironmentBase *env, uint64_t deadline)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	uintptr_t objectsScanned = 0;
+	omrobjectptr_t objectPtr = NULL;
+
+	pushDeletedReferences(env);
+
+	while (NULL != (objectPtr = (omrobjectptr_t)env->_workStack.popNoWait(env))) {
+		scanObject(env, objectPtr, SCAN_REASON_PACKET);
+		objectsScanned += 1;
+		if ((0 == (objectsScanned % SCAN_UNTIL_CLOCK_CHECK_INTERVAL)) && (omrtime_hires_clock() >= deadline)) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
 #endif /* OMR_GC_SEGREGATED_HEAP */
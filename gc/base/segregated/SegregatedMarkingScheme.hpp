@@ -31,6 +31,7 @@
 #include "MarkingScheme.hpp"
 
 #include "BaseVirtual.hpp"
+#include "LightweightNonReentrantLock.hpp"
 
 #if defined(OMR_GC_SEGREGATED_HEAP)
 
@@ -44,12 +45,60 @@ class MM_SegregatedMarkingScheme : public MM_MarkingScheme
 public:
 protected:
 private:
+	volatile bool _incrementalMarkActive; /**< Set while an incremental mark is in progress, enables the deletion barrier */
+	MM_LightweightNonReentrantLock _deletedReferencesLock; /**< Protects the deleted references buffer */
+	omrobjectptr_t *_deletedReferences; /**< Objects marked by the deletion barrier, still to be scanned */
+	uintptr_t _deletedReferencesCount;
+	uintptr_t _deletedReferencesSize; /**< Capacity of _deletedReferences, in entries */
+	bool _deletedReferencesOverflow; /**< Set if the buffer could not grow; the mark can no longer complete incrementally */
 	/*
 	 * Function members
 	 */
 public:
 	static MM_SegregatedMarkingScheme *newInstance(MM_EnvironmentBase *env);
 	void kill(MM_EnvironmentBase *env);
+
+	MMINLINE bool isIncrementalMarkActive() { return _incrementalMarkActive; }
+
+	/**
+	 * Enable or disable the deletion barrier. Enabling it discards the deleted references of any previous mark.
+	 * Must be called with exclusive VM access.
+	 */
+	void setIncrementalMarkActive(bool active);
+
+	/**
+	 * Deletion barrier of the incremental mark: an object reference about to be overwritten is marked and
+	 * queued so that everything reachable at the start of the mark is traced.
+	 * @param[in] env the mutator overwriting the reference
+	 * @param[in] objectPtr the reference being overwritten, may be NULL
+	 */
+	MMINLINE void
+	rememberDeletedReference(MM_EnvironmentBase *env, omrobjectptr_t objectPtr)
+	{
+		if ((NULL != objectPtr) && isHeapObject(objectPtr) && _markMap->atomicSetBit(objectPtr)) {
+			addDeletedReference(env, objectPtr);
+		}
+	}
+
+	/**
+	 * Push the objects queued by the deletion barrier on the work stack of the calling thread.
+	 * @return number of objects pushed
+	 */
+	uintptr_t pushDeletedReferences(MM_EnvironmentBase *env);
+
+	/**
+	 * @return true if the deletion barrier lost references, so an incremental mark must be redone from scratch
+	 */
+	bool hasDeletedReferencesOverflowed() { return _deletedReferencesOverflow; }
+
+	/**
+	 * Scan objects from the work stack of the calling thread, after the deleted references, until no work
+	 * is left or the deadline has passed. Work left at the deadline stays in the work packets.
+	 * @param[in] env the thread doing the increment
+	 * @param[in] deadline omrtime_hires_clock() value at which to stop
+	 * @return true if no marking work is left
+	 */
+	bool scanUntil(MM_EnvironmentBase *env, uint64_t deadline);
 	
 	MMINLINE void
 	preMarkSmallCells(MM_EnvironmentBase* env, MM_HeapRegionDescriptorSegregated *containingRegion, uintptr_t *cellList, uintptr_t preAllocatedBytes)
@@ -67,15 +116,25 @@ public:
 		}
 	}
 protected:
+	virtual bool initialize(MM_EnvironmentBase *env);
+	virtual void tearDown(MM_EnvironmentBase *env);
+
 	/**
 	 * Create a MM_RealtimeMarkingScheme object
 	 */
 	MM_SegregatedMarkingScheme(MM_EnvironmentBase *env)
 		: MM_MarkingScheme(env)
+		, _incrementalMarkActive(false)
+		, _deletedReferencesLock()
+		, _deletedReferences(NULL)
+		, _deletedReferencesCount(0)
+		, _deletedReferencesSize(0)
+		, _deletedReferencesOverflow(false)
 	{
 		_typeId = __FUNCTION__;
 	}
 private:
+	void addDeletedReference(MM_EnvironmentBase *env, omrobjectptr_t objectPtr);
 };
 
 #endif /* OMR_GC_SEGREGATED_HEAP */
@@ -442,45 +442,58 @@ void
 MM_SweepSchemeSegregated::incrementalSweepLarge(MM_EnvironmentBase *env)
 {
 	/* Sweep through large objects. */
-	MM_RegionPoolSegregated *regionPool = _memoryPool->getRegionPool();
-	MM_HeapRegionQueue *largeSweepRegions = regionPool->getLargeSweepRegions();
-	MM_HeapRegionQueue *largeFullRegions = regionPool->getLargeFullRegions();
-	MM_HeapRegionDescriptorSegregated *currentRegion;
-	while ((currentRegion = largeSweepRegions->dequeue()) != NULL) {
-		sweepRegion(env, currentRegion);
-		
-		if (currentRegion->getMemoryPoolACL()->getFreeCount() == 0) {
-			largeFullRegions->enqueue(currentRegion);
-		} else {
-			currentRegion->emptyRegionReturned(env);
-			regionPool->addFreeRegion(env, currentRegion);
-		}
+	while (sweepNextLargeRegion(env)) {
 		yieldFromSweep(env);
 	}
 }
 
+bool
+MM_SweepSchemeSegregated::sweepNextLargeRegion(MM_EnvironmentBase *env)
+{
+	MM_RegionPoolSegregated *regionPool = _memoryPool->getRegionPool();
+	MM_HeapRegionDescriptorSegregated *currentRegion = regionPool->getLargeSweepRegions()->dequeue();
+	if (NULL == currentRegion) {
+		return false;
+	}
+
+	sweepRegion(env, currentRegion);
+
+	if (currentRegion->getMemoryPoolACL()->getFreeCount() == 0) {
+		regionPool->getLargeFullRegions()->enqueue(currentRegion);
+	} else {
+		currentRegion->emptyRegionReturned(env);
+		regionPool->addFreeRegion(env, currentRegion);
+	}
+	return true;
+}
+
 void
 MM_SweepSchemeSegregated::incrementalSweepArraylet(MM_EnvironmentBase *env)
 {
-	uintptr_t arrayletsPerRegion = env->getExtensions()->arrayletsPerRegion;
+	while (sweepNextArrayletRegion(env)) {
+		yieldFromSweep(env);
+	}
+}
 
+bool
+MM_SweepSchemeSegregated::sweepNextArrayletRegion(MM_EnvironmentBase *env)
+{
+	uintptr_t arrayletsPerRegion = env->getExtensions()->arrayletsPerRegion;
 	MM_RegionPoolSegregated *regionPool = _memoryPool->getRegionPool();
-	MM_HeapRegionQueue *arrayletSweepRegions = regionPool->getArrayletSweepRegions();
-	MM_HeapRegionQueue *arrayletAvailableRegions = regionPool->getArrayletAvailableRegions();
-	MM_HeapRegionDescriptorSegregated *currentRegion;
-	
-	while ((currentRegion = arrayletSweepRegions->dequeue()) != NULL) {
-		sweepRegion(env, currentRegion);
-		
-		if (currentRegion->getMemoryPoolACL()->getFreeCount() != arrayletsPerRegion) {
-			arrayletAvailableRegions->enqueue(currentRegion);
-		} else {
-			currentRegion->emptyRegionReturned(env);
-			regionPool->addFreeRegion(env, currentRegion);
-		}
-		
-		yieldFromSweep(env);
+	MM_HeapRegionDescriptorSegregated *currentRegion = regionPool->getArrayletSweepRegions()->dequeue();
+	if (NULL == currentRegion) {
+		return false;
 	}
+
+	sweepRegion(env, currentRegion);
+
+	if (currentRegion->getMemoryPoolACL()->getFreeCount() != arrayletsPerRegion) {
+		regionPool->getArrayletAvailableRegions()->enqueue(currentRegion);
+	} else {
+		currentRegion->emptyRegionReturned(env);
+		regionPool->addFreeRegion(env, currentRegion);
+	}
+	return true;
 }
 
 uintptr_t
@@ -499,9 +512,7 @@ void
 MM_SweepSchemeSegregated::incrementalSweepSmall(MM_EnvironmentBase *env)
 {
 	MM_GCExtensionsBase *ext = env->getExtensions();
-	bool shouldUpdateOccupancy = ext->nonDeterministicSweep;
 	MM_RegionPoolSegregated *regionPool = _memoryPool->getRegionPool();
-	uintptr_t splitIndex = env->getWorkerID() % (regionPool->getSplitAvailableListSplitCount());
 
 	/* 
 	 * Iterate through the regions so that each region is processed exactly once.
@@ -523,42 +534,9 @@ MM_SweepSchemeSegregated::incrementalSweepSmall(MM_EnvironmentBase *env)
 					break;
 				}
 				
-				MM_HeapRegionQueue *sweepList = regionPool->getSmallSweepRegions(sizeClass);
-				MM_HeapRegionDescriptorSegregated *currentRegion;
-				uintptr_t numCells = sizeClasses->getNumCells(sizeClass);
-				uintptr_t sweepSmallRegionsPerIteration = calcSweepSmallRegionsPerIteration(numCells);
+				uintptr_t sweepSmallRegionsPerIteration = calcSweepSmallRegionsPerIteration(sizeClasses->getNumCells(sizeClass));
 				uintptr_t yieldSlackTime = resetSweepSmallRegionCount(env, sweepSmallRegionsPerIteration);
-				uintptr_t actualSweepRegions;
-				if ((actualSweepRegions = sweepList->dequeue(env->getRegionWorkList(), sweepSmallRegionsPerIteration)) > 0) {
-					regionPool->decrementCurrentCountOfSweepRegions(sizeClass, actualSweepRegions);
-					regionPool->decrementCurrentTotalCountOfSweepRegions(actualSweepRegions);
-					MM_HeapRegionQueue *fullList = env->getRegionLocalFull();
-					while ((currentRegion = env->getRegionWorkList()->dequeue()) != NULL) {
-						sweepRegion(env, currentRegion);
-						if (currentRegion->getMemoryPoolACL()->getFreeCount() < numCells) {
-							uintptr_t occupancy = (currentRegion->getMemoryPoolACL()->getMarkCount() * 100) / numCells;
-							/* Maintain average occupancy needed for nondeterministic sweep heuristic */
-							if (shouldUpdateOccupancy) {
-								regionPool->updateOccupancy(sizeClass, occupancy);
-							}
-							if (currentRegion->getMemoryPoolACL()->getMarkCount() == numCells) {
-								/* Return full regions to full list */
-								fullList->enqueue(currentRegion);
-							} else {
-								regionPool->enqueueAvailable(currentRegion, sizeClass, occupancy, splitIndex);
-							}
-						} else {
-							currentRegion->emptyRegionReturned(env);
-							currentRegion->setFree(1);
-							env->getRegionLocalFree()->enqueue(currentRegion);
-						}
-						
-						if (updateSweepSmallRegionCount()) {
-							yieldFromSweep(env, yieldSlackTime);
-						}
-					}
-					regionPool->addSingleFree(env, env->getRegionLocalFree());				
-					regionPool->getSmallFullRegions(sizeClass)->enqueue(fullList);
+				if (0 < sweepSmallRegionBatch(env, sizeClass, sweepSmallRegionsPerIteration, yieldSlackTime)) {
 					yieldFromSweep(env, yieldSlackTime);
 				}
 			} /* end of while(currentTotalCountOfSweepRegions); */
@@ -566,4 +544,117 @@ MM_SweepSchemeSegregated::incrementalSweepSmall(MM_EnvironmentBase *env)
 	}
 }
 
+uintptr_t
+MM_SweepSchemeSegregated::sweepSmallRegionBatch(MM_EnvironmentBase *env, uintptr_t sizeClass, uintptr_t maxRegions, uintptr_t yieldSlackTime)
+{
+	MM_GCExtensionsBase *ext = env->getExtensions();
+	bool shouldUpdateOccupancy = ext->nonDeterministicSweep;
+	MM_RegionPoolSegregated *regionPool = _memoryPool->getRegionPool();
+	uintptr_t splitIndex = env->getWorkerID() % (regionPool->getSplitAvailableListSplitCount());
+	MM_HeapRegionQueue *sweepList = regionPool->getSmallSweepRegions(sizeClass);
+	MM_HeapRegionDescriptorSegregated *currentRegion;
+	uintptr_t numCells = ext->defaultSizeClasses->getNumCells(sizeClass);
+	uintptr_t actualSweepRegions;
+	if ((actualSweepRegions = sweepList->dequeue(env->getRegionWorkList(), maxRegions)) > 0) {
+		regionPool->decrementCurrentCountOfSweepRegions(sizeClass, actualSweepRegions);
+		regionPool->decrementCurrentTotalCountOfSweepRegions(actualSweepRegions);
+		MM_HeapRegionQueue *fullList = env->getRegionLocalFull();
+		while ((currentRegion = env->getRegionWorkList()->dequeue()) != NULL) {
+			sweepRegion(env, currentRegion);
+			if (currentRegion->getMemoryPoolACL()->getFreeCount() < numCells) {
+				uintptr_t occupancy = (currentRegion->getMemoryPoolACL()->getMarkCount() * 100) / numCells;
+				/* Maintain average occupancy needed for nondeterministic sweep heuristic */
+				if (shouldUpdateOccupancy) {
+					regionPool->updateOccupancy(sizeClass, occupancy);
+				}
+				if (currentRegion->getMemoryPoolACL()->getMarkCount() == numCells) {
+					/* Return full regions to full list */
+					fullList->enqueue(currentRegion);
+				} else {
+					regionPool->enqueueAvailable(currentRegion, sizeClass, occupancy, splitIndex);
+				}
+			} else {
+				currentRegion->emptyRegionReturned(env);
+				currentRegion->setFree(1);
+				env->getRegionLocalFree()->enqueue(currentRegion);
+			}
+
+			if (updateSweepSmallRegionCount()) {
+				yieldFromSweep(env, yieldSlackTime);
+			}
+		}
+		regionPool->addSingleFree(env, env->getRegionLocalFree());
+		regionPool->getSmallFullRegions(sizeClass)->enqueue(fullList);
+	}
+	return actualSweepRegions;
+}
+
+void
+MM_SweepSchemeSegregated::publishDeferredSweep(MM_EnvironmentBase *env, MM_MemoryPoolSegregated *memoryPool)
+{
+	_memoryPool = memoryPool;
+	_isFixHeapForWalk = false;
+
+	MM_RegionPoolSegregated *regionPool = _memoryPool->getRegionPool();
+	Assert_MM_false(regionPool->isDeferredSweepPending());
+	regionPool->setSweepScheme(this);
+
+	preSweep(env);
+	regionPool->setSweepSmallPages(true);
+	regionPool->resetSkipAvailableRegionForAllocation();
+	regionPool->publishSweepEpoch();
+}
+
+uintptr_t
+MM_SweepSchemeSegregated::sweepDeferredIncrement(MM_EnvironmentBase *env, uintptr_t maxRegions)
+{
+	MM_RegionPoolSegregated *regionPool = _memoryPool->getRegionPool();
+	if (!regionPool->isDeferredSweepPending()) {
+		return 0;
+	}
+
+	/* Arraylet and large regions first, they are cheap to sweep and may return whole regions to the free lists */
+	uintptr_t regionsSwept = 0;
+	while ((regionsSwept < maxRegions) && sweepNextArrayletRegion(env)) {
+		regionsSwept += 1;
+	}
+	while ((regionsSwept < maxRegions) && sweepNextLargeRegion(env)) {
+		regionsSwept += 1;
+	}
+
+	MM_SizeClasses *sizeClasses = env->getExtensions()->defaultSizeClasses;
+	for (uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; (sizeClass <= OMR_SIZECLASSES_MAX_SMALL) && (regionsSwept < maxRegions); sizeClass++) {
+		while ((regionsSwept < maxRegions) && (0 != regionPool->getCurrentCountOfSweepRegions(sizeClass))) {
+			uintptr_t batchSize = OMR_MIN(maxRegions - regionsSwept, calcSweepSmallRegionsPerIteration(sizeClasses->getNumCells(sizeClass)));
+			uintptr_t batchSwept = sweepSmallRegionBatch(env, sizeClass, batchSize, 0);
+			if (0 == batchSwept) {
+				/* an allocating thread took the remaining regions of this size class */
+				break;
+			}
+			regionsSwept += batchSwept;
+		}
+	}
+
+	return regionsSwept;
+}
+
+uintptr_t
+MM_SweepSchemeSegregated::completeDeferredSweep(MM_EnvironmentBase *env)
+{
+	uintptr_t regionsSwept = 0;
+	if ((NULL != _memoryPool) && _memoryPool->getRegionPool()->isDeferredSweepPending()) {
+		MM_RegionPoolSegregated *regionPool = _memoryPool->getRegionPool();
+		uintptr_t incrementSwept = 0;
+		while (0 != (incrementSwept = sweepDeferredIncrement(env, UDATA_MAX))) {
+			regionsSwept += incrementSwept;
+		}
+
+		regionPool->joinBucketLists(env);
+		regionPool->setSweepSmallPages(false);
+		postSweep(env);
+		regionPool->completeSweepEpoch();
+	}
+	return regionsSwept;
+}
+
 #endif /* OMR_GC_SEGREGATED_HEAP */
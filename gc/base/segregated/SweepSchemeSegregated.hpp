@@ -67,6 +67,28 @@ public:
 	void sweep(MM_EnvironmentBase *env, MM_MemoryPoolSegregated *memoryPool, bool isFixHeapForWalk);
 	virtual void sweepRegion(MM_EnvironmentBase *env, MM_HeapRegionDescriptorSegregated *region);
 
+	/**
+	 * Move the regions allocated into during the last cycle to the sweep lists and start a new deferred
+	 * sweep epoch, without sweeping any of them. They are swept later by sweepDeferredIncrement(), either
+	 * on demand by allocating threads or by a background sweeper, and the sweep is finished by completeDeferredSweep().
+	 * @param memoryPool the memory pool whose regions are to be swept
+	 */
+	void publishDeferredSweep(MM_EnvironmentBase *env, MM_MemoryPoolSegregated *memoryPool);
+
+	/**
+	 * Sweep up to maxRegions regions left by publishDeferredSweep(). May run concurrently on several threads,
+	 * and stops at a region boundary so the caller may release VM access between increments.
+	 * @return the number of regions swept, 0 once there is nothing left that this thread can sweep
+	 */
+	uintptr_t sweepDeferredIncrement(MM_EnvironmentBase *env, uintptr_t maxRegions);
+
+	/**
+	 * Sweep whatever is left of the current deferred sweep, then coalesce free regions and close the sweep epoch.
+	 * Must be called by a single thread while no other thread can be sweeping (i.e. with exclusive VM access).
+	 * @return the number of regions that were still unswept
+	 */
+	uintptr_t completeDeferredSweep(MM_EnvironmentBase *env);
+
 	bool isClearMarkMapAfterSweep() { return _clearMarkMapAfterSweep; }
 	void setClearMarkMapAfterSweep(bool clearMarkMapAfterSweep) { _clearMarkMapAfterSweep = clearMarkMapAfterSweep; }
 protected:
@@ -100,6 +122,15 @@ private:
 	void addBytesFreedAfterSweep(MM_EnvironmentBase *env, MM_HeapRegionDescriptorSegregated *region);
 	void incrementalSweepSmall(MM_EnvironmentBase *env);
 	void incrementalSweepLarge(MM_EnvironmentBase *env);
+	bool sweepNextArrayletRegion(MM_EnvironmentBase *env);
+	bool sweepNextLargeRegion(MM_EnvironmentBase *env);
+
+	/**
+	 * Dequeue up to maxRegions regions of one small size class from the sweep list, sweep them and
+	 * distribute them to the full, available and free lists.
+	 * @return the number of regions swept
+	 */
+	uintptr_t sweepSmallRegionBatch(MM_EnvironmentBase *env, uintptr_t sizeClass, uintptr_t maxRegions, uintptr_t yieldSlackTime);
 	void incrementalCoalesceFreeRegions(MM_EnvironmentBase *env);
 
 	MMINLINE bool addFreeChunk(MM_MemoryPoolAggregatedCellList *memoryPoolACL, uintptr_t *freeChunk, uintptr_t freeChunkSize, uintptr_t minimumFreeEntrySize, uintptr_t freeChunkCellCount)
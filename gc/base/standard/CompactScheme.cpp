@@ -411,12 +411,22 @@ MM_CompactScheme::createSubAreaTable(MM_EnvironmentStandard *env, bool singleThr
 		min_subarea_size = _heap->getMaximumPhysicalRange();
 	}
 	uintptr_t size = (DESIRED_SUBAREA_SIZE >= min_subarea_size) ?  DESIRED_SUBAREA_SIZE : min_subarea_size;
+	_subAreaSize = size;
 
 
 	/* Single threaded pass to set tentative sub area limits tentative limits are
 	 * listed in freeChunk field. This field will be reset during the third pass.
 	 */
 	if (env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
+		/* Pipelining move and fixup only pays off (and is only safe to skip the barrier for) with several threads */
+		_pipelineGroupSize = (!singleThreaded && _extensions->pipelinedCompaction) ? COMPACT_PIPELINE_GROUP_SUBAREAS : 0;
+		/* Only compactions that tidy up fragmentation (or are requested on every global GC) are limited to a window;
+		 * the others need all the free memory they can get
+		 */
+		CompactReason compactReason = _extensions->globalGCStats.compactStats._compactReason;
+		bool windowed = (COMPACT_FRAGMENTED == compactReason) || (COMPACT_MICRO_FRAG == compactReason) || (COMPACT_ALWAYS == compactReason);
+		_compactWindowSize = (!singleThreaded && windowed) ? _extensions->compactWindowSize : 0;
+
 		GC_HeapRegionIteratorStandard regionIterator(_rootManager);
 		uintptr_t i = 0;
 		while(NULL != (region = regionIterator.nextRegion())) {
@@ -496,6 +506,7 @@ MM_CompactScheme::removeNullSubAreas(MM_EnvironmentStandard *env)
 		_compactFrom = (omrobjectptr_t)_heap->getHeapTop();
 		_compactTo   = (omrobjectptr_t)_heap->getHeapBase();
 		uintptr_t j = 0;
+		uintptr_t pendingEvacuation = 0;
 		for (uintptr_t i = 0; _subAreaTable[i].state != SubAreaEntry::end_heap; i++) {
 			if (NULL != _subAreaTable[i].firstObject) {
 				_subAreaTable[j].firstObject = _subAreaTable[i].firstObject;
@@ -506,13 +517,113 @@ MM_CompactScheme::removeNullSubAreas(MM_EnvironmentStandard *env)
 					_compactTo = (_compactTo > _subAreaTable[j].firstObject) ? _compactTo : _subAreaTable[j].firstObject;
 				}
 				_subAreaTable[j].freeChunk = 0;
+				_subAreaTable[j].evacuated = 0;
+				/* pipelined move and fixup claim sub areas from this known action */
+				_subAreaTable[j].currentAction = SubAreaEntry::none;
+				if (SubAreaEntry::end_segment != _subAreaTable[j].state) {
+					pendingEvacuation += 1;
+				}
+				/* waitForSubAreaEvacuated() binary searches the table by address */
+				Assert_MM_true((0 == _pipelineGroupSize) || (0 == j) || (_subAreaTable[j-1].firstObject <= _subAreaTable[j].firstObject));
 				j++;
 			}
 		}
+		_subAreaCount = j;
+		_subAreasPendingEvacuation = (0 != _pipelineGroupSize) ? pendingEvacuation : 0;
+		if (0 != _compactWindowSize) {
+			selectCompactWindow(env);
+		}
 		env->_currentTask->releaseSynchronizedGCThreads(env);
 	}
 }
 
+void
+MM_CompactScheme::selectCompactWindow(MM_EnvironmentStandard *env)
+{
+	for (uintptr_t i = 0; i < _subAreaCount; i++) {
+		_subAreaTable[i].freeBytes = 0;
+	}
+
+	/* The free lists built by the sweep are still intact: attribute each fragmented old space entry to the sub areas it
+	 * overlaps. Entries that can hold a maximum size TLH (such as the untouched top of the heap) gain nothing from compaction.
+	 */
+	uintptr_t fragmentedEntrySize = _extensions->tlhMaximumSize;
+	MM_MemoryPool *memoryPool = NULL;
+	MM_HeapMemoryPoolIterator poolIterator(env, _heap);
+	while (NULL != (memoryPool = poolIterator.nextPool())) {
+		MM_MemorySubSpace *memorySubSpace = memoryPool->getSubSpace();
+		if ((NULL == memorySubSpace) || (MEMORY_TYPE_OLD != (memorySubSpace->getTypeFlags() & MEMORY_TYPE_OLD))) {
+			continue;
+		}
+		void *freeEntry = memoryPool->getFirstFreeStartingAddr(env);
+		while (NULL != freeEntry) {
+			uintptr_t freeBase = (uintptr_t)freeEntry;
+			uintptr_t freeSize = ((MM_HeapLinkedFreeHeader *)freeEntry)->getSize();
+			uintptr_t freeTop = freeBase + freeSize;
+			if (freeSize < fragmentedEntrySize) {
+				for (uintptr_t i = findSubArea(freeEntry); (i < _subAreaCount) && ((uintptr_t)_subAreaTable[i].firstObject < freeTop); i++) {
+					if (SubAreaEntry::end_segment != _subAreaTable[i].state) {
+						uintptr_t overlapBase = OMR_MAX(freeBase, (uintptr_t)_subAreaTable[i].firstObject);
+						uintptr_t overlapTop = OMR_MIN(freeTop, (uintptr_t)_subAreaTable[i + 1].firstObject);
+						if (overlapTop > overlapBase) {
+							_subAreaTable[i].freeBytes += overlapTop - overlapBase;
+						}
+					}
+				}
+			}
+			freeEntry = memoryPool->getNextFreeStartingAddr(env, freeEntry);
+		}
+	}
+
+	/* Slide a window of at most _compactWindowSize bytes over the sub areas of each segment */
+	uintptr_t windowStart = 0;
+	uintptr_t windowBytes = 0;
+	uintptr_t windowFreeBytes = 0;
+	uintptr_t bestStart = 0;
+	uintptr_t bestEnd = 0;
+	uintptr_t bestBytes = 0;
+	uintptr_t bestFreeBytes = 0;
+	for (uintptr_t i = 0; i < _subAreaCount; i++) {
+		if (SubAreaEntry::end_segment == _subAreaTable[i].state) {
+			windowStart = i + 1;
+			windowBytes = 0;
+			windowFreeBytes = 0;
+			continue;
+		}
+		windowBytes += subAreaWindowBytes(i);
+		windowFreeBytes += _subAreaTable[i].freeBytes;
+		while ((windowStart < i) && (windowBytes > _compactWindowSize)) {
+			windowBytes -= subAreaWindowBytes(windowStart);
+			windowFreeBytes -= _subAreaTable[windowStart].freeBytes;
+			windowStart += 1;
+		}
+		if (windowFreeBytes > bestFreeBytes) {
+			bestStart = windowStart;
+			bestEnd = i + 1;
+			bestBytes = windowBytes;
+			bestFreeBytes = windowFreeBytes;
+		}
+	}
+
+	for (uintptr_t i = 0; i < _subAreaCount; i++) {
+		if ((SubAreaEntry::init == _subAreaTable[i].state) && ((i < bestStart) || (i >= bestEnd))) {
+			_subAreaTable[i].state = SubAreaEntry::fixup_only;
+		}
+	}
+
+	/* forwarding pointers only need to be looked up for objects within the window */
+	if (bestEnd > bestStart) {
+		_compactFrom = _subAreaTable[bestStart].firstObject;
+		_compactTo = _subAreaTable[bestEnd].firstObject;
+	} else {
+		_compactFrom = (omrobjectptr_t)_heap->getHeapTop();
+		_compactTo = (omrobjectptr_t)_heap->getHeapBase();
+	}
+
+	env->_compactStats._windowBytes = bestBytes;
+	env->_compactStats._windowFreeBytes = bestFreeBytes;
+}
+
 /**
  *  Complete setup for each sub area.
  */
@@ -583,7 +694,16 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 	/* If a single threaded compaction force compact to run on main thread. Required
 	 * to ensure all events issued on main thread.
 	 */
-	if (!singleThreaded || env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
+	if (0 != _pipelineGroupSize) {
+		/* No barrier between the phases: each thread starts fixing up as soon as it runs out of sub areas to evacuate */
+		env->_compactStats._moveStartTime = omrtime_hires_clock();
+		moveObjects(env, objectCount, byteCount, skippedObjectCount);
+		env->_compactStats._moveEndTime = omrtime_hires_clock();
+
+		env->_compactStats._fixupStartTime = omrtime_hires_clock();
+		fixupObjectsPipelined(env, fixupObjectsCount, env->_compactStats._fixupOverlappedSubAreas);
+		env->_compactStats._fixupEndTime = omrtime_hires_clock();
+	} else if (!singleThreaded || env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
 		env->_compactStats._moveStartTime = omrtime_hires_clock();
 		moveObjects(env, objectCount, byteCount, skippedObjectCount);
 		env->_compactStats._moveEndTime = omrtime_hires_clock();
@@ -613,6 +733,7 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 	MM_AtomicOperations::sync();
 
 	if (env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
+		env->_compactStats._rebuildFreelistStartTime = omrtime_hires_clock();
 		rebuildFreelist(env);
 
 		MM_MemoryPool *memoryPool;
@@ -621,14 +742,17 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 		while(NULL != (memoryPool = poolIterator.nextPool())) {
 			memoryPool->postProcess(env, MM_MemoryPool::forCompact);
 		}
+		env->_compactStats._rebuildFreelistEndTime = omrtime_hires_clock();
 
 		MM_AtomicOperations::sync();
 		env->_currentTask->releaseSynchronizedGCThreads(env);
 	}
 
 	if (rebuildMarkBits) {
+		env->_compactStats._rebuildMarkBitsStartTime = omrtime_hires_clock();
 		rebuildMarkbits(env);
 		MM_AtomicOperations::sync();
+		env->_compactStats._rebuildMarkBitsEndTime = omrtime_hires_clock();
 	}
 
 	_delegate.workerCleanupAfterGC(env);
@@ -698,10 +822,30 @@ void MM_CompactScheme::rebuildFreelist(MM_EnvironmentStandard *env)
 					currentFreeSize = 0;
 					currentFreeBase = (void *)subAreaTable[i].freeChunk;
 				}
-			} else {
-				/* Either there is no free area in the sub area or sub area is
-				 * a fixup_only sub area, i.e. IC is active
+			} else if (SubAreaEntry::fixup_only == subAreaTable[i].state) {
+				/* Nothing was moved into or out of the sub area (window compaction), so
+				 * its free memory is whatever lies between its marked objects
 				 */
+				omrobjectptr_t subAreaEnd = subAreaTable[i + 1].firstObject;
+				if (NULL == currentFreeBase) {
+					currentFreeBase = (void *)subAreaTable[i].firstObject;
+				}
+				MM_HeapMapIterator markedObjectIterator(_extensions, _markMap, (uintptr_t *)subAreaTable[i].firstObject, (uintptr_t *)subAreaEnd);
+				omrobjectptr_t objectPtr = NULL;
+				while (NULL != (objectPtr = markedObjectIterator.nextObject())) {
+					if ((void *)objectPtr > currentFreeBase) {
+						currentFreeSize = (uintptr_t)objectPtr - (uintptr_t)currentFreeBase;
+						addFreeEntry(env, memorySubSpace, poolState, currentFreeBase, currentFreeSize);
+					}
+					currentFreeBase = (void *)((uintptr_t)objectPtr + _extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr));
+				}
+				/* any trailing free memory is carried into the next sub area */
+				if (currentFreeBase >= (void *)subAreaEnd) {
+					currentFreeBase = NULL;
+				}
+				currentFreeSize = 0;
+			} else {
+				/* There is no free area in the sub area */
 				if (NULL != currentFreeBase) {
 					currentFreeSize = (uintptr_t)subAreaTable[i].firstObject - (uintptr_t)currentFreeBase;
 
@@ -829,8 +973,18 @@ MM_CompactScheme::moveObjects(MM_EnvironmentStandard *env, uintptr_t &objectCoun
 		}
 		intptr_t i;
 		for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
-			if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::evacuating)) {
+			/* A pipelined sub area may already be fixing_up when a slower thread gets here, so only claim it from none */
+			bool claimed = (0 != _pipelineGroupSize)
+					? claimSubAreaAction(&subAreaTable[i], SubAreaEntry::none, SubAreaEntry::evacuating)
+					: changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::evacuating);
+			if (claimed) {
 				evacuateSubArea(env, region, subAreaTable, i, objectCount, byteCount, skippedObjectCount);
+				if (0 != _pipelineGroupSize) {
+					/* publish the moved objects and forwarding information before the sub area is seen as evacuated */
+					MM_AtomicOperations::storeSync();
+					subAreaTable[i].evacuated = 1;
+					MM_AtomicOperations::subtract(&_subAreasPendingEvacuation, 1);
+				}
 			}
 		}
         /* Number of regions in regionTable, including
@@ -889,7 +1043,10 @@ MM_CompactScheme::evacuateSubArea(MM_EnvironmentStandard *env, MM_HeapRegionDesc
 	omrobjectptr_t objectPtr = firstObject;
 	MM_MemorySubSpace *subspace = subAreaRegion->getSubSpace();
 
-    intptr_t j = -1;
+	/* When move and fixup are pipelined, objects are only evacuated into earlier sub areas of the same group,
+	 * so a group is settled as soon as all of its own sub areas are evacuated.
+	 */
+	intptr_t j = (0 != _pipelineGroupSize) ? (i - (i % (intptr_t)_pipelineGroupSize) - 1) : -1;
     do {
     	freeChunk = 0;
         for (j++; j < i; j++) { // keeps searching from the prev. value to prevent inf loop
@@ -1286,6 +1443,15 @@ MM_CompactScheme::getForwardingPtr(omrobjectptr_t objectPtr) const
 		return objectPtr;
 	}
 
+	if (0 != _pipelineGroupSize) {
+		if (0 != _subAreasPendingEvacuation) {
+			waitForSubAreaEvacuated(objectPtr);
+		} else {
+			/* pairs with the storeSync() before the last sub area was marked evacuated */
+			MM_AtomicOperations::loadSync();
+		}
+	}
+
 	intptr_t index = pageIndex(objectPtr);
 	omrobjectptr_t forwardingPtr = _compactTable[index].getAddr();
 	if (forwardingPtr == 0) {
@@ -1366,6 +1532,98 @@ MM_CompactScheme::fixupObjects(MM_EnvironmentStandard *env, uintptr_t& objectCou
 	}
 }
 
+void
+MM_CompactScheme::fixupObjectsPipelined(MM_EnvironmentStandard *env, uintptr_t& objectCount, uintptr_t& overlappedCount)
+{
+	MM_HeapRegionManager *regionManager = _heap->getHeapRegionManager();
+	bool pending = false;
+
+	do {
+		GC_HeapRegionIteratorStandard regionIterator(regionManager);
+		MM_HeapRegionDescriptorStandard *region = NULL;
+		SubAreaEntry *subAreaTable = _subAreaTable;
+		pending = false;
+
+		while (NULL != (region = regionIterator.nextRegion())) {
+			if (!region->isCommitted() || (0 == region->getSize())) {
+				continue;
+			}
+			intptr_t i;
+			for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
+				if (SubAreaEntry::fixing_up == subAreaTable[i].currentAction) {
+					/* already claimed */
+					continue;
+				}
+				if (!isSubAreaGroupEvacuated(subAreaTable, i)) {
+					/* objects may still be moving into this group - come back to it */
+					pending = true;
+					continue;
+				}
+				if (claimSubAreaAction(&subAreaTable[i], SubAreaEntry::evacuating, SubAreaEntry::fixing_up)) {
+					if (0 != _subAreasPendingEvacuation) {
+						overlappedCount += 1;
+					}
+					fixupSubArea(env, subAreaTable[i].firstObject, subAreaTable[i+1].firstObject, subAreaTable[i].state == SubAreaEntry::fixup_only, objectCount);
+				}
+			}
+			/* Number of regions in regionTable, including
+			 * the end_segment region, is i+1 */
+			subAreaTable += (i+1);
+		}
+
+		if (pending) {
+			omrthread_yield();
+		}
+	} while (pending);
+}
+
+bool
+MM_CompactScheme::isSubAreaGroupEvacuated(SubAreaEntry *subAreaTable, intptr_t i) const
+{
+	intptr_t groupStart = i - (i % (intptr_t)_pipelineGroupSize);
+	intptr_t groupEnd = groupStart + (intptr_t)_pipelineGroupSize;
+
+	for (intptr_t j = groupStart; (j < groupEnd) && (SubAreaEntry::end_segment != subAreaTable[j].state); j++) {
+		if (0 == subAreaTable[j].evacuated) {
+			return false;
+		}
+	}
+	/* pairs with the storeSync() before each evacuated flag is set */
+	MM_AtomicOperations::loadSync();
+	return true;
+}
+
+uintptr_t
+MM_CompactScheme::findSubArea(void *address) const
+{
+	uintptr_t low = 0;
+	uintptr_t high = _subAreaCount;
+	while ((high - low) > 1) {
+		uintptr_t middle = low + ((high - low) / 2);
+		if ((void *)_subAreaTable[middle].firstObject <= address) {
+			low = middle;
+		} else {
+			high = middle;
+		}
+	}
+	return low;
+}
+
+void
+MM_CompactScheme::waitForSubAreaEvacuated(omrobjectptr_t objectPtr) const
+{
+	SubAreaEntry *entry = &_subAreaTable[findSubArea(objectPtr)];
+	if (SubAreaEntry::end_segment != entry->state) {
+		/* Every sub area has been claimed for evacuation by the time any thread fixes up, and evacuation
+		 * never waits, so this terminates.
+		 */
+		while (0 == entry->evacuated) {
+			omrthread_yield();
+		}
+		MM_AtomicOperations::loadSync();
+	}
+}
+
 void
 MM_CompactScheme::fixupObjectSlot(GC_SlotObject* slotObject)
 {
@@ -1417,7 +1675,7 @@ MM_CompactScheme::rebuildMarkbits(MM_EnvironmentStandard *env)
 		intptr_t i;
         for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
         	/* We only have to rebuild the markbits for sub areas which contain moved objects */
-        	if (subAreaTable->state != SubAreaEntry::fixup_only) {
+        	if (subAreaTable[i].state != SubAreaEntry::fixup_only) {
 	        	if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::rebuilding_mark_bits)) {
 	        		rebuildMarkbitsInSubArea(env, region, subAreaTable, i);
 				}
@@ -1514,6 +1772,12 @@ MM_CompactScheme::parallelFixHeapForWalk(MM_EnvironmentBase *env)
 	}
 }
 
+bool
+MM_CompactScheme::claimSubAreaAction(SubAreaEntry *entry, uintptr_t expectedAction, uintptr_t newAction)
+{
+	return expectedAction == MM_AtomicOperations::lockCompareExchange(&entry->currentAction, expectedAction, newAction);
+}
+
 bool
 MM_CompactScheme::changeSubAreaAction(MM_EnvironmentBase *env, SubAreaEntry * entry, uintptr_t newAction)
 {
@@ -92,6 +92,8 @@ private:
 		omrobjectptr_t freeChunk;
 		volatile uintptr_t state;
 		volatile uintptr_t currentAction; /**< record the status of the subarea for parallelization */
+		volatile uintptr_t evacuated; /**< non-zero once all objects of the subarea have been moved and their forwarding information saved (pipelined compaction only) */
+		uintptr_t freeBytes; /**< bytes on the old space free lists within the subarea when compaction started (window compaction only) */
         
 		/* legal values for currentAction */
 		enum {
@@ -137,6 +139,11 @@ protected:
 	SubAreaEntry           *_subAreaTable;  /**< Reference to the subAreaTable which is shared data from the SweepHeapSectioning */
 	omrobjectptr_t         _compactFrom;
 	omrobjectptr_t         _compactTo;
+	uintptr_t              _subAreaCount; /**< Number of entries in the subAreaTable after null sub areas are removed */
+	uintptr_t              _pipelineGroupSize; /**< Number of sub areas per independently compacted group, or 0 if move and fixup are not pipelined */
+	volatile uintptr_t     _subAreasPendingEvacuation; /**< Number of sub areas not yet evacuated (pipelined compaction only) */
+	uintptr_t              _compactWindowSize; /**< Maximum span of the sub areas evacuated this cycle, or 0 if the whole heap is compacted */
+	uintptr_t              _subAreaSize; /**< Size of the sub areas the heap was divided into this cycle, before empty ones were merged away */
 	MM_CompactDelegate     _delegate;
 
 public:
@@ -218,6 +225,66 @@ protected:
 	void fixupSubArea(MM_EnvironmentStandard *env, omrobjectptr_t firstObject, omrobjectptr_t finish,  bool markedOnly, uintptr_t& objectCount);
 	void fixupObjects(MM_EnvironmentStandard *env, uintptr_t& objectCount);
 
+	/**
+	 * Fix up all references in the heap while other threads may still be moving objects. A subArea is
+	 * only fixed up once every subArea of its group has been evacuated, so its contents are final; slots
+	 * referring to objects that have not been moved yet wait in getForwardingPtr().
+	 * Must only be called once the calling thread has finished moveObjects().
+	 *
+	 * @param env[in] the current thread
+	 * @param[in/out] objectCount the number of objects fixed up (accumulated)
+	 * @param[in/out] overlappedCount the number of subAreas fixed up while evacuation was still in progress (accumulated)
+	 */
+	void fixupObjectsPipelined(MM_EnvironmentStandard *env, uintptr_t& objectCount, uintptr_t& overlappedCount);
+
+	/**
+	 * Determine whether every subArea in the pipeline group containing subArea i has been evacuated.
+	 *
+	 * @param[in] subAreaTable the subAreas of the region containing subArea i
+	 * @param[in] i The subArea index
+	 * @return true if no more objects will be moved into or out of the group
+	 */
+	bool isSubAreaGroupEvacuated(SubAreaEntry *subAreaTable, intptr_t i) const;
+
+	/**
+	 * Wait until the subArea containing objectPtr has been evacuated, so its forwarding information is complete.
+	 *
+	 * @param[in] objectPtr an object within [_compactFrom, _compactTo)
+	 */
+	void waitForSubAreaEvacuated(omrobjectptr_t objectPtr) const;
+
+	/**
+	 * Find the subArea containing the specified address.
+	 *
+	 * @param[in] address an address within the heap
+	 * @return the index of the last subArea starting at or below address
+	 */
+	uintptr_t findSubArea(void *address) const;
+
+	/**
+	 * Restrict evacuation to the contiguous run of subAreas, spanning at most _compactWindowSize bytes
+	 * (but always at least one subArea), that holds the most fragmented free memory according to the
+	 * old space free lists built by the preceding sweep. Only free entries too small for a maximum size
+	 * TLH count as fragmented. A subArea that absorbed empty subAreas following it counts as _subAreaSize
+	 * bytes, since that bounds the objects it holds.
+	 * All other subAreas become fixup_only: their objects stay in place and only their slots are updated.
+	 * Must be called single threaded once null subAreas have been removed.
+	 *
+	 * @param env[in] the current thread
+	 */
+	void selectCompactWindow(MM_EnvironmentStandard *env);
+
+	/**
+	 * @param[in] i index of a subArea that is not an end_segment
+	 * @return the bytes subArea i contributes to a compaction window
+	 */
+	MMINLINE uintptr_t
+	subAreaWindowBytes(uintptr_t i) const
+	{
+		uintptr_t extent = (uintptr_t)_subAreaTable[i + 1].firstObject - (uintptr_t)_subAreaTable[i].firstObject;
+		return OMR_MIN(extent, _subAreaSize);
+	}
+
 	void rebuildFreelist(MM_EnvironmentStandard *env);
 
 	void addFreeEntry(MM_EnvironmentStandard *env,
@@ -302,6 +369,19 @@ protected:
 	 * @return true if the action was changed, or false if another thread already changed it to newAction
 	 */
 	bool changeSubAreaAction(MM_EnvironmentBase *env, SubAreaEntry * entry, uintptr_t newAction);
+
+	/**
+	 * Atomically move a subArea from one specific action to another. Unlike changeSubAreaAction(),
+	 * this fails if the subArea has already moved past expectedAction, which pipelined compaction
+	 * needs because its move and fixup phases run at the same time.
+	 *
+	 * @param entry[in] the subArea to change
+	 * @param expectedAction the action the subArea must currently have
+	 * @param newAction the desired action for the subArea
+	 *
+	 * @return true if this call changed the action
+	 */
+	bool claimSubAreaAction(SubAreaEntry *entry, uintptr_t expectedAction, uintptr_t newAction);
 public:
 	static MM_CompactScheme *newInstance(MM_EnvironmentBase *env, MM_MarkingScheme *markingScheme);
 	
@@ -335,6 +415,11 @@ public:
 		, _markMap(markingScheme->getMarkMap())
 		, _subAreaTableSize(0)
 		, _subAreaTable(NULL)
+		, _subAreaCount(0)
+		, _pipelineGroupSize(0)
+		, _subAreasPendingEvacuation(0)
+		, _compactWindowSize(0)
+		, _subAreaSize(0)
 		, _delegate()
 	{
 		_typeId = __FUNCTION__;
@@ -485,6 +485,8 @@ MM_ConcurrentCardTable::initialize(MM_EnvironmentBase *env, MM_Heap *heap)
 		/* Set default card cleaning masks used by getNextDirtycard */
 		_concurrentCardCleanMask = CONCURRENT_CARD_CLEAN_MASK;
 		_finalCardCleanMask = FINAL_CARD_CLEAN_MASK;
+
+		_findDirtyCard = MM_CardScanKernel::getFunction(MM_ScanKernel::select(env, _extensions->simdCardScan));
 	
 		/* How many of the card clean phases do we need to perform ?
 		 *
@@ -1030,7 +1032,9 @@ MM_ConcurrentCardTable::initializeFinalCardCleaning(MM_EnvironmentBase *env)
  *
  * To be called by a STW parallel mark task to clean enough cards such that we
  * push a packet worth of references.  Loops calling getNextDirtyCard() until
- * we have pushed enough references or end of card table reached.
+ * we have pushed enough references or end of card table reached. Each call
+ * claims a batch of -Xgc:finalCardCleanBatchSize cards, all of which are
+ * cleaned before the push limit is checked.
  *
  * @param bytesTraced  - reference to counter to pass back count of bytes traced
  * 						 to caller
@@ -1044,6 +1048,7 @@ MM_ConcurrentCardTable::finalCleanCards(MM_EnvironmentBase *env, uintptr_t *byte
 {
 	uintptr_t traceCount = 0;
 	Card * nextDirtyCard;
+	Card *batchTop = NULL;
 	omrobjectptr_t objectPtr;
 	uintptr_t cards = 0;
 	bool phase2 = false;
@@ -1056,36 +1061,44 @@ MM_ConcurrentCardTable::finalCleanCards(MM_EnvironmentBase *env, uintptr_t *byte
 
 	MM_MarkMap *markMap = _markingScheme->getMarkMap();
 	
+	/* Claim a batch of cards at a time so threads contend on the cleaning range once per batch rather than once per card */
 	for ( ;
-		(nextDirtyCard= getNextDirtyCard(env, _finalCardCleanMask, false)) != NULL;
+		(nextDirtyCard= getNextDirtyCard(env, _finalCardCleanMask, false, _extensions->finalCardCleanBatchSize, &batchTop)) != NULL;
 		) {
 
 		/* Should never get EXCLUSIVE_VMACCESS_REQUESTED in final clean cards phase */
 		assume0(nextDirtyCard != (Card *)EXCLUSIVE_VMACCESS_REQUESTED);
 
-		/* Reset counters if we are now cleaning phase 2 cards */
-		if(!phase2 && nextDirtyCard >= _firstCardInPhase2) {
-			incFinalCleanedCards(cards, phase2);
-			cards = 0;
-			phase2 = true;
-		}
+		/* The batch is ours alone, so clean every dirty card in it before checking the push limit */
+		for (Card *card = nextDirtyCard;
+			card < batchTop;
+			card = MM_CardScanKernel::findDirtyCard(_findDirtyCard, card + 1, batchTop, _finalCardCleanMask)
+			) {
+
+			/* Reset counters if we are now cleaning phase 2 cards */
+			if(!phase2 && card >= _firstCardInPhase2) {
+				incFinalCleanedCards(cards, phase2);
+				cards = 0;
+				phase2 = true;
+			}
 
-		/* Clean the card before we trace into it */
-		finalCleanCard(nextDirtyCard);
-		cards += 1;
+			/* Clean the card before we trace into it */
+			finalCleanCard(card);
+			cards += 1;
 
-		/* Calculate address of first slot heap for the card to be cleaned... */
-		uintptr_t *heapBase = (uintptr_t *)cardAddrToHeapAddr(env,nextDirtyCard);
-		/* ..and address of last slot N.B Range is EXCLUSIVE */
-		uintptr_t *heapTop = (uintptr_t *)((uint8_t *)heapBase + CARD_SIZE);
+			/* Calculate address of first slot heap for the card to be cleaned... */
+			uintptr_t *heapBase = (uintptr_t *)cardAddrToHeapAddr(env,card);
+			/* ..and address of last slot N.B Range is EXCLUSIVE */
+			uintptr_t *heapTop = (uintptr_t *)((uint8_t *)heapBase + CARD_SIZE);
 
-		/* prevent loading mark bits prematurely */
-		MM_AtomicOperations::readBarrier();
+			/* prevent loading mark bits prematurely */
+			MM_AtomicOperations::readBarrier();
 
-		/* Then iterate over all marked objects in the heap between the two addresses */
-		MM_HeapMapIterator markedObjectIterator(_extensions, markMap, heapBase, heapTop);
-		while (NULL != (objectPtr = markedObjectIterator.nextObject())) {
-			traceCount += _markingScheme->scanObject(env, objectPtr, SCAN_REASON_DIRTY_CARD);
+			/* Then iterate over all marked objects in the heap between the two addresses */
+			MM_HeapMapIterator markedObjectIterator(_extensions, markMap, heapBase, heapTop);
+			while (NULL != (objectPtr = markedObjectIterator.nextObject())) {
+				traceCount += _markingScheme->scanObject(env, objectPtr, SCAN_REASON_DIRTY_CARD);
+			}
 		}
 
 		/* Have we pushed enough new refs ?*/
@@ -1595,13 +1608,17 @@ MM_ConcurrentCardTable::resetCleaningRanges(MM_EnvironmentBase *env)
  *
  * @param cardMask - mask to apply to cards to identify those cards the caller
  * 					 is interested in
+ * @param batchSize - number of cards, starting at the dirty card found, to claim
+ * 					 for the caller
+ * @param batchTop - if not NULL, returns the card after the last card claimed. The
+ * 					 caller must process every card of interest in the claimed batch
  *
  * @return Routine either returns address of next dirty card, NULL if no
  * more dirty cards, EXCLUSIVE_VMACCESS_REQUESTED if another thread waiting
  * for exclusive VM access.
  */
 Card*
-MM_ConcurrentCardTable::getNextDirtyCard(MM_EnvironmentBase *env, Card cardMask, bool concurrentCardClean)
+MM_ConcurrentCardTable::getNextDirtyCard(MM_EnvironmentBase *env, Card cardMask, bool concurrentCardClean, uintptr_t batchSize, Card **batchTop)
 {
 	/* Get a local copy of next current range being cleaned */
 	CleaningRange *currentRange = (CleaningRange *)_currentCleaningRange;
@@ -1623,49 +1640,16 @@ MM_ConcurrentCardTable::getNextDirtyCard(MM_EnvironmentBase *env, Card cardMask,
 		/* CMVC 132231 - cache _lastCardInPhase since it's volatile and min reads its arguments twice */
 		Card *lastCardInPhase = _lastCardInPhase;
 		Card *lastCardToClean = OMR_MIN(lastCardInPhase, currentRange->topCard);
-		Card *nextDirtyCard, *currentCard;
-
-		for (currentCard = firstCard; currentCard < lastCardToClean; currentCard++) {
-
-			/* Are we are on an uintptr_t boundary? If so scan the card table a uintptr_t
-	 		 * at a time until we find a slot which is non-zero or the end of card table
-	 		 * found. This is based on the premise that the card table will be mostly
-	 		 * empty and scanning an uintptr_t at a time will reduce the time taken to
-	 		 * scan the card table.
-	 		 */
-			if (((Card)CARD_CLEAN == *currentCard) && (0 == (uintptr_t)currentCard % sizeof(uintptr_t))) {
-				uintptr_t *nextSlot = (uintptr_t *)currentCard;
-				/* Last card may be in middle of a slot so only scan up to an including last
-				 * complete slots worth of cards; then go card at a time
-				 **/
-				uintptr_t *lastSlot = (uintptr_t *)MM_Math::roundToFloor(sizeof(uintptr_t), (uintptr_t)lastCardToClean);
-				while ((nextSlot < lastSlot) && (SLOT_ALL_CLEAN == *nextSlot)) {
-					nextSlot += 1;
-				}
-				/*
-			     * Either end of scan or a slot which contains a dirty card found. Reset scan ptr
-				 */
-				currentCard = (Card *)nextSlot;
 
-				if (currentCard >= lastCardToClean) {
-					break;
-				}
-			}
+		/* The card table will be mostly clean so skip clean runs many cards at a time */
+		Card *currentCard = MM_CardScanKernel::findDirtyCard(_findDirtyCard, firstCard, lastCardToClean, cardMask);
 
-			/* Have we found a card of interest yet ? */
-			if (0 == (*currentCard & cardMask)) {
-				/* No..so get next card. */
-				continue;
-			}
+		if (currentCard < lastCardToClean) {
+			/* Found a card of interest. Check to see if another thread got to it before us */
+			if (firstCard == (Card *)currentRange->nextCard) {
+				Card *nextDirtyCard = currentCard;
+				Card *claimTop = ((uintptr_t)(lastCardToClean - currentCard) > batchSize) ? (currentCard + batchSize) : lastCardToClean;
 
-			/* Yes..so check to see if another thread got to next dirty card before us ? */
-			if (firstCard != (Card *)currentRange->nextCard) {
-				/* Yes..so re-sync with race winner and start scan again */
-				break;
-			} else {
-				/* No .. so attempt to grab this card*/
-				nextDirtyCard = currentCard;
-				currentCard += 1;
 				if (concurrentCardClean && env->isExclusiveAccessRequestWaiting()) {
 					return (Card *)EXCLUSIVE_VMACCESS_REQUESTED;
 				}
@@ -1673,24 +1657,18 @@ MM_ConcurrentCardTable::getNextDirtyCard(MM_EnvironmentBase *env, Card cardMask,
 				/* Update next card to clean for next caller of getNextDirtyCard. If we fail
 				 * then someone beat us to it so re-sync with race winner and start again
 				 */
-				if (firstCard != (Card *)MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&currentRange->nextCard,
-											  							  (uintptr_t)firstCard,
-											  							  (uintptr_t)currentCard)) {
-					break;
+				if (firstCard == (Card *)MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&currentRange->nextCard,
+																		  (uintptr_t)firstCard,
+																		  (uintptr_t)claimTop)) {
+					if (NULL != batchTop) {
+						*batchTop = claimTop;
+					}
+					return nextDirtyCard;
 				}
-				
-				return nextDirtyCard;
 			}
-		} /* of currentCard < lastCardToClean */
 
-		/* We get here if we break out of FOR loop when another thread beat us to next
-		 * dirty card or we reach then end of the card table.
-		 *
-		 * Did we reach end of card table segment ?
-		 */
-		if (currentCard < lastCardToClean) {
-			/* No..so someone must have beat us to next dirty card. In which case we need
-			 * to restart scan. First though make sure no thread is waiting for exclusive access.
+			/* Someone beat us to next dirty card so we need to restart scan. First though make
+			 * sure no thread is waiting for exclusive access.
 			 */
 			if (concurrentCardClean && env->isExclusiveAccessRequestWaiting()) {
 				return (Card *)EXCLUSIVE_VMACCESS_REQUESTED;
@@ -1714,10 +1692,7 @@ MM_ConcurrentCardTable::getNextDirtyCard(MM_EnvironmentBase *env, Card cardMask,
 			 * cards in next phase we start at last card in this phase. If we fail then
 			 * another thread beat us to it
 			 */
-			if (firstCard != (Card *)MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&currentRange->nextCard,
-										  							  (uintptr_t)firstCard,
-										  							  (uintptr_t)currentCard)) {
-			}
+			MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&currentRange->nextCard, (uintptr_t)firstCard, (uintptr_t)currentCard);
 			return NULL;
 		}
 	}
@@ -27,6 +27,7 @@
 #include "omrcfg.h"
 
 #include "CardTable.hpp"
+#include "CardScanKernel.hpp"
 #include "ConcurrentCardTableStats.hpp"
 #include "Debug.hpp"
 #include "EnvironmentStandard.hpp"
@@ -174,6 +175,8 @@ protected:
 	Card *_firstCardInPhase;
 	Card * volatile _lastCardInPhase;
 	Card *_firstCardInPhase2;
+
+	MM_CardScanKernel::FindDirtyCard _findDirtyCard; /**< Skips runs of clean cards (vectorized where the processor allows) */
 public:
 	
 	/*
@@ -230,7 +233,7 @@ protected:
 	bool initialize(MM_EnvironmentBase *env, MM_Heap *heap);
 	
 	bool cleanSingleCard(MM_EnvironmentBase *env, Card *card, uintptr_t bytesToClean, uintptr_t *totalBytesCleaned);
-	Card* getNextDirtyCard(MM_EnvironmentBase *env, Card cardMask, bool concurrentCardClean);
+	Card* getNextDirtyCard(MM_EnvironmentBase *env, Card cardMask, bool concurrentCardClean, uintptr_t batchSize = 1, Card **batchTop = NULL);
 	
 	bool cardHasMarkedObjects(MM_EnvironmentBase *env, Card *card);
 	
@@ -490,7 +493,8 @@ public:
 		_lastCard(NULL),
 		_firstCardInPhase(NULL),
 		_lastCardInPhase(NULL),
-		_firstCardInPhase2(NULL)
+		_firstCardInPhase2(NULL),
+		_findDirtyCard(MM_CardScanKernel::findDirtyCardScalar)
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -85,6 +85,9 @@ MM_ConfigurationStandard::initialize(MM_EnvironmentBase* env)
 	MM_GCExtensionsBase* extensions = env->getExtensions();
 	bool result = MM_Configuration::initialize(env);
 	if (result) {
+		/* The segregated collector options have no meaning here, and the pre-write barrier assumes a segregated collector when they are set */
+		extensions->incrementalSegregatedGC = false;
+		extensions->deferredSegregatedSweep = false;
 		extensions->payAllocationTax = extensions->isConcurrentMarkEnabled() || extensions->isConcurrentSweepEnabled();
 		extensions->setStandardGC(true);
 	}
@@ -139,6 +142,26 @@ MM_ConfigurationStandard::createHeapWithManager(MM_EnvironmentBase* env, uintptr
 	return MM_HeapVirtualMemory::newInstance(env, env->getExtensions()->heapAlignment, heapBytesRequested, regionManager);
 }
 
+/**
+ * Create a non-split address ordered list memory pool, with size class bins if -Xgc:freeListSizeClassBins was specified.
+ *
+ * @return the memoryPool, or NULL on failure
+ */
+MM_MemoryPoolAddressOrderedList*
+MM_ConfigurationStandard::createAddressOrderedListMemoryPool(MM_EnvironmentBase* env, uintptr_t minimumFreeEntrySize, const char* name)
+{
+	MM_MemoryPoolAddressOrderedList* memoryPool = MM_MemoryPoolAddressOrderedList::newInstance(env, minimumFreeEntrySize, name);
+
+	if ((NULL != memoryPool) && env->getExtensions()->freeListSizeClassBins) {
+		if (!memoryPool->enableSizeClassBins(env)) {
+			memoryPool->kill(env);
+			memoryPool = NULL;
+		}
+	}
+
+	return memoryPool;
+}
+
 /**
  * Create the type of memorypool that corresponds to this Standard configuration.
  * In a generational mode this corresponds to the "old" area.
@@ -200,14 +223,14 @@ MM_ConfigurationStandard::createMemoryPool(MM_EnvironmentBase* env, bool appendC
 		if (doSplit) {
 			memoryPoolSmallObjects = MM_MemoryPoolSplitAddressOrderedList::newInstance(env, minimumFreeEntrySize, extensions->splitFreeListSplitAmount, "SOA");
 		} else {
-			memoryPoolSmallObjects = MM_MemoryPoolAddressOrderedList::newInstance(env, minimumFreeEntrySize, "SOA");
+			memoryPoolSmallObjects = createAddressOrderedListMemoryPool(env, minimumFreeEntrySize, "SOA");
 		}
 
 		if (NULL == memoryPoolSmallObjects) {
 			return NULL;
 		}
 
-		memoryPoolLargeObjects = MM_MemoryPoolAddressOrderedList::newInstance(env, extensions->largeObjectMinimumSize, "LOA");
+		memoryPoolLargeObjects = createAddressOrderedListMemoryPool(env, extensions->largeObjectMinimumSize, "LOA");
 		if (NULL == memoryPoolLargeObjects) {
 			memoryPoolSmallObjects->kill(env);
 			return NULL;
@@ -232,7 +255,7 @@ MM_ConfigurationStandard::createMemoryPool(MM_EnvironmentBase* env, bool appendC
 		if (doSplit) {
 			memoryPool = MM_MemoryPoolSplitAddressOrderedList::newInstance(env, minimumFreeEntrySize, extensions->splitFreeListSplitAmount, "Tenure");
 		} else {
-			memoryPool = MM_MemoryPoolAddressOrderedList::newInstance(env, minimumFreeEntrySize, "Tenure");
+			memoryPool = createAddressOrderedListMemoryPool(env, minimumFreeEntrySize, "Tenure");
 		}
 
 		if (NULL == memoryPool) {
@@ -38,6 +38,7 @@
 class MM_GlobalCollector;
 class MM_Heap;
 class MM_MemoryPool;
+class MM_MemoryPoolAddressOrderedList;
 
 class MM_ConfigurationStandard : public MM_Configuration {
 	/* Data members / Types */
@@ -47,6 +48,7 @@ protected:
 	 * @param appendCollectorLargeAllocateStats - if true, configure the pool to append Collector allocates to Mutator allocates (default is to gather only Mutator)
 	 */
 	virtual MM_MemoryPool* createMemoryPool(MM_EnvironmentBase* env, bool appendCollectorLargeAllocateStats);
+	MM_MemoryPoolAddressOrderedList* createAddressOrderedListMemoryPool(MM_EnvironmentBase* env, uintptr_t minimumFreeEntrySize, const char* name);
 	virtual void tearDown(MM_EnvironmentBase* env);
 
 	bool createSweepPoolManagerAddressOrderedList(MM_EnvironmentBase* env);
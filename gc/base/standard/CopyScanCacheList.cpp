@@ -41,7 +41,13 @@ MM_CopyScanCacheList::initialize(MM_EnvironmentBase *env, volatile uintptr_t *ca
 	MM_GCExtensionsBase *extensions = env->getExtensions();
 	bool result = true;
 	
-	_sublistCount = extensions->cacheListSplit;
+	/* with NUMA-aware copy, each node gets its own group of cacheListSplit sublists */
+	_nodeCount = 1;
+	if (extensions->scavengerNumaAwareCopy && (1 < extensions->_numaManager.getAffinityLeaderCount())) {
+		_nodeCount = extensions->_numaManager.getAffinityLeaderCount();
+	}
+	_sublistsPerNode = extensions->cacheListSplit;
+	_sublistCount = _sublistsPerNode * _nodeCount;
 	Assert_MM_true(0 < _sublistCount);
 
 	_sublists = (CopyScanCacheSublist *)extensions->getForge()->allocate(
@@ -71,7 +77,8 @@ MM_CopyScanCacheList::reinitializeForRestore(MM_EnvironmentBase *env)
 	MM_GCExtensionsBase *extensions = env->getExtensions();
 	bool result = true;
 
-	uintptr_t newSublistCount = extensions->cacheListSplit;
+	uintptr_t newSublistsPerNode = extensions->cacheListSplit;
+	uintptr_t newSublistCount = newSublistsPerNode * _nodeCount;
 	Assert_MM_true(0 < newSublistCount);
 
 	if (newSublistCount > _sublistCount) {
@@ -98,10 +105,11 @@ MM_CopyScanCacheList::reinitializeForRestore(MM_EnvironmentBase *env)
 				extensions->getForge()->free(_sublists);
 				_sublists = newSublists;
 				_sublistCount = newSublistCount;
+				_sublistsPerNode = newSublistsPerNode;
 			}
 		}
 	} else {
-		Assert_MM_true(extensions->cacheListSplit == _sublistCount);
+		Assert_MM_true(newSublistCount == _sublistCount);
 	}
 
 	return result;
@@ -362,10 +370,14 @@ MM_CopyScanCacheList::pushCache(MM_EnvironmentBase *env, MM_CopyScanCacheStandar
 MM_CopyScanCacheStandard *
 MM_CopyScanCacheList::popCache(MM_EnvironmentBase *env)
 {
-	uintptr_t index = getSublistIndex(env);
+	uintptr_t startIndex = getSublistIndex(env);
+	uintptr_t startNode = startIndex / _sublistsPerNode;
 	MM_CopyScanCacheStandard *cache = NULL;
 
+	/* search the sublists of the local node first, then those of the other nodes */
 	for (uintptr_t i = 0; i < _sublistCount; i++) {
+		uintptr_t node = (startNode + (i / _sublistsPerNode)) % _nodeCount;
+		uintptr_t index = (node * _sublistsPerNode) + ((startIndex + i) % _sublistsPerNode);
 		MM_CopyScanCacheList::CopyScanCacheSublist *list = &_sublists[index];
 
 		if (NULL != list->_cacheHead) {
@@ -386,8 +398,6 @@ MM_CopyScanCacheList::popCache(MM_EnvironmentBase *env)
 				break;
 			}
 		}
-
-		index = (index + 1) % _sublistCount;
 	}
 
 	return cache;
@@ -75,6 +75,8 @@ private:
 	
 	CopyScanCacheSublist *_sublists;	/**< An array of CopyScanCacheSublist structures which is _sublistCount elements long */
 	uintptr_t _sublistCount; /**< the number of lists (split for parallelism). Must be at least 1 */
+	uintptr_t _nodeCount; /**< the number of NUMA node groups the sublists are partitioned into (1 unless NUMA-aware copy is enabled) */
+	uintptr_t _sublistsPerNode; /**< the number of consecutive sublists in each node group (_sublistCount / _nodeCount) */
 	
 	MM_CopyScanCacheChunk *_chunkHead; 
 	uintptr_t _incrementEntryCount;
@@ -93,7 +95,8 @@ private:
 
 	/**
 	 * Hash the specified environment to determine what sublist index
-	 * it should use
+	 * it should use. The sublist is picked within the group of the thread's
+	 * NUMA node, so caches released by a thread are preferentially reused on the same node.
 	 * 
 	 * @param env the current environment
 	 * 
@@ -101,7 +104,8 @@ private:
 	 */
 	uintptr_t getSublistIndex(MM_EnvironmentBase *env)
 	{
-		return env->getEnvironmentId() % _sublistCount;
+		uintptr_t nodeIndex = MM_EnvironmentStandard::getEnvironment(env)->_survivorNodeSliceIndex % _nodeCount;
+		return (nodeIndex * _sublistsPerNode) + (env->getEnvironmentId() % _sublistsPerNode);
 	}
 	
 	/**
@@ -213,6 +217,8 @@ public:
 		, _allocationInHeap(false)
 		, _sublists(NULL)
 		, _sublistCount(0)
+		, _nodeCount(1)
+		, _sublistsPerNode(0)
 		, _chunkHead(NULL)
 		, _incrementEntryCount(0)
 		, _totalAllocatedEntryCount(0)
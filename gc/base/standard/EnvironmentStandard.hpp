@@ -66,6 +66,9 @@ public:
 	bool _loaAllocation;  /** true, if tenure TLH remainder is in LOA (TODO: try preventing remainder creation in LOA) */
 	void *_survivorTLHRemainderBase; /**< base and top pointers of the last unused survivor TLH copy cache, that might be reused  on next copy refresh */
 	void *_survivorTLHRemainderTop;
+	uintptr_t _survivorNodeSliceIndex; /**< zero-based index of the per-NUMA-node survivor slice (and copy-scan cache sublist group) this thread prefers during scavenge */
+	bool _survivorNodeAffinityBound; /**< true if this thread was bound to the node of its survivor slice for the current scavenge, and is unbound when it ends */
+	uintptr_t _hotFieldSampleCountdown; /**< objects left to scan before this thread takes the next hot field sample, 0 if it is not sampling in this scavenge */
 
 protected:
 
@@ -98,6 +101,9 @@ public:
 		,_loaAllocation(false)
 		,_survivorTLHRemainderBase(NULL)
 		,_survivorTLHRemainderTop(NULL)
+		,_survivorNodeSliceIndex(0)
+		,_survivorNodeAffinityBound(false)
+		,_hotFieldSampleCountdown(0)
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -48,9 +48,12 @@ private:
 	MM_CompactScheme *_compactScheme;
 	bool _rebuildMarkBits;
 	bool _aggressive;
+	uintptr_t _recommendedThreads; /**< Collector recommended threads for the task (UDATA_MAX for no recommendation) */
 
 public:
 	virtual uintptr_t getVMStateID();
+
+	virtual uintptr_t getRecommendedWorkingThreads() { return _recommendedThreads; };
 	
 	virtual void run(MM_EnvironmentBase *env);
 	virtual void setup(MM_EnvironmentBase *env);
@@ -59,11 +62,12 @@ public:
 	/**
 	 * Create an ParallelCompactTask object.
 	 */
-	MM_ParallelCompactTask(MM_EnvironmentBase *env, MM_ParallelDispatcher *dispatcher, MM_CompactScheme *compactScheme, bool rebuildMarkBits, bool aggressive) :
+	MM_ParallelCompactTask(MM_EnvironmentBase *env, MM_ParallelDispatcher *dispatcher, MM_CompactScheme *compactScheme, bool rebuildMarkBits, bool aggressive, uintptr_t recommendedThreads = UDATA_MAX) :
 		MM_ParallelTask(env, dispatcher),
 		_compactScheme(compactScheme),
 		_rebuildMarkBits(rebuildMarkBits),
-		_aggressive(aggressive)
+		_aggressive(aggressive),
+		_recommendedThreads(recommendedThreads)
 	{
 		_typeId = __FUNCTION__;
 	};
@@ -30,6 +30,7 @@
 
 #include "AllocateDescription.hpp"
 #include "AllocationFailureStats.hpp"
+#include "BackgroundHeapReleaser.hpp"
 #include "CollectionStatisticsStandard.hpp"
 #include "CollectorLanguageInterface.hpp"
 #if defined(OMR_GC_MODRON_COMPACTION)
@@ -351,6 +352,16 @@ MM_ParallelGlobalGC::initialize(MM_EnvironmentBase *env)
 		goto error_no_memory;
 	}
 
+#if defined(LINUX)
+	/* Released pages must stay mapped and be committed again on touch, which decommit only guarantees on Linux */
+	if (_extensions->backgroundHeapRelease) {
+		_backgroundHeapReleaser = MM_BackgroundHeapReleaser::newInstance(env);
+		if (NULL == _backgroundHeapReleaser) {
+			goto error_no_memory;
+		}
+	}
+#endif /* defined(LINUX) */
+
 	/* Attach to hooks required by the global collector's
 	 * heap resize (expand/contraction) functions
 	 */
@@ -415,6 +426,11 @@ MM_ParallelGlobalGC::tearDown(MM_EnvironmentBase *env)
 		_heapWalker->kill(env);
 		_heapWalker = NULL;
 	}
+
+	if (NULL != _backgroundHeapReleaser) {
+		_backgroundHeapReleaser->kill(env);
+		_backgroundHeapReleaser = NULL;
+	}
 }
 
 uintptr_t
@@ -763,7 +779,7 @@ MM_ParallelGlobalGC::shouldCompactThisCycle(MM_EnvironmentBase *env, MM_Allocate
 		uintptr_t totalSize = memorySubSpace->getActiveMemorySize();
 		MM_MemoryPool *memoryPool= memorySubSpace->getMemoryPool();
 		uintptr_t darkMatterBytes = 0;
-		if (!_extensions->concurrentSweep) {
+		if (!_extensions->isConcurrentSweepEnabled()) {
 			darkMatterBytes = memoryPool->getDarkMatterBytes();
 		}
 		uintptr_t freeMemorySize = memoryPool->getActualFreeMemorySize();
@@ -993,11 +1009,13 @@ MM_ParallelGlobalGC::markAll(MM_EnvironmentBase *env, bool initMarkMap)
 		env->_cycleState->_referenceObjectOptions |= MM_CycleState::references_soft_as_weak;
 	}
 
-	/* run the mark */
-	MM_ParallelMarkTask markTask(env, _dispatcher, _markingScheme, initMarkMap, env->_cycleState);
+	/* run the mark, sized from the live data found by the previous mark */
+	uintptr_t recommendedThreads = _dispatcher->recommendThreadsForWork(env, _markedBytesLastCycle);
+	MM_ParallelMarkTask markTask(env, _dispatcher, _markingScheme, initMarkMap, env->_cycleState, MM_ParallelMarkTask::MARK_ALL, recommendedThreads);
 	_dispatcher->run(env, &markTask);
 	
 	Assert_MM_true(_markingScheme->getWorkPackets()->isAllPacketsEmpty());
+	_markedBytesLastCycle = markStats->_bytesScanned;
 
 	/* Do any post mark checks */
 	postMark(env);
@@ -1032,7 +1050,9 @@ MM_ParallelGlobalGC::mainThreadCompact(MM_EnvironmentBase *env, MM_AllocateDescr
 
 	reportCompactStart(env);
 	compactStats->_startTime = omrtime_hires_clock();
-	MM_ParallelCompactTask compactTask(env, _dispatcher, _compactScheme, rebuildMarkBits, env->_cycleState->_gcCode.shouldAggressivelyCompact());
+	/* compaction moves and fixes up the live data found by this cycle's mark */
+	uintptr_t recommendedThreads = _dispatcher->recommendThreadsForWork(env, _extensions->globalGCStats.markStats._bytesScanned);
+	MM_ParallelCompactTask compactTask(env, _dispatcher, _compactScheme, rebuildMarkBits, env->_cycleState->_gcCode.shouldAggressivelyCompact(), recommendedThreads);
 	_dispatcher->run(env, &compactTask);
 	compactStats->_endTime = omrtime_hires_clock();
 	reportCompactEnd(env);
@@ -1438,6 +1458,9 @@ MM_ParallelGlobalGC::collectorStartup(MM_GCExtensionsBase* extensions)
 		extensions->scavenger->collectorStartup(extensions);
 	}
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+	if (NULL != _backgroundHeapReleaser) {
+		return _backgroundHeapReleaser->startReleaserThread(extensions);
+	}
 	return true;
 }
 
@@ -1449,6 +1472,9 @@ MM_ParallelGlobalGC::collectorShutdown(MM_GCExtensionsBase *extensions)
 		extensions->scavenger->collectorShutdown(extensions);
 	}
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+	if ((NULL != _backgroundHeapReleaser) && _backgroundHeapReleaser->isStarted()) {
+		_backgroundHeapReleaser->shutdownReleaserThread(extensions);
+	}
 }
 
 /**
@@ -47,6 +47,7 @@ void healReferenceSlot(MM_EnvironmentBase *env, GC_SlotObject *slotObject);
 void healReferenceSlots(OMR_VMThread *omrVMThread, MM_HeapRegionDescriptor *region, omrobjectptr_t object, void *userData);
 #endif /* defined(OMR_ENV_DATA64) && defined(OMR_GC_FULL_POINTERS) */
 
+class MM_BackgroundHeapReleaser;
 class MM_CollectionStatisticsStandard;
 class MM_CompactScheme;
 class MM_ParallelDispatcher;
@@ -77,9 +78,11 @@ protected:
 	MM_ParallelSweepScheme *_sweepScheme;
 	MM_ParallelHeapWalker *_heapWalker;
 	MM_ParallelDispatcher *_dispatcher;
+	MM_BackgroundHeapReleaser *_backgroundHeapReleaser; /**< Releases long lived free tenure chunks with -Xgc:backgroundHeapRelease, NULL otherwise */
 	MM_CycleState _cycleState;  /**< Embedded cycle state to be used as the main cycle state for GC activity */
 	MM_CollectionStatisticsStandard _collectionStatistics; /** Common collect stats (memory, time etc.) */
 	bool _fixHeapForWalkCompleted;
+	uintptr_t _markedBytesLastCycle; /**< Bytes scanned by the last global mark, used to size the next mark task (UDATA_MAX before the first mark) */
 public:
 	
 /*
@@ -351,9 +354,11 @@ public:
 		, _sweepScheme(NULL)
 		, _heapWalker(NULL)
 		, _dispatcher(_extensions->dispatcher)
+		, _backgroundHeapReleaser(NULL)
 		, _cycleState()
 		, _collectionStatistics()
 		, _fixHeapForWalkCompleted(false)
+		, _markedBytesLastCycle(UDATA_MAX)
 	{
 		_typeId = __FUNCTION__;
 	}
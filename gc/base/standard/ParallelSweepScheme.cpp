@@ -61,6 +61,9 @@
 #define J9MODRON_OBM_SLOT_LAST_SLOT ((uintptr_t)0x80000000)
 #endif /* OMR_ENV_DATA64 */
 
+/* Sweep reads the mark map rather than the objects, so a heap byte swept costs a fraction of a byte scanned */
+#define J9MODRON_SWEEP_HEAP_BYTES_PER_WORK_BYTE 16
+
 /**
  * Run the sweep task.
  * Skeletal code to run the sweep task per work thread.  No actual work done.
@@ -194,6 +197,8 @@ MM_ParallelSweepScheme::initialize(MM_EnvironmentBase *env)
 	if (0 != omrthread_monitor_init_with_name(&_mutexSweepPoolState, 0, "SweepPoolState Monitor")) {
 		return false;
 	}
+
+	_findMarkedWord = MM_MarkMapScanKernel::getFunction(MM_ScanKernel::select(env, extensions->simdSweep));
 	
 	return true;
 }
@@ -341,14 +346,7 @@ MM_ParallelSweepScheme::sweepMarkMapBody(
 		markMapFreeHead = markMapCurrent;
 		heapSlotFreeHead = heapSlotFreeCurrent;
 
-		markMapCurrent += 1;
-
-		while(markMapCurrent < markMapChunkTop) {
-			if(*markMapCurrent != J9MODRON_OBM_SLOT_EMPTY) {
-				break;
-			}
-			markMapCurrent += 1;
-		}
+		markMapCurrent = MM_MarkMapScanKernel::findMarkedWord(_findMarkedWord, markMapCurrent + 1, markMapChunkTop);
 
 		/* Find the number of slots we've walked
 		 * (pointer math makes this the number of slots)
@@ -811,7 +809,8 @@ MM_ParallelSweepScheme::sweep(MM_EnvironmentBase *env)
 {
 	setupForSweep(env);
 	
-	MM_ParallelSweepTask sweepTask(env,_extensions->dispatcher, this);
+	uintptr_t recommendedThreads = _extensions->dispatcher->recommendThreadsForWork(env, _extensions->heap->getActiveMemorySize() / J9MODRON_SWEEP_HEAP_BYTES_PER_WORK_BYTE);
+	MM_ParallelSweepTask sweepTask(env,_extensions->dispatcher, this, recommendedThreads);
 	_extensions->dispatcher->run(env, &sweepTask);
 }
 
@@ -37,6 +37,7 @@
 
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
+#include "MarkMapScanKernel.hpp"
 #include "MemoryPool.hpp"
 #include "ParallelTask.hpp"
 
@@ -60,9 +61,12 @@ class MM_ParallelSweepTask : public MM_ParallelTask
 private:
 protected:
 	MM_ParallelSweepScheme *_sweepScheme;
+	uintptr_t _recommendedThreads; /**< Collector recommended threads for the task (UDATA_MAX for no recommendation) */
 
 public:
 	virtual uintptr_t getVMStateID() { return OMRVMSTATE_GC_SWEEP; };
+
+	virtual uintptr_t getRecommendedWorkingThreads() { return _recommendedThreads; };
 	
 	virtual void run(MM_EnvironmentBase *env);
 	virtual void setup(MM_EnvironmentBase *env);
@@ -77,9 +81,10 @@ public:
 	/**
 	 * Create a ParallelSweepTask object.
 	 */
-	MM_ParallelSweepTask(MM_EnvironmentBase *env, MM_ParallelDispatcher *dispatcher, MM_ParallelSweepScheme *sweepScheme) :
+	MM_ParallelSweepTask(MM_EnvironmentBase *env, MM_ParallelDispatcher *dispatcher, MM_ParallelSweepScheme *sweepScheme, uintptr_t recommendedThreads = UDATA_MAX) :
 		MM_ParallelTask(env, dispatcher),
-		_sweepScheme(sweepScheme)
+		_sweepScheme(sweepScheme),
+		_recommendedThreads(recommendedThreads)
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -105,6 +110,8 @@ protected:
 
 	void *_heapBase;
 
+	MM_MarkMapScanKernel::FindMarkedWord _findMarkedWord; /**< Skips runs of empty mark map words (vectorized where the processor allows) */
+
 	MM_SweepHeapSectioning *_sweepHeapSectioning;	/**< pointer to Sweep Heap Sectioning */
 
 	J9Pool *_poolSweepPoolState;				/**< Memory pools for SweepPoolState*/ 
@@ -222,6 +229,7 @@ public:
 		, _currentMarkMap(NULL)
 		, _currentSweepBits(NULL)
 		, _heapBase(NULL)
+		, _findMarkedWord(MM_MarkMapScanKernel::findMarkedWordScalar)
 		, _sweepHeapSectioning(NULL)
 		, _poolSweepPoolState(NULL)
 		, _mutexSweepPoolState(0)
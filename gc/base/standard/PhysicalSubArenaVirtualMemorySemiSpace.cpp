@@ -36,7 +36,9 @@
 #include "Heap.hpp"
 #include "HeapRegionDescriptorStandard.hpp"
 #include "HeapRegionManager.hpp"
+#include "HeapVirtualMemory.hpp"
 #include "HeapWalker.hpp"
+#include "MemoryManager.hpp"
 #include "MemorySubSpace.hpp"
 #include "MemorySubSpaceSemiSpace.hpp"
 #include "ParallelGlobalGC.hpp"
@@ -118,6 +120,38 @@ MM_PhysicalSubArenaVirtualMemorySemiSpace::tearDown(MM_EnvironmentBase *env)
 	}
 	MM_PhysicalSubArenaVirtualMemory::tearDown(env);
 }
+
+bool
+MM_PhysicalSubArenaVirtualMemorySemiSpace::bindSemiSpacesToAffinityLeaders(MM_EnvironmentBase *env)
+{
+	return bindSemiSpaceRegionToAffinityLeaders(env, _lowSemiSpaceRegion) && bindSemiSpaceRegionToAffinityLeaders(env, _highSemiSpaceRegion);
+}
+
+bool
+MM_PhysicalSubArenaVirtualMemorySemiSpace::bindSemiSpaceRegionToAffinityLeaders(MM_EnvironmentBase *env, MM_HeapRegionDescriptor *region)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	MM_NUMAManager *numaManager = &extensions->_numaManager;
+	uintptr_t affinityLeaderCount = numaManager->getAffinityLeaderCount();
+	bool result = true;
+
+	if (extensions->scavengerNumaAwareCopy && numaManager->isPhysicalNUMASupported() && (1 < affinityLeaderCount) && (0 == _numaNode)) {
+		void *lowAddress = region->getLowAddress();
+		void *highAddress = region->getHighAddress();
+		uintptr_t regionSize = getHeapRegionManager()->getRegionSize();
+
+		for (uintptr_t sliceIndex = 0; result && (sliceIndex < affinityLeaderCount); sliceIndex++) {
+			void *sliceBase = numaManager->getAffinityLeaderSliceBase(lowAddress, highAddress, regionSize, sliceIndex);
+			void *sliceTop = numaManager->getAffinityLeaderSliceBase(lowAddress, highAddress, regionSize, sliceIndex + 1);
+			if (sliceTop > sliceBase) {
+				uintptr_t j9NodeNumber = numaManager->getJ9NodeNumber(sliceIndex + 1);
+				result = extensions->memoryManager->setNumaAffinity(((MM_HeapVirtualMemory *)_heap)->getVmemHandle(), j9NodeNumber, sliceBase, (uintptr_t)sliceTop - (uintptr_t)sliceBase);
+			}
+		}
+	}
+
+	return result;
+}
 	
 /**
  * Reserve initial address space within the parent arena.
@@ -188,6 +222,11 @@ MM_PhysicalSubArenaVirtualMemorySemiSpace::inflate(MM_EnvironmentBase *env)
 			Assert_MM_inflateInvalidRange();
 		}
 
+		/* now that both semi spaces are known (and before they are touched), bind their per-node slices if NUMA-aware copy is requested */
+		if (!bindSemiSpacesToAffinityLeaders(env)) {
+			return false;
+		}
+
 		void *lowAddress = _highSemiSpaceRegion->getLowAddress();
 		void *highAddress = _highSemiSpaceRegion->getHighAddress();
 
@@ -914,6 +953,9 @@ MM_PhysicalSubArenaVirtualMemorySemiSpace::contract(MM_EnvironmentBase *env, uin
 	Assert_MM_true(_lowAddress == _lowSemiSpaceRegion->getLowAddress());
 	Assert_MM_true(_highAddress == _highSemiSpaceRegion->getHighAddress());
 
+	/* semi space boundaries moved - rebind the per-node slices (best effort, the contraction has already happened) */
+	bindSemiSpacesToAffinityLeaders(env);
+
 	return totalContractSize;
 }
 
@@ -1060,6 +1102,9 @@ MM_PhysicalSubArenaVirtualMemorySemiSpace::tilt(MM_EnvironmentBase *env, uintptr
 		}
 	}
 
+	/* semi space boundaries moved - rebind the per-node slices (best effort, the tilt has already happened) */
+	bindSemiSpacesToAffinityLeaders(env);
+
 	/* Set the new tilt ratio of the receiver */
 	((MM_MemorySubSpaceSemiSpace *)_subSpace)->setSurvivorSpaceSizeRatio(survivorSpaceSize / ((_highSemiSpaceRegion->getSize() + _lowSemiSpaceRegion->getSize()) / 100));
 
@@ -1380,6 +1425,9 @@ MM_PhysicalSubArenaVirtualMemorySemiSpace::expandNoCheck(MM_EnvironmentBase *env
 	Assert_MM_true(_lowAddress == (void *)_lowSemiSpaceRegion->getLowAddress());
 	Assert_MM_true(_highAddress == (void *)_highSemiSpaceRegion->getHighAddress());
 
+	/* semi space boundaries moved - rebind the per-node slices (best effort, the expansion has already happened) */
+	bindSemiSpacesToAffinityLeaders(env);
+
 	return splitExpandSize;
 }
 
@@ -45,6 +45,15 @@ private:
 
 	uintptr_t calculateExpansionSplit(MM_EnvironmentBase *env, uintptr_t requestExpandSize, uintptr_t *allocateSpaceSize, uintptr_t *survivorSpaceSize);
 
+	/**
+	 * Bind each semi space to the NUMA affinity leaders in contiguous per-node slices (see MM_NUMAManager::getAffinityLeaderSliceBase).
+	 * Only done if -Xgc:scavengerNumaAwareCopy is specified, physical NUMA is available and the receiver is not bound to a single node.
+	 * Called whenever the semi space boundaries change, since the slices are relative to the current boundaries.
+	 * @return true if the binding succeeded (or was not required), false otherwise
+	 */
+	bool bindSemiSpacesToAffinityLeaders(MM_EnvironmentBase *env);
+	bool bindSemiSpaceRegionToAffinityLeaders(MM_EnvironmentBase *env, MM_HeapRegionDescriptor *region);
+
 protected:
 	MM_HeapRegionDescriptor *_lowSemiSpaceRegion;
 	MM_HeapRegionDescriptor *_highSemiSpaceRegion;
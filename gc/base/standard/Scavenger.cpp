@@ -30,6 +30,7 @@
 #endif
 
 #include <math.h>
+#include <string.h>
 
 #include "omrcfg.h"
 #include "omrcomp.h"
@@ -284,6 +285,31 @@ MM_Scavenger::initialize(MM_EnvironmentBase *env)
 
 	_cacheLineAlignment = CACHE_LINE_SIZE;
 
+	/* NUMA-aware copy only applies to stop-the-world scavenges, and only if there is more than one node to copy into */
+	if (_extensions->scavengerNumaAwareCopy && !IS_CONCURRENT_ENABLED && (1 < _extensions->_numaManager.getAffinityLeaderCount())) {
+		_survivorNodeSliceCount = _extensions->_numaManager.getAffinityLeaderCount();
+		_survivorNodeSlices = (SurvivorNodeSlice *)env->getForge()->allocate(sizeof(SurvivorNodeSlice) * _survivorNodeSliceCount, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		if (NULL == _survivorNodeSlices) {
+			return false;
+		}
+		memset(_survivorNodeSlices, 0, sizeof(SurvivorNodeSlice) * _survivorNodeSliceCount);
+	}
+
+	/* sampled hot fields are only used by the dynamic breadth first depth copy */
+	if (_extensions->scavengerHotFieldSampling && (MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_DYNAMIC_BREADTH_FIRST == _extensions->scavengerScanOrdering)) {
+		_hotFieldProfile = MM_ScavengerHotFieldProfile::newInstance(env);
+		if (NULL == _hotFieldProfile) {
+			return false;
+		}
+	}
+
+	if (_extensions->scavengerShardedRememberedSet) {
+		_rememberedSetShards = MM_ScavengerRememberedSetShards::newInstance(env, _dispatcher->threadCountMaximum(), _extensions->scavengerRememberedSetChunkSize);
+		if (NULL == _rememberedSetShards) {
+			return false;
+		}
+	}
+
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	if (IS_CONCURRENT_ENABLED) {
 		if (!_mainGCThread.initialize(this, true, true, true)) {
@@ -307,6 +333,21 @@ MM_Scavenger::tearDown(MM_EnvironmentBase *env)
 	_scavengeCacheFreeList.tearDown(env);
 	_scavengeCacheScanList.tearDown(env);
 
+	if (NULL != _survivorNodeSlices) {
+		env->getForge()->free(_survivorNodeSlices);
+		_survivorNodeSlices = NULL;
+	}
+
+	if (NULL != _hotFieldProfile) {
+		_hotFieldProfile->kill(env);
+		_hotFieldProfile = NULL;
+	}
+
+	if (NULL != _rememberedSetShards) {
+		_rememberedSetShards->kill(env);
+		_rememberedSetShards = NULL;
+	}
+
 	if (NULL != _scanCacheMonitor) {
 		omrthread_monitor_destroy(_scanCacheMonitor);
 		_scanCacheMonitor = NULL;
@@ -464,9 +505,20 @@ MM_Scavenger::mainSetupForGC(MM_EnvironmentStandard *env)
 	_activeSubSpace->cacheRanges(_evacuateMemorySubSpace, &_evacuateSpaceBase, &_evacuateSpaceTop);
 	_activeSubSpace->cacheRanges(_survivorMemorySubSpace, &_survivorSpaceBase, &_survivorSpaceTop);
 
+	setupSurvivorNodeSlices(env);
+
+	/* hot field samples are taken every gcCountBetweenHotFieldSort scavenges */
+	_hotFieldSamplingCycle = (NULL != _hotFieldProfile) && (0 == (_extensions->scavengerStats._gcCount % OMR_MAX(_extensions->gcCountBetweenHotFieldSort, 1)));
+
 	/* assume that value of RS Overflow flag will not be changed until scavengeRememberedSet() call, so handle it first */
 	_isRememberedSetInOverflowAtTheBeginning = isRememberedSetInOverflowState();
 	_extensions->rememberedSet.startProcessingSublist();
+
+	/* the list scan of a stop-the-world scavenge claims chunks of the puddles rather than whole puddles */
+	_rememberedSetShardsActive = false;
+	if ((NULL != _rememberedSetShards) && !_isRememberedSetInOverflowAtTheBeginning && !IS_CONCURRENT_ENABLED) {
+		_rememberedSetShardsActive = _rememberedSetShards->buildFromPreviousPuddles(env, &_extensions->rememberedSet, _dispatcher->threadCountMaximum());
+	}
 }
 
 void
@@ -501,6 +553,148 @@ MM_Scavenger::workerSetupForGC(MM_EnvironmentStandard *env)
 	Assert_MM_false(env->_loaAllocation);
 	Assert_MM_true(NULL == env->_survivorTLHRemainderBase);
 	Assert_MM_true(NULL == env->_survivorTLHRemainderTop);
+
+	env->_survivorNodeSliceIndex = 0;
+	if (_survivorNodeSlicesActive) {
+		env->_survivorNodeSliceIndex = selectSurvivorNodeSlice(env);
+	}
+
+	/* only every other GC thread samples, to keep the cost of profiling off the critical path */
+	env->_hotFieldSampleCountdown = 0;
+	if (_hotFieldSamplingCycle && (0 == (env->getWorkerID() % 2))) {
+		env->_hotFieldSampleCountdown = _extensions->scavengerHotFieldSampleRate;
+	}
+}
+
+void
+MM_Scavenger::setupSurvivorNodeSlices(MM_EnvironmentStandard *env)
+{
+	Assert_MM_false(_survivorNodeSlicesActive);
+
+	if (NULL != _survivorNodeSlices) {
+		MM_NUMAManager *numaManager = &_extensions->_numaManager;
+		uintptr_t regionSize = _extensions->heap->getHeapRegionManager()->getRegionSize();
+
+		/* Survivor space is empty at this point, and its address ordered pool hands out memory from the lowest free entry,
+		 * so carving the slices in address order makes each slice cover the range that was bound to its node.
+		 */
+		for (uintptr_t sliceIndex = 0; sliceIndex < _survivorNodeSliceCount; sliceIndex++) {
+			SurvivorNodeSlice *slice = &_survivorNodeSlices[sliceIndex];
+			void *sliceBase = numaManager->getAffinityLeaderSliceBase(_survivorSpaceBase, _survivorSpaceTop, regionSize, sliceIndex);
+			void *sliceTop = numaManager->getAffinityLeaderSliceBase(_survivorSpaceBase, _survivorSpaceTop, regionSize, sliceIndex + 1);
+			void *addrBase = NULL;
+			void *addrTop = NULL;
+
+			slice->_alloc = NULL;
+			slice->_top = NULL;
+			if (sliceTop > sliceBase) {
+				MM_AllocateDescription allocDescription(0, 0, false, true);
+				if (NULL != _survivorMemorySubSpace->collectorAllocateTLH(env, this, &allocDescription, (uintptr_t)sliceTop - (uintptr_t)sliceBase, addrBase, addrTop)) {
+					if ((addrBase >= sliceBase) && (addrTop <= sliceTop)) {
+						slice->_alloc = addrBase;
+						slice->_top = addrTop;
+						_survivorNodeSlicesActive = true;
+					} else {
+						/* the pool did not hand out this slice's range, so the memory may belong to another node - give it back and leave the slice empty */
+						MM_MemoryPool *memoryPool = _survivorMemorySubSpace->getMemoryPool();
+						if (((uintptr_t)addrTop - (uintptr_t)addrBase) >= memoryPool->getMinimumFreeEntrySize()) {
+							memoryPool->recycleHeapChunk(env, addrBase, addrTop);
+						} else {
+							_survivorMemorySubSpace->abandonHeapChunk(addrBase, addrTop);
+						}
+					}
+				}
+			}
+		}
+	}
+}
+
+void
+MM_Scavenger::tearDownSurvivorNodeSlices(MM_EnvironmentStandard *env)
+{
+	if (_survivorNodeSlicesActive) {
+		MM_MemoryPool *memoryPool = _survivorMemorySubSpace->getMemoryPool();
+
+		for (uintptr_t sliceIndex = 0; sliceIndex < _survivorNodeSliceCount; sliceIndex++) {
+			SurvivorNodeSlice *slice = &_survivorNodeSlices[sliceIndex];
+			uintptr_t remainderSize = (uintptr_t)slice->_top - (uintptr_t)slice->_alloc;
+
+			if (remainderSize >= memoryPool->getMinimumFreeEntrySize()) {
+				/* give the unused part of the slice back, so it can be allocated from after the flip */
+				memoryPool->recycleHeapChunk(env, slice->_alloc, slice->_top);
+			} else if (0 < remainderSize) {
+				_survivorMemorySubSpace->abandonHeapChunk(slice->_alloc, slice->_top);
+			}
+			slice->_alloc = NULL;
+			slice->_top = NULL;
+		}
+		_survivorNodeSlicesActive = false;
+	}
+}
+
+uintptr_t
+MM_Scavenger::selectSurvivorNodeSlice(MM_EnvironmentStandard *env)
+{
+	MM_NUMAManager *numaManager = &_extensions->_numaManager;
+	uintptr_t sliceIndex = env->getWorkerID() % _survivorNodeSliceCount;
+
+	if (numaManager->isPhysicalNUMASupported()) {
+		uintptr_t threadNodeNumber = env->getNumaAffinity();
+		uintptr_t numaNodeID = numaManager->getAffinityLeaderNodeID(threadNodeNumber);
+		if (0 != numaNodeID) {
+			/* the thread already runs on a single node - copy into that node's slice */
+			sliceIndex = numaNodeID - 1;
+		} else if ((0 == threadNodeNumber) && !env->isMainThread() && numaManager->shouldSetCPUAffinity()) {
+			/* bind the unbound worker to the node of its slice, so the copied objects are node-local to the thread that scans them */
+			uintptr_t j9NodeNumber = numaManager->getJ9NodeNumber(sliceIndex + 1);
+			env->_survivorNodeAffinityBound = env->setNumaAffinity(&j9NodeNumber, 1);
+		}
+	}
+
+	return sliceIndex;
+}
+
+void
+MM_Scavenger::restoreSurvivorNodeAffinity(MM_EnvironmentStandard *env)
+{
+	if (env->_survivorNodeAffinityBound) {
+		/* node 0 removes the binding, leaving the thread with the affinity it had before the scavenge */
+		uintptr_t j9NodeNumber = 0;
+		env->setNumaAffinity(&j9NodeNumber, 1);
+		env->_survivorNodeAffinityBound = false;
+	}
+}
+
+MMINLINE bool
+MM_Scavenger::allocateFromSurvivorNodeSlices(MM_EnvironmentStandard *env, uintptr_t minimumSize, uintptr_t maximumSize, void * &addrBase, void * &addrTop)
+{
+	uintptr_t localSliceIndex = env->_survivorNodeSliceIndex;
+	maximumSize = OMR_MAX(minimumSize, MM_Math::roundToFloor(_objectAlignmentInBytes, maximumSize));
+
+	for (uintptr_t i = 0; i < _survivorNodeSliceCount; i++) {
+		SurvivorNodeSlice *slice = &_survivorNodeSlices[(localSliceIndex + i) % _survivorNodeSliceCount];
+		void *alloc = slice->_alloc;
+
+		/* (top - alloc >= size) rather than (top >= alloc + size), to be safe from overflow */
+		while (((uintptr_t)slice->_top - (uintptr_t)alloc) >= minimumSize) {
+			uintptr_t size = OMR_MIN(maximumSize, (uintptr_t)slice->_top - (uintptr_t)alloc);
+			void *newAlloc = (void *)((uintptr_t)alloc + size);
+			void *oldAlloc = (void *)MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&slice->_alloc, (uintptr_t)alloc, (uintptr_t)newAlloc);
+			if (oldAlloc == alloc) {
+				addrBase = alloc;
+				addrTop = newAlloc;
+				if (0 == i) {
+					env->_scavengerStats._semiSpaceAllocationCountLocalNode += 1;
+				} else {
+					env->_scavengerStats._semiSpaceAllocationCountRemoteNode += 1;
+				}
+				return true;
+			}
+			alloc = oldAlloc;
+		}
+	}
+
+	return false;
 }
 
 uintptr_t
@@ -591,6 +785,19 @@ MM_Scavenger::calculateRecommendedWorkingThreads(MM_EnvironmentStandard *env)
 	Trc_MM_Scavenger_calculateRecommendedWorkingThreads_setRecommendedThreads(env->getLanguageVMThread(), scavengeTotalTime, totalStallTime, (percentStall*100), totalThreads, idealThreads, adjustedAverage, (adjustedAverage +  _extensions->adaptiveThreadBooster), _recommendedThreads);
 }
 
+uintptr_t
+MM_Scavenger::calculateElasticWorkingThreads(MM_EnvironmentStandard *env)
+{
+	uintptr_t recommendedThreads = _recommendedThreads;
+
+	if (UDATA_MAX != _copiedBytesLastCycle) {
+		uintptr_t rememberedSetWork = _extensions->rememberedSet.countElements() * _averageCopiedObjectSize;
+		recommendedThreads = OMR_MIN(recommendedThreads, _dispatcher->recommendThreadsForWork(env, _copiedBytesLastCycle + rememberedSetWork));
+	}
+
+	return recommendedThreads;
+}
+
 /**
  * Run a scavenge.
  */
@@ -598,9 +805,11 @@ void
 MM_Scavenger::scavenge(MM_EnvironmentBase *envBase)
 {
 	MM_EnvironmentStandard *env = MM_EnvironmentStandard::getEnvironment(envBase);
-	MM_ParallelScavengeTask scavengeTask(env, _dispatcher, this, env->_cycleState, _recommendedThreads);
+	MM_ParallelScavengeTask scavengeTask(env, _dispatcher, this, env->_cycleState, calculateElasticWorkingThreads(env));
 	_dispatcher->run(env, &scavengeTask);
 
+	tearDownSurvivorNodeSlices(env);
+
 	/* remove all scan caches temporary allocated in Heap */
 	_scavengeCacheFreeList.removeAllHeapAllocatedChunks(env);
 
@@ -831,6 +1040,8 @@ MM_Scavenger::mergeGCStatsBase(MM_EnvironmentBase *env, MM_ScavengerStats *final
 
 	finalGCStats->_semiSpaceAllocationCountLarge += scavStats->_semiSpaceAllocationCountLarge;
 	finalGCStats->_semiSpaceAllocationCountSmall += scavStats->_semiSpaceAllocationCountSmall;
+	finalGCStats->_semiSpaceAllocationCountLocalNode += scavStats->_semiSpaceAllocationCountLocalNode;
+	finalGCStats->_semiSpaceAllocationCountRemoteNode += scavStats->_semiSpaceAllocationCountRemoteNode;
 
 	finalGCStats->_tenureSpaceAllocationCountLarge += scavStats->_tenureSpaceAllocationCountLarge;
 	finalGCStats->_tenureSpaceAllocationCountSmall += scavStats->_tenureSpaceAllocationCountSmall;
@@ -856,6 +1067,16 @@ MM_Scavenger::mergeGCStatsBase(MM_EnvironmentBase *env, MM_ScavengerStats *final
 		finalGCStats->_copy_cachesize_counts[i] += scavStats->_copy_cachesize_counts[i];
 	}
 	finalGCStats->_leafObjectCount += scavStats->_leafObjectCount;
+	finalGCStats->_prefetchQueueEntries += scavStats->_prefetchQueueEntries;
+	finalGCStats->_prefetchQueueCopied += scavStats->_prefetchQueueCopied;
+	finalGCStats->_hotFieldCopyCount += scavStats->_hotFieldCopyCount;
+	finalGCStats->_rememberedSetScanEntries += scavStats->_rememberedSetScanEntries;
+	finalGCStats->_rememberedSetScanThreads += scavStats->_rememberedSetScanThreads;
+	finalGCStats->_rememberedSetScanTime += scavStats->_rememberedSetScanTime;
+	finalGCStats->_rememberedSetScanTimeMax = OMR_MAX(finalGCStats->_rememberedSetScanTimeMax, scavStats->_rememberedSetScanTimeMax);
+	finalGCStats->_rememberedSetScanShards = OMR_MAX(finalGCStats->_rememberedSetScanShards, scavStats->_rememberedSetScanShards);
+	finalGCStats->_rememberedSetScanChunks += scavStats->_rememberedSetScanChunks;
+	finalGCStats->_hotFieldColocatedCount += scavStats->_hotFieldColocatedCount;
 	finalGCStats->_copy_cachesize_sum += scavStats->_copy_cachesize_sum;
 	finalGCStats->_workStallTime += scavStats->_workStallTime;
 	finalGCStats->_completeStallTime += scavStats->_completeStallTime;
@@ -1197,21 +1418,31 @@ retry:
 				env->_survivorTLHRemainderTop = NULL;
 				activateDeferredCopyScanCache(env);
 			} else if (_extensions->tlhSurvivorDiscardThreshold < cacheSize) {
-				MM_AllocateDescription allocDescription(cacheSize, 0, false, true);
-
-				addrBase = _survivorMemorySubSpace->collectorAllocate(env, this, &allocDescription);
-				if(NULL != addrBase) {
-					addrTop = (void *)(((uint8_t *)addrBase) + cacheSize);
-					/* Check that there is no overflow */
-					Assert_MM_true(addrTop >= addrBase);
-					allocateResult = true;
+				if (_survivorNodeSlicesActive) {
+					allocateResult = allocateFromSurvivorNodeSlices(env, cacheSize, cacheSize, addrBase, addrTop);
+				}
+				if (!allocateResult) {
+					MM_AllocateDescription allocDescription(cacheSize, 0, false, true);
+
+					addrBase = _survivorMemorySubSpace->collectorAllocate(env, this, &allocDescription);
+					if(NULL != addrBase) {
+						addrTop = (void *)(((uint8_t *)addrBase) + cacheSize);
+						/* Check that there is no overflow */
+						Assert_MM_true(addrTop >= addrBase);
+						allocateResult = true;
+					}
 				}
 				env->_scavengerStats._semiSpaceAllocationCountLarge += 1;
 			} else {
-				MM_AllocateDescription allocDescription(0, 0, false, true);
 				/* Update the optimum scan cache size */
 				uintptr_t scanCacheSize = calculateOptimumCopyScanCacheSize(env);
-				allocateResult = (NULL != _survivorMemorySubSpace->collectorAllocateTLH(env, this, &allocDescription, scanCacheSize, addrBase, addrTop));
+				if (_survivorNodeSlicesActive) {
+					allocateResult = allocateFromSurvivorNodeSlices(env, cacheSize, scanCacheSize, addrBase, addrTop);
+				}
+				if (!allocateResult) {
+					MM_AllocateDescription allocDescription(0, 0, false, true);
+					allocateResult = (NULL != _survivorMemorySubSpace->collectorAllocateTLH(env, this, &allocDescription, scanCacheSize, addrBase, addrTop));
+				}
 				env->_scavengerStats._semiSpaceAllocationCountSmall += 1;
 			}
 		}
@@ -1522,6 +1753,25 @@ MM_Scavenger::copyAndForward(MM_EnvironmentStandard *env, GC_SlotObject *slotObj
 	return result;
 }
 
+/**
+ * Copy and forward the object referred to by a slot that was deferred through the prefetch queue.
+ *
+ * @param entry the dequeued entry (the slot is re-read, as it may have been updated since it was queued)
+ * @return true if the new location of the object is in new space
+ * @return false otherwise
+ */
+MMINLINE bool
+MM_Scavenger::copyAndForwardPrefetchedSlot(MM_EnvironmentStandard *env, MM_PrefetchQueue::Entry *entry)
+{
+	GC_SlotObject slotObject(env->getOmrVM(), entry->slot);
+	bool result = copyAndForward(env, &slotObject);
+	env->_scavengerStats._prefetchQueueEntries += 1;
+	if (NULL != env->_effectiveCopyScanCache) {
+		env->_scavengerStats._prefetchQueueCopied += 1;
+	}
+	return result;
+}
+
 bool
 MM_Scavenger::copyObjectSlot(MM_EnvironmentStandard *env, volatile omrobjectptr_t *slotPtr)
 {
@@ -1869,8 +2119,18 @@ MM_Scavenger::depthCopyHotFields(MM_EnvironmentStandard *env, MM_ForwardedHeader
 					copyHotField(env, destinationObjectPtr, hotFieldOffset3);
 				}
 			}
-		} else if (_extensions->alwaysDepthCopyFirstOffset && !_extensions->objectModel.isIndexable(forwardedHeader)) {
-			copyHotField(env, destinationObjectPtr, DEFAULT_HOT_FIELD_OFFSET);
+		} else {
+			const uint8_t *sampledHotFieldOffsets = NULL;
+			if ((NULL != _hotFieldProfile) && !_extensions->objectModel.isIndexable(forwardedHeader)) {
+				sampledHotFieldOffsets = _hotFieldProfile->getHotFieldOffsets(_extensions->objectModel.getHotFieldProfileKey(destinationObjectPtr));
+			}
+			if (NULL != sampledHotFieldOffsets) {
+				for (uintptr_t i = 0; (i < MM_ScavengerHotFieldProfile::_hotFieldCount) && (U_8_MAX != sampledHotFieldOffsets[i]); i++) {
+					copyHotField(env, destinationObjectPtr, sampledHotFieldOffsets[i]);
+				}
+			} else if (_extensions->alwaysDepthCopyFirstOffset && !_extensions->objectModel.isIndexable(forwardedHeader)) {
+				copyHotField(env, destinationObjectPtr, DEFAULT_HOT_FIELD_OFFSET);
+			}
 		}
 	}
 }
@@ -1885,12 +2145,43 @@ MM_Scavenger::copyHotField(MM_EnvironmentStandard *env, omrobjectptr_t destinati
 		MM_ForwardedHeader forwardHeaderHotField(objectPtr, compressed);
 		if (!forwardHeaderHotField.isForwardedPointer()) {
 			env->_hotFieldCopyDepthCount += 1;
-			copyObject(env, &forwardHeaderHotField);
+			omrobjectptr_t hotFieldCopyPtr = copyObject(env, &forwardHeaderHotField);
 			env->_hotFieldCopyDepthCount -= 1;
+			if (NULL != hotFieldCopyPtr) {
+				/* co-located if the copy starts no further than one cache line past the end of the parent */
+				uintptr_t parentTop = (uintptr_t)destinationObjectPtr + _extensions->objectModel.getConsumedSizeInBytesWithHeader(destinationObjectPtr);
+				env->_scavengerStats._hotFieldCopyCount += 1;
+				if (((uintptr_t)hotFieldCopyPtr >= parentTop) && ((uintptr_t)hotFieldCopyPtr < (parentTop + _cacheLineAlignment))) {
+					env->_scavengerStats._hotFieldColocatedCount += 1;
+				}
+			}
 		}
 	}
 }
 
+MMINLINE MM_ScavengerHotFieldProfile::Entry *
+MM_Scavenger::getHotFieldSampleEntry(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr)
+{
+	MM_ScavengerHotFieldProfile::Entry *entry = NULL;
+	if (0 != env->_hotFieldSampleCountdown) {
+		env->_hotFieldSampleCountdown -= 1;
+		if (0 == env->_hotFieldSampleCountdown) {
+			env->_hotFieldSampleCountdown = _extensions->scavengerHotFieldSampleRate;
+			entry = _hotFieldProfile->findOrAddEntry(_extensions->objectModel.getHotFieldProfileKey(objectPtr));
+		}
+	}
+	return entry;
+}
+
+MMINLINE void
+MM_Scavenger::recordHotFieldSample(MM_ScavengerHotFieldProfile::Entry *entry, omrobjectptr_t objectPtr, GC_SlotObject *slotObject, omrobjectptr_t slotReference)
+{
+	if ((NULL != slotReference) && isObjectInEvacuateMemory(slotReference)) {
+		uintptr_t slotSize = _extensions->compressObjectReferences() ? sizeof(uint32_t) : sizeof(uintptr_t);
+		_hotFieldProfile->recordSlot(entry, ((uintptr_t)slotObject->readAddressFromSlot() - (uintptr_t)objectPtr) / slotSize);
+	}
+}
+
 /****************************************
  * Object scan and copy routines
  ****************************************
@@ -2039,14 +2330,61 @@ MM_Scavenger::scavengeObjectSlots(MM_EnvironmentStandard *env, MM_CopyScanCacheS
 	uint64_t slotsScanned = 0;
 	GC_SlotObject *slotObject = NULL;
 
+	MM_ScavengerHotFieldProfile::Entry *hotFieldSampleEntry = NULL;
+	if ((NULL != _hotFieldProfile) && !objectScanner->isIndexableObject()) {
+		hotFieldSampleEntry = getHotFieldSampleEntry(env, objectPtr);
+	}
+
 	MM_CopyScanCacheStandard **copyCache = &(env->_effectiveCopyScanCache);
-	while (NULL != (slotObject = objectScanner->getNextSlot())) {
-		bool isSlotObjectInNewSpace = copyAndForward(env, slotObject);
-		shouldRemember |= isSlotObjectInNewSpace;
-		if (NULL != *copyCache) {
-			slotsCopied += 1;
+	uintptr_t prefetchDistance = OMR_MIN(_extensions->scanPrefetchDistance, (uintptr_t)MM_PrefetchQueue::_capacity);
+	if (0 == prefetchDistance) {
+		while (NULL != (slotObject = objectScanner->getNextSlot())) {
+			if (NULL != hotFieldSampleEntry) {
+				/* sample before copying, the slot is updated to the forwarded reference */
+				recordHotFieldSample(hotFieldSampleEntry, objectPtr, slotObject, slotObject->readReferenceFromSlot());
+			}
+			bool isSlotObjectInNewSpace = copyAndForward(env, slotObject);
+			shouldRemember |= isSlotObjectInNewSpace;
+			if (NULL != *copyCache) {
+				slotsCopied += 1;
+			}
+			slotsScanned += 1;
+		}
+	} else {
+		/* Only slots referring into evacuate space are deferred; the header of the object they refer to
+		 * is read (forwarding check) and possibly copied when the slot is dequeued. Other slots are cheap
+		 * to process immediately.
+		 */
+		MM_PrefetchQueue *prefetchQueue = &env->_prefetchQueue;
+		while (NULL != (slotObject = objectScanner->getNextSlot())) {
+			omrobjectptr_t slotReference = slotObject->readReferenceFromSlot();
+			if (NULL != hotFieldSampleEntry) {
+				recordHotFieldSample(hotFieldSampleEntry, objectPtr, slotObject, slotReference);
+			}
+			if ((NULL != slotReference) && isObjectInEvacuateMemory(slotReference)) {
+				if (prefetchQueue->getCount() >= prefetchDistance) {
+					shouldRemember |= copyAndForwardPrefetchedSlot(env, prefetchQueue->pop());
+					if (NULL != *copyCache) {
+						slotsCopied += 1;
+					}
+				}
+				MM_PrefetchQueue::prefetch(slotReference);
+				prefetchQueue->push(slotObject->readAddressFromSlot(), slotReference, false);
+			} else {
+				bool isSlotObjectInNewSpace = copyAndForward(env, slotObject);
+				shouldRemember |= isSlotObjectInNewSpace;
+				if (NULL != *copyCache) {
+					slotsCopied += 1;
+				}
+			}
+			slotsScanned += 1;
+		}
+		while (!prefetchQueue->isEmpty()) {
+			shouldRemember |= copyAndForwardPrefetchedSlot(env, prefetchQueue->pop());
+			if (NULL != *copyCache) {
+				slotsCopied += 1;
+			}
 		}
-		slotsScanned += 1;
 	}
 	updateCopyScanCounts(env, slotsScanned, slotsCopied);
 
@@ -2648,6 +2986,8 @@ MM_Scavenger::workThreadGarbageCollect(MM_EnvironmentStandard *env)
 
 	/* No matter what happens, always sum up the gc stats */
 	mergeThreadGCStats(env);
+
+	restoreSurvivorNodeAffinity(env);
 }
 
 /****************************************
@@ -2906,6 +3246,9 @@ MM_Scavenger::pruneRememberedSet(MM_EnvironmentStandard *env)
 {
 	if(isRememberedSetInOverflowState()) {
 		pruneRememberedSetOverflow(env);
+	} else if ((NULL != _rememberedSetShards) && !IS_CONCURRENT_ENABLED) {
+		/* shards are only built for stop-the-world scavenges, the concurrent scavenger keeps dividing the work by puddle */
+		pruneRememberedSetListShards(env);
 	} else {
 		pruneRememberedSetList(env);
 	}
@@ -2986,12 +3329,71 @@ MM_Scavenger::pruneRememberedSetOverflow(MM_EnvironmentStandard *env)
 	}
 }
 
+MMINLINE bool
+MM_Scavenger::pruneRememberedSetListSlot(MM_EnvironmentStandard *env, omrobjectptr_t *slotPtr)
+{
+	omrobjectptr_t objectPtr = *slotPtr;
+	bool removeSlot = false;
+
+#if defined(OMR_SCAVENGER_TRACE_REMEMBERED_SET)
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+#endif /* OMR_SCAVENGER_TRACE_REMEMBERED_SET */
+
+	if (NULL == objectPtr) {
+		removeSlot = true;
+	} else if((uintptr_t)objectPtr & DEFERRED_RS_REMOVE_FLAG) {
+		/* Is slot flagged for deferred removal ? */
+		/* Yes..so first remove tag bit from object address */
+		objectPtr = (omrobjectptr_t)((uintptr_t)objectPtr & ~(uintptr_t)DEFERRED_RS_REMOVE_FLAG);
+		/* The object did not have Nursery references at initial RS scan, but one could have been added during CS cycle by a mutator. */
+		if (!IS_CONCURRENT_ENABLED || !shouldRememberObject(env, objectPtr)) {
+#if defined(OMR_SCAVENGER_TRACE_REMEMBERED_SET)
+			omrtty_printf("{SCAV: REMOVED remembered set object %p}\n", objectPtr);
+#endif /* OMR_SCAVENGER_TRACE_REMEMBERED_SET */
+
+			/* A simple mask out can be used - we are guaranteed to be the only manipulator of the object */
+			_extensions->objectModel.clearRemembered(objectPtr);
+			removeSlot = true;
+			/* Inform interested parties (Concurrent Marker) that an object has been removed from the remembered set.
+			 * In non-concurrent Scavenger this is the only way to create an old-to-old reference, that has parent object being marked.
+			 * In Concurrent Scavenger, it can be created even with parent object that was not in RS to start with. So this is handled
+			 * in a more generic spot when object is scavenged and is unnecessary to do it here.
+			 */
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+			if (_extensions->shouldScavengeNotifyGlobalGCOfOldToOldReference() && !IS_CONCURRENT_ENABLED) {
+				oldToOldReferenceCreated(env, objectPtr);
+			}
+#endif /* OMR_GC_MODRON_CONCURRENT_MARK */
+		}
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+		else {
+			/* We are not removing it after all, since the object has Nursery references => reset the deferred flag.
+			 * todo: consider doing double remembering, if remembered during CS cycle, to avoid the rescan of the object
+			 */
+			*slotPtr = objectPtr;
+		}
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
+
+	} else {
+		/* Retain remembered object */
+#if defined(OMR_SCAVENGER_TRACE_REMEMBERED_SET)
+		omrtty_printf("{SCAV: Remembered set object %p}\n", objectPtr);
+#endif /* OMR_SCAVENGER_TRACE_REMEMBERED_SET */
+
+		if (!IS_CONCURRENT_ENABLED && processRememberedThreadReference(env, objectPtr)) {
+			/* the object was tenured from the stack on a previous scavenge -- keep it around for a bit longer */
+			Trc_MM_ParallelScavenger_scavengeRememberedSet_keepingRememberedObject(env->getLanguageVMThread(), objectPtr, _extensions->objectModel.getRememberedBits(objectPtr));
+		}
+	}
+
+	return removeSlot;
+}
+
 void
 MM_Scavenger::pruneRememberedSetList(MM_EnvironmentStandard *env)
 {
 	/* Remembered set walk */
 	omrobjectptr_t *slotPtr;
-	omrobjectptr_t objectPtr;
 	MM_SublistPuddle *puddle;
 
 #if defined(OMR_SCAVENGER_TRACE_REMEMBERED_SET)
@@ -3004,60 +3406,62 @@ MM_Scavenger::pruneRememberedSetList(MM_EnvironmentStandard *env)
 		if(J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
 			GC_SublistSlotIterator remSetSlotIterator(puddle);
 			while((slotPtr = (omrobjectptr_t *)remSetSlotIterator.nextSlot()) != NULL) {
-				objectPtr = *slotPtr;
-
-				if (NULL == objectPtr) {
+				if (pruneRememberedSetListSlot(env, slotPtr)) {
 					remSetSlotIterator.removeSlot();
-				} else if((uintptr_t)objectPtr & DEFERRED_RS_REMOVE_FLAG) {
-					/* Is slot flagged for deferred removal ? */
-					/* Yes..so first remove tag bit from object address */
-					objectPtr = (omrobjectptr_t)((uintptr_t)objectPtr & ~(uintptr_t)DEFERRED_RS_REMOVE_FLAG);
-					/* The object did not have Nursery references at initial RS scan, but one could have been added during CS cycle by a mutator. */
-					if (!IS_CONCURRENT_ENABLED || !shouldRememberObject(env, objectPtr)) {
+				}
+			} /* while non-null slots */
+		}
+	}
 #if defined(OMR_SCAVENGER_TRACE_REMEMBERED_SET)
-						omrtty_printf("{SCAV: REMOVED remembered set object %p}\n", objectPtr);
+	omrtty_printf("{SCAV: End prune remembered set list; count = %lld}\n", _extensions->rememberedSet.countElements());
 #endif /* OMR_SCAVENGER_TRACE_REMEMBERED_SET */
+}
 
-						/* A simple mask out can be used - we are guaranteed to be the only manipulator of the object */
-						_extensions->objectModel.clearRemembered(objectPtr);
-						remSetSlotIterator.removeSlot();
-						/* Inform interested parties (Concurrent Marker) that an object has been removed from the remembered set.
-						 * In non-concurrent Scavenger this is the only way to create an old-to-old reference, that has parent object being marked.
-						 * In Concurrent Scavenger, it can be created even with parent object that was not in RS to start with. So this is handled
-						 * in a more generic spot when object is scavenged and is unnecessary to do it here.
-						 */
-#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
-						if (_extensions->shouldScavengeNotifyGlobalGCOfOldToOldReference() && !IS_CONCURRENT_ENABLED) {
-							oldToOldReferenceCreated(env, objectPtr);
-						}
-#endif /* OMR_GC_MODRON_CONCURRENT_MARK */
-					}
-#if defined(OMR_GC_CONCURRENT_SCAVENGER)
-					else {
-						/* We are not removing it after all, since the object has Nursery references => reset the deferred flag.
-						 * todo: consider doing double remembering, if remembered during CS cycle, to avoid the rescan of the object
-						 */
-						*slotPtr = objectPtr;
-					}
-#endif /* OMR_GC_CONCURRENT_SCAVENGER */
+void
+MM_Scavenger::pruneRememberedSetListShards(MM_EnvironmentStandard *env)
+{
+	/* Cut the whole list into chunks, including the entries added while scavenging */
+	if (env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
+		_rememberedSetShardsActive = _rememberedSetShards->buildFromPuddles(env, &_extensions->rememberedSet, env->_currentTask->getThreadCount());
+		env->_currentTask->releaseSynchronizedGCThreads(env);
+	}
 
-				} else {
-					/* Retain remembered object */
-#if defined(OMR_SCAVENGER_TRACE_REMEMBERED_SET)
-					omrtty_printf("{SCAV: Remembered set object %p}\n", objectPtr);
-#endif /* OMR_SCAVENGER_TRACE_REMEMBERED_SET */
+	if (!_rememberedSetShardsActive) {
+		pruneRememberedSetList(env);
+		return;
+	}
 
-					if (!IS_CONCURRENT_ENABLED && processRememberedThreadReference(env, objectPtr)) {
-						/* the object was tenured from the stack on a previous scavenge -- keep it around for a bit longer */
-						Trc_MM_ParallelScavenger_scavengeRememberedSet_keepingRememberedObject(env->getLanguageVMThread(), objectPtr, _extensions->objectModel.getRememberedBits(objectPtr));
-					}
+	/* Pruned entries are only cleared here: removing an entry moves the last entry of the puddle, which may
+	 * belong to another thread's chunk, into its place.
+	 */
+	uintptr_t removedCount = 0;
+	MM_ScavengerRememberedSetShards::Chunk *chunk = NULL;
+	while (NULL != (chunk = _rememberedSetShards->nextChunk(env->getWorkerID()))) {
+		for (omrobjectptr_t *slotPtr = (omrobjectptr_t *)chunk->base; slotPtr < (omrobjectptr_t *)chunk->top; slotPtr++) {
+			if ((NULL != *slotPtr) && pruneRememberedSetListSlot(env, slotPtr)) {
+				*slotPtr = NULL;
+				removedCount += 1;
+			}
+		}
+	}
+	_extensions->rememberedSet.decrementCount(removedCount);
+
+	/* Then squeeze the cleared entries out of each puddle; this only reads the list, not the objects */
+	env->_currentTask->synchronizeGCThreads(env, UNIQUE_ID);
+
+	GC_SublistIterator remSetIterator(&(_extensions->rememberedSet));
+	MM_SublistPuddle *puddle = NULL;
+	while (NULL != (puddle = remSetIterator.nextList())) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			GC_SublistSlotIterator remSetSlotIterator(puddle);
+			omrobjectptr_t *slotPtr = NULL;
+			while (NULL != (slotPtr = (omrobjectptr_t *)remSetSlotIterator.nextSlot())) {
+				if (NULL == *slotPtr) {
+					remSetSlotIterator.removeSlot();
 				}
-			} /* while non-null slots */
+			}
 		}
 	}
-#if defined(OMR_SCAVENGER_TRACE_REMEMBERED_SET)
-	omrtty_printf("{SCAV: End prune remembered set list; count = %lld}\n", _extensions->rememberedSet.countElements());
-#endif /* OMR_SCAVENGER_TRACE_REMEMBERED_SET */
 }
 
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
@@ -3135,51 +3539,78 @@ MM_Scavenger::scavengeRememberedSetListIndirect(MM_EnvironmentStandard *env)
 
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 
-void
-MM_Scavenger::scavengeRememberedSetList(MM_EnvironmentStandard *env)
+MMINLINE void
+MM_Scavenger::scavengeRememberedSetListSlot(MM_EnvironmentStandard *env, omrobjectptr_t *slotPtr)
 {
-	Assert_MM_false(IS_CONCURRENT_ENABLED);
+	omrobjectptr_t objectPtr = *slotPtr;
+	Assert_MM_true(_extensions->objectModel.isRemembered(objectPtr));
 
-	Trc_MM_ParallelScavenger_scavengeRememberedSetList_Entry(env->getLanguageVMThread());
+	/* First assume the object will not be remembered.
+	 * This is helpful for work completion ordering of split arrays.
+	 * Flag slot for later removal if we complete scavenge OK
+	 */
+	*slotPtr = (omrobjectptr_t)((uintptr_t)*slotPtr | DEFERRED_RS_REMOVE_FLAG);
+	bool shouldBeRemembered = scavengeObjectSlots(env, NULL, objectPtr, GC_ObjectScanner::scanRoots, slotPtr);
+	if (_extensions->objectModel.hasIndirectObjectReferents((CLI_THREAD_TYPE*)env->getLanguageVMThread(), objectPtr)) {
+		shouldBeRemembered |= _delegate.scavengeIndirectObjectSlots(env, objectPtr);
+	}
 
-	/* Remembered set walk */
-	MM_SublistPuddle *puddle = NULL;
-	while (NULL != (puddle = _extensions->rememberedSet.popPreviousPuddle(puddle))) {
-		Trc_MM_ParallelScavenger_scavengeRememberedSetList_startPuddle(env->getLanguageVMThread(), puddle);
-		uintptr_t numElements = 0;
-		GC_SublistSlotIterator remSetSlotIterator(puddle);
-		omrobjectptr_t *slotPtr;
-		while((slotPtr = (omrobjectptr_t *)remSetSlotIterator.nextSlot()) != NULL) {
-			omrobjectptr_t objectPtr = *slotPtr;
+	shouldBeRemembered |= isRememberedThreadReference(env, objectPtr);
 
-			if(NULL != objectPtr) {
-				Assert_MM_true(_extensions->objectModel.isRemembered(objectPtr));
-				numElements += 1;
+	if (shouldBeRemembered) {
+		/* We want to remember this object after all; clear the flag for removal. */
+		*slotPtr = (omrobjectptr_t)((uintptr_t)*slotPtr & ~(uintptr_t)DEFERRED_RS_REMOVE_FLAG);
+	}
+}
 
-				/* First assume the object will not be remembered.
-				 * This is helpful for work completion ordering of split arrays.
-				 * Flag slot for later removal if we complete scavenge OK
-				 */
-				*slotPtr = (omrobjectptr_t)((uintptr_t)*slotPtr | DEFERRED_RS_REMOVE_FLAG);
-				bool shouldBeRemembered = scavengeObjectSlots(env, NULL, objectPtr, GC_ObjectScanner::scanRoots, slotPtr);
-				if (_extensions->objectModel.hasIndirectObjectReferents((CLI_THREAD_TYPE*)env->getLanguageVMThread(), objectPtr)) {
-					shouldBeRemembered |= _delegate.scavengeIndirectObjectSlots(env, objectPtr);
-				}
+void
+MM_Scavenger::scavengeRememberedSetList(MM_EnvironmentStandard *env)
+{
+	Assert_MM_false(IS_CONCURRENT_ENABLED);
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
 
-				shouldBeRemembered |= isRememberedThreadReference(env, objectPtr);
+	Trc_MM_ParallelScavenger_scavengeRememberedSetList_Entry(env->getLanguageVMThread());
 
-				if (shouldBeRemembered) {
-					/* We want to remember this object after all; clear the flag for removal. */
-					*slotPtr = (omrobjectptr_t)((uintptr_t)*slotPtr & ~(uintptr_t)DEFERRED_RS_REMOVE_FLAG);
+	uint64_t startTime = omrtime_hires_clock();
+	uintptr_t scannedCount = 0;
+
+	if (_rememberedSetShardsActive) {
+		/* Empty entries are left for pruning: removing one here would move an entry of another thread's chunk into its place */
+		MM_ScavengerRememberedSetShards::Chunk *chunk = NULL;
+		env->_scavengerStats._rememberedSetScanShards = _rememberedSetShards->getShardCount();
+		while (NULL != (chunk = _rememberedSetShards->nextChunk(env->getWorkerID()))) {
+			env->_scavengerStats._rememberedSetScanChunks += 1;
+			for (omrobjectptr_t *slotPtr = (omrobjectptr_t *)chunk->base; slotPtr < (omrobjectptr_t *)chunk->top; slotPtr++) {
+				if (NULL != *slotPtr) {
+					scavengeRememberedSetListSlot(env, slotPtr);
+					scannedCount += 1;
 				}
-			} else {
-				remSetSlotIterator.removeSlot();
 			}
 		}
+	} else {
+		/* Remembered set walk */
+		MM_SublistPuddle *puddle = NULL;
+		while (NULL != (puddle = _extensions->rememberedSet.popPreviousPuddle(puddle))) {
+			Trc_MM_ParallelScavenger_scavengeRememberedSetList_startPuddle(env->getLanguageVMThread(), puddle);
+			uintptr_t numElements = 0;
+			GC_SublistSlotIterator remSetSlotIterator(puddle);
+			omrobjectptr_t *slotPtr;
+			while((slotPtr = (omrobjectptr_t *)remSetSlotIterator.nextSlot()) != NULL) {
+				if(NULL != *slotPtr) {
+					numElements += 1;
+					scavengeRememberedSetListSlot(env, slotPtr);
+				} else {
+					remSetSlotIterator.removeSlot();
+				}
+			}
 
-		Trc_MM_ParallelScavenger_scavengeRememberedSetList_donePuddle(env->getLanguageVMThread(), puddle, numElements);
+			Trc_MM_ParallelScavenger_scavengeRememberedSetList_donePuddle(env->getLanguageVMThread(), puddle, numElements);
+			scannedCount += numElements;
+		}
 	}
 
+	env->_scavengerStats.addToRememberedSetScanTime(startTime, omrtime_hires_clock(), scannedCount);
+
 	Trc_MM_ParallelScavenger_scavengeRememberedSetList_Exit(env->getLanguageVMThread());
 }
 
@@ -4302,9 +4733,22 @@ MM_Scavenger::mainThreadGarbageCollect(MM_EnvironmentBase *envBase, MM_AllocateD
 
 			calculateRecommendedWorkingThreads(env);
 
+			/* Remember how much was copied to size the next scavenge */
+			MM_ScavengerStats *scavengerStats = &_extensions->scavengerStats;
+			uintptr_t copiedObjects = scavengerStats->_flipCount + scavengerStats->_tenureAggregateCount;
+			_copiedBytesLastCycle = scavengerStats->_flipBytes + scavengerStats->_tenureAggregateBytes;
+			if (0 != copiedObjects) {
+				_averageCopiedObjectSize = OMR_MAX(_copiedBytesLastCycle / copiedObjects, (uintptr_t)OMR_MINIMUM_OBJECT_SIZE);
+			}
+
 			/* Merge sublists in the remembered set (if necessary) */
 			_extensions->rememberedSet.compact(env);
 
+			/* Pick the hot fields used by depth copy in the following scavenges */
+			if (_hotFieldSamplingCycle) {
+				_hotFieldProfile->updateHotFields(env);
+			}
+
 			/* If -Xgc:fvtest=forcePoisonEvacuate has been specified, poison(fill poison pattern) evacuate space */
 			if(_extensions->fvtest_forcePoisonEvacuate) {
 				_activeSubSpace->poisonEvacuateSpace();
@@ -41,7 +41,10 @@
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 #include "MainGCThread.hpp"
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
+#include "PrefetchQueue.hpp"
 #include "ScavengerDelegate.hpp"
+#include "ScavengerHotFieldProfile.hpp"
+#include "ScavengerRememberedSetShards.hpp"
 
 struct J9HookInterface;
 class GC_ObjectScanner;
@@ -110,6 +113,8 @@ private:
 	uintptr_t _minTenureFailureSize;
 	uintptr_t _minSemiSpaceFailureSize;
 	uintptr_t _recommendedThreads; /** Number of threads recommended to the dispatcher for the Scavenge task */
+	uintptr_t _copiedBytesLastCycle; /**< Bytes flipped and tenured by the last successful scavenge (UDATA_MAX before the first one) */
+	uintptr_t _averageCopiedObjectSize; /**< Average size of the objects copied by the last successful scavenge, to weigh remembered set entries */
 
 	MM_CycleState _cycleState;  /**< Embedded cycle state to be used as the main cycle state for GC activity */
 	MM_CollectionStatisticsStandard _collectionStatistics;  /** Common collect stats (memory, time etc.) */
@@ -131,6 +136,27 @@ private:
 	void *_heapTop;  /**< Cached top pointer of heap */
 	MM_HeapRegionManager *_regionManager;
 
+	/**
+	 * A per-NUMA-node slice of survivor space (-Xgc:scavengerNumaAwareCopy). GC threads bump-allocate
+	 * their survivor copy caches from the slice of their own node, and only fall back to the other slices
+	 * (and then to the survivor memory pool) once it is exhausted.
+	 */
+	struct SurvivorNodeSlice {
+		void * volatile _alloc; /**< next free address in the slice, advanced atomically by the copying threads */
+		void *_top; /**< top of the slice */
+		uint8_t _padding[64 - (2 * sizeof(void *))]; /**< keep slices of different nodes on separate cache lines */
+	};
+
+	SurvivorNodeSlice *_survivorNodeSlices; /**< array of _survivorNodeSliceCount slices, NULL unless NUMA-aware copy is enabled with more than one affinity leader */
+	uintptr_t _survivorNodeSliceCount; /**< number of elements in _survivorNodeSlices (the affinity leader count) */
+	bool _survivorNodeSlicesActive; /**< true while survivor space is carved into node slices (from main setup until the scavenge task completes) */
+
+	MM_ScavengerHotFieldProfile *_hotFieldProfile; /**< sampled hot fields per class, NULL unless -Xgc:scavengerHotFieldSampling is enabled */
+	bool _hotFieldSamplingCycle; /**< true if GC threads take hot field samples in the current scavenge */
+
+	MM_ScavengerRememberedSetShards *_rememberedSetShards; /**< chunked work division of the remembered set list, NULL unless -Xgc:scavengerShardedRememberedSet is enabled */
+	bool _rememberedSetShardsActive; /**< true if the current remembered set list scan or prune claims chunks from _rememberedSetShards rather than whole puddles */
+
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	MM_MainGCThread _mainGCThread; /**< An object which manages the state of the main GC thread */
 	
@@ -271,6 +297,12 @@ public:
 
 	MMINLINE bool copyAndForward(MM_EnvironmentStandard *env, volatile omrobjectptr_t *objectPtrIndirect);
 
+	/**
+	 * Implementation of CopyAndForward for a slot deferred through the prefetch queue
+	 * @param entry dequeued prefetch queue entry
+	 */
+	MMINLINE bool copyAndForwardPrefetchedSlot(MM_EnvironmentStandard *env, MM_PrefetchQueue::Entry *entry);
+
 	/**
 	 * Handle the path after a failed attempt to forward an object:
 	 * try to reuse or abandon reserved memory for this threads destination object candidate.
@@ -306,6 +338,22 @@ public:
 	 */ 
 	MMINLINE void copyHotField(MM_EnvironmentStandard *env, omrobjectptr_t destinationObjectPtr, uint8_t offset);
 
+	/**
+	 * Decide whether the object about to be scanned is a hot field sample for this thread.
+	 * @param objectPtr the object about to be scanned
+	 * @return the profile entry to record the slots of the object in, or NULL if it is not sampled
+	 */
+	MMINLINE MM_ScavengerHotFieldProfile::Entry *getHotFieldSampleEntry(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr);
+
+	/**
+	 * Record a slot of a sampled object in the hot field profile if it refers into evacuate space.
+	 * @param entry the profile entry returned by getHotFieldSampleEntry() for the object
+	 * @param objectPtr the sampled object
+	 * @param slotObject the slot being scanned
+	 * @param slotReference the value of the slot
+	 */
+	MMINLINE void recordHotFieldSample(MM_ScavengerHotFieldProfile::Entry *entry, omrobjectptr_t objectPtr, GC_SlotObject *slotObject, omrobjectptr_t slotReference);
+
 	MMINLINE void updateCopyScanCounts(MM_EnvironmentBase* env, uint64_t slotsScanned, uint64_t slotsCopied);
 	bool splitIndexableObjectScanner(MM_EnvironmentStandard *env, GC_ObjectScanner *objectScanner, uintptr_t startIndex, omrobjectptr_t *rememberedSetSlot);
 
@@ -357,10 +405,13 @@ public:
 	void deepScanOutline(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr, uintptr_t priorityFieldOffset1, uintptr_t priorityFieldOffset2);
 
 	MMINLINE bool scavengeRememberedObject(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr);
+	MMINLINE void scavengeRememberedSetListSlot(MM_EnvironmentStandard *env, omrobjectptr_t *slotPtr);
 	void scavengeRememberedSetList(MM_EnvironmentStandard *env);
 	void scavengeRememberedSetOverflow(MM_EnvironmentStandard *env);
 	MMINLINE void flushRememberedSet(MM_EnvironmentStandard *env);
+	MMINLINE bool pruneRememberedSetListSlot(MM_EnvironmentStandard *env, omrobjectptr_t *slotPtr);
 	void pruneRememberedSetList(MM_EnvironmentStandard *env);
+	void pruneRememberedSetListShards(MM_EnvironmentStandard *env);
 	void pruneRememberedSetOverflow(MM_EnvironmentStandard *env);
 
 	/**
@@ -499,6 +550,46 @@ public:
 	 */
 	bool clearCache(MM_EnvironmentStandard *env, MM_CopyScanCacheStandard *cache);
 
+	/**
+	 * Carve the (empty) survivor space into one slice per NUMA affinity leader, for -Xgc:scavengerNumaAwareCopy.
+	 * Slice boundaries match the ones survivor memory was bound with (see MM_PhysicalSubArenaVirtualMemorySemiSpace).
+	 * Called by the main thread before the scavenge task is dispatched.
+	 * @param env - main thread environment
+	 */
+	void setupSurvivorNodeSlices(MM_EnvironmentStandard *env);
+
+	/**
+	 * Return the unused remainders of the survivor node slices to the survivor memory pool.
+	 * Called by the main thread once all GC threads have stopped copying.
+	 * @param env - main thread environment
+	 */
+	void tearDownSurvivorNodeSlices(MM_EnvironmentStandard *env);
+
+	/**
+	 * Determine which survivor node slice the calling thread should copy into. Worker threads that are not bound
+	 * to a single node are spread round-robin over the nodes (and bound to them for the scavenge, if physical NUMA is available).
+	 * @param env - current thread environment
+	 * @return zero-based slice index
+	 */
+	uintptr_t selectSurvivorNodeSlice(MM_EnvironmentStandard *env);
+
+	/**
+	 * Unbind the calling thread from the node that selectSurvivorNodeSlice() bound it to, if any.
+	 * @param env - current thread environment
+	 */
+	void restoreSurvivorNodeAffinity(MM_EnvironmentStandard *env);
+
+	/**
+	 * Bump-allocate survivor memory from the node slices, starting with the slice of the calling thread's node.
+	 * @param env - current thread environment
+	 * @param minimumSize the smallest acceptable allocation
+	 * @param maximumSize the preferred allocation size (less is returned if the slice has less, but never less than minimumSize)
+	 * @param addrBase[out] base of the allocated memory
+	 * @param addrTop[out] top of the allocated memory
+	 * @return true if the allocation succeeded
+	 */
+	MMINLINE bool allocateFromSurvivorNodeSlices(MM_EnvironmentStandard *env, uintptr_t minimumSize, uintptr_t maximumSize, void * &addrBase, void * &addrTop);
+
 	/**
 	 * Called (typically at the end of GC) to explicitly abandon the TLH remainders (for the calling thread)
 	 */
@@ -607,6 +698,15 @@ public:
 	 */
 	void resetRecommendedThreads() { _recommendedThreads = UDATA_MAX; };
 
+	/**
+	 * Bound the adaptive thread recommendation by the work expected from the scavenge about to start
+	 * (-Xgc:elasticTaskThreads): the bytes the last scavenge copied, plus one average object for every
+	 * remembered set entry. Small scavenges then wake only as many threads as they can keep busy.
+	 *
+	 * @return the number of threads to recommend for the Scavenge task, UDATA_MAX for no recommendation
+	 */
+	uintptr_t calculateElasticWorkingThreads(MM_EnvironmentStandard *env);
+
 	void scavenge(MM_EnvironmentBase *env);
 	bool scavengeCompletedSuccessfully(MM_EnvironmentStandard *env);
 	virtual	void mainThreadGarbageCollect(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool initMarkMap = false, bool rebuildMarkBits = false);
@@ -961,6 +1061,8 @@ public:
 		, _minTenureFailureSize(UDATA_MAX)
 		, _minSemiSpaceFailureSize(UDATA_MAX)
 		, _recommendedThreads(UDATA_MAX)
+		, _copiedBytesLastCycle(UDATA_MAX)
+		, _averageCopiedObjectSize(OMR_MINIMUM_OBJECT_SIZE)
 		, _cycleState()
 		, _collectionStatistics()
 		, _cachedEntryCount(0)
@@ -977,6 +1079,13 @@ public:
 		, _heapBase(NULL)
 		, _heapTop(NULL)
 		, _regionManager(_extensions->heapRegionManager)
+		, _survivorNodeSlices(NULL)
+		, _survivorNodeSliceCount(0)
+		, _survivorNodeSlicesActive(false)
+		, _hotFieldProfile(NULL)
+		, _hotFieldSamplingCycle(false)
+		, _rememberedSetShards(NULL)
+		, _rememberedSetShardsActive(false)
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 		, _mainGCThread(env)
 		, _concurrentPhase(concurrent_phase_idle)
@@ -0,0 +1,124 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "ScavengerHotFieldProfile.hpp"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+#include <string.h>
+
+#include "EnvironmentBase.hpp"
+#include "Forge.hpp"
+
+MM_ScavengerHotFieldProfile *
+MM_ScavengerHotFieldProfile::newInstance(MM_EnvironmentBase *env)
+{
+	MM_ScavengerHotFieldProfile *profile = (MM_ScavengerHotFieldProfile *)env->getForge()->allocate(sizeof(MM_ScavengerHotFieldProfile), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != profile) {
+		new(profile) MM_ScavengerHotFieldProfile();
+		if (!profile->initialize(env)) {
+			profile->kill(env);
+			profile = NULL;
+		}
+	}
+	return profile;
+}
+
+void
+MM_ScavengerHotFieldProfile::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_ScavengerHotFieldProfile::initialize(MM_EnvironmentBase *env)
+{
+	_table = (Entry *)env->getForge()->allocate(sizeof(Entry) * _tableSize, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL == _table) {
+		return false;
+	}
+	memset(_table, 0, sizeof(Entry) * _tableSize);
+	for (uintptr_t i = 0; i < _tableSize; i++) {
+		memset(_table[i].hotFieldOffsets, U_8_MAX, sizeof(_table[i].hotFieldOffsets));
+	}
+	return true;
+}
+
+void
+MM_ScavengerHotFieldProfile::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _table) {
+		env->getForge()->free(_table);
+		_table = NULL;
+	}
+}
+
+void
+MM_ScavengerHotFieldProfile::updateHotFields(MM_EnvironmentBase *env)
+{
+	uintptr_t hotClassCount = 0;
+
+	for (uintptr_t i = 0; i < _tableSize; i++) {
+		Entry *entry = &_table[i];
+		if (0 == entry->key) {
+			continue;
+		}
+
+		/* insertion sort of the slots by count, keeping the _hotFieldCount hottest */
+		uint32_t hotCounts[_hotFieldCount];
+		uint8_t hotSlots[_hotFieldCount];
+		uintptr_t hotSlotCount = 0;
+		for (uintptr_t slot = 0; slot < _maxSlots; slot++) {
+			uint32_t count = entry->slotCounts[slot];
+			if (count >= _minimumSamples) {
+				uintptr_t position = hotSlotCount;
+				while ((0 < position) && (hotCounts[position - 1] < count)) {
+					if (position < _hotFieldCount) {
+						hotCounts[position] = hotCounts[position - 1];
+						hotSlots[position] = hotSlots[position - 1];
+					}
+					position -= 1;
+				}
+				if (position < _hotFieldCount) {
+					hotCounts[position] = count;
+					hotSlots[position] = (uint8_t)slot;
+					if (hotSlotCount < _hotFieldCount) {
+						hotSlotCount += 1;
+					}
+				}
+			}
+			entry->slotCounts[slot] = count / 2;
+		}
+
+		for (uintptr_t hot = 0; hot < _hotFieldCount; hot++) {
+			entry->hotFieldOffsets[hot] = (hot < hotSlotCount) ? hotSlots[hot] : (uint8_t)U_8_MAX;
+		}
+		if (0 < hotSlotCount) {
+			hotClassCount += 1;
+		}
+	}
+
+	_hotClassCount = hotClassCount;
+}
+
+#endif /* OMR_GC_MODRON_SCAVENGER */
@@ -0,0 +1,173 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#if !defined(SCAVENGERHOTFIELDPROFILE_HPP_)
+#define SCAVENGERHOTFIELDPROFILE_HPP_
+
+#include "omrcfg.h"
+#include "omr.h"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+#include "AtomicOperations.hpp"
+#include "BaseVirtual.hpp"
+
+class MM_EnvironmentBase;
+
+/**
+ * Sampled per-class profile of the reference slots that lead the scavenger to surviving objects.
+ *
+ * Sampling threads record, for a subset of the objects they scan, which slots refer into evacuate
+ * space. Between scavenges the counts are reduced to at most three hot slots per class, which the
+ * scavenger depth copies right after the parent object so that parent and children end up adjacent
+ * in survivor or tenure space. Classes are identified by the key returned by the object model's
+ * getHotFieldProfileKey(); the table is fixed size and classes that do not fit are not profiled.
+ *
+ * Counts are updated without synchronization, lost increments only make the profile less precise.
+ *
+ * @ingroup GC_Modron_Standard
+ */
+class MM_ScavengerHotFieldProfile : public MM_BaseVirtual
+{
+/* Data members */
+public:
+	enum {
+		_tableSize = 256, /**< Number of classes that can be profiled (must be a power of two) */
+		_maxProbes = 8, /**< Open addressing probe limit before a class is dropped */
+		_maxSlots = 32, /**< Slots at this index or beyond are not profiled */
+		_hotFieldCount = 3, /**< Hot slots kept per class, matching the glue's getHotFieldOffset..3 */
+		_minimumSamples = 16 /**< Samples a slot needs in the decayed count before it is considered hot */
+	};
+
+	struct Entry {
+		volatile uintptr_t key; /**< Class key, 0 for an unused entry */
+		uint32_t slotCounts[_maxSlots]; /**< Decayed number of samples in which each slot referred into evacuate space */
+		uint8_t hotFieldOffsets[_hotFieldCount]; /**< Hottest slot indices in decreasing order, U_8_MAX terminated */
+	};
+
+private:
+	Entry *_table;
+	uintptr_t _hotClassCount; /**< Number of classes with at least one hot slot after the last update */
+
+/* Methods */
+private:
+	MMINLINE static uintptr_t hash(uintptr_t key)
+	{
+		return (key ^ (key >> 7) ^ (key >> 17)) & (_tableSize - 1);
+	}
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+public:
+	static MM_ScavengerHotFieldProfile *newInstance(MM_EnvironmentBase *env);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Find the entry for a class, claiming an unused entry if the class has not been seen.
+	 * @param key the class key (0 if the object should not be profiled)
+	 * @return the entry, or NULL if the key is 0 or the table has no room for it
+	 */
+	MMINLINE Entry *findOrAddEntry(uintptr_t key)
+	{
+		if (0 != key) {
+			uintptr_t index = hash(key);
+			for (uintptr_t probe = 0; probe < _maxProbes; probe++) {
+				Entry *entry = &_table[(index + probe) & (_tableSize - 1)];
+				uintptr_t entryKey = entry->key;
+				if (0 == entryKey) {
+					entryKey = MM_AtomicOperations::lockCompareExchange(&entry->key, 0, key);
+					if (0 == entryKey) {
+						return entry;
+					}
+				}
+				if (key == entryKey) {
+					return entry;
+				}
+			}
+		}
+		return NULL;
+	}
+
+	/**
+	 * Record that a slot of a sampled object referred into evacuate space.
+	 * @param entry the entry for the class of the sampled object
+	 * @param slotIndex index of the slot from the start of the object, in slots
+	 */
+	MMINLINE void recordSlot(Entry *entry, uintptr_t slotIndex)
+	{
+		if (slotIndex < _maxSlots) {
+			entry->slotCounts[slotIndex] += 1;
+		}
+	}
+
+	/**
+	 * Get the hot slots discovered for a class.
+	 * @param key the class key
+	 * @return U_8_MAX terminated array of up to _hotFieldCount slot indices, or NULL if the class has no hot slot
+	 */
+	MMINLINE const uint8_t *getHotFieldOffsets(uintptr_t key)
+	{
+		if (0 != key) {
+			uintptr_t index = hash(key);
+			for (uintptr_t probe = 0; probe < _maxProbes; probe++) {
+				Entry *entry = &_table[(index + probe) & (_tableSize - 1)];
+				uintptr_t entryKey = entry->key;
+				if (key == entryKey) {
+					return (U_8_MAX != entry->hotFieldOffsets[0]) ? entry->hotFieldOffsets : NULL;
+				} else if (0 == entryKey) {
+					break;
+				}
+			}
+		}
+		return NULL;
+	}
+
+	/**
+	 * Recompute the hot slots of every class from the samples, then halve the counts so that the
+	 * profile follows changes in the workload. Must only be called while no thread is copying.
+	 * @param env the calling thread
+	 */
+	void updateHotFields(MM_EnvironmentBase *env);
+
+	/**
+	 * @return the number of classes with at least one hot slot after the last update
+	 */
+	MMINLINE uintptr_t getHotClassCount() { return _hotClassCount; }
+
+	MM_ScavengerHotFieldProfile()
+		: MM_BaseVirtual()
+		, _table(NULL)
+		, _hotClassCount(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* OMR_GC_MODRON_SCAVENGER */
+#endif /* SCAVENGERHOTFIELDPROFILE_HPP_ */
@@ -0,0 +1,179 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "ScavengerRememberedSetShards.hpp"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+#include <string.h>
+
+#include "EnvironmentBase.hpp"
+#include "Forge.hpp"
+#include "SublistIterator.hpp"
+#include "SublistPool.hpp"
+#include "SublistPuddle.hpp"
+
+MM_ScavengerRememberedSetShards *
+MM_ScavengerRememberedSetShards::newInstance(MM_EnvironmentBase *env, uintptr_t maximumShardCount, uintptr_t chunkSize)
+{
+	MM_ScavengerRememberedSetShards *shards = (MM_ScavengerRememberedSetShards *)env->getForge()->allocate(sizeof(MM_ScavengerRememberedSetShards), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != shards) {
+		new(shards) MM_ScavengerRememberedSetShards();
+		if (!shards->initialize(env, maximumShardCount, chunkSize)) {
+			shards->kill(env);
+			shards = NULL;
+		}
+	}
+	return shards;
+}
+
+void
+MM_ScavengerRememberedSetShards::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_ScavengerRememberedSetShards::initialize(MM_EnvironmentBase *env, uintptr_t maximumShardCount, uintptr_t chunkSize)
+{
+	_shardCapacity = OMR_MAX(maximumShardCount, 1);
+	_forcedChunkSize = chunkSize;
+	_shards = (Shard *)env->getForge()->allocate(sizeof(Shard) * _shardCapacity, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL == _shards) {
+		return false;
+	}
+	memset(_shards, 0, sizeof(Shard) * _shardCapacity);
+	return true;
+}
+
+void
+MM_ScavengerRememberedSetShards::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _chunks) {
+		env->getForge()->free(_chunks);
+		_chunks = NULL;
+	}
+	if (NULL != _shards) {
+		env->getForge()->free(_shards);
+		_shards = NULL;
+	}
+}
+
+void
+MM_ScavengerRememberedSetShards::startBuild(MM_SublistPool *pool, uintptr_t shardCount)
+{
+	_shardCount = OMR_MAX(OMR_MIN(shardCount, _shardCapacity), 1);
+	_chunkCount = 0;
+	_chunkSize = _forcedChunkSize;
+	if (0 == _chunkSize) {
+		/* enough chunks for stealing to even out the threads, but not so many that claiming them dominates */
+		_chunkSize = pool->countElements() / (_shardCount * _chunksPerShard);
+		_chunkSize = OMR_MIN(OMR_MAX(_chunkSize, (uintptr_t)_minimumChunkSize), (uintptr_t)_maximumChunkSize);
+	}
+}
+
+bool
+MM_ScavengerRememberedSetShards::growChunks(MM_EnvironmentBase *env)
+{
+	uintptr_t newCapacity = OMR_MAX(_chunkCapacity * 2, (uintptr_t)256);
+	Chunk *newChunks = (Chunk *)env->getForge()->allocate(sizeof(Chunk) * newCapacity, OMR::GC::AllocationCategory::OTHER, OMR_GET_CALLSITE());
+	if (NULL == newChunks) {
+		return false;
+	}
+	if (NULL != _chunks) {
+		memcpy(newChunks, _chunks, sizeof(Chunk) * _chunkCount);
+		env->getForge()->free(_chunks);
+	}
+	_chunks = newChunks;
+	_chunkCapacity = newCapacity;
+	return true;
+}
+
+bool
+MM_ScavengerRememberedSetShards::addPuddle(MM_EnvironmentBase *env, MM_SublistPuddle *puddle)
+{
+	uintptr_t *base = puddle->getListBase();
+	uintptr_t *top = puddle->getListCurrent();
+	while (base < top) {
+		if ((_chunkCount == _chunkCapacity) && !growChunks(env)) {
+			return false;
+		}
+		uintptr_t *chunkTop = (((uintptr_t)(top - base)) > _chunkSize) ? (base + _chunkSize) : top;
+		_chunks[_chunkCount].base = base;
+		_chunks[_chunkCount].top = chunkTop;
+		_chunkCount += 1;
+		base = chunkTop;
+	}
+	return true;
+}
+
+void
+MM_ScavengerRememberedSetShards::finishBuild()
+{
+	/* each shard gets a contiguous run of chunks, so a thread working its own shard walks puddle memory in order */
+	for (uintptr_t i = 0; i < _shardCount; i++) {
+		_shards[i]._next = (_chunkCount * i) / _shardCount;
+		_shards[i]._top = (_chunkCount * (i + 1)) / _shardCount;
+	}
+}
+
+bool
+MM_ScavengerRememberedSetShards::buildFromPreviousPuddles(MM_EnvironmentBase *env, MM_SublistPool *pool, uintptr_t shardCount)
+{
+	startBuild(pool, shardCount);
+	for (MM_SublistPuddle *puddle = pool->peekPreviousPuddle(); NULL != puddle; puddle = puddle->getNext()) {
+		if (!addPuddle(env, puddle)) {
+			_chunkCount = 0;
+			finishBuild();
+			return false;
+		}
+	}
+	finishBuild();
+
+	/* the chunks now stand for the puddles, hand them back to the pool so that new entries can follow them */
+	MM_SublistPuddle *puddle = pool->popPreviousPuddle(NULL);
+	while (NULL != puddle) {
+		puddle = pool->popPreviousPuddle(puddle);
+	}
+
+	return true;
+}
+
+bool
+MM_ScavengerRememberedSetShards::buildFromPuddles(MM_EnvironmentBase *env, MM_SublistPool *pool, uintptr_t shardCount)
+{
+	startBuild(pool, shardCount);
+	GC_SublistIterator puddleIterator(pool);
+	MM_SublistPuddle *puddle = NULL;
+	while (NULL != (puddle = puddleIterator.nextList())) {
+		if (!addPuddle(env, puddle)) {
+			_chunkCount = 0;
+			finishBuild();
+			return false;
+		}
+	}
+	finishBuild();
+	return true;
+}
+
+#endif /* OMR_GC_MODRON_SCAVENGER */
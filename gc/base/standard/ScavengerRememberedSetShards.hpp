@@ -0,0 +1,173 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#if !defined(SCAVENGERREMEMBEREDSETSHARDS_HPP_)
+#define SCAVENGERREMEMBEREDSETSHARDS_HPP_
+
+#include "omrcfg.h"
+#include "omr.h"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+#include "AtomicOperations.hpp"
+#include "BaseVirtual.hpp"
+
+class MM_EnvironmentBase;
+class MM_SublistPool;
+class MM_SublistPuddle;
+
+/**
+ * Work division for the parallel scan and prune of the scavenger remembered set list.
+ *
+ * The puddles of the remembered set are cut into chunks of contiguous entries, and the chunks are
+ * dealt out to one shard per GC thread. A thread claims chunks from its own shard first, then steals
+ * from the shards of the other threads, so a thread that gets a puddle full of large objects does
+ * not hold up the phase. Claiming a chunk is a single atomic increment; unlike popping puddles from
+ * the sublist pool it takes no lock.
+ *
+ * Chunks are fixed when the shards are built. Entries added to the pool afterwards are not covered.
+ *
+ * @ingroup GC_Modron_Standard
+ */
+class MM_ScavengerRememberedSetShards : public MM_BaseVirtual
+{
+/* Data members */
+public:
+	enum {
+		_chunksPerShard = 16, /**< Chunks each shard gets when chunk size is derived from the remembered set size */
+		_minimumChunkSize = 64, /**< Smallest derived chunk size, in entries */
+		_maximumChunkSize = 4096 /**< Largest derived chunk size, in entries */
+	};
+
+	struct Chunk {
+		uintptr_t *base; /**< First entry of the chunk */
+		uintptr_t *top; /**< One past the last entry of the chunk */
+	};
+
+private:
+	struct Shard {
+		volatile uintptr_t _next; /**< Index in _chunks of the next unclaimed chunk of the shard */
+		uintptr_t _top; /**< Index in _chunks one past the last chunk of the shard */
+		uint8_t _padding[64 - (2 * sizeof(uintptr_t))]; /**< keep the claim counters of different shards on separate cache lines */
+	};
+
+	Chunk *_chunks; /**< Chunks of all shards, each shard owning a contiguous range */
+	uintptr_t _chunkCount; /**< Number of chunks in use */
+	uintptr_t _chunkCapacity; /**< Number of chunks _chunks can hold */
+	uintptr_t _chunkSize; /**< Entries per chunk for the current build */
+	Shard *_shards; /**< Array of _shardCapacity shards */
+	uintptr_t _shardCount; /**< Number of shards in use */
+	uintptr_t _shardCapacity; /**< Number of shards _shards can hold (maximum GC thread count) */
+	uintptr_t _forcedChunkSize; /**< Chunk size set on the command line, 0 to derive it from the remembered set size */
+
+/* Methods */
+private:
+	void startBuild(MM_SublistPool *pool, uintptr_t shardCount);
+	bool addPuddle(MM_EnvironmentBase *env, MM_SublistPuddle *puddle);
+	bool growChunks(MM_EnvironmentBase *env);
+	void finishBuild();
+
+protected:
+	bool initialize(MM_EnvironmentBase *env, uintptr_t maximumShardCount, uintptr_t chunkSize);
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+public:
+	static MM_ScavengerRememberedSetShards *newInstance(MM_EnvironmentBase *env, uintptr_t maximumShardCount, uintptr_t chunkSize);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Build the shards over the puddles set aside by MM_SublistPool::startProcessingSublist(). On success
+	 * the puddles are returned to the pool, as if popped and processed. Must be called by a single thread.
+	 * @param env the calling thread
+	 * @param pool the remembered set
+	 * @param shardCount number of GC threads that will claim chunks
+	 * @return true on success, false if the chunk table could not grow. In that case the puddles are left
+	 * on the previous puddle list and the shards must not be used.
+	 */
+	bool buildFromPreviousPuddles(MM_EnvironmentBase *env, MM_SublistPool *pool, uintptr_t shardCount);
+
+	/**
+	 * Build the shards over every puddle of the pool. Must be called by a single thread.
+	 * @param env the calling thread
+	 * @param pool the remembered set
+	 * @param shardCount number of GC threads that will claim chunks
+	 * @return true on success, false if the chunk table could not grow (the shards must not be used)
+	 */
+	bool buildFromPuddles(MM_EnvironmentBase *env, MM_SublistPool *pool, uintptr_t shardCount);
+
+	/**
+	 * Claim the next chunk for a GC thread, from its own shard if possible and otherwise from the
+	 * other shards in turn.
+	 * @param workerID the worker ID of the calling thread, which selects its own shard
+	 * @return the chunk, or NULL once every chunk has been claimed
+	 */
+	MMINLINE Chunk *nextChunk(uintptr_t workerID)
+	{
+		uintptr_t shardIndex = workerID % _shardCount;
+		for (uintptr_t i = 0; i < _shardCount; i++) {
+			Shard *shard = &_shards[shardIndex];
+			if (shard->_next < shard->_top) {
+				uintptr_t chunkIndex = MM_AtomicOperations::add(&shard->_next, 1) - 1;
+				if (chunkIndex < shard->_top) {
+					return &_chunks[chunkIndex];
+				}
+			}
+			shardIndex += 1;
+			if (shardIndex == _shardCount) {
+				shardIndex = 0;
+			}
+		}
+		return NULL;
+	}
+
+	/**
+	 * @return the number of chunks of the last build
+	 */
+	MMINLINE uintptr_t getChunkCount() { return _chunkCount; }
+
+	/**
+	 * @return the number of shards of the last build
+	 */
+	MMINLINE uintptr_t getShardCount() { return _shardCount; }
+
+	MM_ScavengerRememberedSetShards()
+		: MM_BaseVirtual()
+		, _chunks(NULL)
+		, _chunkCount(0)
+		, _chunkCapacity(0)
+		, _chunkSize(0)
+		, _shards(NULL)
+		, _shardCount(0)
+		, _shardCapacity(0)
+		, _forcedChunkSize(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* OMR_GC_MODRON_SCAVENGER */
+#endif /* SCAVENGERREMEMBEREDSETSHARDS_HPP_ */
@@ -32,6 +32,9 @@
 #include "ObjectModel.hpp"
 #include "Scavenger.hpp"
 #include "SlotObject.hpp"
+#if defined(OMR_GC_SEGREGATED_HEAP)
+#include "SegregatedGC.hpp"
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 
 struct OMR_VMThread;
 
@@ -70,9 +73,33 @@ standardWriteBarrier(OMR_VMThread *omrThread, omrobjectptr_t parentObject, omrob
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_MODRON_CONCURRENT_MARK) */
 }
 
+/**
+ * Out-of-line pre-write barrier. Must be called before a reference slot is overwritten.
+ *
+ * With -Xgc:incrementalSegregatedGC, while an incremental mark is in progress, this records the reference
+ * about to be overwritten so that everything reachable at the start of the mark is marked.
+ *
+ * @param omrThread The thread overwriting the slot
+ * @param parentSlot Points to the slot that is about to be overwritten
+ */
+MMINLINE void
+standardPreWriteBarrier(OMR_VMThread *omrThread, fomrobject_t *parentSlot)
+{
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(omrThread->_vm);
+	if (extensions->incrementalSegregatedGC) {
+		MM_SegregatedMarkingScheme *markingScheme = ((MM_SegregatedGC *)extensions->getGlobalCollector())->getMarkingScheme();
+		if (markingScheme->isIncrementalMarkActive()) {
+			GC_SlotObject slotObject(omrThread->_vm, parentSlot);
+			markingScheme->rememberDeletedReference(MM_EnvironmentBase::getEnvironment(omrThread), slotObject.readReferenceFromSlot());
+		}
+	}
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+}
+
 /**
  * Convenience method to effect the assignment of a child reference to a parent slot and call
- * out-of-line write barrier.
+ * out-of-line pre-write and write barriers.
  *
  * @param omrThread The thread making the assignment of child reference to parent slot
  * @param parentObject the parent object
@@ -83,6 +110,8 @@ standardWriteBarrier(OMR_VMThread *omrThread, omrobjectptr_t parentObject, omrob
 MMINLINE void
 standardWriteBarrierStore(OMR_VMThread *omrThread, omrobjectptr_t parentObject, fomrobject_t *parentSlot, omrobjectptr_t childObject)
 {
+	standardPreWriteBarrier(omrThread, parentSlot);
+
 	GC_SlotObject slotObject(omrThread->_vm, parentSlot);
 	slotObject.writeReferenceToSlot(childObject);
 
@@ -63,11 +63,25 @@ collectorCreationHelper(OMR_VM *omrVM, MM_EnvironmentBase *env)
 	} else {
 		globalCollector->setGlobalCollector(true);
 		extensions->setGlobalCollector(globalCollector);
+	}
 
-		if (!extensions->getGlobalCollector()->collectorStartup(extensions)) {
-			omrtty_printf("Failed to start global collector.\n");
-			rc = OMR_ERROR_INTERNAL;
-		}
+	return rc;
+}
+
+/**
+ * Start the global collector's own threads. Threads attaching to the VM get an allocation
+ * context, so this must not run before the default memory space exists.
+ */
+static omr_error_t
+collectorStartupHelper(OMR_VM *omrVM)
+{
+	OMRPORT_ACCESS_FROM_OMRVM(omrVM);
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(omrVM);
+	omr_error_t rc = OMR_ERROR_NONE;
+
+	if (!extensions->getGlobalCollector()->collectorStartup(extensions)) {
+		omrtty_printf("Failed to start global collector.\n");
+		rc = OMR_ERROR_INTERNAL;
 	}
 
 	return rc;
@@ -179,6 +193,11 @@ heapCreationHelper(OMR_VM *omrVM, MM_StartupManager *startupManager, bool create
 	extensions->configuration->defaultMemorySpaceAllocated(extensions, memorySpace);
 	extensions->heap->setDefaultMemorySpace(memorySpace);
 
+	if (createCollector && (OMR_ERROR_NONE != collectorStartupHelper(omrVM))) {
+		rc = OMR_ERROR_INTERNAL;
+		goto done;
+	}
+
 	if (startupManager->isVerboseEnabled()) {
 		extensions->verboseGCManager = startupManager->createVerboseManager(&envBase);
 		if (NULL == extensions->verboseGCManager) {
@@ -283,6 +302,8 @@ OMR_GC_InitializeCollector(OMR_VMThread* omrVMThread)
 
 			/* Make sure sweep scheme is up-to-date with the heap configuration */
 			globalCollector->heapReconfigured(env, HEAP_RECONFIG_EXPAND, NULL, NULL, NULL);
+
+			rc = collectorStartupHelper(omrVMThread->_vm);
 		}
 	}
 
@@ -41,6 +41,7 @@ public:
 	uintptr_t _tlhAllocatedReused; 		/**< The amount of memory allocated form reused TLHs. */
 	uintptr_t _tlhRequestedBytes; 		/**< The amount of memory requested for refreshes. */
 	uintptr_t _tlhDiscardedBytes; 		/**< The amount of memory from discarded TLHs. */
+	uintptr_t _tlhFlushedBytes; 		/**< The amount of memory left unused in TLHs when they were flushed. */
 	uintptr_t _tlhMaxAbandonedListSize; /**< The maximum size of the abandoned list. */
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 
@@ -65,6 +66,8 @@ public:
 	uintptr_t tlhBytesAllocated() { return _tlhAllocatedFresh - _tlhDiscardedBytes; }
 	uintptr_t tlhBytesAllocatedUsed() { return _tlhAllocatedUsed; }
 	uintptr_t nontlhBytesAllocated() { return _allocationBytes; }
+	uintptr_t tlhRefreshCount() { return _tlhRefreshCountFresh + _tlhRefreshCountReused; }
+	uintptr_t tlhWastedBytes() { return _tlhDiscardedBytes + _tlhFlushedBytes; }
 #endif
 
 	/* return bytesAllocated includes new refreshed TLH, if includeJustRefreshedTLH == true(default)
@@ -108,6 +111,7 @@ public:
 		_tlhAllocatedReused(0),
 		_tlhRequestedBytes(0),
 		_tlhDiscardedBytes(0),
+		_tlhFlushedBytes(0),
 		_tlhMaxAbandonedListSize(0),
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 		_arrayletLeafAllocationCount(0),
@@ -48,6 +48,13 @@ MM_CompactStats::clear()
 	_fixupEndTime = 0;
 	_rootFixupStartTime = 0;
 	_rootFixupEndTime = 0;
+	_rebuildFreelistStartTime = 0;
+	_rebuildFreelistEndTime = 0;
+	_rebuildMarkBitsStartTime = 0;
+	_rebuildMarkBitsEndTime = 0;
+	_fixupOverlappedSubAreas = 0;
+	_windowBytes = 0;
+	_windowFreeBytes = 0;
 };
 
 void
@@ -65,6 +72,19 @@ MM_CompactStats::merge(MM_CompactStats *statsToMerge)
 	_fixupEndTime = OMR_MAX(_fixupEndTime, statsToMerge->_fixupEndTime);
 	_rootFixupStartTime = (0 == _rootFixupStartTime) ? statsToMerge->_rootFixupStartTime : OMR_MIN(_rootFixupStartTime, statsToMerge->_rootFixupStartTime);
 	_rootFixupEndTime = OMR_MAX(_rootFixupEndTime, statsToMerge->_rootFixupEndTime);
+	/* free lists are rebuilt by the main thread only and mark bits only on request, so skip threads that did not record these phases */
+	if (0 != statsToMerge->_rebuildFreelistStartTime) {
+		_rebuildFreelistStartTime = (0 == _rebuildFreelistStartTime) ? statsToMerge->_rebuildFreelistStartTime : OMR_MIN(_rebuildFreelistStartTime, statsToMerge->_rebuildFreelistStartTime);
+		_rebuildFreelistEndTime = OMR_MAX(_rebuildFreelistEndTime, statsToMerge->_rebuildFreelistEndTime);
+	}
+	if (0 != statsToMerge->_rebuildMarkBitsStartTime) {
+		_rebuildMarkBitsStartTime = (0 == _rebuildMarkBitsStartTime) ? statsToMerge->_rebuildMarkBitsStartTime : OMR_MIN(_rebuildMarkBitsStartTime, statsToMerge->_rebuildMarkBitsStartTime);
+		_rebuildMarkBitsEndTime = OMR_MAX(_rebuildMarkBitsEndTime, statsToMerge->_rebuildMarkBitsEndTime);
+	}
+	_fixupOverlappedSubAreas += statsToMerge->_fixupOverlappedSubAreas;
+	/* the window is selected by a single thread */
+	_windowBytes += statsToMerge->_windowBytes;
+	_windowFreeBytes += statsToMerge->_windowFreeBytes;
 };
 
 #endif /* OMR_GC_MODRON_COMPACTION */
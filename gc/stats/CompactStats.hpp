@@ -58,6 +58,13 @@ public:
 	uint64_t _fixupEndTime;
 	uint64_t _rootFixupStartTime;
 	uint64_t _rootFixupEndTime;
+	uint64_t _rebuildFreelistStartTime;
+	uint64_t _rebuildFreelistEndTime;
+	uint64_t _rebuildMarkBitsStartTime;
+	uint64_t _rebuildMarkBitsEndTime;
+	uintptr_t _fixupOverlappedSubAreas; /**< Number of sub areas fixed up while other threads were still moving objects (pipelined compaction) */
+	uintptr_t _windowBytes; /**< Span of the sub areas evacuated by a window compaction (0 if the whole heap was compacted) */
+	uintptr_t _windowFreeBytes; /**< Free memory within the window before it was compacted */
 		
 	/* Remember gc count on last compaction of heap */
 	uintptr_t _lastHeapCompaction;
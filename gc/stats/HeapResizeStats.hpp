@@ -71,6 +71,13 @@ private:
 	uint64_t 				_ticksOutsideGC[RATIO_RESIZE_HISTORIES];
 	bool					_excludeCurrentGCTimeFromStats;
 
+	/* Background release of free heap pages (-Xgc:backgroundHeapRelease) */
+	uintptr_t				_backgroundReleasePassCount; /**< number of passes made by the background heap releaser */
+	uintptr_t				_backgroundReleasedBytes; /**< total bytes decommitted by the background heap releaser */
+	uintptr_t				_backgroundRecommittedBytes; /**< total released bytes found allocated from again (commit churn) */
+	uintptr_t				_releasedFreePageBytes; /**< bytes of free chunks currently decommitted, as of the last pass */
+	uintptr_t				_estimatedResidentHeapBytes; /**< active heap size less _releasedFreePageBytes, as of the last pass */
+
 protected:
 public:
 
@@ -179,6 +186,27 @@ public:
 	MMINLINE void setExcludeCurrentGCTimeFromStats() { _excludeCurrentGCTimeFromStats = TRUE; }
 	MMINLINE bool getExcludeCurrentGCTimeFromStats() { return _excludeCurrentGCTimeFromStats; }
 
+	/**
+	 * Record the result of a background heap release pass.
+	 * @param releasedBytes bytes decommitted by the pass
+	 * @param recommittedBytes bytes released by earlier passes that were found allocated from again
+	 * @param releasedFreePageBytes bytes of free chunks decommitted after the pass
+	 * @param activeHeapBytes active heap size after the pass
+	 */
+	MMINLINE void recordBackgroundReleasePass(uintptr_t releasedBytes, uintptr_t recommittedBytes, uintptr_t releasedFreePageBytes, uintptr_t activeHeapBytes)
+	{
+		_backgroundReleasePassCount += 1;
+		_backgroundReleasedBytes += releasedBytes;
+		_backgroundRecommittedBytes += recommittedBytes;
+		_releasedFreePageBytes = releasedFreePageBytes;
+		_estimatedResidentHeapBytes = (activeHeapBytes > releasedFreePageBytes) ? (activeHeapBytes - releasedFreePageBytes) : 0;
+	}
+	MMINLINE uintptr_t getBackgroundReleasePassCount() { return _backgroundReleasePassCount; }
+	MMINLINE uintptr_t getBackgroundReleasedBytes() { return _backgroundReleasedBytes; }
+	MMINLINE uintptr_t getBackgroundRecommittedBytes() { return _backgroundRecommittedBytes; }
+	MMINLINE uintptr_t getReleasedFreePageBytes() { return _releasedFreePageBytes; }
+	MMINLINE uintptr_t getEstimatedResidentHeapBytes() { return _estimatedResidentHeapBytes; }
+
 	MM_HeapResizeStats() :
 		MM_Base(),
 		_lastAFEndTime(0),
@@ -196,7 +224,12 @@ public:
 		_lastGCPercentage(0),
 		_lastTimeOutsideGC(0),
 		_globalGCCountAtAF(0),
-		_excludeCurrentGCTimeFromStats(true)
+		_excludeCurrentGCTimeFromStats(true),
+		_backgroundReleasePassCount(0),
+		_backgroundReleasedBytes(0),
+		_backgroundRecommittedBytes(0),
+		_releasedFreePageBytes(0),
+		_estimatedResidentHeapBytes(0)
 	{
 		resetRatioTicks();
 	}
@@ -38,6 +38,9 @@ public:
 	uintptr_t _allocBytes;
 	uintptr_t _allocDiscardedBytes;
 	uintptr_t _allocSearchCount;
+	uintptr_t _allocSizeClassBinStarts; /**< allocate searches that started from a size class bin */
+	uintptr_t _allocTLHCarveCount; /**< TLHs carved from a detached chunk (approximate) */
+	uintptr_t _allocTLHCarveChunkCount; /**< chunks detached from the free list to carve TLHs from */
 	
 	/* Number of bytes free at end of last GC */
 	uintptr_t _lastFreeBytes;
@@ -54,6 +57,9 @@ public:
 		_allocBytes(0),
 		_allocDiscardedBytes(0),
 		_allocSearchCount(0),
+		_allocSizeClassBinStarts(0),
+		_allocTLHCarveCount(0),
+		_allocTLHCarveChunkCount(0),
 		_lastFreeBytes(0),
 		_activeFreeEntryCount(0),
 		_inactiveFreeEntryCount(0)
@@ -35,6 +35,10 @@ MM_MarkStats::clear()
 	_objectsMarked = 0;
 	_objectsScanned = 0;
 	_bytesScanned = 0;
+	_prefetchQueueEntries = 0;
+	_prefetchQueueMarked = 0;
+	_deletedReferences = 0;
+	_incrementalQuanta = 0;
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	_syncStallCount = 0;
@@ -52,6 +56,9 @@ MM_MarkStats::merge(MM_MarkStats *statsToMerge)
 	_objectsMarked += statsToMerge->_objectsMarked;
 	_objectsScanned += statsToMerge->_objectsScanned;
 	_bytesScanned += statsToMerge->_bytesScanned;
+	_prefetchQueueEntries += statsToMerge->_prefetchQueueEntries;
+	_prefetchQueueMarked += statsToMerge->_prefetchQueueMarked;
+	_deletedReferences += statsToMerge->_deletedReferences;
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	/* It may not ever be useful to merge these stats, but do it anyways */
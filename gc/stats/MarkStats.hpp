@@ -48,6 +48,10 @@ public:
 	uintptr_t _objectsMarked;  /**< The number of objects found through scanning during marking */
 	uintptr_t _objectsScanned;  /**< The number of objects popped and scanned during marking (e.g., non-base type arrays) */
 	uintptr_t _bytesScanned; /**< The number of bytes scanned by the owning thread (or globally) during marking */
+	uintptr_t _prefetchQueueEntries; /**< The number of slots deferred through the prefetch queue during marking */
+	uintptr_t _prefetchQueueMarked; /**< The number of deferred slots whose target was marked by this thread when dequeued */
+	uintptr_t _deletedReferences; /**< The number of references recorded by the incremental segregated pre-write barrier that this thread marked */
+	uintptr_t _incrementalQuanta; /**< The number of incremental segregated quanta that marked before the final pause (global stats only) */
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	uintptr_t _syncStallCount; /**< The number of times the thread stalled at a sync point */
@@ -110,6 +114,10 @@ public:
 		,_objectsMarked(0)
 		,_objectsScanned(0)
 		,_bytesScanned(0)
+		,_prefetchQueueEntries(0)
+		,_prefetchQueueMarked(0)
+		,_deletedReferences(0)
+		,_incrementalQuanta(0)
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 		,_syncStallCount(0)
 		,_syncStallTime(0)
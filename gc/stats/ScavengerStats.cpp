@@ -84,12 +84,24 @@ MM_ScavengerStats::MM_ScavengerStats()
 	,_tenureSpaceAllocBytesAcumulation(0)
 	,_semiSpaceAllocationCountLarge(0)
 	,_semiSpaceAllocationCountSmall(0)
+	,_semiSpaceAllocationCountLocalNode(0)
+	,_semiSpaceAllocationCountRemoteNode(0)
 	,_tenureSpaceAllocationCountLarge(0)
 	,_tenureSpaceAllocationCountSmall(0)
 	,_tenureExpandedBytes(0)
 	,_tenureExpandedCount(0)
 	,_tenureExpandedTime(0)
 	,_leafObjectCount(0)
+	,_prefetchQueueEntries(0)
+	,_prefetchQueueCopied(0)
+	,_hotFieldCopyCount(0)
+	,_hotFieldColocatedCount(0)
+	,_rememberedSetScanEntries(0)
+	,_rememberedSetScanThreads(0)
+	,_rememberedSetScanTime(0)
+	,_rememberedSetScanTimeMax(0)
+	,_rememberedSetScanShards(0)
+	,_rememberedSetScanChunks(0)
 	,_copy_cachesize_sum(0)
 	,_slotsCopied(0)
 	,_slotsScanned(0)
@@ -187,6 +199,8 @@ MM_ScavengerStats::clear(bool firstIncrement)
 
 	_semiSpaceAllocationCountLarge = 0;
 	_semiSpaceAllocationCountSmall = 0;
+	_semiSpaceAllocationCountLocalNode = 0;
+	_semiSpaceAllocationCountRemoteNode = 0;
 	_tenureSpaceAllocationCountLarge = 0;
 	_tenureSpaceAllocationCountSmall = 0;
 
@@ -208,6 +222,16 @@ MM_ScavengerStats::clear(bool firstIncrement)
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 
 	_leafObjectCount = 0;
+	_prefetchQueueEntries = 0;
+	_prefetchQueueCopied = 0;
+	_hotFieldCopyCount = 0;
+	_hotFieldColocatedCount = 0;
+	_rememberedSetScanEntries = 0;
+	_rememberedSetScanThreads = 0;
+	_rememberedSetScanTime = 0;
+	_rememberedSetScanTimeMax = 0;
+	_rememberedSetScanShards = 0;
+	_rememberedSetScanChunks = 0;
 	_copy_cachesize_sum = 0;
 	memset(_copy_distance_counts, 0, sizeof(_copy_distance_counts));
 	memset(_copy_cachesize_counts, 0, sizeof(_copy_cachesize_counts));
@@ -134,6 +134,8 @@ public:
 
 	uintptr_t _semiSpaceAllocationCountLarge;
 	uintptr_t _semiSpaceAllocationCountSmall;
+	uintptr_t _semiSpaceAllocationCountLocalNode; /**< Survivor allocations satisfied from the allocating thread's own NUMA node survivor slice */
+	uintptr_t _semiSpaceAllocationCountRemoteNode; /**< Survivor allocations satisfied from another NUMA node's survivor slice because the local slice was exhausted */
 	uintptr_t _tenureSpaceAllocationCountLarge;
 	uintptr_t _tenureSpaceAllocationCountSmall;
 
@@ -142,6 +144,16 @@ public:
 	uint64_t _tenureExpandedTime; /**< Time taken expanding the heap in order to complete the collection, in hi-res ticks */
 
 	uint64_t _leafObjectCount;
+	uintptr_t _prefetchQueueEntries; /**< The number of slots deferred through the prefetch queue while scanning */
+	uintptr_t _prefetchQueueCopied; /**< The number of deferred slots whose target was copied by this thread when dequeued */
+	uintptr_t _hotFieldCopyCount; /**< The number of hot field objects depth copied right after their parent */
+	uintptr_t _hotFieldColocatedCount; /**< The number of depth copied hot field objects placed within a cache line of the end of their parent */
+	uintptr_t _rememberedSetScanEntries; /**< The number of remembered set list entries scanned as roots */
+	uintptr_t _rememberedSetScanThreads; /**< The number of threads that took part in the remembered set list scan */
+	uint64_t _rememberedSetScanTime; /**< The time, in hi-res ticks, threads spent scanning the remembered set list, summed over threads */
+	uint64_t _rememberedSetScanTimeMax; /**< The time, in hi-res ticks, the slowest thread spent scanning the remembered set list */
+	uintptr_t _rememberedSetScanShards; /**< The number of shards the remembered set list was divided into for the scan, 0 if it was divided by puddle */
+	uintptr_t _rememberedSetScanChunks; /**< The number of remembered set list chunks claimed by the scan */
 	uint64_t _copy_distance_counts[OMR_SCAVENGER_DISTANCE_BINS];
 	uint64_t _copy_cachesize_counts[OMR_SCAVENGER_CACHESIZE_BINS];
 	uint64_t _copy_cachesize_sum;
@@ -227,6 +239,30 @@ public:
 	}
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 
+	MMINLINE void
+	addToRememberedSetScanTime(uint64_t startTime, uint64_t endTime, uintptr_t entries)
+	{
+		uint64_t scanTime = endTime - startTime;
+		_rememberedSetScanEntries += entries;
+		_rememberedSetScanThreads += 1;
+		_rememberedSetScanTime += scanTime;
+		_rememberedSetScanTimeMax = OMR_MAX(_rememberedSetScanTimeMax, scanTime);
+	}
+
+	/**
+	 * Get the remembered set scan imbalance, the time of the slowest thread over the average thread time.
+	 * @return the imbalance in hundredths (100 for a perfectly balanced scan), or 0 if the list was not scanned
+	 */
+	MMINLINE uintptr_t
+	getRememberedSetScanImbalance()
+	{
+		uintptr_t imbalance = 0;
+		if (0 != _rememberedSetScanTime) {
+			imbalance = (uintptr_t)((_rememberedSetScanTimeMax * _rememberedSetScanThreads * 100) / _rememberedSetScanTime);
+		}
+		return imbalance;
+	}
+
 	MMINLINE void
 	countCopyDistance(uintptr_t fromAddr, uintptr_t toAddr)
 	{
@@ -44,6 +44,10 @@ public:
 	uintptr_t sweepHeapBytesTotal;  /**< Number of heap bytes processed during the sweep phase */
 #endif /* OMR_GC_CONCURRENT_SWEEP */
 
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	uintptr_t deferredRegionsSweptInPause; /**< Regions of the previous cycle's deferred sweep that were still unswept when this cycle started */
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	uint64_t idleTime;
 	uint64_t mergeTime;
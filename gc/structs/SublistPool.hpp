@@ -125,6 +125,13 @@ public:
 	 * @return a puddle to process, or NULL if the list is empty
 	 */
 	MM_SublistPuddle *popPreviousPuddle(MM_SublistPuddle * returnedPuddle);
+
+	/**
+	 * Get the first of the puddles which were active when #startProcessingSublist() was called, without
+	 * removing it from the list. Not synchronized against #popPreviousPuddle().
+	 * @return the first puddle to process, or NULL if the list is empty
+	 */
+	MMINLINE MM_SublistPuddle *peekPreviousPuddle() { return _previousList; }
 	
 	MM_SublistPool() 
 		: _list(NULL)
@@ -87,6 +87,9 @@ public:
 	MMINLINE uintptr_t freeSize() { return ((uintptr_t)_listTop) - ((uintptr_t)_listCurrent); }
 	MMINLINE uintptr_t totalSize() { return ((uintptr_t)_listTop) - ((uintptr_t)_listBase); }
 
+	MMINLINE uintptr_t *getListBase() { return _listBase; }
+	MMINLINE uintptr_t *getListCurrent() { return _listCurrent; }
+
 	MMINLINE MM_SublistPool *getParent() {return _parent; }
 
 	void merge(MM_SublistPuddle *sourcePuddle);
@@ -0,0 +1,256 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#if !defined(VERBOSEBINARYFORMAT_HPP_)
+#define VERBOSEBINARYFORMAT_HPP_
+
+/*
+ * Layout of the files written by MM_VerboseWriterFileLoggingBinary (-Xgc:binaryVerboseLogging).
+ *
+ * This header is shared with the offline converter (tools/verbosegcconv) and must not depend on the
+ * port library or on any GC headers.
+ *
+ * A file is a VerboseBinaryFileHeader followed by variable size records in native byte order, each starting
+ * with a VerboseBinaryRecordHeader and padded to VERBOSE_BINARY_ALIGNMENT bytes.
+ *
+ * The verbose handlers output each line as an omrstr_printf format and its arguments. The writer does not format
+ * them: a FORMAT record defines each format string once per file, and a STANZA record holds the lines of one
+ * stanza, each a VerboseBinaryLine naming its format followed by one 8 byte slot per value the format consumes
+ * (including '*' widths and precisions) holding the integer, pointer or double. The slots of strings are unused;
+ * the strings follow the slots, in order, each a uint32_t length (VERBOSE_BINARY_NULL_STRING for NULL) and its bytes,
+ * padded to VERBOSE_BINARY_ALIGNMENT. Lines the writer cannot encode this way (see verboseBinaryParseSpec()) use
+ * VERBOSE_BINARY_FORMAT_TEXT and carry their text, indent and line feed included, as a single string without slots.
+ *
+ * Stanzas are drained from per-thread buffers, so they are not in sequence order in the file; readers sort them on
+ * their sequence numbers and format each line as omrstr_printf would to recover the XML described by schema.xsd.
+ */
+
+#include <stdint.h>
+
+#define VERBOSE_BINARY_MAGIC "OMRVGCB"
+#define VERBOSE_BINARY_MAGIC_LENGTH 8
+#define VERBOSE_BINARY_VERSION 2
+#define VERBOSE_BINARY_BYTE_ORDER_MARK 0x0102
+#define VERBOSE_BINARY_ALIGNMENT 8
+#define VERBOSE_BINARY_INDENT_SPACER "  " /**< output per indent level, as MM_VerboseBuffer does */
+
+/* Record types */
+#define VERBOSE_BINARY_RECORD_FORMAT 1 /**< a VerboseBinaryFormatDefinition followed by the format string */
+#define VERBOSE_BINARY_RECORD_STANZA 2 /**< the lines of one stanza */
+#define VERBOSE_BINARY_RECORD_FOOTER 3 /**< the lines written when the file is closed */
+
+#define VERBOSE_BINARY_FORMAT_TEXT 0xFFFFFFFF /**< format id of a line carrying its text */
+#define VERBOSE_BINARY_NULL_STRING 0xFFFFFFFF /**< string field length of a NULL string */
+#define VERBOSE_BINARY_NO_VALUE 0xFFFFFFFF /**< width or precision not given */
+#define VERBOSE_BINARY_MAX_SPECS 16 /**< omrstr_printf handles no more conversions per format */
+
+typedef struct VerboseBinaryFileHeader {
+	char magic[VERBOSE_BINARY_MAGIC_LENGTH]; /**< VERBOSE_BINARY_MAGIC, NUL terminated */
+	uint16_t version; /**< VERBOSE_BINARY_VERSION */
+	uint16_t byteOrderMark; /**< VERBOSE_BINARY_BYTE_ORDER_MARK as written by the producing machine */
+	uint8_t pointerSize; /**< sizeof(uintptr_t) on the producing machine, which sets the meaning of %z and %p */
+	uint8_t reserved[3];
+} VerboseBinaryFileHeader;
+
+typedef struct VerboseBinaryRecordHeader {
+	uint32_t size; /**< bytes in the record, this header and padding included */
+	uint8_t type; /**< one of VERBOSE_BINARY_RECORD_* */
+	uint8_t reserved;
+	uint16_t buffer; /**< the per-thread buffer the record was appended to */
+	uint64_t sequence; /**< orders the stanzas across all buffers, 0 for FORMAT records */
+} VerboseBinaryRecordHeader;
+
+typedef struct VerboseBinaryFormatDefinition {
+	uint32_t id; /**< the id lines use to name the format */
+	uint32_t length; /**< bytes in the format string that follows, which is not NUL terminated */
+} VerboseBinaryFormatDefinition;
+
+typedef struct VerboseBinaryLine {
+	uint32_t format; /**< id of a format definition, or VERBOSE_BINARY_FORMAT_TEXT */
+	uint16_t indent; /**< indent level, ignored for text lines */
+	uint16_t reserved;
+} VerboseBinaryLine;
+
+/* What a conversion reads from the arguments, as omrstr_vprintf reads them */
+#define VERBOSE_BINARY_FIELD_U32 1
+#define VERBOSE_BINARY_FIELD_U64 2
+#define VERBOSE_BINARY_FIELD_DOUBLE 3
+#define VERBOSE_BINARY_FIELD_POINTER 4
+#define VERBOSE_BINARY_FIELD_STRING 5
+
+typedef struct VerboseBinaryFormatSpec {
+	char flag; /**< the flag character, or 0 */
+	bool widthArgument; /**< width is read from the arguments ('*') */
+	bool precisionArgument; /**< precision is read from the arguments ('*') */
+	bool longLong; /**< the value is 64 bits ("ll", or "z" with 8 byte pointers) */
+	uint32_t width; /**< immediate width, or VERBOSE_BINARY_NO_VALUE */
+	uint32_t precision; /**< immediate precision, or VERBOSE_BINARY_NO_VALUE */
+	char type; /**< the conversion character */
+	uint8_t field; /**< one of VERBOSE_BINARY_FIELD_* */
+} VerboseBinaryFormatSpec;
+
+/**
+ * Find the next conversion in an omrstr_printf format and parse it following the grammar of omrstr_vprintf.
+ * Conversions both sides cannot reproduce exactly (positional arguments, wide characters and strings, unknown
+ * types) are rejected, as are formats with more conversions than omrstr_vprintf handles.
+ *
+ * @param[in] cursor the format, or the end of the previous conversion
+ * @param[in] pointerSize sizeof(uintptr_t) on the machine formatting the values
+ * @param[out] spec the conversion found
+ * @param[out] specStart the '%' starting the conversion
+ * @return the end of the conversion, cursor if there is none left, NULL if it can not be encoded
+ */
+static inline const char *
+verboseBinaryParseSpec(const char *cursor, uint8_t pointerSize, VerboseBinaryFormatSpec *spec, const char **specStart)
+{
+	while ('\0' != *cursor) {
+		if ('%' != *cursor) {
+			cursor += 1;
+		} else if ('%' == cursor[1]) {
+			cursor += 2;
+		} else {
+			break;
+		}
+	}
+	*specStart = cursor;
+	if ('\0' == *cursor) {
+		return cursor;
+	}
+	cursor += 1;
+
+	spec->flag = 0;
+	spec->widthArgument = false;
+	spec->precisionArgument = false;
+	spec->longLong = false;
+	spec->width = VERBOSE_BINARY_NO_VALUE;
+	spec->precision = VERBOSE_BINARY_NO_VALUE;
+
+	/* a positional index is digits followed by '$' */
+	for (const char *digits = cursor; ('0' <= *digits) && ('9' >= *digits); digits++) {
+		if ('$' == digits[1]) {
+			return NULL;
+		}
+	}
+
+	switch (*cursor) {
+	case '0':
+	case ' ':
+	case '-':
+	case '+':
+	case '#':
+		spec->flag = *cursor++;
+		break;
+	}
+
+	if ('*' == *cursor) {
+		spec->widthArgument = true;
+		cursor += 1;
+	} else if (('0' <= *cursor) && ('9' >= *cursor)) {
+		spec->width = 0;
+		while (('0' <= *cursor) && ('9' >= *cursor)) {
+			spec->width = (spec->width * 10) + (uint32_t)(*cursor++ - '0');
+		}
+	}
+
+	if ('.' == *cursor) {
+		cursor += 1;
+		if ('*' == *cursor) {
+			spec->precisionArgument = true;
+			cursor += 1;
+		} else if (('0' <= *cursor) && ('9' >= *cursor)) {
+			spec->precision = 0;
+			while (('0' <= *cursor) && ('9' >= *cursor)) {
+				spec->precision = (spec->precision * 10) + (uint32_t)(*cursor++ - '0');
+			}
+		}
+	}
+
+	if ('z' == *cursor) {
+		spec->longLong = (8 == pointerSize);
+		cursor += 1;
+	} else if ('l' == *cursor) {
+		if ('l' != cursor[1]) {
+			/* a single 'l' marks wide characters and strings, which are left to the text path */
+			return NULL;
+		}
+		spec->longLong = true;
+		cursor += 2;
+	}
+
+	spec->type = *cursor;
+	switch (*cursor) {
+	case 'c':
+		spec->field = VERBOSE_BINARY_FIELD_U32;
+		break;
+	case 'i':
+	case 'd':
+	case 'u':
+	case 'x':
+	case 'X':
+		spec->field = spec->longLong ? VERBOSE_BINARY_FIELD_U64 : VERBOSE_BINARY_FIELD_U32;
+		break;
+	case 'p':
+		spec->field = VERBOSE_BINARY_FIELD_POINTER;
+		break;
+	case 's':
+		spec->field = VERBOSE_BINARY_FIELD_STRING;
+		break;
+	case 'f':
+	case 'e':
+	case 'E':
+	case 'F':
+	case 'g':
+	case 'G':
+		spec->field = VERBOSE_BINARY_FIELD_DOUBLE;
+		break;
+	default:
+		return NULL;
+	}
+
+	return cursor + 1;
+}
+
+/**
+ * Count the conversions in a format.
+ * @return the number of conversions, or -1 if the format can not be encoded (see verboseBinaryParseSpec())
+ */
+static inline int32_t
+verboseBinaryCountSpecs(const char *format, uint8_t pointerSize)
+{
+	int32_t count = 0;
+	const char *cursor = format;
+	VerboseBinaryFormatSpec spec;
+	const char *specStart = NULL;
+
+	while (NULL != (cursor = verboseBinaryParseSpec(cursor, pointerSize, &spec, &specStart))) {
+		if ('\0' == *specStart) {
+			return count;
+		}
+		count += 1;
+		if (count > VERBOSE_BINARY_MAX_SPECS) {
+			break;
+		}
+	}
+	return -1;
+}
+
+#endif /* VERBOSEBINARYFORMAT_HPP_ */
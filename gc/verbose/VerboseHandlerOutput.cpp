@@ -29,6 +29,8 @@
 #include "ConcurrentPhaseStatsBase.hpp"
 #include "Heap.hpp"
 #include "HeapRegionManager.hpp"
+#include "HeapStats.hpp"
+#include "MemoryManager.hpp"
 #include "ObjectAllocationInterface.hpp"
 #include "ParallelDispatcher.hpp"
 #include "VerboseHandlerOutput.hpp"
@@ -332,7 +334,26 @@ MM_VerboseHandlerOutput::outputInitializedStanza(MM_EnvironmentBase *env, MM_Ver
 	buffer->formatAndOutput(env, 1, "<attribute name=\"pageType\" value=\"%s\" />", getPageTypeString(_extensions->heap->getPageFlags()));
 	buffer->formatAndOutput(env, 1, "<attribute name=\"requestedPageSize\" value=\"0x%zx\" />", _extensions->requestedPageSize);
 	buffer->formatAndOutput(env, 1, "<attribute name=\"requestedPageType\" value=\"%s\" />", getPageTypeString(_extensions->requestedPageFlags));
+	if (MM_GCExtensionsBase::LARGE_PAGE_POLICY_NONE != _extensions->largePagePolicy) {
+		buffer->formatAndOutput(env, 1, "<attribute name=\"largePagePolicy\" value=\"%s\" />",
+				(MM_GCExtensionsBase::LARGE_PAGE_POLICY_TRANSPARENT == _extensions->largePagePolicy) ? "transparent" : "explicit");
+		if (0 != _extensions->memoryManager->getTransparentHugePageSize()) {
+			buffer->formatAndOutput(env, 1, "<attribute name=\"transparentHugePageSize\" value=\"0x%zx\" />", _extensions->memoryManager->getTransparentHugePageSize());
+		}
+		if (0 != _extensions->markMapPageSize) {
+			buffer->formatAndOutput(env, 1, "<attribute name=\"markMapPageSize\" value=\"0x%zx\" />", _extensions->markMapPageSize);
+		}
+		if (0 != _extensions->cardTablePageSize) {
+			buffer->formatAndOutput(env, 1, "<attribute name=\"cardTablePageSize\" value=\"0x%zx\" />", _extensions->cardTablePageSize);
+		}
+		if (0 != _extensions->regionTablePageSize) {
+			buffer->formatAndOutput(env, 1, "<attribute name=\"regionTablePageSize\" value=\"0x%zx\" />", _extensions->regionTablePageSize);
+		}
+	}
 	buffer->formatAndOutput(env, 1, "<attribute name=\"gcthreads\" value=\"%zu\" />", _extensions->gcThreadCount);
+	if (_extensions->elasticTaskThreads) {
+		buffer->formatAndOutput(env, 1, "<attribute name=\"elasticTaskThreadWork\" value=\"0x%zx\" />", _extensions->elasticTaskThreadWork);
+	}
 
 	if (gc_policy_gencon == _extensions->configurationOptions._gcPolicy) {
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
@@ -900,6 +921,22 @@ MM_VerboseHandlerOutput::printAllocationStats(MM_EnvironmentBase* env)
 	} else if (_extensions->isStandardGC()) {
 #if defined(OMR_GC_MODRON_STANDARD)
 		writer->formatAndOutput(env, 1, "<allocated-bytes non-tlh=\"%zu\" tlh=\"%zu\" />", systemStats->nontlhBytesAllocated(), systemStats->tlhBytesAllocated());
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+		if (_extensions->adaptiveTLHSizing) {
+			writer->formatAndOutput(env, 1, "<tlh-refresh count=\"%zu\" reused=\"%zu\" requestedBytes=\"%zu\" wastedBytes=\"%zu\" />",
+					systemStats->tlhRefreshCount(), systemStats->_tlhRefreshCountReused, systemStats->_tlhRequestedBytes, systemStats->tlhWastedBytes());
+		}
+		if (_extensions->lockFreeTLHRefresh) {
+			MM_HeapStats heapStats;
+			_extensions->heap->mergeHeapStats(&heapStats);
+			writer->formatAndOutput(env, 1, "<tlh-carve carved=\"%zu\" chunks=\"%zu\" />", heapStats._allocTLHCarveCount, heapStats._allocTLHCarveChunkCount);
+		}
+#endif /* defined(OMR_GC_THREAD_LOCAL_HEAP) */
+		if (_extensions->freeListSizeClassBins) {
+			MM_HeapStats heapStats;
+			_extensions->heap->mergeHeapStats(&heapStats, MEMORY_TYPE_OLD);
+			writer->formatAndOutput(env, 1, "<free-list-search walked=\"%zu\" binstarts=\"%zu\" />", heapStats._allocSearchCount, heapStats._allocSizeClassBinStarts);
+		}
 #endif /* OMR_GC_MODRON_STANDARD */
 	} else {
 		/* for now, not covered the case of specs that do not have TLHs, but have arraylets */
@@ -1079,7 +1116,7 @@ MM_VerboseHandlerOutput::outputHeapResizeInfo(MM_EnvironmentBase *env, uintptr_t
 		reasonString = getLoaResizeReasonAsString((LoaResizeReason)reason);
 	} else if (HEAP_RELEASE_FREE_PAGES == resizeType) {
 		resizeTypeName = "release free pages";
-		reasonString = "idle";
+		reasonString = (RELEASE_FREE_PAGES_BACKGROUND == (ReleaseFreePagesReason)reason) ? "background" : "idle";
 	} else {
 		resizeTypeName = "unknown";
 		reasonString = "unknown";
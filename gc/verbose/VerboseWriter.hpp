@@ -24,6 +24,7 @@
 #define VERBOSEWRITER_HPP_
 
 #include "omrcfg.h"
+#include "omrstdarg.h"
 #include "modronbase.h"
 
 #include "Base.hpp"
@@ -35,7 +36,8 @@ typedef enum {
 	VERBOSE_WRITER_FILE_LOGGING_SYNCHRONOUS = 2,
 	VERBOSE_WRITER_FILE_LOGGING_BUFFERED = 3,
 	VERBOSE_WRITER_TRACE = 4,
-	VERBOSE_WRITER_HOOK = 5
+	VERBOSE_WRITER_HOOK = 5,
+	VERBOSE_WRITER_FILE_LOGGING_BINARY = 6
 } WriterType;
 
 /**
@@ -75,6 +77,32 @@ public:
 
 	virtual void closeStream(MM_EnvironmentBase *env) = 0;
 
+	/**
+	 * Writers returning true store the fields of each line rather than its text. The writer chain passes them
+	 * every line through formatAndOutputV() and outputText(), and the end of every stanza through flushStanza(),
+	 * instead of the formatted stanza through outputString().
+	 */
+	virtual bool encodesFields() { return false; }
+
+	/**
+	 * Add a line to the current stanza.
+	 * @param[in] env the current thread
+	 * @param[in] indent the indent level of the line
+	 * @param[in] format an omrstr_printf format
+	 * @param[in] args the values to format
+	 */
+	virtual void formatAndOutputV(MM_EnvironmentBase *env, uintptr_t indent, const char *format, va_list args) {}
+
+	/**
+	 * Add text that is already formatted, indents and line feeds included, to the current stanza.
+	 */
+	virtual void outputText(MM_EnvironmentBase *env, const char *text) {}
+
+	/**
+	 * Output the current stanza.
+	 */
+	virtual void flushStanza(MM_EnvironmentBase *env) {}
+
 	/**
 	 * Open the output mechanism for the writer.
 	 * @param[in] env the current environment.
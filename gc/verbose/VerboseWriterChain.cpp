@@ -36,6 +36,9 @@ MM_VerboseWriterChain::MM_VerboseWriterChain()
 	: MM_Base()
 	,_buffer(NULL)
 	,_writers(NULL)
+	,_hasTextWriters(false)
+	,_hasFieldWriters(false)
+	,_forwardedSize(0)
 {}
 
 MM_VerboseWriterChain *
@@ -60,19 +63,58 @@ MM_VerboseWriterChain::formatAndOutput(MM_EnvironmentBase *env, uintptr_t indent
 	va_list args;
 
 	va_start(args, format);
-	_buffer->formatAndOutputV(env, indent, format, args);
+	if (_hasFieldWriters) {
+		forwardBufferedText(env);
+		MM_VerboseWriter* writer = _writers;
+		while (NULL != writer) {
+			if (writer->encodesFields()) {
+				va_list argsCopy;
+				COPY_VA_LIST(argsCopy, args);
+				writer->formatAndOutputV(env, indent, format, argsCopy);
+				END_VA_LIST_COPY(argsCopy);
+			}
+			writer = writer->getNextWriter();
+		}
+	}
+	if (_hasTextWriters) {
+		_buffer->formatAndOutputV(env, indent, format, args);
+		_forwardedSize = _buffer->currentSize();
+	}
 	va_end(args);
 }
 
+void
+MM_VerboseWriterChain::forwardBufferedText(MM_EnvironmentBase *env)
+{
+	if (_buffer->currentSize() > _forwardedSize) {
+		MM_VerboseWriter* writer = _writers;
+		while (NULL != writer) {
+			if (writer->encodesFields()) {
+				writer->outputText(env, _buffer->contents() + _forwardedSize);
+			}
+			writer = writer->getNextWriter();
+		}
+		_forwardedSize = _buffer->currentSize();
+	}
+}
+
 void
 MM_VerboseWriterChain::flush(MM_EnvironmentBase *env)
 {
+	if (_hasFieldWriters) {
+		forwardBufferedText(env);
+	}
 	MM_VerboseWriter* writer = _writers;
 	while (NULL != writer) {
-		writer->outputString(env, _buffer->contents());
+		if (writer->encodesFields()) {
+			writer->flushStanza(env);
+		} else {
+			writer->outputString(env, _buffer->contents());
+		}
 		writer = writer->getNextWriter();
 	}
 	_buffer->reset();
+	_forwardedSize = 0;
 }
 
 void
@@ -115,6 +157,11 @@ MM_VerboseWriterChain::addWriter(MM_VerboseWriter* writer)
 {
 	writer->setNextWriter(_writers);
 	_writers = writer;
+	if (writer->encodesFields()) {
+		_hasFieldWriters = true;
+	} else {
+		_hasTextWriters = true;
+	}
 }
 
 void
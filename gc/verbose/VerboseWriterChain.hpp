@@ -45,6 +45,9 @@ protected:
 private:
 	MM_VerboseBuffer *_buffer;
 	MM_VerboseWriter *_writers;
+	bool _hasTextWriters; /**< some writers output the formatted text in _buffer */
+	bool _hasFieldWriters; /**< some writers encode the fields of each line (see MM_VerboseWriter::encodesFields()) */
+	uintptr_t _forwardedSize; /**< bytes at the start of _buffer the field writers already have, in some form */
 
 public:
 	static MM_VerboseWriterChain *newInstance(MM_EnvironmentBase *env);
@@ -66,6 +69,9 @@ public:
 	 */
 	MM_VerboseWriter *getFirstWriter() { return _writers; }
 	
+	/**
+	 * Text written straight to the buffer is output with the stanza it is written in.
+	 */
 	MM_VerboseBuffer *getBuffer() { return _buffer; }
 
 	/**
@@ -79,6 +85,10 @@ protected:
 	void tearDown(MM_EnvironmentBase *env);
 	bool initialize(MM_EnvironmentBase* env);
 private:
+	/**
+	 * Pass the field writers whatever was written straight to the buffer since they were last passed a line.
+	 */
+	void forwardBufferedText(MM_EnvironmentBase *env);
 };
 
 #endif /* VERBOSEWRITERCHAIN_HPP_ */
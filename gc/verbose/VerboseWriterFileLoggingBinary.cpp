@@ -0,0 +1,798 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "modronapicore.hpp"
+#include "omrutil.h"
+#include "VerboseManager.hpp"
+#include "VerboseWriterFileLoggingBinary.hpp"
+
+#include "AtomicOperations.hpp"
+#include "GCExtensionsBase.hpp"
+#include "EnvironmentBase.hpp"
+#include "VerboseBuffer.hpp"
+#include "VerboseHandlerOutput.hpp"
+
+#include <string.h>
+
+#define VERBOSE_BINARY_ALIGN(size) (((size) + (VERBOSE_BINARY_ALIGNMENT - 1)) & ~(uintptr_t)(VERBOSE_BINARY_ALIGNMENT - 1))
+
+/**
+ * Drain thread procedure
+ *
+ * @parm info Address of the MM_VerboseWriterFileLoggingBinary to drain
+ */
+static int J9THREAD_PROC
+binary_verbose_drain_thread_proc(void *info)
+{
+	MM_VerboseWriterFileLoggingBinary *writer = (MM_VerboseWriterFileLoggingBinary *)info;
+	writer->drainThreadEntryPoint();
+	return 0;
+}
+
+/**
+ * Release the buffer of an exiting thread for reuse. What it has already appended is still drained.
+ *
+ * @parm buffer The MM_VerboseBinaryThreadBuffer of the thread
+ */
+static void J9THREAD_PROC
+binary_verbose_thread_buffer_finalizer(void *buffer)
+{
+	MM_AtomicOperations::set(&((MM_VerboseBinaryThreadBuffer *)buffer)->owned, 0);
+}
+
+MM_VerboseWriterFileLoggingBinary::MM_VerboseWriterFileLoggingBinary(MM_EnvironmentBase *env, MM_VerboseManager *manager)
+	:MM_VerboseWriterFileLogging(env, manager, VERBOSE_WRITER_FILE_LOGGING_BINARY)
+	,_portLibrary(env->getPortLibrary())
+	,_logFileDescriptor(-1)
+	,_bufferKey(0)
+	,_bufferKeyAllocated(false)
+	,_buffers(NULL)
+	,_bufferCount(0)
+	,_formats(NULL)
+	,_formatCount(0)
+	,_sequence(0)
+	,_drainMonitor(NULL)
+	,_drainThreadState(DRAIN_THREAD_NONE)
+	,_drainRequested(false)
+{
+}
+
+/**
+ * Create a new MM_VerboseWriterFileLoggingBinary instance.
+ * @return Pointer to the new MM_VerboseWriterFileLoggingBinary.
+ */
+MM_VerboseWriterFileLoggingBinary *
+MM_VerboseWriterFileLoggingBinary::newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+
+	MM_VerboseWriterFileLoggingBinary *agent = (MM_VerboseWriterFileLoggingBinary *)extensions->getForge()->allocate(sizeof(MM_VerboseWriterFileLoggingBinary), OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if(agent) {
+		new(agent) MM_VerboseWriterFileLoggingBinary(env, manager);
+		if(!agent->initialize(env, filename, numFiles, numCycles)) {
+			agent->kill(env);
+			agent = NULL;
+		}
+	}
+	return agent;
+}
+
+/**
+ * Initializes the MM_VerboseWriterFileLoggingBinary instance.
+ * The format table, the thread buffer key and the drain thread must exist before the file is opened, since opening it outputs the header.
+ * @return true on success, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingBinary::initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+	uintptr_t formatTableSize = VERBOSE_BINARY_FORMAT_TABLE_SIZE * sizeof(MM_VerboseBinaryFormatEntry);
+
+	_formats = (MM_VerboseBinaryFormatEntry *)extensions->getForge()->allocate(formatTableSize, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if (NULL == _formats) {
+		return false;
+	}
+	memset(_formats, 0, formatTableSize);
+
+	if (0 != omrthread_tls_alloc_with_finalizer(&_bufferKey, binary_verbose_thread_buffer_finalizer)) {
+		return false;
+	}
+	_bufferKeyAllocated = true;
+
+	if (0 != omrthread_monitor_init_with_name(&_drainMonitor, 0, "MM_VerboseWriterFileLoggingBinary::drainMonitor")) {
+		_drainMonitor = NULL;
+		return false;
+	}
+
+	if (!startDrainThread(env)) {
+		return false;
+	}
+
+	return MM_VerboseWriterFileLogging::initialize(env, filename, numFiles, numCycles);
+}
+
+/**
+ * Tear down the structures managed by the MM_VerboseWriterFileLoggingBinary.
+ * Stops the drain thread once it has written out everything already appended.
+ */
+void
+MM_VerboseWriterFileLoggingBinary::tearDown(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+	OMRPORT_ACCESS_FROM_OMRPORT(_portLibrary);
+
+	if (DRAIN_THREAD_RUNNING == _drainThreadState) {
+		shutdownDrainThread();
+	}
+
+	if (-1 != _logFileDescriptor) {
+		omrfile_close(_logFileDescriptor);
+		_logFileDescriptor = -1;
+	}
+
+	if (NULL != _drainMonitor) {
+		omrthread_monitor_destroy(_drainMonitor);
+		_drainMonitor = NULL;
+	}
+
+	/* freeing the key clears it in every thread, so the finalizer never sees a freed buffer */
+	if (_bufferKeyAllocated) {
+		omrthread_tls_free(_bufferKey);
+		_bufferKeyAllocated = false;
+	}
+	MM_VerboseBinaryThreadBuffer *buffer = _buffers;
+	while (NULL != buffer) {
+		MM_VerboseBinaryThreadBuffer *next = buffer->next;
+		if (NULL != buffer->stanza) {
+			extensions->getForge()->free(buffer->stanza);
+		}
+		extensions->getForge()->free(buffer);
+		buffer = next;
+	}
+	_buffers = NULL;
+
+	if (NULL != _formats) {
+		for (uintptr_t i = 0; i < VERBOSE_BINARY_FORMAT_TABLE_SIZE; i++) {
+			if (NULL != _formats[i].copy) {
+				extensions->getForge()->free(_formats[i].copy);
+			}
+		}
+		extensions->getForge()->free(_formats);
+		_formats = NULL;
+	}
+
+	MM_VerboseWriterFileLogging::tearDown(env);
+}
+
+/**
+ * Start the drain thread and wait for it to be running.
+ * @return true on success, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingBinary::startDrainThread(MM_EnvironmentBase *env)
+{
+	omrthread_monitor_enter(_drainMonitor);
+	_drainThreadState = DRAIN_THREAD_NONE;
+	_drainRequested = false;
+	intptr_t threadForkResult = createThreadWithCategory(NULL, OMR_OS_STACK_SIZE, J9THREAD_PRIORITY_NORMAL,
+			0, binary_verbose_drain_thread_proc, (void *)this, J9THREAD_CATEGORY_SYSTEM_GC_THREAD);
+	if (0 == threadForkResult) {
+		while (DRAIN_THREAD_NONE == _drainThreadState) {
+			omrthread_monitor_wait(_drainMonitor);
+		}
+	}
+	omrthread_monitor_exit(_drainMonitor);
+
+	return DRAIN_THREAD_RUNNING == _drainThreadState;
+}
+
+/**
+ * Ask the drain thread to write out what remains and exit, and wait until it has.
+ */
+void
+MM_VerboseWriterFileLoggingBinary::shutdownDrainThread()
+{
+	omrthread_monitor_enter(_drainMonitor);
+	_drainThreadState = DRAIN_THREAD_SHUTDOWN_REQUESTED;
+	omrthread_monitor_notify_all(_drainMonitor);
+	while (DRAIN_THREAD_TERMINATED != _drainThreadState) {
+		omrthread_monitor_wait(_drainMonitor);
+	}
+	omrthread_monitor_exit(_drainMonitor);
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::drainThreadEntryPoint()
+{
+	omrthread_monitor_enter(_drainMonitor);
+	_drainThreadState = DRAIN_THREAD_RUNNING;
+	omrthread_monitor_notify_all(_drainMonitor);
+
+	while (DRAIN_THREAD_RUNNING == _drainThreadState) {
+		/* producers set _drainRequested without the monitor; it is only cleared (and tested) while holding it, so no request is lost */
+		if (!_drainRequested) {
+			omrthread_monitor_wait_timed(_drainMonitor, VERBOSE_BINARY_DRAIN_INTERVAL_MILLIS, 0);
+		}
+		_drainRequested = false;
+		drainBuffers();
+	}
+	drainBuffers();
+
+	_drainThreadState = DRAIN_THREAD_TERMINATED;
+	omrthread_monitor_notify_all(_drainMonitor);
+	omrthread_exit(_drainMonitor);
+}
+
+/**
+ * Wake the drain thread. Does not block: if the monitor is busy the drain thread (or a file operation) is
+ * already draining, and the drain thread tests _drainRequested again before it next waits.
+ */
+void
+MM_VerboseWriterFileLoggingBinary::requestDrain()
+{
+	_drainRequested = true;
+	if (0 == omrthread_monitor_try_enter(_drainMonitor)) {
+		omrthread_monitor_notify(_drainMonitor);
+		omrthread_monitor_exit(_drainMonitor);
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::drainBuffers()
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(_portLibrary);
+
+	for (MM_VerboseBinaryThreadBuffer *buffer = _buffers; NULL != buffer; buffer = buffer->next) {
+		uintptr_t produced = buffer->produced;
+		uintptr_t consumed = buffer->consumed;
+		if (produced == consumed) {
+			continue;
+		}
+
+		/* the ring must not be read before the count that publishes it */
+		MM_AtomicOperations::readBarrier();
+		if (-1 != _logFileDescriptor) {
+			uintptr_t offset = consumed & (VERBOSE_BINARY_THREAD_BUFFER_SIZE - 1);
+			uintptr_t length = produced - consumed;
+			uintptr_t first = OMR_MIN(length, VERBOSE_BINARY_THREAD_BUFFER_SIZE - offset);
+			omrfile_write(_logFileDescriptor, (void *)(buffer->ring + offset), (intptr_t)first);
+			if (first < length) {
+				omrfile_write(_logFileDescriptor, (void *)buffer->ring, (intptr_t)(length - first));
+			}
+		}
+		/* full barrier: the space may be reused as soon as the owner sees the new count */
+		MM_AtomicOperations::set(&buffer->consumed, produced);
+	}
+}
+
+MM_VerboseBinaryThreadBuffer *
+MM_VerboseWriterFileLoggingBinary::getThreadBuffer(MM_EnvironmentBase *env)
+{
+	MM_VerboseBinaryThreadBuffer *buffer = (MM_VerboseBinaryThreadBuffer *)omrthread_tls_get(omrthread_self(), _bufferKey);
+	if (NULL == buffer) {
+		buffer = acquireThreadBuffer(env);
+	}
+	return buffer;
+}
+
+/**
+ * Give the current thread a buffer, reusing one released by an exited thread if there is one.
+ */
+MM_VerboseBinaryThreadBuffer *
+MM_VerboseWriterFileLoggingBinary::acquireThreadBuffer(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	MM_VerboseBinaryThreadBuffer *buffer = NULL;
+
+	for (MM_VerboseBinaryThreadBuffer *candidate = _buffers; NULL != candidate; candidate = candidate->next) {
+		if ((0 == candidate->owned) && (0 == MM_AtomicOperations::lockCompareExchange(&candidate->owned, 0, 1))) {
+			buffer = candidate;
+			/* a thread exiting mid-stanza leaves an incomplete stanza behind, which is dropped */
+			buffer->stanzaSize = sizeof(VerboseBinaryRecordHeader);
+			break;
+		}
+	}
+
+	if (NULL == buffer) {
+		uintptr_t size = sizeof(MM_VerboseBinaryThreadBuffer) + VERBOSE_BINARY_THREAD_BUFFER_SIZE;
+		buffer = (MM_VerboseBinaryThreadBuffer *)extensions->getForge()->allocate(size, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+		if (NULL == buffer) {
+			return NULL;
+		}
+		uint8_t *stanza = (uint8_t *)extensions->getForge()->allocate(VERBOSE_BINARY_STANZA_INITIAL_SIZE, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+		if (NULL == stanza) {
+			extensions->getForge()->free(buffer);
+			return NULL;
+		}
+		memset(buffer, 0, sizeof(MM_VerboseBinaryThreadBuffer));
+		buffer->owned = 1;
+		buffer->ring = (uint8_t *)(buffer + 1);
+		buffer->stanza = stanza;
+		buffer->stanzaSize = sizeof(VerboseBinaryRecordHeader);
+		buffer->stanzaCapacity = VERBOSE_BINARY_STANZA_INITIAL_SIZE;
+
+		omrthread_monitor_enter(_drainMonitor);
+		buffer->index = _bufferCount++;
+		buffer->next = _buffers;
+		_buffers = buffer;
+		omrthread_monitor_exit(_drainMonitor);
+	}
+
+	omrthread_tls_set(omrthread_self(), _bufferKey, buffer);
+	return buffer;
+}
+
+uint8_t *
+MM_VerboseWriterFileLoggingBinary::reserveStanzaBytes(MM_EnvironmentBase *env, MM_VerboseBinaryThreadBuffer *buffer, uintptr_t bytes)
+{
+	bytes = VERBOSE_BINARY_ALIGN(bytes);
+	if ((buffer->stanzaCapacity - buffer->stanzaSize) < bytes) {
+		MM_GCExtensionsBase *extensions = env->getExtensions();
+		uintptr_t capacity = buffer->stanzaCapacity * 2;
+		while ((capacity - buffer->stanzaSize) < bytes) {
+			capacity *= 2;
+		}
+		uint8_t *stanza = (uint8_t *)extensions->getForge()->allocate(capacity, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+		if (NULL == stanza) {
+			return NULL;
+		}
+		memcpy(stanza, buffer->stanza, buffer->stanzaSize);
+		extensions->getForge()->free(buffer->stanza);
+		buffer->stanza = stanza;
+		buffer->stanzaCapacity = capacity;
+	}
+
+	uint8_t *result = buffer->stanza + buffer->stanzaSize;
+	memset(result, 0, bytes);
+	buffer->stanzaSize += bytes;
+	return result;
+}
+
+bool
+MM_VerboseWriterFileLoggingBinary::appendStringField(MM_EnvironmentBase *env, MM_VerboseBinaryThreadBuffer *buffer, const char *string)
+{
+	uint32_t length = (NULL == string) ? VERBOSE_BINARY_NULL_STRING : (uint32_t)strlen(string);
+	uint8_t *field = reserveStanzaBytes(env, buffer, sizeof(uint32_t) + ((NULL == string) ? 0 : length));
+	if (NULL == field) {
+		return false;
+	}
+	memcpy(field, &length, sizeof(uint32_t));
+	if (NULL != string) {
+		memcpy(field + sizeof(uint32_t), string, length);
+	}
+	return true;
+}
+
+/**
+ * Format a line the writer can not encode and add it to the stanza as a text line.
+ */
+void
+MM_VerboseWriterFileLoggingBinary::appendTextLine(MM_EnvironmentBase *env, MM_VerboseBinaryThreadBuffer *buffer, uintptr_t indent, const char *format, va_list args)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	uintptr_t lineStart = buffer->stanzaSize;
+	va_list argsCopy;
+
+	COPY_VA_LIST(argsCopy, args);
+	uintptr_t formattedLength = omrstr_vprintf(NULL, 0, format, argsCopy);
+	END_VA_LIST_COPY(argsCopy);
+	/* the spacers, the text and the line feed, which takes the place of the NUL omrstr_vprintf writes */
+	uint32_t length = (uint32_t)((indent * strlen(VERBOSE_BINARY_INDENT_SPACER)) + formattedLength + 1);
+
+	VerboseBinaryLine *line = (VerboseBinaryLine *)reserveStanzaBytes(env, buffer, sizeof(VerboseBinaryLine));
+	uint8_t *field = (NULL == line) ? NULL : reserveStanzaBytes(env, buffer, sizeof(uint32_t) + length);
+	if (NULL == field) {
+		buffer->stanzaSize = lineStart;
+		return;
+	}
+	line = (VerboseBinaryLine *)(buffer->stanza + lineStart);
+	line->format = VERBOSE_BINARY_FORMAT_TEXT;
+
+	memcpy(field, &length, sizeof(uint32_t));
+	char *text = (char *)(field + sizeof(uint32_t));
+	for (uintptr_t i = 0; i < indent; i++) {
+		memcpy(text, VERBOSE_BINARY_INDENT_SPACER, strlen(VERBOSE_BINARY_INDENT_SPACER));
+		text += strlen(VERBOSE_BINARY_INDENT_SPACER);
+	}
+	COPY_VA_LIST(argsCopy, args);
+	text += omrstr_vprintf(text, formattedLength + 1, format, argsCopy);
+	END_VA_LIST_COPY(argsCopy);
+	*text = '\n';
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::formatAndOutputV(MM_EnvironmentBase *env, uintptr_t indent, const char *format, va_list args)
+{
+	MM_VerboseBinaryThreadBuffer *buffer = getThreadBuffer(env);
+	if (NULL == buffer) {
+		return;
+	}
+
+	MM_VerboseBinaryFormatEntry *entry = findFormat(env, format);
+	if (NULL == entry) {
+		appendTextLine(env, buffer, indent, format, args);
+		return;
+	}
+
+	uintptr_t lineStart = buffer->stanzaSize;
+	uint8_t *values = reserveStanzaBytes(env, buffer, sizeof(VerboseBinaryLine) + (entry->fieldCount * sizeof(uint64_t)));
+	if (NULL == values) {
+		return;
+	}
+	VerboseBinaryLine *line = (VerboseBinaryLine *)values;
+	line->format = entry->id;
+	line->indent = (uint16_t)indent;
+	values += sizeof(VerboseBinaryLine);
+
+	/* read the arguments as omrstr_vprintf reads them; strings go after the fixed size fields of the line */
+	for (uint32_t i = 0; i < entry->fieldCount; i++) {
+		uint64_t value = 0;
+		switch (entry->fields[i]) {
+		case VERBOSE_BINARY_FIELD_U32:
+			value = va_arg(args, uint32_t);
+			break;
+		case VERBOSE_BINARY_FIELD_U64:
+			value = va_arg(args, uint64_t);
+			break;
+		case VERBOSE_BINARY_FIELD_DOUBLE:
+		{
+			double doubleValue = va_arg(args, double);
+			memcpy(&value, &doubleValue, sizeof(value));
+			break;
+		}
+		case VERBOSE_BINARY_FIELD_POINTER:
+			value = (uintptr_t)va_arg(args, void *);
+			break;
+		case VERBOSE_BINARY_FIELD_STRING:
+			if (!appendStringField(env, buffer, va_arg(args, const char *))) {
+				buffer->stanzaSize = lineStart;
+				return;
+			}
+			/* the stanza may have moved */
+			values = buffer->stanza + lineStart + sizeof(VerboseBinaryLine) + (i * sizeof(uint64_t));
+			break;
+		}
+		memcpy(values, &value, sizeof(value));
+		values += sizeof(value);
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::outputText(MM_EnvironmentBase *env, const char *text)
+{
+	MM_VerboseBinaryThreadBuffer *buffer = getThreadBuffer(env);
+	if (NULL != buffer) {
+		uintptr_t lineStart = buffer->stanzaSize;
+		VerboseBinaryLine *line = (VerboseBinaryLine *)reserveStanzaBytes(env, buffer, sizeof(VerboseBinaryLine));
+		if ((NULL == line) || !appendStringField(env, buffer, text)) {
+			buffer->stanzaSize = lineStart;
+		} else {
+			((VerboseBinaryLine *)(buffer->stanza + lineStart))->format = VERBOSE_BINARY_FORMAT_TEXT;
+		}
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::flushStanza(MM_EnvironmentBase *env)
+{
+	MM_VerboseBinaryThreadBuffer *buffer = getThreadBuffer(env);
+	if (NULL != buffer) {
+		if (-1 == _logFileDescriptor) {
+			/**
+			 * Under normal circumstances, new file should be opened during endOfCycle call.
+			 * This path works as one backup, in case we failed to open the file,  we'll attempt to open it again before outputting the stanza.
+			 */
+			openFile(env);
+		}
+		commitStanza(buffer, VERBOSE_BINARY_RECORD_STANZA);
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::commitStanza(MM_VerboseBinaryThreadBuffer *buffer, uint8_t type)
+{
+	if (sizeof(VerboseBinaryRecordHeader) < buffer->stanzaSize) {
+		VerboseBinaryRecordHeader *header = (VerboseBinaryRecordHeader *)buffer->stanza;
+		header->size = (uint32_t)buffer->stanzaSize;
+		header->type = type;
+		header->reserved = 0;
+		header->buffer = buffer->index;
+		header->sequence = MM_AtomicOperations::addU64(&_sequence, 1);
+		appendRecord(buffer, buffer->stanza, buffer->stanzaSize);
+		buffer->stanzaSize = sizeof(VerboseBinaryRecordHeader);
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::appendRecord(MM_VerboseBinaryThreadBuffer *buffer, const uint8_t *record, uintptr_t size)
+{
+	if (size > VERBOSE_BINARY_THREAD_BUFFER_SIZE) {
+		/* too big for the ring, so write it here; readers order records by sequence, not by file position */
+		OMRPORT_ACCESS_FROM_OMRPORT(_portLibrary);
+		omrthread_monitor_enter(_drainMonitor);
+		if (-1 != _logFileDescriptor) {
+			omrfile_write(_logFileDescriptor, (void *)record, (intptr_t)size);
+		}
+		omrthread_monitor_exit(_drainMonitor);
+		return;
+	}
+
+	uintptr_t produced = buffer->produced;
+	while ((VERBOSE_BINARY_THREAD_BUFFER_SIZE - (produced - buffer->consumed)) < size) {
+		/* Ring is full. Records are never dropped, so drain it here if nobody else is doing so already. */
+		if (0 == omrthread_monitor_try_enter(_drainMonitor)) {
+			drainBuffers();
+			omrthread_monitor_exit(_drainMonitor);
+		} else {
+			omrthread_yield();
+		}
+	}
+
+	uintptr_t offset = produced & (VERBOSE_BINARY_THREAD_BUFFER_SIZE - 1);
+	uintptr_t first = OMR_MIN(size, VERBOSE_BINARY_THREAD_BUFFER_SIZE - offset);
+	memcpy(buffer->ring + offset, record, first);
+	if (first < size) {
+		memcpy(buffer->ring, record + first, size - first);
+	}
+
+	/* publish the record */
+	MM_AtomicOperations::writeBarrier();
+	buffer->produced = produced + size;
+
+	if (!_drainRequested && ((produced + size - buffer->consumed) >= (VERBOSE_BINARY_THREAD_BUFFER_SIZE / 2))) {
+		requestDrain();
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::outputTextStanza(MM_EnvironmentBase *env, uint8_t type, const char *text)
+{
+	MM_VerboseBinaryThreadBuffer *buffer = getThreadBuffer(env);
+	if (NULL != buffer) {
+		/* whatever the thread has pending goes first, as a stanza of its own */
+		commitStanza(buffer, VERBOSE_BINARY_RECORD_STANZA);
+		outputText(env, text);
+		commitStanza(buffer, type);
+	}
+}
+
+MM_VerboseBinaryFormatEntry *
+MM_VerboseWriterFileLoggingBinary::findFormat(MM_EnvironmentBase *env, const char *format)
+{
+	uintptr_t slot = (((uintptr_t)format) >> 3) & (VERBOSE_BINARY_FORMAT_TABLE_SIZE - 1);
+
+	for (uintptr_t probes = 0; probes < VERBOSE_BINARY_FORMAT_TABLE_SIZE; probes++) {
+		MM_VerboseBinaryFormatEntry *entry = &_formats[slot];
+		const char *key = entry->key;
+		if (NULL == key) {
+			return defineFormat(env, format);
+		}
+		if (format == key) {
+			/* the entry must not be read before the key that publishes it */
+			MM_AtomicOperations::readBarrier();
+			/* a format built at run time can reuse the address of an earlier one; it is then output as text */
+			if ((NULL == entry->copy) || (0 != strcmp(entry->copy, format))) {
+				return NULL;
+			}
+			return entry;
+		}
+		slot = (slot + 1) & (VERBOSE_BINARY_FORMAT_TABLE_SIZE - 1);
+	}
+	return NULL;
+}
+
+MM_VerboseBinaryFormatEntry *
+MM_VerboseWriterFileLoggingBinary::defineFormat(MM_EnvironmentBase *env, const char *format)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	MM_VerboseBinaryFormatEntry *result = NULL;
+
+	omrthread_monitor_enter(_drainMonitor);
+	uintptr_t slot = (((uintptr_t)format) >> 3) & (VERBOSE_BINARY_FORMAT_TABLE_SIZE - 1);
+	while ((NULL != _formats[slot].key) && (format != _formats[slot].key)) {
+		slot = (slot + 1) & (VERBOSE_BINARY_FORMAT_TABLE_SIZE - 1);
+	}
+	MM_VerboseBinaryFormatEntry *entry = &_formats[slot];
+
+	if (format == entry->key) {
+		/* another thread defined it first */
+		if ((NULL != entry->copy) && (0 == strcmp(entry->copy, format))) {
+			result = entry;
+		}
+	} else if (_formatCount < VERBOSE_BINARY_FORMAT_TABLE_LIMIT) {
+		entry->id = VERBOSE_BINARY_FORMAT_TEXT;
+		int32_t specCount = verboseBinaryCountSpecs(format, (uint8_t)sizeof(uintptr_t));
+		if (0 <= specCount) {
+			uintptr_t length = strlen(format);
+			entry->copy = (char *)extensions->getForge()->allocate(length + 1, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+		}
+		if (NULL != entry->copy) {
+			strcpy(entry->copy, format);
+			entry->fieldCount = 0;
+			const char *cursor = format;
+			const char *specStart = NULL;
+			VerboseBinaryFormatSpec spec;
+			for (int32_t i = 0; i < specCount; i++) {
+				cursor = verboseBinaryParseSpec(cursor, (uint8_t)sizeof(uintptr_t), &spec, &specStart);
+				if (spec.widthArgument) {
+					entry->fields[entry->fieldCount++] = VERBOSE_BINARY_FIELD_U32;
+				}
+				if (spec.precisionArgument) {
+					entry->fields[entry->fieldCount++] = VERBOSE_BINARY_FIELD_U32;
+				}
+				entry->fields[entry->fieldCount++] = spec.field;
+			}
+			entry->id = _formatCount;
+			writeFormatDefinition(entry);
+			result = entry;
+		}
+		/* formats that can not be encoded keep their entry too, so they are only parsed once */
+		_formatCount += 1;
+		MM_AtomicOperations::writeBarrier();
+		entry->key = format;
+	}
+	omrthread_monitor_exit(_drainMonitor);
+
+	return result;
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::writeFormatDefinition(MM_VerboseBinaryFormatEntry *entry)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(_portLibrary);
+
+	if (-1 != _logFileDescriptor) {
+		uintptr_t length = strlen(entry->copy);
+		uintptr_t size = sizeof(VerboseBinaryRecordHeader) + sizeof(VerboseBinaryFormatDefinition) + length;
+		uint8_t padding[VERBOSE_BINARY_ALIGNMENT];
+		VerboseBinaryRecordHeader header;
+		VerboseBinaryFormatDefinition definition;
+
+		memset(padding, 0, sizeof(padding));
+		memset(&header, 0, sizeof(header));
+		header.size = (uint32_t)VERBOSE_BINARY_ALIGN(size);
+		header.type = VERBOSE_BINARY_RECORD_FORMAT;
+		definition.id = entry->id;
+		definition.length = (uint32_t)length;
+
+		omrfile_write(_logFileDescriptor, (void *)&header, sizeof(header));
+		omrfile_write(_logFileDescriptor, (void *)&definition, sizeof(definition));
+		omrfile_write(_logFileDescriptor, (void *)entry->copy, (intptr_t)length);
+		if (header.size != size) {
+			omrfile_write(_logFileDescriptor, (void *)padding, (intptr_t)(header.size - size));
+		}
+	}
+}
+
+/**
+ * Opens the file to log output to, defines the formats seen so far in it and prints the header.
+ * @return true on sucess, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingBinary::openFile(MM_EnvironmentBase *env, bool printInitializedHeader)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_GCExtensionsBase* extensions = env->getExtensions();
+
+	char *filenameToOpen = expandFilename(env, _currentFile);
+	if (NULL == filenameToOpen) {
+		return false;
+	}
+
+	int32_t openFlags =  EsOpenWrite | EsOpenCreate | _manager->fileOpenMode(env);
+
+	omrthread_monitor_enter(_drainMonitor);
+	_logFileDescriptor = omrfile_open(filenameToOpen, openFlags, 0666);
+	if(-1 == _logFileDescriptor) {
+		char *cursor = filenameToOpen;
+		/**
+		 * This may have failed due to directories in the path not being available.
+		 * Try to create these directories and attempt to open again before failing.
+		 */
+		while ( (cursor = strchr(++cursor, DIR_SEPARATOR)) != NULL ) {
+			*cursor = '\0';
+			omrfile_mkdir(filenameToOpen);
+			*cursor = DIR_SEPARATOR;
+		}
+
+		/* Try again */
+		_logFileDescriptor = omrfile_open(filenameToOpen, openFlags, 0666);
+		if (-1 == _logFileDescriptor) {
+			omrthread_monitor_exit(_drainMonitor);
+			_manager->handleFileOpenError(env, filenameToOpen);
+			extensions->getForge()->free(filenameToOpen);
+			return false;
+		}
+	}
+
+	VerboseBinaryFileHeader fileHeader;
+	memset(&fileHeader, 0, sizeof(fileHeader));
+	strcpy(fileHeader.magic, VERBOSE_BINARY_MAGIC);
+	fileHeader.version = VERBOSE_BINARY_VERSION;
+	fileHeader.byteOrderMark = VERBOSE_BINARY_BYTE_ORDER_MARK;
+	fileHeader.pointerSize = (uint8_t)sizeof(uintptr_t);
+	omrfile_write(_logFileDescriptor, (void *)&fileHeader, sizeof(fileHeader));
+
+	/* each file stands alone, so it defines every format already in use */
+	for (uintptr_t i = 0; i < VERBOSE_BINARY_FORMAT_TABLE_SIZE; i++) {
+		if ((NULL != _formats[i].key) && (NULL != _formats[i].copy)) {
+			writeFormatDefinition(&_formats[i]);
+		}
+	}
+	omrthread_monitor_exit(_drainMonitor);
+
+	extensions->getForge()->free(filenameToOpen);
+
+	outputTextStanza(env, VERBOSE_BINARY_RECORD_STANZA, getHeader(env));
+	/* Print an Initialized Stanza in new file */
+	if (printInitializedHeader) {
+		MM_VerboseBuffer* buffer = MM_VerboseBuffer::newInstance(env, INITIAL_BUFFER_SIZE);
+		if (NULL != buffer) {
+			_manager->getVerboseHandlerOutput()->outputInitializedStanza(env, buffer);
+			outputTextStanza(env, VERBOSE_BINARY_RECORD_STANZA, buffer->contents());
+			buffer->kill(env);
+		}
+	}
+
+	return true;
+}
+
+/**
+ * Prints the footer, writes out everything appended so far and closes the file being logged to.
+ */
+void
+MM_VerboseWriterFileLoggingBinary::closeFile(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if(-1 != _logFileDescriptor) {
+		outputTextStanza(env, VERBOSE_BINARY_RECORD_FOOTER, getFooter(env));
+		omrthread_monitor_enter(_drainMonitor);
+		drainBuffers();
+		omrfile_close(_logFileDescriptor);
+		_logFileDescriptor = -1;
+		omrthread_monitor_exit(_drainMonitor);
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::outputString(MM_EnvironmentBase *env, const char* string)
+{
+	if(-1 == _logFileDescriptor) {
+		/**
+		 * Under normal circumstances, new file should be opened during endOfCycle call.
+		 * This path works as one backup, in case we failed to open the file,  we'll attempt to open it again before outputting the string.
+		 */
+		openFile(env);
+	}
+
+	outputTextStanza(env, VERBOSE_BINARY_RECORD_STANZA, string);
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::endOfCycle(MM_EnvironmentBase *env)
+{
+	requestDrain();
+
+	/* rotating to the next file drains the buffers synchronously before closing this one */
+	MM_VerboseWriterFileLogging::endOfCycle(env);
+}
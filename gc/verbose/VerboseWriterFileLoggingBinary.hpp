@@ -0,0 +1,179 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#if !defined(VERBOSEWRITERFILELOGGINGBINARY_HPP_)
+#define VERBOSEWRITERFILELOGGINGBINARY_HPP_
+
+#include "omrcfg.h"
+#include "omrthread.h"
+
+#include "VerboseBinaryFormat.hpp"
+#include "VerboseWriterFileLogging.hpp"
+
+#define VERBOSE_BINARY_THREAD_BUFFER_SIZE (64 * 1024) /**< bytes in each thread's ring, must be a power of two */
+#define VERBOSE_BINARY_STANZA_INITIAL_SIZE 1024
+#define VERBOSE_BINARY_FORMAT_TABLE_SIZE 512 /**< slots in the format table, must be a power of two */
+#define VERBOSE_BINARY_FORMAT_TABLE_LIMIT 384 /**< formats defined before the table stops taking new ones */
+#define VERBOSE_BINARY_MAX_FIELDS (VERBOSE_BINARY_MAX_SPECS * 3)
+#define VERBOSE_BINARY_DRAIN_INTERVAL_MILLIS 100
+
+/**
+ * Output buffer of one thread. The owning thread builds each stanza in the stanza area and then appends it as
+ * one record to the ring, which the drain thread writes to the file. A buffer outlives its thread and is reused
+ * by the next thread that needs one.
+ */
+typedef struct MM_VerboseBinaryThreadBuffer {
+	struct MM_VerboseBinaryThreadBuffer *next; /**< next buffer of the writer */
+	volatile uintptr_t owned; /**< non-zero while a thread is using the buffer */
+	volatile uintptr_t produced; /**< bytes ever appended to the ring, only advanced by the owning thread */
+	volatile uintptr_t consumed; /**< bytes ever written to the file, only advanced while holding the drain monitor */
+	uint8_t *ring; /**< VERBOSE_BINARY_THREAD_BUFFER_SIZE bytes */
+	uint8_t *stanza; /**< record being built, starting with room for its VerboseBinaryRecordHeader */
+	uintptr_t stanzaSize;
+	uintptr_t stanzaCapacity;
+	uint16_t index;
+} MM_VerboseBinaryThreadBuffer;
+
+/**
+ * A format seen by the writer. Entries are published by storing key last and are never removed, so lookups
+ * need no lock.
+ */
+typedef struct MM_VerboseBinaryFormatEntry {
+	const char * volatile key; /**< the format pointer passed by the handlers */
+	char *copy; /**< the format text at the time it was defined, NULL if it can not be encoded */
+	uint32_t id; /**< id of the format definition, VERBOSE_BINARY_FORMAT_TEXT if it can not be encoded */
+	uint32_t fieldCount;
+	uint8_t fields[VERBOSE_BINARY_MAX_FIELDS]; /**< VERBOSE_BINARY_FIELD_* of each value the format reads */
+} MM_VerboseBinaryFormatEntry;
+
+/**
+ * Output agent which directs verbosegc output to file as binary records (see VerboseBinaryFormat.hpp).
+ * Each line is stored as the id of its format and the raw values of its arguments, so the reporting thread neither
+ * formats nor writes; it appends whole stanzas to its own buffer and a background thread writes the buffers to the file.
+ * tools/verbosegcconv formats the records into the XML described by schema.xsd.
+ */
+class MM_VerboseWriterFileLoggingBinary : public MM_VerboseWriterFileLogging
+{
+	/*
+	 * Data members
+	 */
+public:
+	typedef enum {
+		DRAIN_THREAD_NONE = 0,
+		DRAIN_THREAD_RUNNING,
+		DRAIN_THREAD_SHUTDOWN_REQUESTED,
+		DRAIN_THREAD_TERMINATED
+	} DrainThreadState;
+
+protected:
+private:
+	OMRPortLibrary *_portLibrary; /**< used by the drain thread, which has no environment */
+	intptr_t _logFileDescriptor; /**< the file being written to */
+	omrthread_tls_key_t _bufferKey; /**< finds the buffer of the current thread */
+	bool _bufferKeyAllocated;
+	MM_VerboseBinaryThreadBuffer * volatile _buffers; /**< all buffers, only added to while holding _drainMonitor */
+	uint16_t _bufferCount;
+	MM_VerboseBinaryFormatEntry *_formats; /**< VERBOSE_BINARY_FORMAT_TABLE_SIZE slots hashed on the format pointer */
+	uint32_t _formatCount; /**< formats in the table, only changed while holding _drainMonitor */
+	volatile uint64_t _sequence; /**< last sequence number handed out */
+	omrthread_monitor_t _drainMonitor; /**< serializes draining, file operations and format definitions, used to wake the drain thread */
+	volatile DrainThreadState _drainThreadState;
+	volatile bool _drainRequested; /**< a producer asked for the buffers to be drained */
+
+	/*
+	 * Function members
+	 */
+public:
+	static MM_VerboseWriterFileLoggingBinary *newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char* filename, uintptr_t fileCount, uintptr_t iterations);
+
+	virtual void outputString(MM_EnvironmentBase *env, const char* string);
+	virtual void endOfCycle(MM_EnvironmentBase *env);
+
+	virtual bool encodesFields() { return true; }
+	virtual void formatAndOutputV(MM_EnvironmentBase *env, uintptr_t indent, const char *format, va_list args);
+	virtual void outputText(MM_EnvironmentBase *env, const char *text);
+	virtual void flushStanza(MM_EnvironmentBase *env);
+
+	/**
+	 * Main loop of the drain thread.
+	 */
+	void drainThreadEntryPoint();
+
+protected:
+	MM_VerboseWriterFileLoggingBinary(MM_EnvironmentBase *env, MM_VerboseManager *manager);
+
+	virtual bool initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles);
+
+private:
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+	bool openFile(MM_EnvironmentBase *env, bool printInitializedHeader = false);
+	void closeFile(MM_EnvironmentBase *env);
+
+	bool startDrainThread(MM_EnvironmentBase *env);
+	void shutdownDrainThread();
+	void requestDrain();
+
+	/**
+	 * Write everything appended to the buffers so far to the file. The caller must own _drainMonitor.
+	 */
+	void drainBuffers();
+
+	/**
+	 * @return the buffer of the current thread, NULL if none could be allocated
+	 */
+	MM_VerboseBinaryThreadBuffer *getThreadBuffer(MM_EnvironmentBase *env);
+	MM_VerboseBinaryThreadBuffer *acquireThreadBuffer(MM_EnvironmentBase *env);
+
+	/**
+	 * Grow the stanza being built by the given number of bytes, rounded up to VERBOSE_BINARY_ALIGNMENT and zeroed.
+	 * @return the bytes added, NULL if the stanza could not be grown
+	 */
+	uint8_t *reserveStanzaBytes(MM_EnvironmentBase *env, MM_VerboseBinaryThreadBuffer *buffer, uintptr_t bytes);
+	bool appendStringField(MM_EnvironmentBase *env, MM_VerboseBinaryThreadBuffer *buffer, const char *string);
+	void appendTextLine(MM_EnvironmentBase *env, MM_VerboseBinaryThreadBuffer *buffer, uintptr_t indent, const char *format, va_list args);
+
+	/**
+	 * Append the stanza being built, if any, to the ring as a record of the given type.
+	 */
+	void commitStanza(MM_VerboseBinaryThreadBuffer *buffer, uint8_t type);
+	void appendRecord(MM_VerboseBinaryThreadBuffer *buffer, const uint8_t *record, uintptr_t size);
+
+	/**
+	 * Output text as a stanza of its own.
+	 */
+	void outputTextStanza(MM_EnvironmentBase *env, uint8_t type, const char *text);
+
+	/**
+	 * Find the format, defining it if this is the first time it is seen.
+	 * @return the entry, or NULL if the line must be output as text
+	 */
+	MM_VerboseBinaryFormatEntry *findFormat(MM_EnvironmentBase *env, const char *format);
+	MM_VerboseBinaryFormatEntry *defineFormat(MM_EnvironmentBase *env, const char *format);
+
+	/**
+	 * Write a format definition to the file. The caller must own _drainMonitor.
+	 */
+	void writeFormatDefinition(MM_VerboseBinaryFormatEntry *entry);
+};
+
+#endif /* VERBOSEWRITERFILELOGGINGBINARY_HPP_ */
@@ -297,6 +297,14 @@ MM_VerboseHandlerOutputStandard::handleMarkEnd(J9HookInterface** hook, uintptr_t
 
 	writer->formatAndOutput(env, 1, "<trace-info objectcount=\"%zu\" scancount=\"%zu\" scanbytes=\"%zu\" />",
 			markStats->_objectsMarked, markStats->_objectsScanned, markStats->_bytesScanned);
+	if (0 != markStats->_prefetchQueueEntries) {
+		writer->formatAndOutput(env, 1, "<prefetch-info queued=\"%zu\" marked=\"%zu\" />",
+				markStats->_prefetchQueueEntries, markStats->_prefetchQueueMarked);
+	}
+	if (0 != markStats->_incrementalQuanta) {
+		writer->formatAndOutput(env, 1, "<incremental-mark-info quanta=\"%zu\" deletedrefs=\"%zu\" />",
+				markStats->_incrementalQuanta, markStats->_deletedReferences);
+	}
 
 	handleMarkEndInternal(env, eventData);
 
@@ -322,7 +330,18 @@ MM_VerboseHandlerOutputStandard::handleSweepEnd(J9HookInterface** hook, uintptr_
 	bool deltaTimeSuccess = getTimeDeltaInMicroSeconds(&duration, sweepStats->_startTime, sweepStats->_endTime);
 
 	enterAtomicReportingBlock();
-	handleGCOPStanza(env, "sweep", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	if (extensions->deferredSegregatedSweep) {
+		MM_VerboseWriterChain* writer = getManager()->getWriterChain();
+		handleGCOPOuterStanzaStart(env, "sweep", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
+		writer->formatAndOutput(env, 1, "<deferred-sweep-info regionssweptinpause=\"%zu\" />", sweepStats->deferredRegionsSweptInPause);
+		handleGCOPOuterStanzaEnd(env);
+		writer->flush(env);
+	} else
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+	{
+		handleGCOPStanza(env, "sweep", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
+	}
 
 	handleSweepEndInternal(env, eventData);
 	exitAtomicReportingBlock();
@@ -372,6 +391,27 @@ MM_VerboseHandlerOutputStandard::handleCompactEnd(J9HookInterface** hook, uintpt
 	if(COMPACT_PREVENTED_NONE == compactStats->_compactPreventedReason) {
 		writer->formatAndOutput(env, 1, "<compact-info movecount=\"%zu\" movebytes=\"%zu\" reason=\"%s\" />",
 				compactStats->_movedObjects, compactStats->_movedBytes, getCompactionReasonAsString(compactStats->_compactReason));
+
+		/* phase intervals are the union over all threads, so move and fixup overlap when compaction is pipelined */
+		uint64_t setupTime = 0;
+		uint64_t moveTime = 0;
+		uint64_t fixupTime = 0;
+		uint64_t rootFixupTime = 0;
+		uint64_t freelistTime = 0;
+		uint64_t markBitsTime = 0;
+		getTimeDeltaInMicroSeconds(&setupTime, compactStats->_setupStartTime, compactStats->_setupEndTime);
+		getTimeDeltaInMicroSeconds(&moveTime, compactStats->_moveStartTime, compactStats->_moveEndTime);
+		getTimeDeltaInMicroSeconds(&fixupTime, compactStats->_fixupStartTime, compactStats->_fixupEndTime);
+		getTimeDeltaInMicroSeconds(&rootFixupTime, compactStats->_rootFixupStartTime, compactStats->_rootFixupEndTime);
+		getTimeDeltaInMicroSeconds(&freelistTime, compactStats->_rebuildFreelistStartTime, compactStats->_rebuildFreelistEndTime);
+		getTimeDeltaInMicroSeconds(&markBitsTime, compactStats->_rebuildMarkBitsStartTime, compactStats->_rebuildMarkBitsEndTime);
+		writer->formatAndOutput(env, 1, "<compact-phases setupms=\"%llu.%03llu\" movems=\"%llu.%03llu\" fixupms=\"%llu.%03llu\" rootfixupms=\"%llu.%03llu\" freelistms=\"%llu.%03llu\" markbitsms=\"%llu.%03llu\" overlappedsubareas=\"%zu\" />",
+				setupTime / 1000, setupTime % 1000, moveTime / 1000, moveTime % 1000, fixupTime / 1000, fixupTime % 1000,
+				rootFixupTime / 1000, rootFixupTime % 1000, freelistTime / 1000, freelistTime % 1000, markBitsTime / 1000, markBitsTime % 1000,
+				compactStats->_fixupOverlappedSubAreas);
+		if (0 != compactStats->_windowBytes) {
+			writer->formatAndOutput(env, 1, "<compact-window bytes=\"%zu\" freebytes=\"%zu\" />", compactStats->_windowBytes, compactStats->_windowFreeBytes);
+		}
 	} else {
 		writer->formatAndOutput(env, 1, "<compact-info reason=\"%s\" />", getCompactionReasonAsString(compactStats->_compactReason));
 		writer->formatAndOutput(env, 1, "<warning details=\"compaction prevented due to %s\" />", getCompactionPreventedReasonAsString(compactStats->_compactPreventedReason));
@@ -430,6 +470,31 @@ MM_VerboseHandlerOutputStandard::handleScavengeEndNoLock(J9HookInterface** hook,
 		writer->formatAndOutput(env, 1, "<copy-failed type=\"tenure\" objects=\"%zu\" bytes=\"%zu\" />",
 				scavengerStats->_failedTenureCount, scavengerStats->_failedTenureBytes);
 	}
+	if (0 != scavengerStats->_prefetchQueueEntries) {
+		writer->formatAndOutput(env, 1, "<prefetch-info queued=\"%zu\" copied=\"%zu\" />",
+				scavengerStats->_prefetchQueueEntries, scavengerStats->_prefetchQueueCopied);
+	}
+	if (0 != scavengerStats->_hotFieldCopyCount) {
+		writer->formatAndOutput(env, 1, "<hot-field-copy copied=\"%zu\" colocated=\"%zu\" />",
+				scavengerStats->_hotFieldCopyCount, scavengerStats->_hotFieldColocatedCount);
+	}
+	if ((0 != scavengerStats->_semiSpaceAllocationCountLocalNode) || (0 != scavengerStats->_semiSpaceAllocationCountRemoteNode)) {
+		writer->formatAndOutput(env, 1, "<survivor-node-slices localallocations=\"%zu\" remoteallocations=\"%zu\" />",
+				scavengerStats->_semiSpaceAllocationCountLocalNode, scavengerStats->_semiSpaceAllocationCountRemoteNode);
+	}
+	if (0 != scavengerStats->_rememberedSetScanEntries) {
+		uint64_t totalMicros = omrtime_hires_delta(0, scavengerStats->_rememberedSetScanTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		uint64_t maxMicros = omrtime_hires_delta(0, scavengerStats->_rememberedSetScanTimeMax, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		uintptr_t imbalance = scavengerStats->getRememberedSetScanImbalance();
+		writer->formatAndOutput(env, 1, "<remembered-set-scan entries=\"%zu\" threads=\"%zu\" totalms=\"%llu.%03llu\" maxms=\"%llu.%03llu\" imbalance=\"%zu.%02zu\" />",
+				scavengerStats->_rememberedSetScanEntries, scavengerStats->_rememberedSetScanThreads,
+				totalMicros / 1000, totalMicros % 1000, maxMicros / 1000, maxMicros % 1000,
+				imbalance / 100, imbalance % 100);
+		if (0 != scavengerStats->_rememberedSetScanShards) {
+			writer->formatAndOutput(env, 1, "<remembered-set-shards shards=\"%zu\" chunks=\"%zu\" />",
+					scavengerStats->_rememberedSetScanShards, scavengerStats->_rememberedSetScanChunks);
+		}
+	}
 
 	handleScavengeEndInternal(env, eventData);
 	
@@ -896,7 +961,7 @@ MM_VerboseHandlerOutputStandard::outputMemType(MM_EnvironmentBase* env, uintptr_
 		bufPos += omrstr_printf(memInfoBuffer + bufPos, INITIAL_BUFFER_SIZE - bufPos," macro-fragmented=\"%zu\"", (size_t) macroFragment);
 	}
 	bufPos += omrstr_printf(memInfoBuffer + bufPos, INITIAL_BUFFER_SIZE - bufPos, " />");
-	writer->formatAndOutput(env, indent, memInfoBuffer);
+	writer->formatAndOutput(env, indent, "%s", memInfoBuffer);
 }
 
 void
@@ -940,7 +1005,7 @@ MM_VerboseHandlerOutputStandard::outputMemoryInfoInnerStanza(MM_EnvironmentBase
 			bufPos += omrstr_printf(tenureMemInfoBuffer + bufPos, INITIAL_BUFFER_SIZE - bufPos, " macro-fragmented=\"%zu\"", (size_t) stats->_macroFragmentedSize);
 		}
 		bufPos += omrstr_printf(tenureMemInfoBuffer + bufPos, INITIAL_BUFFER_SIZE - bufPos, ">");
-		writer->formatAndOutput(env, indent, tenureMemInfoBuffer);
+		writer->formatAndOutput(env, indent, "%s", tenureMemInfoBuffer);
 
 		outputMemType(env, indent + 1, "soa", (stats->_totalFreeTenureHeapSize - stats->_totalFreeLOAHeapSize), (stats->_totalTenureHeapSize - stats->_totalLOAHeapSize));
 		outputMemType(env, indent + 1, "loa", stats->_totalFreeLOAHeapSize, stats->_totalLOAHeapSize);
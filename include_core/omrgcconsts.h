@@ -287,6 +287,7 @@ struct ModronLnrlOptions {
 #define DEFAULT_MINIMUM_CONTRACTION_RATIO	10
 
 #define DESIRED_SUBAREA_SIZE		((uintptr_t)(4*1024*1024))
+#define COMPACT_PIPELINE_GROUP_SUBAREAS		8
 
 typedef enum {
 	COMPACT_NONE = 0,
@@ -431,6 +432,11 @@ typedef enum {
 	HEAP_RELEASE_FREE_PAGES
 } HeapResizeType;
 
+typedef enum {
+	RELEASE_FREE_PAGES_IDLE = 1,
+	RELEASE_FREE_PAGES_BACKGROUND
+} ReleaseFreePagesReason;
+
 typedef enum {
 	NO_CONTRACT = 1,
 	GC_RATIO_TOO_LOW,
@@ -20,8 +20,21 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
  *******************************************************************************/
 
+/*
+ * Reports GC statistics from the verbose GC logs left in the working directory by omrgctest, e.g.
+ *
+ *   omrgctest --gtest_filter=perfTest* -keepVerboseLog
+ *   omrperfgctest -results=gcPerfResults.xml -thresholds=perftest/gctest/configuration/pauseTimeThresholds.xml
+ *
+ * For each log it prints mark/sweep/expand times and the pause time distribution, and it writes one
+ * <config> element per log to the results file so that runs can be compared between builds. When a
+ * thresholds file is given, any configuration that exceeds its limits is reported as a regression and
+ * the exit code is non-zero.
+ */
+
 #include <string.h>
 #include <algorithm>
+#include <string>
 #include <vector>
 #include <iterator>
 #include <numeric>
@@ -37,13 +50,40 @@ const char* XPATH_GET_ALL_MARK_TIME = "/verbosegc/gc-op[@type='mark']";
 const char* XPATH_GET_ALL_SWEEP_TIME = "/verbosegc/gc-op[@type='sweep']";
 const char* XPATH_GET_ALL_EXPAND_TIME = "/verbosegc/heap-resize[@type='expand']";
 const char* XPATH_GET_TOTAL_GC_TIME = "/verbosegc/gc-end[@type='global']";
+const char* XPATH_GET_ALL_EXCLUSIVE_START = "/verbosegc/exclusive-start";
+const char* XPATH_GET_ALL_EXCLUSIVE_END = "/verbosegc/exclusive-end";
+const char* XPATH_GET_ALL_ALLOCATION_STATS = "/verbosegc/allocation-stats";
+const char* XPATH_GET_ALL_GC_END_MEM_INFO = "/verbosegc/gc-end/mem-info";
 const char* SRC_DIR = "./";
 const char* VERBOSE_GC_FILE_PREFIX = "VerboseGC";
+const char* DEFAULT_RESULTS_FILE = "gcPerfResults.xml";
+const char* RESULTS_OPTION = "-results=";
+const char* THRESHOLDS_OPTION = "-thresholds=";
+
+/* Pause and throughput figures for one verbose GC log (one collector configuration) */
+typedef struct PauseResults {
+	std::string config;
+	std::string fileName;
+	size_t pauseCount;
+	double pauseP50;
+	double pauseP99;
+	double pauseMax;
+	double pauseTotal;
+	double throughputPercent; /**< mutator share of the time between the end of the first pause and the end of the last */
+	double allocationRateMB; /**< MB allocated per second over the same period */
+	double occupancyAvgPercent; /**< heap occupied after each collection, i.e. the live set */
+	double occupancyMaxPercent;
+	uintptr_t regressions;
+} PauseResults;
 
 double getAvg(std::vector<double> v);
-void analyze(char* fileName, OMRPortLibrary portLibrary);
+double getPercentile(std::vector<double> sorted, double percentile);
+std::string getConfigName(const char *fileName);
+bool analyze(char* fileName, OMRPortLibrary portLibrary, PauseResults *results);
+uintptr_t checkThresholds(const char *thresholdsFile, std::vector<PauseResults> *allResults, OMRPortLibrary portLibrary);
+bool writeResults(const char *resultsFile, std::vector<PauseResults> *allResults);
 
-int main(void)
+int main(int argc, char **argv)
 {
 	int32_t totalFiles = 0;
 	intptr_t rc = 0;
@@ -51,6 +91,20 @@ int main(void)
 	uintptr_t rcFile;
 	uintptr_t handle;
 	OMRPortLibrary portLibrary;
+	const char *resultsFile = DEFAULT_RESULTS_FILE;
+	const char *thresholdsFile = NULL;
+	std::vector<PauseResults> allResults;
+
+	for (int i = 1; i < argc; i++) {
+		if (0 == strncmp(argv[i], RESULTS_OPTION, strlen(RESULTS_OPTION))) {
+			resultsFile = argv[i] + strlen(RESULTS_OPTION);
+		} else if (0 == strncmp(argv[i], THRESHOLDS_OPTION, strlen(THRESHOLDS_OPTION))) {
+			thresholdsFile = argv[i] + strlen(THRESHOLDS_OPTION);
+		} else {
+			fprintf(stderr, "usage: %s [%s<file>] [%s<file>]\n", argv[0], RESULTS_OPTION, THRESHOLDS_OPTION);
+			return -1;
+		}
+	}
 
 	rc = omrthread_attach_ex(NULL, J9THREAD_ATTR_DEFAULT);
 	if (0 != rc) {
@@ -75,7 +129,10 @@ int main(void)
 
 	while ((uintptr_t)-1 != rcFile) {
 		if (strncmp(resultBuffer, VERBOSE_GC_FILE_PREFIX, strlen(VERBOSE_GC_FILE_PREFIX)) == 0) {
-			analyze(resultBuffer, portLibrary);
+			PauseResults results;
+			if (analyze(resultBuffer, portLibrary, &results)) {
+				allResults.push_back(results);
+			}
 			totalFiles++;
 			/* Clean up verbose log file */
 			omrfile_unlink(resultBuffer);
@@ -90,8 +147,27 @@ int main(void)
 		omrtty_printf("Failed to find any verbose GC file to process!\n\n");
 	}
 
+	uintptr_t regressions = 0;
+	if (NULL != thresholdsFile) {
+		regressions = checkThresholds(thresholdsFile, &allResults, portLibrary);
+	}
+
+	if (writeResults(resultsFile, &allResults)) {
+		omrtty_printf("Results for %zu configuration(s) written to %s\n", allResults.size(), resultsFile);
+	} else {
+		omrtty_printf("Failed to write results to %s\n", resultsFile);
+		rc = -1;
+	}
+
+	if (0 != regressions) {
+		omrtty_printf("%zu performance regression(s) found\n", regressions);
+		rc = 1;
+	}
+
 	portLibrary.port_shutdown_library(&portLibrary);
 	omrthread_detach(NULL);
+
+	return (int)rc;
 }
 
 double
@@ -102,13 +178,52 @@ getAvg(std::vector<double> v)
 	return avg;
 }
 
-void
-analyze(char* fileName, OMRPortLibrary portLibrary)
+/**
+ * Nearest rank percentile of an ascending, non-empty vector.
+ */
+double
+getPercentile(std::vector<double> sorted, double percentile)
+{
+	size_t rank = (size_t)((percentile / 100.0) * sorted.size() + 0.999999);
+	if (rank < 1) {
+		rank = 1;
+	}
+	return sorted[std::min(rank, sorted.size()) - 1];
+}
+
+/**
+ * Name of the configuration that wrote a log: the verboseLog prefix from the configuration file
+ * without "VerboseGC_" and without the "_<pid>_<time>.xml" omrgctest appends.
+ */
+std::string
+getConfigName(const char *fileName)
+{
+	std::string name(fileName);
+	size_t prefixLength = strlen(VERBOSE_GC_FILE_PREFIX);
+	if ((name.length() > prefixLength) && (('_' == name[prefixLength]) || ('-' == name[prefixLength]))) {
+		prefixLength += 1;
+	}
+	name = name.substr(prefixLength);
+	for (int i = 0; i < 2; i++) {
+		size_t separator = name.rfind('_');
+		if (std::string::npos != separator) {
+			name = name.substr(0, separator);
+		}
+	}
+	return name;
+}
+
+bool
+analyze(char* fileName, OMRPortLibrary portLibrary, PauseResults *results)
 {
 	std::vector<double> mark_values;
 	std::vector<double> sweep_values;
 	std::vector<double> expand_values;
 	std::vector<double> gcduration_values;
+	std::vector<double> pause_values;
+	std::vector<double> interval_values;
+	std::vector<double> allocated_values;
+	std::vector<double> occupancy_values;
 
 	pugi::xpath_node_set markTimes;
 	pugi::xpath_node_set sweepTimes;
@@ -137,7 +252,7 @@ analyze(char* fileName, OMRPortLibrary portLibrary)
 	OMRPORT_ACCESS_FROM_OMRPORT(&portLibrary);
 	if(!result) {
 		omrtty_printf("Error loading file : %s\n", fileName);
-		return;
+		return false;
 	} else {
 		omrtty_printf("\nResults for : %s\n",fileName);
 	}
@@ -170,6 +285,31 @@ analyze(char* fileName, OMRPortLibrary portLibrary)
 	    gcduration_values.push_back(value);
 	}
 
+	/* Every stop-the-world pause, whatever the collector, is bracketed by exclusive-start and exclusive-end */
+	pugi::xpath_node_set pauses = doc.select_nodes(XPATH_GET_ALL_EXCLUSIVE_END);
+	for (pugi::xpath_node_set::const_iterator it = pauses.begin(); it != pauses.end(); ++it) {
+		pause_values.push_back(it->node().attribute("durationms").as_double());
+	}
+
+	pugi::xpath_node_set intervals = doc.select_nodes(XPATH_GET_ALL_EXCLUSIVE_START);
+	for (pugi::xpath_node_set::const_iterator it = intervals.begin(); it != intervals.end(); ++it) {
+		interval_values.push_back(it->node().attribute("intervalms").as_double());
+	}
+
+	pugi::xpath_node_set allocationStats = doc.select_nodes(XPATH_GET_ALL_ALLOCATION_STATS);
+	for (pugi::xpath_node_set::const_iterator it = allocationStats.begin(); it != allocationStats.end(); ++it) {
+		allocated_values.push_back(it->node().attribute("totalBytes").as_double());
+	}
+
+	pugi::xpath_node_set memInfos = doc.select_nodes(XPATH_GET_ALL_GC_END_MEM_INFO);
+	for (pugi::xpath_node_set::const_iterator it = memInfos.begin(); it != memInfos.end(); ++it) {
+		double total = it->node().attribute("total").as_double();
+		double free = it->node().attribute("free").as_double();
+		if (total > 0) {
+			occupancy_values.push_back(((total - free) * 100.0) / total);
+		}
+	}
+
 	if (!mark_values.empty()) {
 		maxMark = *std::max_element(mark_values.begin(), mark_values.end());
 		minMark = *std::min_element(mark_values.begin(), mark_values.end());
@@ -204,4 +344,121 @@ analyze(char* fileName, OMRPortLibrary portLibrary)
 
 	omrtty_printf("Average : %f        %f        %f        %f\n\n",
 								avgMark, avgSweep, avgExpand, avgGCDuration);
+
+	results->config = getConfigName(fileName);
+	results->fileName = fileName;
+	results->pauseCount = pause_values.size();
+	results->pauseP50 = 0;
+	results->pauseP99 = 0;
+	results->pauseMax = 0;
+	results->pauseTotal = std::accumulate(pause_values.begin(), pause_values.end(), 0.0);
+	results->throughputPercent = 100;
+	results->allocationRateMB = 0;
+	results->occupancyAvgPercent = 0;
+	results->occupancyMaxPercent = 0;
+	results->regressions = 0;
+
+	if (!pause_values.empty()) {
+		std::vector<double> sorted(pause_values);
+		std::sort(sorted.begin(), sorted.end());
+		results->pauseP50 = getPercentile(sorted, 50);
+		results->pauseP99 = getPercentile(sorted, 99);
+		results->pauseMax = sorted.back();
+	}
+
+	/* The interval before the first pause covers test setup rather than the workload, so measure from the end of the first pause */
+	if ((pause_values.size() > 1) && (interval_values.size() == pause_values.size())) {
+		double mutator = std::accumulate(interval_values.begin() + 1, interval_values.end(), 0.0);
+		double paused = std::accumulate(pause_values.begin() + 1, pause_values.end(), 0.0);
+		if ((mutator + paused) > 0) {
+			results->throughputPercent = (mutator * 100.0) / (mutator + paused);
+			if (allocated_values.size() > 1) {
+				double allocated = std::accumulate(allocated_values.begin() + 1, allocated_values.end(), 0.0);
+				results->allocationRateMB = (allocated / (1024.0 * 1024.0)) / ((mutator + paused) / 1000.0);
+			}
+		}
+	}
+
+	if (!occupancy_values.empty()) {
+		results->occupancyAvgPercent = getAvg(occupancy_values);
+		results->occupancyMaxPercent = *std::max_element(occupancy_values.begin(), occupancy_values.end());
+	}
+
+	omrtty_printf("Pauses  : %zu   p50 %f   p99 %f   max %f   total %f\n",
+								results->pauseCount, results->pauseP50, results->pauseP99, results->pauseMax, results->pauseTotal);
+	omrtty_printf("Mutator : throughput %f%%   allocation %f MB/s   occupancy avg %f%% max %f%%\n\n",
+								results->throughputPercent, results->allocationRateMB, results->occupancyAvgPercent, results->occupancyMaxPercent);
+
+	return true;
+}
+
+/**
+ * Compare each configuration against its <threshold> element, if it has one. Attributes that are
+ * absent are not checked.
+ * @return the number of limits exceeded
+ */
+uintptr_t
+checkThresholds(const char *thresholdsFile, std::vector<PauseResults> *allResults, OMRPortLibrary portLibrary)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(&portLibrary);
+	uintptr_t regressions = 0;
+	pugi::xml_document doc;
+
+	if (!doc.load_file(thresholdsFile)) {
+		omrtty_printf("Error loading thresholds file : %s\n", thresholdsFile);
+		return 1;
+	}
+
+	for (std::vector<PauseResults>::iterator results = allResults->begin(); results != allResults->end(); ++results) {
+		char xpath[256];
+		omrstr_printf(xpath, sizeof(xpath), "/gc-perf-thresholds/threshold[@config='%s']", results->config.c_str());
+		pugi::xml_node threshold = doc.select_node(xpath).node();
+		if (threshold.empty()) {
+			continue;
+		}
+
+		pugi::xml_attribute limit = threshold.attribute("maxPauseP99ms");
+		if (!limit.empty() && (results->pauseP99 > limit.as_double())) {
+			omrtty_printf("REGRESSION %s: p99 pause %f ms exceeds %f ms\n", results->config.c_str(), results->pauseP99, limit.as_double());
+			results->regressions += 1;
+		}
+		limit = threshold.attribute("maxPauseMaxms");
+		if (!limit.empty() && (results->pauseMax > limit.as_double())) {
+			omrtty_printf("REGRESSION %s: max pause %f ms exceeds %f ms\n", results->config.c_str(), results->pauseMax, limit.as_double());
+			results->regressions += 1;
+		}
+		limit = threshold.attribute("minThroughputPercent");
+		if (!limit.empty() && (results->throughputPercent < limit.as_double())) {
+			omrtty_printf("REGRESSION %s: throughput %f%% below %f%%\n", results->config.c_str(), results->throughputPercent, limit.as_double());
+			results->regressions += 1;
+		}
+		regressions += results->regressions;
+	}
+
+	return regressions;
+}
+
+bool
+writeResults(const char *resultsFile, std::vector<PauseResults> *allResults)
+{
+	pugi::xml_document doc;
+	pugi::xml_node root = doc.append_child("gc-perf-results");
+
+	for (std::vector<PauseResults>::iterator results = allResults->begin(); results != allResults->end(); ++results) {
+		pugi::xml_node config = root.append_child("config");
+		config.append_attribute("name") = results->config.c_str();
+		config.append_attribute("file") = results->fileName.c_str();
+		config.append_attribute("pauseCount") = (unsigned int)results->pauseCount;
+		config.append_attribute("pauseP50ms") = results->pauseP50;
+		config.append_attribute("pauseP99ms") = results->pauseP99;
+		config.append_attribute("pauseMaxms") = results->pauseMax;
+		config.append_attribute("pauseTotalms") = results->pauseTotal;
+		config.append_attribute("throughputPercent") = results->throughputPercent;
+		config.append_attribute("allocationRateMBps") = results->allocationRateMB;
+		config.append_attribute("occupancyAvgPercent") = results->occupancyAvgPercent;
+		config.append_attribute("occupancyMaxPercent") = results->occupancyMaxPercent;
+		config.append_attribute("regressions") = (unsigned int)results->regressions;
+	}
+
+	return doc.save_file(resultsFile);
 }
@@ -0,0 +1,490 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "VerboseBinaryConverter.hpp"
+
+#define VERBOSEGC_FOOTER "</verbosegc>\n"
+#define DIGITS_DECIMAL "0123456789"
+#define DIGITS_HEX_LOWER "0123456789abcdef"
+#define DIGITS_HEX_UPPER "0123456789ABCDEF"
+
+const char *
+VerboseBinaryConverter::getResultMessage(Result rc)
+{
+	switch (rc) {
+	case RC_OK:
+		return "ok";
+	case RC_READ_FAILED:
+		return "failed to read input";
+	case RC_WRITE_FAILED:
+		return "failed to write output";
+	case RC_BAD_FORMAT:
+		return "input is not a binary verbosegc file written on a machine of this byte order";
+	case RC_OUT_OF_MEMORY:
+		return "out of memory";
+	default:
+		return "unknown error";
+	}
+}
+
+int
+VerboseBinaryConverter::compareRecords(const void *left, const void *right)
+{
+	const VerboseBinaryRecordHeader *l = *(const VerboseBinaryRecordHeader * const *)left;
+	const VerboseBinaryRecordHeader *r = *(const VerboseBinaryRecordHeader * const *)right;
+
+	if (l->sequence != r->sequence) {
+		return (l->sequence < r->sequence) ? -1 : 1;
+	}
+	return 0;
+}
+
+/* The output routines below reproduce omrstr_vprintf (port/common/omrstr.c), quirks included. */
+
+void
+VerboseBinaryConverter::outputInteger(FILE *output, uint32_t width, uint32_t precision, uint64_t value, char flag, bool isSigned, bool longLong, const char *digits)
+{
+	uint64_t base = strlen(digits);
+	uint32_t length = 0;
+	uint32_t rightSpace = 0;
+	int64_t actualPrecision = 0;
+	char signChar = 0;
+
+	if (isSigned) {
+		int64_t signedValue = longLong ? (int64_t)value : (int64_t)(int32_t)value;
+		if (signedValue < 0) {
+			signChar = '-';
+			value = 0 - (uint64_t)signedValue;
+		} else if ('+' == flag) {
+			signChar = '+';
+		}
+	}
+
+	uint64_t temp = value;
+	do {
+		length += 1;
+		temp /= base;
+	} while (0 != temp);
+
+	if (VERBOSE_BINARY_NO_VALUE != precision) {
+		actualPrecision = precision;
+		if (precision > length) {
+			length = precision;
+		}
+	}
+	if (0 != signChar) {
+		length += 1;
+	}
+	if ((VERBOSE_BINARY_NO_VALUE != width) && (width > length)) {
+		if ('-' == flag) {
+			rightSpace = width - length;
+		}
+		length = width;
+	}
+	if ('0' == flag) {
+		actualPrecision = length - ((0 != signChar) ? 1 : 0);
+	}
+
+	/* written from the right, as omrstr_vprintf does */
+	char stackText[128];
+	char *text = (length <= sizeof(stackText)) ? stackText : (char *)malloc(length);
+	if (NULL == text) {
+		return;
+	}
+	uint32_t index = length;
+	for (; 0 != rightSpace; rightSpace--) {
+		text[--index] = ' ';
+	}
+	temp = value;
+	do {
+		actualPrecision -= 1;
+		text[--index] = digits[temp % base];
+		temp /= base;
+	} while (0 != temp);
+	while (0 != index) {
+		actualPrecision -= 1;
+		if (actualPrecision >= 0) {
+			text[--index] = '0';
+		} else if (0 != signChar) {
+			text[--index] = signChar;
+			signChar = 0;
+		} else {
+			text[--index] = ' ';
+		}
+	}
+	fwrite(text, 1, length, output);
+	if (text != stackText) {
+		free(text);
+	}
+}
+
+void
+VerboseBinaryConverter::outputText(FILE *output, uint32_t width, uint32_t precision, const char *value, size_t length, char flag)
+{
+	if ((VERBOSE_BINARY_NO_VALUE != precision) && (precision < length)) {
+		length = precision;
+	}
+	size_t padding = ((VERBOSE_BINARY_NO_VALUE != width) && (width > length)) ? (width - length) : 0;
+
+	if ('-' != flag) {
+		for (size_t i = 0; i < padding; i++) {
+			fputc(' ', output);
+		}
+	}
+	fwrite(value, 1, length, output);
+	if ('-' == flag) {
+		for (size_t i = 0; i < padding; i++) {
+			fputc(' ', output);
+		}
+	}
+}
+
+void
+VerboseBinaryConverter::outputCharacter(FILE *output, uint32_t width, uint32_t precision, char value)
+{
+	/* omrstr_vprintf formats " " and then replaces the last character it wrote, padding or not */
+	size_t length = ((VERBOSE_BINARY_NO_VALUE != precision) && (0 == precision)) ? 0 : 1;
+	size_t total = ((VERBOSE_BINARY_NO_VALUE != width) && (width > length)) ? width : length;
+
+	for (size_t i = 1; i < total; i++) {
+		fputc(' ', output);
+	}
+	if (0 != total) {
+		fputc(value, output);
+	}
+}
+
+void
+VerboseBinaryConverter::outputDouble(FILE *output, uint32_t width, uint32_t precision, double value, char flag, char type)
+{
+	char format[sizeof("%+4294967295.4294967295f")];
+	char *cursor = format;
+
+	*cursor++ = '%';
+	if (0 != flag) {
+		*cursor++ = flag;
+	}
+	if (VERBOSE_BINARY_NO_VALUE != width) {
+		cursor += sprintf(cursor, "%u", width);
+	}
+	if (VERBOSE_BINARY_NO_VALUE != precision) {
+		cursor += sprintf(cursor, ".%u", precision);
+	}
+	*cursor++ = type;
+	*cursor = '\0';
+
+	/* 509 is maximum size of a converted double */
+	char text[510];
+	snprintf(text, sizeof(text), format, value);
+	fputs(text, output);
+}
+
+bool
+VerboseBinaryConverter::readString(const uint8_t **cursor, const uint8_t *end, const char **value, uint32_t *length)
+{
+	if ((size_t)(end - *cursor) < sizeof(uint32_t)) {
+		return false;
+	}
+	memcpy(length, *cursor, sizeof(uint32_t));
+	size_t size = sizeof(uint32_t);
+	if (VERBOSE_BINARY_NULL_STRING == *length) {
+		*value = NULL;
+	} else {
+		*value = (const char *)(*cursor + sizeof(uint32_t));
+		size += *length;
+	}
+	size = (size + (VERBOSE_BINARY_ALIGNMENT - 1)) & ~(size_t)(VERBOSE_BINARY_ALIGNMENT - 1);
+	if ((size_t)(end - *cursor) < size) {
+		return false;
+	}
+	*cursor += size;
+	return true;
+}
+
+bool
+VerboseBinaryConverter::outputLine(const char *format, uint8_t pointerSize, const uint64_t *slots, const uint8_t **strings, const uint8_t *end, FILE *output)
+{
+	const char *cursor = format;
+	const char *specStart = NULL;
+	VerboseBinaryFormatSpec spec;
+
+	while (true) {
+		const char *next = verboseBinaryParseSpec(cursor, pointerSize, &spec, &specStart);
+		/* literal text, where "%%" stands for '%' */
+		while (cursor < specStart) {
+			fputc(*cursor, output);
+			cursor += (('%' == cursor[0]) && ('%' == cursor[1])) ? 2 : 1;
+		}
+		if ('\0' == *specStart) {
+			break;
+		}
+		cursor = next;
+
+		uint32_t width = spec.widthArgument ? (uint32_t)*slots++ : spec.width;
+		uint32_t precision = spec.precisionArgument ? (uint32_t)*slots++ : spec.precision;
+		uint64_t value = *slots++;
+
+		switch (spec.type) {
+		case 'i':
+		case 'd':
+			outputInteger(output, width, precision, value, spec.flag, true, spec.longLong, DIGITS_DECIMAL);
+			break;
+		case 'u':
+			outputInteger(output, width, precision, value, spec.flag, false, spec.longLong, DIGITS_DECIMAL);
+			break;
+		case 'x':
+			outputInteger(output, width, precision, value, spec.flag, false, spec.longLong, DIGITS_HEX_LOWER);
+			break;
+		case 'X':
+			outputInteger(output, width, precision, value, spec.flag, false, spec.longLong, DIGITS_HEX_UPPER);
+			break;
+		case 'p':
+			outputInteger(output, pointerSize * 2, pointerSize * 2, value, 0, false, true, DIGITS_HEX_UPPER);
+			break;
+		case 'c':
+			outputCharacter(output, width, precision, (char)value);
+			break;
+		case 's':
+		{
+			const char *string = NULL;
+			uint32_t length = 0;
+			if (!readString(strings, end, &string, &length)) {
+				return false;
+			}
+			if (NULL == string) {
+				outputText(output, width, precision, "<NULL>", strlen("<NULL>"), spec.flag);
+			} else {
+				/* omrstr_vprintf stops at the first NUL */
+				const char *nul = (const char *)memchr(string, '\0', length);
+				outputText(output, width, precision, string, (NULL == nul) ? length : (size_t)(nul - string), spec.flag);
+			}
+			break;
+		}
+		default:
+		{
+			double doubleValue = 0.0;
+			memcpy(&doubleValue, &value, sizeof(doubleValue));
+			outputDouble(output, width, precision, doubleValue, spec.flag, spec.type);
+			break;
+		}
+		}
+	}
+	return true;
+}
+
+VerboseBinaryConverter::Result
+VerboseBinaryConverter::outputStanza(const VerboseBinaryRecordHeader *record, const FormatDefinition *formats, uint32_t formatCount, uint8_t pointerSize, FILE *output)
+{
+	const uint8_t *cursor = (const uint8_t *)(record + 1);
+	const uint8_t *end = ((const uint8_t *)record) + record->size;
+
+	while (cursor < end) {
+		if ((size_t)(end - cursor) < sizeof(VerboseBinaryLine)) {
+			return RC_BAD_FORMAT;
+		}
+		const VerboseBinaryLine *line = (const VerboseBinaryLine *)cursor;
+		cursor += sizeof(VerboseBinaryLine);
+
+		if (VERBOSE_BINARY_FORMAT_TEXT == line->format) {
+			const char *text = NULL;
+			uint32_t length = 0;
+			if (!readString(&cursor, end, &text, &length) || (NULL == text)) {
+				return RC_BAD_FORMAT;
+			}
+			fwrite(text, 1, length, output);
+		} else {
+			if ((line->format >= formatCount) || (NULL == formats[line->format].text)) {
+				return RC_BAD_FORMAT;
+			}
+			const FormatDefinition *definition = &formats[line->format];
+			const uint64_t *slots = (const uint64_t *)cursor;
+			if ((size_t)(end - cursor) < (definition->slotCount * sizeof(uint64_t))) {
+				return RC_BAD_FORMAT;
+			}
+			cursor += definition->slotCount * sizeof(uint64_t);
+
+			for (uint16_t i = 0; i < line->indent; i++) {
+				fputs(VERBOSE_BINARY_INDENT_SPACER, output);
+			}
+			if (!outputLine(definition->text, pointerSize, slots, &cursor, end, output)) {
+				return RC_BAD_FORMAT;
+			}
+			fputc('\n', output);
+		}
+	}
+	return RC_OK;
+}
+
+VerboseBinaryConverter::Result
+VerboseBinaryConverter::convert(FILE *input, FILE *output)
+{
+	VerboseBinaryFileHeader header;
+
+	if (1 != fread(&header, sizeof(header), 1, input)) {
+		return RC_READ_FAILED;
+	}
+	if ((0 != memcmp(header.magic, VERBOSE_BINARY_MAGIC, sizeof(VERBOSE_BINARY_MAGIC)))
+		|| (VERBOSE_BINARY_VERSION != header.version)
+		|| (VERBOSE_BINARY_BYTE_ORDER_MARK != header.byteOrderMark)
+		|| ((4 != header.pointerSize) && (8 != header.pointerSize))
+	) {
+		return RC_BAD_FORMAT;
+	}
+
+	/* read the whole file; stanzas from different buffers are interleaved in it and must be sorted */
+	size_t capacity = 64 * 1024;
+	size_t size = 0;
+	uint8_t *data = (uint8_t *)malloc(capacity);
+	if (NULL == data) {
+		return RC_OUT_OF_MEMORY;
+	}
+	while (true) {
+		if (size == capacity) {
+			capacity *= 2;
+			uint8_t *grown = (uint8_t *)realloc(data, capacity);
+			if (NULL == grown) {
+				free(data);
+				return RC_OUT_OF_MEMORY;
+			}
+			data = grown;
+		}
+		size_t read = fread(data + size, 1, capacity - size, input);
+		size += read;
+		if (size < capacity) {
+			break;
+		}
+	}
+	if (ferror(input)) {
+		free(data);
+		return RC_READ_FAILED;
+	}
+
+	Result rc = RC_OK;
+	FormatDefinition *formats = NULL;
+	uint32_t formatCount = 0;
+	const VerboseBinaryRecordHeader **stanzas = NULL;
+	size_t stanzaCount = 0;
+	size_t stanzaCapacity = 0;
+	bool sawFooter = false;
+
+	/* collect the format definitions and the stanzas; a record cut short ends the file along with its stanza */
+	size_t offset = 0;
+	while ((RC_OK == rc) && ((size - offset) >= sizeof(VerboseBinaryRecordHeader))) {
+		const VerboseBinaryRecordHeader *record = (const VerboseBinaryRecordHeader *)(data + offset);
+		if ((record->size < sizeof(VerboseBinaryRecordHeader)) || (0 != (record->size % VERBOSE_BINARY_ALIGNMENT))) {
+			rc = RC_BAD_FORMAT;
+			break;
+		}
+		if (record->size > (size - offset)) {
+			break;
+		}
+		offset += record->size;
+
+		if (VERBOSE_BINARY_RECORD_FORMAT == record->type) {
+			const VerboseBinaryFormatDefinition *definition = (const VerboseBinaryFormatDefinition *)(record + 1);
+			if (((record->size - sizeof(VerboseBinaryRecordHeader)) < sizeof(VerboseBinaryFormatDefinition))
+				|| (definition->length > (record->size - sizeof(VerboseBinaryRecordHeader) - sizeof(VerboseBinaryFormatDefinition)))
+				|| (VERBOSE_BINARY_FORMAT_TEXT == definition->id)
+			) {
+				rc = RC_BAD_FORMAT;
+				break;
+			}
+			if (definition->id >= formatCount) {
+				uint32_t count = definition->id + 1;
+				FormatDefinition *grown = (FormatDefinition *)realloc(formats, count * sizeof(FormatDefinition));
+				if (NULL == grown) {
+					rc = RC_OUT_OF_MEMORY;
+					break;
+				}
+				memset(grown + formatCount, 0, (count - formatCount) * sizeof(FormatDefinition));
+				formats = grown;
+				formatCount = count;
+			}
+			/* a file defines a format once, but a redefinition would have to be the same format */
+			FormatDefinition *format = &formats[definition->id];
+			if (NULL == format->text) {
+				format->text = (char *)malloc(definition->length + 1);
+				if (NULL == format->text) {
+					rc = RC_OUT_OF_MEMORY;
+					break;
+				}
+				memcpy(format->text, definition + 1, definition->length);
+				format->text[definition->length] = '\0';
+
+				int32_t specCount = verboseBinaryCountSpecs(format->text, header.pointerSize);
+				if (specCount < 0) {
+					rc = RC_BAD_FORMAT;
+					break;
+				}
+				const char *cursor = format->text;
+				const char *specStart = NULL;
+				VerboseBinaryFormatSpec spec;
+				format->slotCount = 0;
+				for (int32_t i = 0; i < specCount; i++) {
+					cursor = verboseBinaryParseSpec(cursor, header.pointerSize, &spec, &specStart);
+					format->slotCount += 1 + (spec.widthArgument ? 1 : 0) + (spec.precisionArgument ? 1 : 0);
+				}
+			}
+		} else if ((VERBOSE_BINARY_RECORD_STANZA == record->type) || (VERBOSE_BINARY_RECORD_FOOTER == record->type)) {
+			if (stanzaCount == stanzaCapacity) {
+				stanzaCapacity = (0 == stanzaCapacity) ? 1024 : (stanzaCapacity * 2);
+				const VerboseBinaryRecordHeader **grown = (const VerboseBinaryRecordHeader **)realloc(stanzas, stanzaCapacity * sizeof(VerboseBinaryRecordHeader *));
+				if (NULL == grown) {
+					rc = RC_OUT_OF_MEMORY;
+					break;
+				}
+				stanzas = grown;
+			}
+			stanzas[stanzaCount++] = record;
+		} else {
+			rc = RC_BAD_FORMAT;
+		}
+	}
+
+	if (RC_OK == rc) {
+		qsort(stanzas, stanzaCount, sizeof(VerboseBinaryRecordHeader *), compareRecords);
+		for (size_t i = 0; (RC_OK == rc) && (i < stanzaCount); i++) {
+			if (VERBOSE_BINARY_RECORD_FOOTER == stanzas[i]->type) {
+				sawFooter = true;
+			}
+			rc = outputStanza(stanzas[i], formats, formatCount, header.pointerSize, output);
+		}
+	}
+
+	if ((RC_OK == rc) && !sawFooter) {
+		fputs(VERBOSEGC_FOOTER, output);
+	}
+	if ((RC_OK == rc) && ((0 != fflush(output)) || ferror(output))) {
+		rc = RC_WRITE_FAILED;
+	}
+
+	for (uint32_t i = 0; i < formatCount; i++) {
+		free(formats[i].text);
+	}
+	free(formats);
+	free(stanzas);
+	free(data);
+	return rc;
+}
@@ -0,0 +1,91 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#if !defined(VERBOSEBINARYCONVERTER_HPP_)
+#define VERBOSEBINARYCONVERTER_HPP_
+
+#include <stdio.h>
+
+#include "VerboseBinaryFormat.hpp"
+
+/**
+ * Turns a file written by -Xgc:binaryVerboseLogging back into the XML verbosegc log described by
+ * gc/verbose/schema.xsd, formatting each line as omrstr_printf does. Output is identical to what the text file
+ * writers produce for the same run, except that a file cut short (e.g. by a crash) loses the stanzas that were
+ * not completely written and gets a closing tag.
+ */
+class VerboseBinaryConverter
+{
+public:
+	typedef enum {
+		RC_OK = 0,
+		RC_READ_FAILED,
+		RC_WRITE_FAILED,
+		RC_BAD_FORMAT,
+		RC_OUT_OF_MEMORY
+	} Result;
+
+	/**
+	 * Convert a whole binary verbose file.
+	 * @param[in] input binary file positioned at its header
+	 * @param[in] output receives the XML text
+	 * @return RC_OK on success
+	 */
+	static Result convert(FILE *input, FILE *output);
+
+	static const char *getResultMessage(Result rc);
+
+private:
+	typedef struct FormatDefinition {
+		char *text; /**< NUL terminated copy of the format, NULL if the id is not defined */
+		uint32_t slotCount; /**< values the format consumes */
+	} FormatDefinition;
+
+	static int compareRecords(const void *left, const void *right);
+
+	/**
+	 * Output the lines of a STANZA or FOOTER record.
+	 * @return RC_OK, or RC_BAD_FORMAT if a line does not fit the record or names an undefined format
+	 */
+	static Result outputStanza(const VerboseBinaryRecordHeader *record, const FormatDefinition *formats, uint32_t formatCount, uint8_t pointerSize, FILE *output);
+
+	/**
+	 * Format one line as omrstr_printf would on the machine that wrote the file.
+	 * @param[in] slots the values of the line
+	 * @param[in,out] strings the strings of the line, advanced past those used
+	 * @return false if a string does not fit the record
+	 */
+	static bool outputLine(const char *format, uint8_t pointerSize, const uint64_t *slots, const uint8_t **strings, const uint8_t *end, FILE *output);
+
+	static void outputInteger(FILE *output, uint32_t width, uint32_t precision, uint64_t value, char flag, bool isSigned, bool longLong, const char *digits);
+	static void outputText(FILE *output, uint32_t width, uint32_t precision, const char *value, size_t length, char flag);
+	static void outputCharacter(FILE *output, uint32_t width, uint32_t precision, char value);
+	static void outputDouble(FILE *output, uint32_t width, uint32_t precision, double value, char flag, char type);
+
+	/**
+	 * Read a string of a line.
+	 * @return false if it does not fit the record
+	 */
+	static bool readString(const uint8_t **cursor, const uint8_t *end, const char **value, uint32_t *length);
+};
+
+#endif /* VERBOSEBINARYCONVERTER_HPP_ */
@@ -0,0 +1,68 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "VerboseBinaryConverter.hpp"
+
+/**
+ * verbosegcconv <binary verbosegc file> [<xml output file>]
+ *
+ * Converts a file written with -Xgc:binaryVerboseLogging to the XML verbosegc format. Output goes to stdout
+ * unless an output file is given.
+ */
+int
+main(int argc, char **argv)
+{
+	if ((argc < 2) || (argc > 3)) {
+		fprintf(stderr, "usage: %s <binary verbosegc file> [<xml output file>]\n", argv[0]);
+		return -1;
+	}
+
+	FILE *input = fopen(argv[1], "rb");
+	if (NULL == input) {
+		fprintf(stderr, "failed to open %s\n", argv[1]);
+		return -1;
+	}
+
+	FILE *output = stdout;
+	if (3 == argc) {
+		output = fopen(argv[2], "w");
+		if (NULL == output) {
+			fprintf(stderr, "failed to open %s\n", argv[2]);
+			fclose(input);
+			return -1;
+		}
+	}
+
+	VerboseBinaryConverter::Result rc = VerboseBinaryConverter::convert(input, output);
+	if (VerboseBinaryConverter::RC_OK != rc) {
+		fprintf(stderr, "%s: %s\n", argv[1], VerboseBinaryConverter::getResultMessage(rc));
+	}
+
+	fclose(input);
+	if (stdout != output) {
+		fclose(output);
+	}
+	return (VerboseBinaryConverter::RC_OK == rc) ? 0 : -1;
+}